@@ -20,6 +20,7 @@
 #include "guilib/guiinfo/GUIInfo.h"
 #include "guilib/guiinfo/GUIInfoHelper.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
+#include "guilib/guiinfo/GUIInfoNameMap.h"
 #include "input/WindowTranslator.h"
 #include "interfaces/AnnouncementManager.h"
 #include "interfaces/info/InfoExpression.h"
@@ -41,6 +42,7 @@
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 
 using namespace KODI;
 using namespace KODI::GUILIB;
@@ -49,12 +51,6 @@ using namespace INFO;
 
 namespace
 {
-struct InfoMap
-{
-  std::string_view str{};
-  int val{0};
-};
-
 /// \page modules__infolabels_boolean_conditions Infolabels and Boolean conditions
 /// \tableofcontents
 ///
@@ -10379,9 +10375,44 @@ constexpr std::array<InfoMap, 63> slideshow = {{
 /// \page modules__infolabels_boolean_conditions
 /// \tableofcontents
 
+// The tables above are looked up by name while skins are loaded and for every label python or
+// JSON-RPC asks for, hash them once at compile time.
+constexpr CInfoNameMap addons_map{addons};
+constexpr CInfoNameMap string_bools_map{string_bools};
+constexpr CInfoNameMap integer_bools_map{integer_bools};
+constexpr CInfoNameMap player_labels_map{player_labels};
+constexpr CInfoNameMap player_param_map{player_param};
+constexpr CInfoNameMap player_times_map{player_times};
+constexpr CInfoNameMap player_process_map{player_process};
+constexpr CInfoNameMap weather_map{weather};
+constexpr CInfoNameMap system_labels_map{system_labels};
+constexpr CInfoNameMap system_param_map{system_param};
+constexpr CInfoNameMap network_labels_map{network_labels};
+constexpr CInfoNameMap musicpartymode_map{musicpartymode};
+constexpr CInfoNameMap musicplayer_map{musicplayer};
+constexpr CInfoNameMap videoplayer_map{videoplayer};
+constexpr CInfoNameMap retroplayer_map{retroplayer};
+constexpr CInfoNameMap mediacontainer_map{mediacontainer};
+constexpr CInfoNameMap container_bools_map{container_bools};
+constexpr CInfoNameMap container_ints_map{container_ints};
+constexpr CInfoNameMap container_str_map{container_str};
+constexpr CInfoNameMap listitem_labels_map{listitem_labels};
+constexpr CInfoNameMap visualisation_map{visualisation};
+constexpr CInfoNameMap fanart_labels_map{fanart_labels};
+constexpr CInfoNameMap skin_labels_map{skin_labels};
+constexpr CInfoNameMap window_bools_map{window_bools};
+constexpr CInfoNameMap control_labels_map{control_labels};
+constexpr CInfoNameMap playlist_map{playlist};
+constexpr CInfoNameMap pvr_map{pvr};
+constexpr CInfoNameMap pvr_times_map{pvr_times};
+constexpr CInfoNameMap rds_map{rds};
+constexpr CInfoNameMap slideshow_map{slideshow};
+
 } // unnamed namespace
 
-CGUIInfoManager::CGUIInfoManager() : m_currentFile(std::make_unique<CFileItem>())
+CGUIInfoManager::CGUIInfoManager()
+  : m_multiInfo(MULTI_INFO_END - MULTI_INFO_START + 1),
+    m_currentFile(std::make_unique<CFileItem>())
 {
 }
 
@@ -10398,9 +10429,28 @@ void CGUIInfoManager::Initialize()
 /// Player.HasVideo | Player.HasAudio (Logical or)
 int CGUIInfoManager::TranslateString(const std::string& condition)
 {
+  // strings with $LOCALIZE, $INFO or $VAR may translate differently next time
+  const bool cacheable = condition.find('$') == std::string::npos;
+  TranslationShard& shard =
+      m_translations[std::hash<std::string>{}(condition) % TRANSLATION_SHARDS];
+  if (cacheable)
+  {
+    std::shared_lock lock(shard.lock);
+    const auto it = shard.ids.find(condition);
+    if (it != shard.ids.end())
+      return it->second;
+  }
+
   // translate $LOCALIZE as required
   std::string strCondition(CGUIInfoLabel::ReplaceLocalize(condition));
-  return TranslateSingleString(strCondition);
+  const int id = TranslateSingleString(strCondition);
+
+  if (cacheable)
+  {
+    std::unique_lock lock(shard.lock);
+    shard.ids.try_emplace(condition, id);
+  }
+  return id;
 }
 
 CGUIInfoManager::Property::Property(const std::string& property, const std::string& parameters)
@@ -10543,23 +10593,20 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
       }
       else if (prop.num_params() == 2)
       {
-        for (const auto& string_bool : string_bools)
+        if (const InfoMap* string_bool = string_bools_map.Find(prop.Name()))
         {
-          if (prop.Name() == string_bool.str)
+          int data1 = TranslateSingleString(prop.param(0), listItemDependent);
+          // pipe our original string through the localize parsing then make it lowercase (picks up $LBRACKET etc.)
+          std::string label = CGUIInfoLabel::GetLabel(prop.param(1), INFO::DEFAULT_CONTEXT);
+          StringUtils::ToLower(label);
+          // 'true', 'false', 'yes', 'no' are valid strings, do not resolve them to SYSTEM_ALWAYS_TRUE or SYSTEM_ALWAYS_FALSE
+          if (label != "true" && label != "false" && label != "yes" && label != "no")
           {
-            int data1 = TranslateSingleString(prop.param(0), listItemDependent);
-            // pipe our original string through the localize parsing then make it lowercase (picks up $LBRACKET etc.)
-            std::string label = CGUIInfoLabel::GetLabel(prop.param(1), INFO::DEFAULT_CONTEXT);
-            StringUtils::ToLower(label);
-            // 'true', 'false', 'yes', 'no' are valid strings, do not resolve them to SYSTEM_ALWAYS_TRUE or SYSTEM_ALWAYS_FALSE
-            if (label != "true" && label != "false" && label != "yes" && label != "no")
-            {
-              int data2 = TranslateSingleString(prop.param(1), listItemDependent);
-              if (data2 > 0)
-                return AddMultiInfo(CGUIInfo(string_bool.val, data1, -data2));
-            }
-            return AddMultiInfo(CGUIInfo(string_bool.val, data1, label));
+            int data2 = TranslateSingleString(prop.param(1), listItemDependent);
+            if (data2 > 0)
+              return AddMultiInfo(CGUIInfo(string_bool->val, data1, -data2));
           }
+          return AddMultiInfo(CGUIInfo(string_bool->val, data1, label));
         }
       }
     }
@@ -10572,98 +10619,70 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
         return AddMultiInfo(CGUIInfo(INTEGER_VALUEOF, value));
       }
 
-      for (const auto& integer_bool : integer_bools)
+      if (const InfoMap* integer_bool = integer_bools_map.Find(prop.Name()))
       {
-        if (prop.Name() == integer_bool.str)
+        std::array<int, 2> data = {-1, -1};
+        for (size_t i = 0; i < data.size(); i++)
         {
-          std::array<int, 2> data = {-1, -1};
-          for (size_t i = 0; i < data.size(); i++)
+          std::from_chars_result result = std::from_chars(
+              prop.param(i).data(), prop.param(i).data() + prop.param(i).size(), data.at(i));
+          if (result.ec == std::errc::invalid_argument)
           {
-            std::from_chars_result result = std::from_chars(
-                prop.param(i).data(), prop.param(i).data() + prop.param(i).size(), data.at(i));
-            if (result.ec == std::errc::invalid_argument)
-            {
-              // could not translate provided value to int, translate the info string
-              data.at(i) = TranslateSingleString(prop.param(i), listItemDependent);
-            }
-            else
-            {
-              // conversion succeeded, integer value provided - translate it to an Integer.ValueOf() info.
-              data.at(i) = AddMultiInfo(CGUIInfo(INTEGER_VALUEOF, data.at(i)));
-            }
+            // could not translate provided value to int, translate the info string
+            data.at(i) = TranslateSingleString(prop.param(i), listItemDependent);
+          }
+          else
+          {
+            // conversion succeeded, integer value provided - translate it to an Integer.ValueOf() info.
+            data.at(i) = AddMultiInfo(CGUIInfo(INTEGER_VALUEOF, data.at(i)));
           }
-          return AddMultiInfo(CGUIInfo(integer_bool.val, data.at(0), data.at(1)));
         }
+        return AddMultiInfo(CGUIInfo(integer_bool->val, data.at(0), data.at(1)));
       }
     }
     else if (cat.Name() == "player")
     {
-      for (const auto& player_label : player_labels)
-      {
-        if (prop.Name() == player_label.str)
-          return player_label.val;
-      }
-      for (const auto& player_time : player_times)
-      {
-        if (prop.Name() == player_time.str)
-          return AddMultiInfo(CGUIInfo(player_time.val, TranslateTimeFormat(prop.param())));
-      }
+      if (const InfoMap* player_label = player_labels_map.Find(prop.Name()))
+        return player_label->val;
+      if (const InfoMap* player_time = player_times_map.Find(prop.Name()))
+        return AddMultiInfo(CGUIInfo(player_time->val, TranslateTimeFormat(prop.param())));
       if (prop.Name() == "process" && prop.num_params())
       {
-        for (const auto& player_proces : player_process)
-        {
-          if (StringUtils::EqualsNoCase(prop.param(), player_proces.str))
-            return player_proces.val;
-        }
+        const std::string param = StringUtils::ToLower(prop.param());
+        if (const InfoMap* player_proces = player_process_map.Find(param))
+          return player_proces->val;
       }
       if (prop.num_params() == 1)
       {
-        for (const auto& i : player_param)
-        {
-          if (prop.Name() == i.str)
-            return AddMultiInfo(CGUIInfo(i.val, prop.param()));
-        }
+        if (const InfoMap* i = player_param_map.Find(prop.Name()))
+          return AddMultiInfo(CGUIInfo(i->val, prop.param()));
       }
     }
     else if (cat.Name() == "addon")
     {
-      for (const auto& i : addons)
-      {
-        if (prop.Name() == i.str && prop.num_params() == 2)
-          return AddMultiInfo(CGUIInfo(i.val, prop.param(0), prop.param(1)));
-      }
+      const InfoMap* i = addons_map.Find(prop.Name());
+      if (i && prop.num_params() == 2)
+        return AddMultiInfo(CGUIInfo(i->val, prop.param(0), prop.param(1)));
     }
     else if (cat.Name() == "weather")
     {
-      for (const auto& i : weather)
-      {
-        if (prop.Name() == i.str)
-          return i.val;
-      }
+      if (const InfoMap* i = weather_map.Find(prop.Name()))
+        return i->val;
     }
     else if (cat.Name() == "network")
     {
-      for (const auto& network_label : network_labels)
-      {
-        if (prop.Name() == network_label.str)
-          return network_label.val;
-      }
+      if (const InfoMap* network_label = network_labels_map.Find(prop.Name()))
+        return network_label->val;
     }
     else if (cat.Name() == "musicpartymode")
     {
-      for (const auto& i : musicpartymode)
-      {
-        if (prop.Name() == i.str)
-          return i.val;
-      }
+      if (const InfoMap* i = musicpartymode_map.Find(prop.Name()))
+        return i->val;
     }
     else if (cat.Name() == "system")
     {
-      for (const auto& system_label : system_labels)
-      {
-        if (prop.Name() == system_label.str)
-          return system_label.val;
-      }
+      if (const InfoMap* system_label = system_labels_map.Find(prop.Name()))
+        return system_label->val;
       if (prop.num_params() == 1)
       {
         const std::string &param = prop.param();
@@ -10673,11 +10692,8 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
           StringUtils::ToLower(paramCopy);
           return AddMultiInfo(CGUIInfo(SYSTEM_GET_BOOL, paramCopy));
         }
-        for (const auto& i : system_param)
-        {
-          if (prop.Name() == i.str)
-            return AddMultiInfo(CGUIInfo(i.val, param));
-        }
+        if (const InfoMap* i = system_param_map.Find(prop.Name()))
+          return AddMultiInfo(CGUIInfo(i->val, param));
         if (prop.Name() == "memory")
         {
           if (param == "free")
@@ -10806,11 +10822,9 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
     }
     else if (cat.Name() == "musicplayer")
     {
-      for (const auto& player_time : player_times) //! @todo remove these, they're repeats
-      {
-        if (prop.Name() == player_time.str)
-          return AddMultiInfo(CGUIInfo(player_time.val, TranslateTimeFormat(prop.param())));
-      }
+      //! @todo remove these, they're repeats
+      if (const InfoMap* player_time = player_times_map.Find(prop.Name()))
+        return AddMultiInfo(CGUIInfo(player_time->val, TranslateTimeFormat(prop.param())));
       if (prop.Name() == "content" && prop.num_params())
       {
         return AddMultiInfo(CGUIInfo(MUSICPLAYER_CONTENT, prop.param(), 0));
@@ -10833,11 +10847,9 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
       if (prop.Name() !=
           "starttime") // player.starttime is semantically different from videoplayer.starttime which has its own implementation!
       {
-        for (const auto& player_time : player_times) //! @todo remove these, they're repeats
-        {
-          if (prop.Name() == player_time.str)
-            return AddMultiInfo(CGUIInfo(player_time.val, TranslateTimeFormat(prop.param())));
-        }
+        //! @todo remove these, they're repeats
+        if (const InfoMap* player_time = player_times_map.Find(prop.Name()))
+          return AddMultiInfo(CGUIInfo(player_time->val, TranslateTimeFormat(prop.param())));
       }
       if (prop.Name() == "content" && prop.num_params())
       {
@@ -10882,45 +10894,29 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
     }
     else if (cat.Name() == "retroplayer")
     {
-      for (const auto& i : retroplayer)
-      {
-        if (prop.Name() == i.str)
-          return i.val;
-      }
+      if (const InfoMap* i = retroplayer_map.Find(prop.Name()))
+        return i->val;
     }
     else if (cat.Name() == "slideshow")
     {
-      for (const auto& i : slideshow)
-      {
-        if (prop.Name() == i.str)
-          return i.val;
-      }
+      if (const InfoMap* i = slideshow_map.Find(prop.Name()))
+        return i->val;
     }
     else if (cat.Name() == "container")
     {
-      for (const auto& i : mediacontainer) // these ones don't have or need an id
-      {
-        if (prop.Name() == i.str)
-          return i.val;
-      }
+      // these ones don't have or need an id
+      if (const InfoMap* i = mediacontainer_map.Find(prop.Name()))
+        return i->val;
       int id = atoi(cat.param().c_str());
-      for (const auto& container_bool :
-           container_bools) // these ones can have an id (but don't need to?)
-      {
-        if (prop.Name() == container_bool.str)
-          return id ? AddMultiInfo(CGUIInfo(container_bool.val, id)) : container_bool.val;
-      }
-      for (const auto& container_int :
-           container_ints) // these ones can have an int param on the property
-      {
-        if (prop.Name() == container_int.str)
-          return AddMultiInfo(CGUIInfo(container_int.val, id, atoi(prop.param().c_str())));
-      }
-      for (const auto& i : container_str) // these ones have a string param on the property
-      {
-        if (prop.Name() == i.str)
-          return AddMultiInfo(CGUIInfo(i.val, id, prop.param()));
-      }
+      // these ones can have an id (but don't need to?)
+      if (const InfoMap* container_bool = container_bools_map.Find(prop.Name()))
+        return id ? AddMultiInfo(CGUIInfo(container_bool->val, id)) : container_bool->val;
+      // these ones can have an int param on the property
+      if (const InfoMap* container_int = container_ints_map.Find(prop.Name()))
+        return AddMultiInfo(CGUIInfo(container_int->val, id, atoi(prop.param().c_str())));
+      // these ones have a string param on the property
+      if (const InfoMap* i = container_str_map.Find(prop.Name()))
+        return AddMultiInfo(CGUIInfo(i->val, id, prop.param()));
       if (prop.Name() == "sortdirection")
       {
         SortOrder order = SortOrderNone;
@@ -10941,27 +10937,18 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
     }
     else if (cat.Name() == "visualisation")
     {
-      for (const auto& i : visualisation)
-      {
-        if (prop.Name() == i.str)
-          return i.val;
-      }
+      if (const InfoMap* i = visualisation_map.Find(prop.Name()))
+        return i->val;
     }
     else if (cat.Name() == "fanart")
     {
-      for (const auto& fanart_label : fanart_labels)
-      {
-        if (prop.Name() == fanart_label.str)
-          return fanart_label.val;
-      }
+      if (const InfoMap* fanart_label = fanart_labels_map.Find(prop.Name()))
+        return fanart_label->val;
     }
     else if (cat.Name() == "skin")
     {
-      for (const auto& skin_label : skin_labels)
-      {
-        if (prop.Name() == skin_label.str)
-          return skin_label.val;
-      }
+      if (const InfoMap* skin_label = skin_labels_map.Find(prop.Name()))
+        return skin_label->val;
       if (prop.num_params())
       {
         if (prop.Name() == "string")
@@ -10994,28 +10981,24 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
         if (winID != WINDOW_INVALID)
           return AddMultiInfo(CGUIInfo(WINDOW_PROPERTY, winID, prop.param()));
       }
-      for (const auto& window_bool : window_bools)
+      //! @todo The parameter for these should really be on the first not the second property
+      if (const InfoMap* window_bool = window_bools_map.Find(prop.Name()))
       {
-        if (prop.Name() == window_bool.str)
-        { //! @todo The parameter for these should really be on the first not the second property
-          if (prop.param().find("xml") != std::string::npos)
-            return AddMultiInfo(CGUIInfo(window_bool.val, 0, prop.param()));
-          int winID = prop.param().empty() ? WINDOW_INVALID : CWindowTranslator::TranslateWindow(prop.param());
-          return AddMultiInfo(CGUIInfo(window_bool.val, winID, 0));
-        }
+        if (prop.param().find("xml") != std::string::npos)
+          return AddMultiInfo(CGUIInfo(window_bool->val, 0, prop.param()));
+        int winID = prop.param().empty() ? WINDOW_INVALID : CWindowTranslator::TranslateWindow(prop.param());
+        return AddMultiInfo(CGUIInfo(window_bool->val, winID, 0));
       }
     }
     else if (cat.Name() == "control")
     {
-      for (const auto& control_label : control_labels)
+      //! @todo The parameter for these should really be on the first not the second property
+      if (const InfoMap* control_label = control_labels_map.Find(prop.Name()))
       {
-        if (prop.Name() == control_label.str)
-        { //! @todo The parameter for these should really be on the first not the second property
-          int controlID = atoi(prop.param().c_str());
-          if (controlID)
-            return AddMultiInfo(CGUIInfo(control_label.val, controlID, 0));
-          return 0;
-        }
+        int controlID = atoi(prop.param().c_str());
+        if (controlID)
+          return AddMultiInfo(CGUIInfo(control_label->val, controlID, 0));
+        return 0;
       }
     }
     else if (cat.Name() == "controlgroup" && prop.Name() == "hasfocus")
@@ -11027,14 +11010,8 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
     else if (cat.Name() == "playlist")
     {
       int ret = -1;
-      for (const auto& i : playlist)
-      {
-        if (prop.Name() == i.str)
-        {
-          ret = i.val;
-          break;
-        }
-      }
+      if (const InfoMap* i = playlist_map.Find(prop.Name()))
+        ret = i->val;
       if (ret >= 0)
       {
         if (prop.num_params() <= 0)
@@ -11054,27 +11031,18 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
     }
     else if (cat.Name() == "pvr")
     {
-      for (const auto& i : pvr)
-      {
-        if (prop.Name() == i.str)
-          return i.val;
-      }
-      for (const auto& pvr_time : pvr_times)
-      {
-        if (prop.Name() == pvr_time.str)
-          return AddMultiInfo(CGUIInfo(pvr_time.val, TranslateTimeFormat(prop.param())));
-      }
+      if (const InfoMap* i = pvr_map.Find(prop.Name()))
+        return i->val;
+      if (const InfoMap* pvr_time = pvr_times_map.Find(prop.Name()))
+        return AddMultiInfo(CGUIInfo(pvr_time->val, TranslateTimeFormat(prop.param())));
     }
     else if (cat.Name() == "rds")
     {
       if (prop.Name() == "getline")
         return AddMultiInfo(CGUIInfo(RDS_GET_RADIOTEXT_LINE, atoi(prop.param(0).c_str())));
 
-      for (const auto& rd : rds)
-      {
-        if (prop.Name() == rd.str)
-          return rd.val;
-      }
+      if (const InfoMap* rd = rds_map.Find(prop.Name()))
+        return rd->val;
     }
   }
   else if (info.size() == 3 || info.size() == 4)
@@ -11166,15 +11134,13 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
     else if (info[0].Name() == "control")
     {
       const Property &prop = info[1];
-      for (const auto& control_label : control_labels)
+      //! @todo The parameter for these should really be on the first not the second property
+      if (const InfoMap* control_label = control_labels_map.Find(prop.Name()))
       {
-        if (prop.Name() == control_label.str)
-        { //! @todo The parameter for these should really be on the first not the second property
-          int controlID = atoi(prop.param().c_str());
-          if (controlID)
-            return AddMultiInfo(CGUIInfo(control_label.val, controlID, atoi(info[2].param(0).c_str())));
-          return 0;
-        }
+        int controlID = atoi(prop.param().c_str());
+        if (controlID)
+          return AddMultiInfo(CGUIInfo(control_label->val, controlID, atoi(info[2].param(0).c_str())));
+        return 0;
       }
     }
   }
@@ -11213,14 +11179,9 @@ int CGUIInfoManager::TranslateListItem(const Property& cat, const Property& prop
 
   if (ret == 0)
   {
-    for (const auto& listitem_label : listitem_labels) // these ones don't have or need an id
-    {
-      if (prop.Name() == listitem_label.str)
-      {
-        ret = listitem_label.val;
-        break;
-      }
-    }
+    // these ones don't have or need an id
+    if (const InfoMap* listitem_label = listitem_labels_map.Find(prop.Name()))
+      ret = listitem_label->val;
   }
 
   if (ret)
@@ -11248,31 +11209,22 @@ int CGUIInfoManager::TranslateListItem(const Property& cat, const Property& prop
 
 int CGUIInfoManager::TranslateMusicPlayerString(std::string_view info) const
 {
-  for (const auto& i : musicplayer)
-  {
-    if (info == i.str)
-      return i.val;
-  }
+  if (const InfoMap* i = musicplayer_map.Find(info))
+    return i->val;
   return 0;
 }
 
 int CGUIInfoManager::TranslateVideoPlayerString(std::string_view info) const
 {
-  for (const auto& i : videoplayer)
-  {
-    if (info == i.str)
-      return i.val;
-  }
+  if (const InfoMap* i = videoplayer_map.Find(info))
+    return i->val;
   return 0;
 }
 
 int CGUIInfoManager::TranslatePlayerString(std::string_view info) const
 {
-  for (const auto& i : player_labels)
-  {
-    if (info == i.str)
-      return i.val;
-  }
+  if (const InfoMap* i = player_labels_map.Find(info))
+    return i->val;
   return 0;
 }
 
@@ -11368,9 +11320,9 @@ INFO::InfoPtr CGUIInfoManager::Register(const std::string &expression, int conte
   std::pair<INFOBOOLTYPE::iterator, bool> res;
 
   if (condition.find_first_of("|+[]!") != std::string::npos)
-    res = m_bools.insert(std::make_shared<InfoExpression>(condition, context, m_refreshCounter));
+    res = m_bools.insert(std::make_shared<InfoExpression>(condition, context, m_infoSources));
   else
-    res = m_bools.insert(std::make_shared<InfoSingle>(condition, context, m_refreshCounter));
+    res = m_bools.insert(std::make_shared<InfoSingle>(condition, context, m_infoSources));
 
   if (res.second)
     res.first->get()->Initialize(this);
@@ -11706,6 +11658,13 @@ void CGUIInfoManager::Clear()
 {
   std::unique_lock lock(m_critInfo);
   m_skinVariableStrings.clear();
+  m_infoSources.InvalidateAll();
+
+  for (auto& shard : m_translations)
+  {
+    std::unique_lock shardLock(shard.lock);
+    shard.ids.clear();
+  }
 
   /*
     Erase any info bools that are unused. We do this repeatedly as each run
@@ -11748,16 +11707,14 @@ void CGUIInfoManager::UpdateAVInfo() const
 
 int CGUIInfoManager::AddMultiInfo(const CGUIInfo &info)
 {
-  // check to see if we have this info already
-  for (unsigned int i = 0; i < m_multiInfo.size(); ++i)
-    if (m_multiInfo[i] == info)
-      return static_cast<int>(i) + MULTI_INFO_START;
-  // return the new offset
-  m_multiInfo.emplace_back(info);
-  int id = static_cast<int>(m_multiInfo.size()) + MULTI_INFO_START - 1;
-  if (id > MULTI_INFO_END)
+  // returns the existing offset if we have this info already
+  const int index = m_multiInfo.Add(info);
+  if (index < 0)
+  {
     CLog::LogF(LOGERROR, "Too many multiinfo bool/labels in this skin");
-  return id;
+    return 0;
+  }
+  return index + MULTI_INFO_START;
 }
 
 int CGUIInfoManager::ResolveMultiInfo(int info) const
@@ -11987,8 +11944,71 @@ bool CGUIInfoManager::GetItemBool(const CGUIListItem *item, int contextWindow, i
 void CGUIInfoManager::ResetCache()
 {
   // mark our infobools as dirty
-  std::unique_lock lock(m_critInfo);
-  ++m_refreshCounter;
+  m_infoSources.InvalidateAll();
+}
+
+void CGUIInfoManager::NewFrame()
+{
+  m_infoSources.NewFrame();
+}
+
+INFO::InfoSourceMask CGUIInfoManager::GetInfoSources(int info) const
+{
+  info = std::abs(info);
+  switch (info)
+  {
+    case 0: // failed to translate, always false or empty
+    case SYSTEM_ALWAYS_TRUE:
+    case SYSTEM_ALWAYS_FALSE:
+      return 0;
+    case SYSTEM_TIME:
+    case SYSTEM_DATE:
+      return INFO::ToMask(INFO::InfoSource::CLOCK);
+    default:
+      break;
+  }
+
+  if (info < MULTI_INFO_START || info > MULTI_INFO_END ||
+      info - MULTI_INFO_START >= static_cast<int>(m_multiInfo.Size()))
+    return INFO::ToMask(INFO::InfoSource::FRAME);
+
+  const CGUIInfo& multiInfo = m_multiInfo[info - MULTI_INFO_START];
+  switch (multiInfo.GetInfo())
+  {
+    case INTEGER_VALUEOF:
+      return 0;
+    case SKIN_BOOL:
+    case SKIN_STRING:
+    case SKIN_STRING_IS_EQUAL:
+    case SKIN_INTEGER:
+      return INFO::ToMask(INFO::InfoSource::SKIN_SETTINGS);
+    case SYSTEM_TIME:
+    case SYSTEM_DATE:
+      return INFO::ToMask(INFO::InfoSource::CLOCK);
+    case WINDOW_PROPERTY:
+      // without a window the property is looked up in the window of the context
+      return INFO::ToMask(multiInfo.GetData1() ? INFO::InfoSource::WINDOW_PROPERTIES
+                                               : INFO::InfoSource::FRAME);
+    case STRING_IS_EMPTY:
+      return GetInfoSources(multiInfo.GetData1());
+    case STRING_IS_EQUAL:
+    case STRING_STARTS_WITH:
+    case STRING_ENDS_WITH:
+    case STRING_CONTAINS:
+      // the second parameter is either a constant label or an info stored negated
+      return GetInfoSources(multiInfo.GetData1()) |
+             (multiInfo.GetData2() < 0 ? GetInfoSources(multiInfo.GetData2()) : 0);
+    case INTEGER_IS_EQUAL:
+    case INTEGER_GREATER_THAN:
+    case INTEGER_GREATER_OR_EQUAL:
+    case INTEGER_LESS_THAN:
+    case INTEGER_LESS_OR_EQUAL:
+    case INTEGER_EVEN:
+    case INTEGER_ODD:
+      return GetInfoSources(multiInfo.GetData1()) | GetInfoSources(multiInfo.GetData2());
+    default:
+      return INFO::ToMask(INFO::InfoSource::FRAME);
+  }
 }
 
 void CGUIInfoManager::SetCurrentVideoTag(const CVideoInfoTag &tag)
@@ -9,16 +9,21 @@
 #pragma once
 
 #include "guilib/guiinfo/GUIInfoProviders.h"
+#include "guilib/guiinfo/GUIInfoTable.h"
 #include "interfaces/info/InfoBool.h"
+#include "interfaces/info/InfoSource.h"
 #include "interfaces/info/SkinVariable.h"
 #include "messaging/IMessageTarget.h"
 #include "threads/CriticalSection.h"
+#include "threads/SharedSection.h"
 
+#include <array>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 class CFileItem;
@@ -57,8 +62,29 @@ public:
   void Initialize();
 
   void Clear();
+
+  /*! \brief Mark all infos as dirty, whatever they depend on
+   */
   void ResetCache();
 
+  /*! \brief Start a new frame, marking infos that may change at any time as dirty
+   Infos with tracked sources stay cached until their source changes.
+   */
+  void NewFrame();
+
+  /*! \brief Mark infos depending on the given source as dirty
+   \param source what changed
+   */
+  void InvalidateInfos(INFO::InfoSource source) { m_infoSources.Invalidate(source); }
+
+  /*! \brief Get the sources the value of an info depends on
+   \param info the info id, negative for inverted conditions
+   \return the sources, FRAME for everything that is not tracked
+   */
+  INFO::InfoSourceMask GetInfoSources(int info) const;
+
+  INFO::CInfoSourceTracker& GetInfoSourceTracker() { return m_infoSources; }
+
   // KODI::MESSAGING::IMessageTarget implementation
   int GetMessageMask() override;
   void OnApplicationMessage(KODI::MESSAGING::ThreadMessage* pMsg) override;
@@ -209,8 +235,18 @@ private:
   void SetCurrentSongTag(const MUSIC_INFO::CMusicInfoTag &tag);
   void SetCurrentVideoTag(const CVideoInfoTag &tag);
 
-  // Vector of multiple information mapped to a single integer lookup
-  std::vector<KODI::GUILIB::GUIINFO::CGUIInfo> m_multiInfo;
+  // Multiple information mapped to a single integer lookup
+  KODI::GUILIB::GUIINFO::CGUIInfoTable m_multiInfo;
+
+  // Ids of the strings TranslateString was asked for, sharded so readers of different strings
+  // don't wait for each other
+  struct TranslationShard
+  {
+    CSharedSection lock;
+    std::unordered_map<std::string, int> ids;
+  };
+  static constexpr size_t TRANSLATION_SHARDS = 16;
+  std::array<TranslationShard, TRANSLATION_SHARDS> m_translations;
 
   // Current playing stuff
   std::unique_ptr<CFileItem> m_currentFile;
@@ -224,7 +260,7 @@ private:
   }
 
   INFOBOOLTYPE m_bools{&CGUIInfoManager::InfoBoolComparator};
-  unsigned int m_refreshCounter = 0;
+  INFO::CInfoSourceTracker m_infoSources;
   std::vector<INFO::CSkinVariableString> m_skinVariableStrings;
 
   CCriticalSection m_critInfo;
@@ -81,6 +81,7 @@
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/LocalizeStrings.h"
 #include "guilib/StereoscopicsManager.h"
@@ -830,6 +831,8 @@ void CApplication::Render()
   if (m_bStop)
     return;
 
+  CGUIFrameProfiler::CScope scope("Application::Render", "app");
+
   const auto appPlayer = GetComponent<CApplicationPlayer>();
   const auto appPower = GetComponent<CApplicationPowerHandling>();
 
@@ -875,13 +878,16 @@ void CApplication::Render()
   // render video layer
   CServiceBroker::GetGUI()->GetWindowManager().RenderEx();
 
-  CServiceBroker::GetRenderSystem()->EndRender();
+  {
+    CGUIFrameProfiler::CScope scope("RenderSystem::EndRender", "render");
+    CServiceBroker::GetRenderSystem()->EndRender();
+  }
 
   // reset our info cache - we do this at the end of Render so that it is
   // fresh for the next process(), or after a windowclose animation (where process()
-  // isn't called)
+  // isn't called). Infos with tracked sources stay cached until these change.
   CGUIInfoManager& infoMgr = CServiceBroker::GetGUI()->GetInfoManager();
-  infoMgr.ResetCache();
+  infoMgr.NewFrame();
   infoMgr.GetInfoProviders().GetGUIControlsInfoProvider().ResetContainerMovingCache();
 
   if (hasRendered)
@@ -889,8 +895,11 @@ void CApplication::Render()
     infoMgr.GetInfoProviders().GetSystemInfoProvider().UpdateFPS();
   }
 
-  CServiceBroker::GetWinSystem()->GetGfxContext().Flip(hasRendered,
-                                                       appPlayer->IsRenderingVideoLayer());
+  {
+    CGUIFrameProfiler::CScope scope("GraphicContext::Flip", "render");
+    CServiceBroker::GetWinSystem()->GetGfxContext().Flip(hasRendered,
+                                                         appPlayer->IsRenderingVideoLayer());
+  }
 
   CTimeUtils::UpdateFrameTime(hasRendered);
 }
@@ -1777,6 +1786,7 @@ void CApplication::UnlockFrameMoveGuard()
 
 void CApplication::FrameMove(bool processEvents, bool processGUI)
 {
+  CGUIFrameProfiler::CScope scope("Application::FrameMove", "app");
   const auto appPlayer = GetComponent<CApplicationPlayer>();
   bool renderGUI = GetComponent<CApplicationPowerHandling>()->GetRenderGUI();
   if (processEvents)
@@ -1901,6 +1911,8 @@ int CApplication::Run()
     // Animate and render a frame
 
     lastFrameTime = std::chrono::steady_clock::now();
+    CGUIFrameProfiler::Instance().NewFrame();
+    CGUIFrameProfiler::CScope frameScope("Frame", "app");
     Process();
 
     bool renderGUI = GetComponent<CApplicationPowerHandling>()->GetRenderGUI();
@@ -3229,6 +3241,8 @@ void CApplication::ConfigureAndEnableAddons()
 
 void CApplication::Process()
 {
+  CGUIFrameProfiler::CScope scope("Application::Process", "app");
+
   // dispatch the messages generated by python or other threads to the current window
   CServiceBroker::GetGUI()->GetWindowManager().DispatchThreadMessages();
 
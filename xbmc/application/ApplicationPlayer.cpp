@@ -776,6 +776,15 @@ void CApplicationPlayer::GetAudioCapabilities(std::vector<IPlayerAudioCaps>& cap
     player->GetAudioCapabilities(caps);
 }
 
+bool CApplicationPlayer::GetWaveform(std::vector<float>& peaks) const
+{
+  const std::shared_ptr<const IPlayer> player = GetInternal();
+  if (player)
+    return player->GetWaveform(peaks);
+  else
+    return false;
+}
+
 void CApplicationPlayer::GetSubtitleCapabilities(std::vector<IPlayerSubtitleCaps>& caps) const
 {
   const std::shared_ptr<const IPlayer> player = GetInternal();
@@ -109,6 +109,7 @@ public:
   int64_t GetMaxTime() const;
   time_t GetStartTime() const;
   int64_t GetTotalTime() const;
+  bool GetWaveform(std::vector<float>& peaks) const;
   int GetVideoStream();
   int GetVideoStreamCount() const;
   void GetVideoStreamInfo(int streamId, VideoStreamInfo& info) const;
@@ -8,13 +8,29 @@
 
 #include "AEResampleFactory.h"
 #include "cores/AudioEngine/Engines/ActiveAE/ActiveAEResampleFFMPEG.h"
+#include "cores/AudioEngine/Engines/ActiveAE/ActiveAEResamplePolyphase.h"
 
 namespace ActiveAE
 {
 
+std::atomic<AEResampler> CAEResampleFactory::m_resampler{AEResampler::FFMPEG};
+
 std::unique_ptr<IAEResample> CAEResampleFactory::Create(uint32_t flags /* = 0 */)
 {
+  if (m_resampler == AEResampler::POLYPHASE && !(flags & AERESAMPLEFACTORY_QUICK_RESAMPLE))
+    return std::make_unique<CActiveAEResamplePolyphase>();
+
   return std::make_unique<CActiveAEResampleFFMPEG>();
 }
 
+void CAEResampleFactory::SetResampler(AEResampler resampler)
+{
+  m_resampler = resampler;
+}
+
+AEResampler CAEResampleFactory::GetResampler()
+{
+  return m_resampler;
+}
+
 }
@@ -10,6 +10,8 @@
 
 #include "cores/AudioEngine/Interfaces/AEResample.h"
 
+#include <atomic>
+
 class IAEResample;
 
 namespace ActiveAE
@@ -24,10 +26,28 @@ enum AEResampleFactoryOptions
   AERESAMPLEFACTORY_QUICK_RESAMPLE = 0x01
 };
 
+/**
+ * Resampler implementations, values of the audiooutput.resampler setting
+ */
+enum class AEResampler
+{
+  FFMPEG = 0,
+  POLYPHASE = 1
+};
+
 class CAEResampleFactory
 {
 public:
   static std::unique_ptr<IAEResample> Create(uint32_t flags = 0U);
+
+  /**
+   * Select the implementation returned by Create. Quick resample jobs always use ffmpeg.
+   */
+  static void SetResampler(AEResampler resampler);
+  static AEResampler GetResampler();
+
+private:
+  static std::atomic<AEResampler> m_resampler;
 };
 
 }
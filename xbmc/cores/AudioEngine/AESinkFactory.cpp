@@ -18,6 +18,7 @@
 using namespace AE;
 
 std::map<std::string, AESinkRegEntry> CAESinkFactory::m_AESinkRegEntry;
+std::atomic<AELatencyMode> CAESinkFactory::m_latencyMode{AELatencyMode::NORMAL};
 
 void CAESinkFactory::RegisterSink(const AESinkRegEntry& regEntry)
 {
@@ -129,3 +130,18 @@ void CAESinkFactory::Cleanup()
       reg.second.cleanupFunc();
   }
 }
+
+void CAESinkFactory::SetLatencyMode(AELatencyMode mode)
+{
+  m_latencyMode = mode;
+}
+
+AELatencyMode CAESinkFactory::GetLatencyMode()
+{
+  return m_latencyMode;
+}
+
+const AELatencyProfile& CAESinkFactory::GetLatencyProfile()
+{
+  return AELatencyProfile::Get(m_latencyMode);
+}
@@ -10,7 +10,9 @@
 
 #include "Utils/AEAudioFormat.h"
 #include "Utils/AEDeviceInfo.h"
+#include "Utils/AELatencyProfile.h"
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -66,8 +68,16 @@ public:
   static void EnumerateEx(std::vector<AESinkInfo>& list, bool force, const std::string& driver);
   static void Cleanup();
 
+  /*!
+   * \brief Set the latency profile sinks negotiate with the device when they are created
+   */
+  static void SetLatencyMode(AELatencyMode mode);
+  static AELatencyMode GetLatencyMode();
+  static const AELatencyProfile& GetLatencyProfile();
+
 protected:
   static std::map<std::string, AESinkRegEntry> m_AESinkRegEntry;
+  static std::atomic<AELatencyMode> m_latencyMode;
 };
 
 }
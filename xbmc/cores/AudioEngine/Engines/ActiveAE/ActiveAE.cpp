@@ -11,18 +11,22 @@
 #include "ActiveAESettings.h"
 #include "ActiveAESound.h"
 #include "ActiveAEStream.h"
+#include "ActiveAEZone.h"
 #include "ServiceBroker.h"
 #include "cores/AudioEngine/AEResampleFactory.h"
 #include "cores/AudioEngine/Encoders/AEEncoderFFmpeg.h"
 #include "cores/AudioEngine/Interfaces/IAudioCallback.h"
+#include "cores/AudioEngine/Utils/AEKernels.h"
 #include "cores/AudioEngine/Utils/AEStreamData.h"
 #include "cores/AudioEngine/Utils/AEStreamInfo.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
@@ -33,9 +37,10 @@ using namespace std::chrono_literals;
 
 namespace
 {
-constexpr float MAX_CACHE_LEVEL = 0.4f; // total cache time of stream in seconds;
-constexpr float MAX_WATER_LEVEL = 0.2f; // buffered time after stream stages in seconds;
-constexpr double MAX_BUFFER_TIME = 0.1; // max time of a buffer in seconds;
+AELatencyMode GetLatencyMode(const AudioSettings& settings)
+{
+  return settings.lowLatency ? AELatencyMode::LOW : AELatencyMode::NORMAL;
+}
 } // unnamed namespace
 
 void CEngineStats::Reset(unsigned int sampleRate, bool pcm)
@@ -90,6 +95,11 @@ void CEngineStats::AddStream(unsigned int streamid)
   stream.m_resampleRatio = 1.0;
   stream.m_syncError = 0;
   stream.m_syncState = CAESyncInfo::AESyncState::SYNC_OFF;
+  stream.m_queuedTime = 0;
+  stream.m_estimatedOutputTime = 0;
+  stream.m_peakEstimatedOutputTime = 0;
+  stream.m_wakeupsPerSec = 0;
+  stream.m_wakeupTime = std::chrono::steady_clock::now();
   m_streamStats.push_back(stream);
 }
 
@@ -136,6 +146,29 @@ void CEngineStats::UpdateStream(CActiveAEStream *stream)
       }
       str.m_bufferedTime = static_cast<double>(delay);
       stream->m_bufferedTime = 0;
+
+      str.m_queuedTime = static_cast<double>(stream->m_queuedTime) / 1000;
+
+      // what a sample added by the stream now has to pass until it is heard, estimated from the
+      // buffer levels, the sink latency is what the sink reports
+      double output = m_sinkDelay.GetDelay() + static_cast<double>(m_sinkLatency);
+      if (m_pcmOutput)
+        output += static_cast<double>(m_bufferedSamples) / m_sinkSampleRate;
+      else
+        output += static_cast<double>(m_bufferedSamples) *
+                  m_sinkFormat.m_streamInfo.GetDuration() / 1000;
+      output += str.m_bufferedTime / str.m_resampleRatio;
+      str.m_estimatedOutputTime = output * 1000;
+      str.m_peakEstimatedOutputTime =
+          std::max(str.m_peakEstimatedOutputTime, str.m_estimatedOutputTime);
+
+      const auto now = std::chrono::steady_clock::now();
+      const std::chrono::duration<double> elapsed = now - str.m_wakeupTime;
+      if (elapsed >= 1s)
+      {
+        str.m_wakeupsPerSec = stream->m_engineWakeups.exchange(0) / elapsed.count();
+        str.m_wakeupTime = now;
+      }
       break;
     }
   }
@@ -196,6 +229,24 @@ void CEngineStats::GetSyncInfo(CAESyncInfo& info, CActiveAEStream *stream)
   }
 }
 
+CAEStreamLatency CEngineStats::GetStreamLatency(CActiveAEStream* stream)
+{
+  std::unique_lock lock(m_lock);
+  CAEStreamLatency latency;
+  for (const auto& str : m_streamStats)
+  {
+    if (str.m_streamId == stream->m_id)
+    {
+      latency.queuedMs = str.m_queuedTime;
+      latency.estimatedOutputMs = str.m_estimatedOutputTime;
+      latency.peakEstimatedOutputMs = str.m_peakEstimatedOutputTime;
+      latency.wakeupsPerSec = str.m_wakeupsPerSec;
+      break;
+    }
+  }
+  return latency;
+}
+
 float CEngineStats::GetCacheTime(CActiveAEStream *stream)
 {
   std::unique_lock lock(m_lock);
@@ -216,12 +267,13 @@ float CEngineStats::GetCacheTime(CActiveAEStream *stream)
 
 float CEngineStats::GetCacheTotal()
 {
-  return MAX_CACHE_LEVEL;
+  return static_cast<float>(AELatencyProfile::Get(m_latencyMode).streamCache);
 }
 
 float CEngineStats::GetMaxDelay() const
 {
-  return MAX_CACHE_LEVEL + MAX_WATER_LEVEL + m_sinkCacheTotal;
+  const AELatencyProfile& latency = AELatencyProfile::Get(m_latencyMode);
+  return static_cast<float>(latency.streamCache + latency.waterLevel) + m_sinkCacheTotal;
 }
 
 float CEngineStats::GetWaterLevel()
@@ -301,6 +353,7 @@ void CActiveAE::Dispose()
   StopThread();
   m_controlPort.Purge();
   m_dataPort.Purge();
+  m_zones.clear();
   m_sink.Dispose();
 }
 
@@ -352,6 +405,11 @@ void CActiveAE::StateMachine(int signal, Protocol *port, Message *msg)
           m_volumeScaled = CAEUtil::GainToScale(CAEUtil::PercentToGain(m_volume));
           if (m_sinkHasVolume)
             m_sink.m_controlPort.SendOutMessage(CSinkControlProtocol::VOLUME, &m_volume, sizeof(float));
+          for (auto& zone : m_zones)
+          {
+            if (zone->HasVolume())
+              zone->SetVolume(m_volume);
+          }
           return;
         case CActiveAEControlProtocol::MUTE:
           m_muted = *(bool*)msg->data;
@@ -373,6 +431,11 @@ void CActiveAE::StateMachine(int signal, Protocol *port, Message *msg)
             par->stream->m_resampleIntegral = 0.0;
           }
           return;
+        case CActiveAEControlProtocol::STREAMZONES:
+          par = reinterpret_cast<MsgStreamParameter*>(msg->data);
+          if (par->stream)
+            par->stream->m_zones = static_cast<unsigned int>(par->parameter.int_par);
+          return;
         default:
           break;
         }
@@ -505,6 +568,7 @@ void CActiveAE::StateMachine(int signal, Protocol *port, Message *msg)
           m_sink.EnumerateSinkList(false, "");
           LoadSettings();
           ValidateOutputDevices(true);
+          CreateZones();
           Configure();
           if (!m_isWinSysReg)
           {
@@ -788,21 +852,6 @@ void CActiveAE::StateMachine(int signal, Protocol *port, Message *msg)
           else
             msg->Reply(CActiveAEDataProtocol::ERR);
           return;
-        case CActiveAEDataProtocol::STREAMSAMPLE:
-          MsgStreamSample *msgData;
-          CSampleBuffer *samples;
-          msgData = reinterpret_cast<MsgStreamSample*>(msg->data);
-          samples = msgData->stream->m_processingSamples.front();
-          msgData->stream->m_processingSamples.pop_front();
-          if (samples != msgData->buffer)
-            CLog::Log(LOGERROR, "CActiveAE - inconsistency in stream sample message");
-          if (msgData->buffer->pkt->nb_samples == 0)
-            msgData->buffer->Return();
-          else
-            msgData->stream->m_processingBuffers->m_inputSamples.push_back(msgData->buffer);
-          m_extTimeout = 0ms;
-          m_state = AE_TOP_CONFIGURED_PLAY;
-          return;
         case CActiveAEDataProtocol::FREESTREAM:
           MsgStreamFree *msgStreamFree;
           msgStreamFree = reinterpret_cast<MsgStreamFree*>(msg->data);
@@ -1079,6 +1128,12 @@ void CActiveAE::Process()
       gotMsg = true;
       port = &m_sink.m_dataPort;
     }
+    // buffers played by the sinks of zones
+    else if (std::any_of(m_zones.begin(), m_zones.end(),
+                         [](const auto& zone) { return zone->ReceiveSinkMessage(); }))
+    {
+      continue;
+    }
     else if (!m_extDeferData)
     {
       // check data port
@@ -1087,6 +1142,11 @@ void CActiveAE::Process()
         gotMsg = true;
         port = &m_dataPort;
       }
+      // samples queued by streams
+      else if (ReceiveStreamSamples())
+      {
+        continue;
+      }
       // stream data ports
       else
       {
@@ -1114,8 +1174,20 @@ void CActiveAE::Process()
       continue;
     }
 
+    // streams don't signal every sample, announce that we are going to sleep and check
+    // again for samples queued in between
+    m_extWaitForData = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (HasStreamSamples())
+    {
+      m_extWaitForData = false;
+      continue;
+    }
+
     // wait for message
-    else if (m_outMsgEvent.Wait(m_extTimeout))
+    const bool signaled = m_outMsgEvent.Wait(m_extTimeout);
+    m_extWaitForData = false;
+    if (signaled)
     {
       m_extTimeout = timer.GetTimeLeft();
       continue;
@@ -1188,9 +1260,11 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
 
   if ((!CompareFormat(m_sinkRequestFormat, m_sinkFormat) &&
        !CompareFormat(m_sinkRequestFormat, oldSinkRequestFormat)) ||
-      m_currDevice.compare(dev.name) != 0 || m_settings.driver.compare(dev.driver) != 0)
+      m_currDevice.compare(dev.name) != 0 || m_settings.driver.compare(dev.driver) != 0 ||
+      GetLatencyMode(m_settings) != m_latencyMode)
   {
     FlushEngine();
+    ApplyLatencyMode(GetLatencyMode(m_settings));
     if (!InitSink())
       return;
     m_settings.driver = dev.driver;
@@ -1202,17 +1276,20 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
     if (m_sinkRequestFormat.m_dataFormat != AE_FMT_RAW)
     {
       // limit buffer size in case of sink returns large buffer
+      const double maxBufferTime = AELatencyProfile::Get(m_latencyMode).maxPeriod;
       double buffertime = (double)m_sinkFormat.m_frames / m_sinkFormat.m_sampleRate;
-      if (buffertime > MAX_BUFFER_TIME)
+      if (buffertime > maxBufferTime)
       {
         CLog::Log(LOGWARNING,
                   "ActiveAE::{} - sink returned large period time of {} ms, reducing to {} ms",
-                  __FUNCTION__, (int)(buffertime * 1000), (int)(MAX_BUFFER_TIME * 1000));
-        m_sinkFormat.m_frames = MAX_BUFFER_TIME * m_sinkFormat.m_sampleRate;
+                  __FUNCTION__, (int)(buffertime * 1000), (int)(maxBufferTime * 1000));
+        m_sinkFormat.m_frames = maxBufferTime * m_sinkFormat.m_sampleRate;
       }
     }
   }
 
+  const AELatencyProfile& latency = AELatencyProfile::Get(m_latencyMode);
+
   if (m_silenceBuffers)
   {
     m_discardBufferPools.push_back(std::move(m_silenceBuffers));
@@ -1232,7 +1309,7 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
     inputFormat.m_frameSize = inputFormat.m_channelLayout.Count() *
                               (CAEUtil::DataFormatToBits(inputFormat.m_dataFormat) >> 3);
     m_silenceBuffers = std::make_unique<CActiveAEBufferPool>(inputFormat);
-    m_silenceBuffers->Create(MAX_WATER_LEVEL*1000);
+    m_silenceBuffers->Create(latency.waterLevel * 1000);
     sinkInputFormat = inputFormat;
     m_internalFormat = inputFormat;
 
@@ -1308,7 +1385,7 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
         if (!m_encoderBuffers)
         {
           m_encoderBuffers = std::make_unique<CActiveAEBufferPool>(format);
-          m_encoderBuffers->Create(MAX_WATER_LEVEL*1000);
+          m_encoderBuffers->Create(latency.waterLevel * 1000);
         }
       }
 
@@ -1350,7 +1427,7 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
 
         // create buffer pool
         (*it)->m_inputBuffers = std::make_unique<CActiveAEBufferPool>((*it)->m_format);
-        (*it)->m_inputBuffers->Create(MAX_CACHE_LEVEL*1000);
+        (*it)->m_inputBuffers->Create(latency.streamCache * 1000);
         (*it)->m_streamSpace = (*it)->m_format.m_frameSize * (*it)->m_format.m_frames;
 
         // if input format does not follow ffmpeg channel mask, we may need to remap channels
@@ -1369,8 +1446,9 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
             (*it)->m_inputBuffers->m_format, outputFormat, m_settings.resampleQuality);
         (*it)->m_processingBuffers->ForceResampler((*it)->m_forceResampler);
 
-        (*it)->m_processingBuffers->Create(MAX_CACHE_LEVEL * 1000, false, m_settings.stereoupmix,
-                                           m_settings.normalizelevels, m_settings.mixSubLevel);
+        (*it)->m_processingBuffers->Create(latency.streamCache * 1000, false,
+                                           m_settings.stereoupmix, m_settings.normalizelevels,
+                                           m_settings.mixSubLevel);
       }
       if (m_mode == MODE_TRANSCODE || m_streams.size() > 1)
         (*it)->m_processingBuffers->FillBuffer();
@@ -1430,7 +1508,7 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
   {
     m_sinkBuffers = std::make_unique<CActiveAEBufferPoolResample>(sinkInputFormat, m_sinkFormat,
                                                                   m_settings.resampleQuality);
-    m_sinkBuffers->Create(MAX_WATER_LEVEL*1000, true, false);
+    m_sinkBuffers->Create(latency.waterLevel * 1000, true, false);
   }
 
   // reset gui sounds
@@ -1449,10 +1527,44 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
     m_sounds_playing.clear();
   }
 
+  ConfigureZones();
+
   ClearDiscardedBuffers();
   m_extDrain = false;
 }
 
+void CActiveAE::CreateZones()
+{
+  if (!m_zones.empty())
+    return;
+
+  // bit 0 of the routing mask of streams is the audio device
+  const auto& zones = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioZones;
+  for (unsigned int i = 0; i < zones.size() && i + 1 < 32; i++)
+  {
+    auto zone = std::make_unique<CActiveAEZone>(i + 1, zones[i].device, &m_outMsgEvent);
+    zone->Start();
+    m_zones.push_back(std::move(zone));
+  }
+}
+
+void CActiveAE::ConfigureZones()
+{
+  for (auto& zone : m_zones)
+  {
+    // zones only play what is mixed, passthrough is for the audio device
+    if (m_streams.empty() || m_mode == MODE_RAW)
+    {
+      zone->Unconfigure(m_discardBufferPools);
+      continue;
+    }
+
+    if (zone->Configure(m_internalFormat, m_settings.resampleQuality, m_latencyMode, m_volume,
+                        m_discardBufferPools))
+      zone->SetStreaming(true);
+  }
+}
+
 CActiveAEStream* CActiveAE::CreateStream(MsgStreamNew *streamMsg)
 {
   // we only can handle a single pass through stream
@@ -1522,7 +1634,12 @@ void CActiveAE::DiscardStream(CActiveAEStream *stream)
         m_discardBufferPools.push_back((*it)->m_processingBuffers->GetResampleBuffers());
         m_discardBufferPools.push_back((*it)->m_processingBuffers->GetAtempoBuffers());
       }
-      CLog::Log(LOGDEBUG, "CActiveAE::DiscardStream - audio stream deleted");
+      const CAEStreamLatency latency = m_stats.GetStreamLatency(*it);
+      CLog::Log(LOGDEBUG,
+                "CActiveAE::DiscardStream - audio stream deleted, estimated latency {:.1f}ms "
+                "(peak {:.1f}ms), queued {:.1f}ms, engine wakeups {:.1f}/s",
+                latency.estimatedOutputMs, latency.peakEstimatedOutputMs, latency.queuedMs,
+                latency.wakeupsPerSec);
       m_stats.RemoveStream((*it)->m_id);
       delete (*it);
       it = m_streams.erase(it);
@@ -1534,6 +1651,65 @@ void CActiveAE::DiscardStream(CActiveAEStream *stream)
   ClearDiscardedBuffers();
 }
 
+bool CActiveAE::ReceiveStreamSamples()
+{
+  if (m_extDeferData ||
+      (m_state != AE_TOP_CONFIGURED_IDLE && m_state != AE_TOP_CONFIGURED_PLAY))
+    return false;
+
+  bool received = false;
+  CSampleBuffer* buffer;
+  for (auto& stream : m_streams)
+  {
+    while (stream->m_sampleQueue.Pop(buffer))
+    {
+      stream->m_queuedTime -= stream->GetDurationUs(buffer);
+
+      CSampleBuffer* samples = stream->m_processingSamples.front();
+      stream->m_processingSamples.pop_front();
+      if (samples != buffer)
+        CLog::Log(LOGERROR, "CActiveAE - inconsistency in stream sample queue");
+      if (buffer->pkt->nb_samples == 0)
+        buffer->Return();
+      else
+        stream->m_processingBuffers->m_inputSamples.push_back(buffer);
+      received = true;
+    }
+  }
+
+  if (received)
+  {
+    m_extTimeout = 0ms;
+    m_state = AE_TOP_CONFIGURED_PLAY;
+  }
+  return received;
+}
+
+bool CActiveAE::HasStreamSamples()
+{
+  if (m_extDeferData ||
+      (m_state != AE_TOP_CONFIGURED_IDLE && m_state != AE_TOP_CONFIGURED_PLAY))
+    return false;
+
+  for (const auto& stream : m_streams)
+  {
+    if (!stream->m_sampleQueue.Empty())
+      return true;
+  }
+  return false;
+}
+
+void CActiveAE::SignalStreamSample(CActiveAEStream* stream)
+{
+  // pairs with the fence in Process() before going to sleep
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_extWaitForData.exchange(false))
+  {
+    stream->m_engineWakeups++;
+    m_outMsgEvent.Set();
+  }
+}
+
 void CActiveAE::SFlushStream(CActiveAEStream *stream)
 {
   while (!stream->m_processingSamples.empty())
@@ -1543,6 +1719,10 @@ void CActiveAE::SFlushStream(CActiveAEStream *stream)
   }
   stream->m_processingBuffers->Flush();
   stream->m_streamPort->Purge();
+  // the stream is blocked in FlushStream(), nobody else touches the queues
+  stream->m_sampleQueue.Clear();
+  stream->m_bufferQueue.Clear();
+  stream->m_queuedTime = 0;
   stream->m_bufferedTime = 0.0;
   stream->m_paused = false;
   stream->m_syncState = CAESyncInfo::AESyncState::SYNC_START;
@@ -1583,6 +1763,9 @@ void CActiveAE::FlushEngine()
     m_extError = true;
   }
   m_stats.Reset(m_sinkFormat.m_sampleRate, m_mode == MODE_PCM);
+
+  for (auto& zone : m_zones)
+    zone->Flush();
 }
 
 void CActiveAE::ClearDiscardedBuffers()
@@ -1781,7 +1964,31 @@ bool CActiveAE::NeedReconfigureSink()
   const AESinkDevice dev = CAESinkFactory::ParseDevice(device);
 
   return !CompareFormat(newFormat, m_sinkFormat) || m_currDevice.compare(dev.name) != 0 ||
-         m_settings.driver.compare(dev.driver) != 0;
+         m_settings.driver.compare(dev.driver) != 0 || GetLatencyMode(m_settings) != m_latencyMode;
+}
+
+void CActiveAE::ApplyLatencyMode(AELatencyMode mode)
+{
+  if (mode == m_latencyMode)
+    return;
+
+  CLog::Log(LOGINFO, "ActiveAE::{} - {} latency mode", __FUNCTION__,
+            mode == AELatencyMode::LOW ? "low" : "normal");
+
+  m_latencyMode = mode;
+  m_stats.SetLatencyMode(mode);
+
+  // with periods of a few ms the engine must not be preempted by gui or decoder threads
+  if (mode == AELatencyMode::LOW)
+  {
+    if (!SetRealtime(true))
+      SetPriority(ThreadPriority::HIGHEST);
+  }
+  else
+  {
+    SetRealtime(false);
+    SetPriority(ThreadPriority::NORMAL);
+  }
 }
 
 bool CActiveAE::InitSink()
@@ -1791,6 +1998,7 @@ bool CActiveAE::InitSink()
   config.stats = &m_stats;
   config.device = (m_sinkRequestFormat.m_dataFormat == AE_FMT_RAW) ? &m_settings.passthroughdevice :
                                                                      &m_settings.device;
+  config.latencyMode = m_latencyMode;
 
   // send message to sink
   m_sink.m_controlPort.SendOutMessage(CSinkControlProtocol::SETNOISETYPE, &m_settings.streamNoise, sizeof(bool));
@@ -1892,6 +2100,7 @@ void CActiveAE::UnconfigureSink()
 bool CActiveAE::RunStages()
 {
   bool busy = false;
+  const AELatencyProfile& latency = AELatencyProfile::Get(m_latencyMode);
 
   // serve input streams
   std::list<CActiveAEStream*>::iterator it;
@@ -1916,15 +2125,20 @@ bool CActiveAE::RunStages()
       float buftime = (float)(*it)->m_inputBuffers->m_format.m_frames / (*it)->m_inputBuffers->m_format.m_sampleRate;
       if ((*it)->m_inputBuffers->m_format.m_dataFormat == AE_FMT_RAW)
         buftime = (*it)->m_inputBuffers->m_format.m_streamInfo.GetDuration() / 1000;
-      while ((time < MAX_CACHE_LEVEL || (*it)->m_streamIsBuffering) &&
-             !(*it)->m_inputBuffers->m_freeSamples.empty())
+      bool provided = false;
+      while ((time < latency.streamCache || (*it)->m_streamIsBuffering) &&
+             !(*it)->m_inputBuffers->m_freeSamples.empty() &&
+             (*it)->m_processingSamples.size() < CActiveAEStream::QUEUE_SIZE)
       {
         buffer = (*it)->m_inputBuffers->GetFreeBuffer();
         (*it)->m_processingSamples.push_back(buffer);
-        (*it)->m_streamPort->SendInMessage(CActiveAEDataProtocol::STREAMBUFFER, &buffer, sizeof(CSampleBuffer*));
+        (*it)->m_bufferQueue.Push(buffer);
         (*it)->IncFreeBuffers();
         time += buftime;
+        provided = true;
       }
+      if (provided)
+        (*it)->SignalFreeBuffers();
     }
     else
     {
@@ -1961,7 +2175,7 @@ bool CActiveAE::RunStages()
   const bool isTrueHDPassthrough =
       (m_mode == MODE_RAW && m_sinkFormat.m_streamInfo.m_type == CAEStreamInfo::STREAM_TYPE_TRUEHD);
 
-  if ((m_stats.GetWaterLevel() < (MAX_WATER_LEVEL + 0.0001f) || isTrueHDPassthrough) &&
+  if ((m_stats.GetWaterLevel() < (latency.waterLevel + 0.0001) || isTrueHDPassthrough) &&
       (m_mode != MODE_TRANSCODE || (m_encoderBuffers && !m_encoderBuffers->m_freeSamples.empty())))
   {
     // calculate sync error
@@ -2036,6 +2250,7 @@ bool CActiveAE::RunStages()
       }
 
       bool needClamp = false;
+      int mixedSamples = 0;
       for (it = m_streams.begin(); it != m_streams.end() && allStreamsReady; ++it)
       {
         if ((*it)->m_paused || !(*it)->m_processingBuffers)
@@ -2054,172 +2269,67 @@ bool CActiveAE::RunStages()
 
           (*it)->m_started = true;
 
-          if (!out)
-          {
-            out = (*it)->m_processingBuffers->m_outputSamples.front();
-            (*it)->m_processingBuffers->m_outputSamples.pop_front();
-
-            int nb_floats = out->pkt->nb_samples * out->pkt->config.channels / out->pkt->planes;
-            int nb_loops = 1;
-            float fadingStep = 0.0f;
-
-            // fading
-            if ((*it)->m_fadingSamples == -1)
-            {
-              (*it)->m_fadingSamples = m_internalFormat.m_sampleRate * (float)(*it)->m_fadingTime / 1000.0f;
-              if ((*it)->m_fadingSamples > 0)
-                (*it)->m_volume = (*it)->m_fadingBase;
-              else
-              {
-                (*it)->m_volume = (*it)->m_fadingTarget;
-                std::unique_lock lock((*it)->m_streamLock);
-                (*it)->m_streamFading = false;
-              }
-            }
-            if ((*it)->m_fadingSamples > 0)
-            {
-              nb_floats = out->pkt->config.channels / out->pkt->planes;
-              nb_loops = out->pkt->nb_samples;
-              float delta = (*it)->m_fadingTarget - (*it)->m_fadingBase;
-              int samples = m_internalFormat.m_sampleRate * (float)(*it)->m_fadingTime / 1000.0f;
-              fadingStep = delta / samples;
-            }
-
-            // for stream amplification,
-            // turned off downmix normalization,
-            // or if sink format is float (in order to prevent from clipping)
-            // we need to run on a per sample basis
-            if ((*it)->m_amplify != 1.0f || !(*it)->m_processingBuffers->DoesNormalize() ||
-                (m_sinkFormat.m_dataFormat == AE_FMT_FLOAT))
-            {
-              nb_floats = out->pkt->config.channels / out->pkt->planes;
-              nb_loops = out->pkt->nb_samples;
-            }
-
-            for(int i=0; i<nb_loops; i++)
-            {
-              if ((*it)->m_fadingSamples > 0)
-              {
-                (*it)->m_volume += fadingStep;
-                (*it)->m_fadingSamples--;
-
-                if ((*it)->m_fadingSamples == 0)
-                {
-                  // set variables being polled via stream interface
-                  std::unique_lock lock((*it)->m_streamLock);
-                  (*it)->m_streamFading = false;
-                }
-              }
+          CSampleBuffer* buf = (*it)->m_processingBuffers->m_outputSamples.front();
+          (*it)->m_processingBuffers->m_outputSamples.pop_front();
+          // the first stream of the mix is limited per sample for a float sink, so are the
+          // streams mixed in zones, the others only when they need it anyway
+          const bool first = !out && ((*it)->m_zones & CActiveAEStream::MAIN_ZONE);
+          const bool zoned = ((*it)->m_zones & ~CActiveAEStream::MAIN_ZONE) && !m_zones.empty();
+          ApplyStreamVolume(*it, *buf->pkt, first || zoned);
 
-              // volume for stream
-              float volume = (*it)->m_volume * (*it)->m_rgain;
-              if(nb_loops > 1)
-                volume *= (*it)->m_limiter.Run((float**)out->pkt->data, out->pkt->config.channels, i*nb_floats, out->pkt->planes > 1);
+          // a stream is decoded once, every zone it plays in mixes the same buffer
+          for (auto& zone : m_zones)
+          {
+            if ((*it)->m_zones & zone->GetMask())
+              zone->AddSamples(buf);
+          }
+          mixedSamples = buf->pkt->nb_samples;
 
-              for(int j=0; j<out->pkt->planes; j++)
-              {
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
-#else
-                float* fbuffer = (float*) out->pkt->data[j]+i*nb_floats;
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  fbuffer[k] *= volume;
-                }
-#endif
-              }
-            }
+          if (!((*it)->m_zones & CActiveAEStream::MAIN_ZONE))
+          {
+            buf->Return();
+          }
+          else if (!out)
+          {
+            out = buf;
           }
           else
           {
-            CSampleBuffer *mix = NULL;
-            mix = (*it)->m_processingBuffers->m_outputSamples.front();
-            (*it)->m_processingBuffers->m_outputSamples.pop_front();
-
-            int nb_floats = mix->pkt->nb_samples * mix->pkt->config.channels / mix->pkt->planes;
-            int nb_loops = 1;
-            float fadingStep = 0.0f;
-
-            // fading
-            if ((*it)->m_fadingSamples == -1)
-            {
-              (*it)->m_fadingSamples = m_internalFormat.m_sampleRate * (float)(*it)->m_fadingTime / 1000.0f;
-              (*it)->m_volume = (*it)->m_fadingBase;
-            }
-            if ((*it)->m_fadingSamples > 0)
-            {
-              nb_floats = mix->pkt->config.channels / mix->pkt->planes;
-              nb_loops = mix->pkt->nb_samples;
-              float delta = (*it)->m_fadingTarget - (*it)->m_fadingBase;
-              int samples = m_internalFormat.m_sampleRate * (float)(*it)->m_fadingTime / 1000.0f;
-              fadingStep = delta / samples;
-            }
-
-            // for streams amplification of turned off downmix normalization
-            // we need to run on a per sample basis
-            if ((*it)->m_amplify != 1.0f || !(*it)->m_processingBuffers->DoesNormalize())
-            {
-              nb_floats = out->pkt->config.channels / out->pkt->planes;
-              nb_loops = out->pkt->nb_samples;
-            }
-
-            for(int i=0; i<nb_loops; i++)
+            int nb_floats = buf->pkt->nb_samples * buf->pkt->config.channels / buf->pkt->planes;
+            const CAEKernels& kernels = CAEKernels::Get();
+            for (int j = 0; j < out->pkt->planes && j < buf->pkt->planes; j++)
             {
-              if ((*it)->m_fadingSamples > 0)
-              {
-                (*it)->m_volume += fadingStep;
-                (*it)->m_fadingSamples--;
-
-                if ((*it)->m_fadingSamples == 0)
-                {
-                  // set variables being polled via stream interface
-                  std::unique_lock lock((*it)->m_streamLock);
-                  (*it)->m_streamFading = false;
-                }
-              }
-
-              // volume for stream
-              float volume = (*it)->m_volume * (*it)->m_rgain;
-              if(nb_loops > 1)
-                volume *= (*it)->m_limiter.Run((float**)mix->pkt->data, mix->pkt->config.channels, i*nb_floats, mix->pkt->planes > 1);
-
-              for(int j=0; j<out->pkt->planes && j<mix->pkt->planes; j++)
-              {
-                float *dst = (float*)out->pkt->data[j]+i*nb_floats;
-                float *src = (float*)mix->pkt->data[j]+i*nb_floats;
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulAddArray(dst, src, volume, nb_floats);
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  if (fabs(dst[k]) > 1.0f)
-                  {
-                    needClamp = true;
-                    break;
-                  }
-                }
-#else
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  dst[k] += src[k] * volume;
-                  if (fabs(dst[k]) > 1.0f)
-                    needClamp = true;
-                }
-#endif
-              }
+              float* dst = reinterpret_cast<float*>(out->pkt->data[j]);
+              kernels.MulAddArray(dst, reinterpret_cast<float*>(buf->pkt->data[j]), 1.0f,
+                                  nb_floats);
+              if (!needClamp && kernels.PeakArray(dst, nb_floats) > 1.0f)
+                needClamp = true;
             }
-            mix->Return();
+            buf->Return();
           }
           busy = true;
         }
       }// for
 
+      // streams only heard in zones still drive the clock of the audio device
+      if (!out && mixedSamples > 0 && m_silenceBuffers && !m_silenceBuffers->m_freeSamples.empty())
+      {
+        out = m_silenceBuffers->GetFreeBuffer();
+        for (int i = 0; i < out->pkt->planes; i++)
+        {
+          memset(out->pkt->data[i], 0, out->pkt->linesize);
+        }
+        out->pkt->nb_samples = std::min(mixedSamples, out->pkt->max_nb_samples);
+      }
+      const int cycleSamples = out ? out->pkt->nb_samples : 0;
+
       // finally clamp samples
       if (out && needClamp)
       {
         int nb_floats = out->pkt->nb_samples * out->pkt->config.channels / out->pkt->planes;
         for (int i=0; i<out->pkt->planes; i++)
         {
-          CAEUtil::ClampArray((float*)out->pkt->data[i], nb_floats);
+          CAEKernels::Get().SoftClipArray((float*)out->pkt->data[i], nb_floats);
         }
       }
 
@@ -2276,7 +2386,10 @@ bool CActiveAE::RunStages()
             }
           }
           else if (m_vizBuffers)
+          {
             m_vizBuffers->Flush();
+            m_vizAnalyzer.Reset();
+          }
         }
 
         // mix gui sounds
@@ -2310,6 +2423,22 @@ bool CActiveAE::RunStages()
         int samples = (m_mode == MODE_TRANSCODE) ? 1 : out->pkt->nb_samples;
         m_stats.AddSamples(samples, m_streams);
         m_sinkBuffers->m_inputSamples.push_back(out);
+
+        // zones play in step with this cycle, as far behind as the audio device
+        if (!m_zones.empty())
+        {
+          AEDelayStatus status;
+          m_stats.GetDelay(status);
+          for (auto& zone : m_zones)
+          {
+            CSampleBuffer* mix = zone->TakeMix(cycleSamples);
+            if (!mix)
+              continue;
+            if (!zone->HasVolume() || m_muted)
+              Deamplify(*(mix->pkt));
+            zone->Output(mix, status.GetDelay());
+          }
+        }
       }
     }
     // pass through
@@ -2347,6 +2476,8 @@ bool CActiveAE::RunStages()
         &out, sizeof(CSampleBuffer*));
     busy = true;
   }
+  for (auto& zone : m_zones)
+    busy |= zone->ProcessBuffers();
 
   return busy;
 }
@@ -2565,6 +2696,72 @@ CSampleBuffer* CActiveAE::SyncStream(CActiveAEStream *stream)
   return ret;
 }
 
+void CActiveAE::ApplyStreamVolume(CActiveAEStream* stream, CSoundPacket& packet, bool limitFloat)
+{
+  int nb_floats = packet.nb_samples * packet.config.channels / packet.planes;
+  int nb_loops = 1;
+  float fadingStep = 0.0f;
+
+  // fading
+  if (stream->m_fadingSamples == -1)
+  {
+    stream->m_fadingSamples = m_internalFormat.m_sampleRate * (float)stream->m_fadingTime / 1000.0f;
+    if (stream->m_fadingSamples > 0)
+      stream->m_volume = stream->m_fadingBase;
+    else
+    {
+      stream->m_volume = stream->m_fadingTarget;
+      std::unique_lock lock(stream->m_streamLock);
+      stream->m_streamFading = false;
+    }
+  }
+  if (stream->m_fadingSamples > 0)
+  {
+    nb_floats = packet.config.channels / packet.planes;
+    nb_loops = packet.nb_samples;
+    float delta = stream->m_fadingTarget - stream->m_fadingBase;
+    int samples = m_internalFormat.m_sampleRate * (float)stream->m_fadingTime / 1000.0f;
+    fadingStep = delta / samples;
+  }
+
+  // for stream amplification,
+  // turned off downmix normalization,
+  // or if sink format is float (in order to prevent from clipping)
+  // we need to run on a per sample basis
+  if (stream->m_amplify != 1.0f || !stream->m_processingBuffers->DoesNormalize() ||
+      (limitFloat && m_sinkFormat.m_dataFormat == AE_FMT_FLOAT))
+  {
+    nb_floats = packet.config.channels / packet.planes;
+    nb_loops = packet.nb_samples;
+  }
+
+  for(int i=0; i<nb_loops; i++)
+  {
+    if (stream->m_fadingSamples > 0)
+    {
+      stream->m_volume += fadingStep;
+      stream->m_fadingSamples--;
+
+      if (stream->m_fadingSamples == 0)
+      {
+        // set variables being polled via stream interface
+        std::unique_lock lock(stream->m_streamLock);
+        stream->m_streamFading = false;
+      }
+    }
+
+    // volume for stream
+    float volume = stream->m_volume * stream->m_rgain;
+    if(nb_loops > 1)
+      volume *= stream->m_limiter.Run((float**)packet.data, packet.config.channels, i*nb_floats, packet.planes > 1);
+
+    for(int j=0; j<packet.planes; j++)
+    {
+      CAEKernels::Get().MulArray((float*)packet.data[j] + i * nb_floats, volume, nb_floats);
+    }
+  }
+}
+
 void CActiveAE::MixSounds(CSoundPacket &dstSample)
 {
   if (m_sounds_playing.empty())
@@ -2593,12 +2790,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
       out = (float*)dstSample.data[j];
       sample_buffer = (float*)(it->sound->GetSound(false)->data[j]+start);
       int nb_floats = mix_samples * dstSample.config.channels / dstSample.planes;
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulAddArray(out, sample_buffer, volume, nb_floats);
-#else
-      for (int k = 0; k < nb_floats; ++k)
-        *out++ += *sample_buffer++ * volume;
-#endif
+      CAEKernels::Get().MulAddArray(out, sample_buffer, volume, nb_floats);
     }
 
     it->samples_played += mix_samples;
@@ -2623,13 +2815,7 @@ void CActiveAE::Deamplify(CSoundPacket &dstSample)
     for(int j=0; j<dstSample.planes; j++)
     {
       float* buffer = reinterpret_cast<float*>(dstSample.data[j]);
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulArray(buffer, volume, nb_floats);
-#else
-      float *fbuffer = buffer;
-      for (int i = 0; i < nb_floats; i++)
-        *fbuffer++ *= volume;
-#endif
+      CAEKernels::Get().MulArray(buffer, volume, nb_floats);
     }
   }
 }
@@ -2666,10 +2852,14 @@ void CActiveAE::LoadSettings()
       settings->GetBool(CSettings::SETTING_AUDIOOUTPUT_DTSHDCOREFALLBACK);
 
   m_settings.resampleQuality = static_cast<AEQuality>(settings->GetInt(CSettings::SETTING_AUDIOOUTPUT_PROCESSQUALITY));
+  m_settings.resampler =
+      static_cast<AEResampler>(settings->GetInt(CSettings::SETTING_AUDIOOUTPUT_RESAMPLER));
+  CAEResampleFactory::SetResampler(m_settings.resampler);
   m_settings.atempoThreshold = settings->GetInt(CSettings::SETTING_AUDIOOUTPUT_ATEMPOTHRESHOLD) / 100.0;
   m_settings.streamNoise = settings->GetBool(CSettings::SETTING_AUDIOOUTPUT_STREAMNOISE);
   m_settings.silenceTimeoutMinutes = settings->GetInt(CSettings::SETTING_AUDIOOUTPUT_STREAMSILENCE);
   m_settings.mixSubLevel = settings->GetInt(CSettings::SETTING_AUDIOOUTPUT_MIXSUBLEVEL) / 100.0;
+  m_settings.lowLatency = settings->GetBool(CSettings::SETTING_AUDIOOUTPUT_LOWLATENCY);
 }
 
 void CActiveAE::ValidateOutputDevices(bool saveChanges)
@@ -3504,6 +3694,15 @@ void CActiveAE::SetStreamFade(CActiveAEStream *stream, float from, float target,
                                      &msg, sizeof(MsgStreamFade));
 }
 
+void CActiveAE::SetStreamZones(CActiveAEStream* stream, unsigned int zones)
+{
+  MsgStreamParameter msg;
+  msg.stream = stream;
+  msg.parameter.int_par = static_cast<int>(zones);
+  m_controlPort.SendOutMessage(CActiveAEControlProtocol::STREAMZONES, &msg,
+                               sizeof(MsgStreamParameter));
+}
+
 void CActiveAE::RegisterAudioCallback(IAudioCallback* pCallback)
 {
   std::unique_lock lock(m_vizLock);
@@ -3518,3 +3717,31 @@ void CActiveAE::UnregisterAudioCallback(IAudioCallback* pCallback)
   if (it != m_audioCallback.end())
     m_audioCallback.erase(it);
 }
+
+void CActiveAE::RegisterVisualizationConsumer()
+{
+  std::unique_lock lock(m_vizLock);
+  if (m_vizConsumers++ == 0)
+  {
+    m_audioCallback.push_back(&m_vizAnalyzer);
+    m_vizInitialized = false;
+  }
+}
+
+void CActiveAE::UnregisterVisualizationConsumer()
+{
+  std::unique_lock lock(m_vizLock);
+  if (m_vizConsumers == 0 || --m_vizConsumers > 0)
+    return;
+
+  auto it = std::find(m_audioCallback.begin(), m_audioCallback.end(), &m_vizAnalyzer);
+  if (it != m_audioCallback.end())
+    m_audioCallback.erase(it);
+  m_vizAnalyzer.Reset();
+}
+
+bool CActiveAE::GetVisualizationFrame(AEVisualizationFrame& frame)
+{
+  // the analyzer has a lock of its own, the engine thread is not held up
+  return m_vizAnalyzer.GetFrame(frame);
+}
@@ -9,13 +9,18 @@
 #pragma once
 
 #include "ActiveAESink.h"
+#include "cores/AudioEngine/AEResampleFactory.h"
 #include "cores/AudioEngine/Engines/ActiveAE/ActiveAEBuffer.h"
 #include "cores/AudioEngine/Interfaces/AESound.h"
 #include "cores/AudioEngine/Interfaces/AEStream.h"
+#include "cores/AudioEngine/Utils/AELatencyProfile.h"
+#include "cores/AudioEngine/Utils/AEVisualizationAnalyzer.h"
 #include "guilib/DispResource.h"
 #include "threads/SystemClock.h"
 #include "threads/Thread.h"
 
+#include <atomic>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <queue>
@@ -39,6 +44,7 @@ namespace ActiveAE
 class CActiveAESound;
 class CActiveAEStream;
 class CActiveAESettings;
+class CActiveAEZone;
 
 struct AudioSettings
 {
@@ -60,10 +66,12 @@ struct AudioSettings
   int guisoundmode;
   unsigned int samplerate;
   AEQuality resampleQuality;
+  AEResampler resampler;
   double atempoThreshold;
   bool streamNoise;
   int silenceTimeoutMinutes;
   float mixSubLevel;
+  bool lowLatency;
 };
 
 class CActiveAEControlProtocol : public Protocol
@@ -92,6 +100,7 @@ public:
     STREAMRESAMPLEMODE,
     STREAMFADE,
     STREAMFFMPEGINFO,
+    STREAMZONES,
     STOPSOUND,
     GETSTATE,
     DISPLAYLOST,
@@ -122,14 +131,12 @@ public:
     FREESOUND,
     NEWSTREAM,
     FREESTREAM,
-    STREAMSAMPLE,
     DRAINSTREAM,
   };
   enum InSignal
   {
     ACC,
     ERR,
-    STREAMBUFFER,
     STREAMDRAINED,
   };
 };
@@ -147,12 +154,6 @@ struct MsgStreamFree
   bool finish; // if true switch back to gui sound mode
 };
 
-struct MsgStreamSample
-{
-  CSampleBuffer *buffer;
-  CActiveAEStream *stream;
-};
-
 struct MsgStreamParameter
 {
   CActiveAEStream *stream;
@@ -193,6 +194,7 @@ public:
   void GetDelay(AEDelayStatus& status, CActiveAEStream *stream);
   void GetSyncInfo(CAESyncInfo& info, CActiveAEStream *stream);
   float GetCacheTime(CActiveAEStream *stream);
+  CAEStreamLatency GetStreamLatency(CActiveAEStream* stream);
   float GetCacheTotal();
   float GetMaxDelay() const;
   float GetWaterLevel();
@@ -201,6 +203,7 @@ public:
   void SetSinkCacheTotal(float time) { m_sinkCacheTotal = time; }
   void SetSinkLatency(float time) { m_sinkLatency = time; }
   void SetSinkNeedIec(bool needIEC) { m_sinkNeedIecPack = needIEC; }
+  void SetLatencyMode(AELatencyMode mode) { m_latencyMode = mode; }
   bool IsSuspended();
   AEAudioFormat GetCurrentSinkFormat();
 protected:
@@ -213,6 +216,7 @@ protected:
   AEAudioFormat m_sinkFormat;
   bool m_pcmOutput;
   bool m_sinkNeedIecPack{false};
+  std::atomic<AELatencyMode> m_latencyMode{AELatencyMode::NORMAL};
   CCriticalSection m_lock;
   struct StreamStats
   {
@@ -222,6 +226,11 @@ protected:
     double m_syncError;
     unsigned int m_errorTime;
     CAESyncInfo::AESyncState m_syncState;
+    double m_queuedTime;
+    double m_estimatedOutputTime;
+    double m_peakEstimatedOutputTime;
+    double m_wakeupsPerSec;
+    std::chrono::steady_clock::time_point m_wakeupTime;
   };
   std::vector<StreamStats> m_streamStats;
 };
@@ -272,6 +281,9 @@ public:
 
   void RegisterAudioCallback(IAudioCallback* pCallback) override;
   void UnregisterAudioCallback(IAudioCallback* pCallback) override;
+  void RegisterVisualizationConsumer() override;
+  void UnregisterVisualizationConsumer() override;
+  bool GetVisualizationFrame(AEVisualizationFrame& frame) override;
 
   void OnLostDisplay() override;
   void OnResetDisplay() override;
@@ -288,6 +300,10 @@ protected:
   void GetDelay(AEDelayStatus& status, CActiveAEStream *stream) { m_stats.GetDelay(status, stream); }
   void GetSyncInfo(CAESyncInfo& info, CActiveAEStream *stream) { m_stats.GetSyncInfo(info, stream); }
   float GetCacheTime(CActiveAEStream *stream) { return m_stats.GetCacheTime(stream); }
+  CAEStreamLatency GetStreamLatency(CActiveAEStream* stream)
+  {
+    return m_stats.GetStreamLatency(stream);
+  }
   float GetCacheTotal() { return m_stats.GetCacheTotal(); }
   float GetMaxDelay() { return m_stats.GetMaxDelay(); }
   void FlushStream(CActiveAEStream *stream);
@@ -300,11 +316,13 @@ protected:
   void SetStreamResampleMode(CActiveAEStream *stream, int mode);
   void SetStreamFFmpegInfo(CActiveAEStream *stream, int profile, enum AVMatrixEncoding matrix_encoding, enum AVAudioServiceType audio_service_type);
   void SetStreamFade(CActiveAEStream *stream, float from, float target, unsigned int millis);
+  void SetStreamZones(CActiveAEStream* stream, unsigned int zones);
 
 protected:
   void Process() override;
   void StateMachine(int signal, Protocol *port, Message *msg);
   bool InitSink();
+  void ApplyLatencyMode(AELatencyMode mode);
   void DrainSink();
   void UnconfigureSink();
   void Dispose();
@@ -321,6 +339,8 @@ protected:
   void DiscardStream(CActiveAEStream *stream);
   void SFlushStream(CActiveAEStream *stream);
   void FlushEngine();
+  void CreateZones();
+  void ConfigureZones();
   void ClearDiscardedBuffers();
   void SStopSound(CActiveAESound *sound);
   void DiscardSound(CActiveAESound *sound);
@@ -328,10 +348,18 @@ protected:
 
   bool RunStages();
   bool HasWork();
+  bool ReceiveStreamSamples();
+  bool HasStreamSamples();
+  void SignalStreamSample(CActiveAEStream* stream);
   CSampleBuffer* SyncStream(CActiveAEStream *stream);
 
   void ResampleSounds();
   bool ResampleSound(CActiveAESound *sound);
+  /*!
+   * \brief Fade and apply the volume of a stream to a buffer in place
+   * \param limitFloat limit per sample for a float sink, as done for the first stream of a mix
+   */
+  void ApplyStreamVolume(CActiveAEStream* stream, CSoundPacket& packet, bool limitFloat);
   void MixSounds(CSoundPacket &dstSample);
   void Deamplify(CSoundPacket &dstSample);
 
@@ -349,9 +377,12 @@ protected:
   XbmcThreads::EndTime<> m_extDrainTimer;
   std::chrono::milliseconds m_extKeepConfig;
   bool m_extDeferData;
+  // set while the engine thread sleeps, streams only signal new samples then
+  std::atomic_bool m_extWaitForData{false};
   std::queue<time_t> m_extLastDeviceChange;
   bool m_extSuspended = false;
   bool m_isWinSysReg = false;
+  AELatencyMode m_latencyMode = AELatencyMode::NORMAL;
 
   enum
   {
@@ -380,6 +411,9 @@ protected:
       m_silenceBuffers; // needed to drive gui sounds if we have no streams
   std::unique_ptr<CActiveAEBufferPool> m_encoderBuffers;
 
+  // outputs besides m_sink, each with its own mix, see CActiveAEZone
+  std::vector<std::unique_ptr<CActiveAEZone>> m_zones;
+
   // streams
   std::list<CActiveAEStream*> m_streams;
   std::list<std::unique_ptr<CActiveAEBufferPool>> m_discardBufferPools;
@@ -402,6 +436,9 @@ protected:
   // viz
   std::vector<IAudioCallback*> m_audioCallback;
   bool m_vizInitialized;
+  //! shared analysis, one of the audio callbacks while it has consumers
+  CAEVisualizationAnalyzer m_vizAnalyzer;
+  unsigned int m_vizConsumers = 0;
   CCriticalSection m_vizLock;
 
   // polled via the interface
@@ -160,7 +160,7 @@ bool CActiveAEBufferPoolResample::Create(
   if (m_inputFormat.m_channelLayout != m_format.m_channelLayout ||
       m_inputFormat.m_sampleRate != m_format.m_sampleRate ||
       m_inputFormat.m_dataFormat != m_format.m_dataFormat ||
-      m_changeResampler)
+      m_changeResampler || m_forceResampler)
   {
     ChangeResampler();
   }
@@ -170,6 +170,7 @@ bool CActiveAEBufferPoolResample::Create(
 void CActiveAEBufferPoolResample::ChangeResampler()
 {
   m_resampler = CAEResampleFactory::Create();
+  m_resamplerType = CAEResampleFactory::GetResampler();
 
   SampleConfig dstConfig, srcConfig;
   dstConfig.channel_layout = CAEUtil::GetAVChannelLayout(m_format.m_channelLayout);
@@ -364,6 +365,10 @@ void CActiveAEBufferPoolResample::ConfigureResampler(bool normalizelevels,
     m_changeResampler = true;
   }
 
+  // another implementation was selected
+  if (m_resampler && m_resamplerType != CAEResampleFactory::GetResampler())
+    m_changeResampler = true;
+
   m_resampleQuality = quality;
   m_normalize = normalize;
 }
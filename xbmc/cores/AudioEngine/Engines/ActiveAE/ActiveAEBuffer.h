@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "cores/AudioEngine/AEResampleFactory.h"
 #include "cores/AudioEngine/Utils/AEAudioFormat.h"
 #include "cores/AudioEngine/Interfaces/AE.h"
 #include <cmath>
@@ -115,6 +116,7 @@ protected:
   bool m_changeResampler = false;
   bool m_forceResampler = false;
   AEQuality m_resampleQuality;
+  AEResampler m_resamplerType = AEResampler::FFMPEG;
   bool m_stereoUpmix = false;
 };
 
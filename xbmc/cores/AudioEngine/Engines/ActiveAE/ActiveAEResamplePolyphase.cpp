@@ -0,0 +1,235 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ActiveAEResamplePolyphase.h"
+
+#include "ActiveAEResampleFFMPEG.h"
+#include "cores/AudioEngine/Utils/AEKernels.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+extern "C" {
+#include <libavutil/mathematics.h>
+#include <libavutil/samplefmt.h>
+}
+
+using namespace ActiveAE;
+
+namespace
+{
+
+bool IsFloat(AVSampleFormat fmt)
+{
+  return fmt == AV_SAMPLE_FMT_FLT || fmt == AV_SAMPLE_FMT_FLTP;
+}
+
+CAEPolyphaseResampler::Filter GetFilter(AEQuality quality)
+{
+  CAEPolyphaseResampler::Filter filter;
+  switch (quality)
+  {
+    case AE_QUALITY_LOW:
+      filter.taps = 16;
+      filter.cutoff = 0.8;
+      filter.beta = 6.0;
+      break;
+    case AE_QUALITY_HIGH:
+    case AE_QUALITY_REALLYHIGH:
+      filter.taps = 64;
+      filter.cutoff = 0.95;
+      filter.beta = 9.0;
+      break;
+    default:
+      filter.taps = 32;
+      filter.cutoff = 0.9;
+      filter.beta = 8.0;
+      break;
+  }
+  return filter;
+}
+
+} // namespace
+
+float** CActiveAEResamplePolyphase::CPlanes::Get(unsigned int channels, int samples)
+{
+  const size_t size = static_cast<size_t>(channels) * samples;
+  if (m_data.size() < size || m_planes.size() != channels)
+  {
+    m_data.resize(std::max(m_data.size(), size));
+    m_planes.resize(channels);
+  }
+
+  for (unsigned int ch = 0; ch < channels; ++ch)
+    m_planes[ch] = m_data.data() + static_cast<size_t>(ch) * samples;
+
+  return m_planes.data();
+}
+
+CActiveAEResamplePolyphase::CActiveAEResamplePolyphase() : m_kernels(CAEKernels::Get())
+{
+}
+
+CActiveAEResamplePolyphase::~CActiveAEResamplePolyphase() = default;
+
+bool CActiveAEResamplePolyphase::Init(SampleConfig dstConfig,
+                                      SampleConfig srcConfig,
+                                      bool upmix,
+                                      bool normalize,
+                                      double centerMix,
+                                      CAEChannelInfo* remapLayout,
+                                      AEQuality quality,
+                                      bool force_resample,
+                                      float sublevel)
+{
+  m_dstConfig = dstConfig;
+  m_srcConfig = srcConfig;
+
+  if (srcConfig.sample_rate == dstConfig.sample_rate && !force_resample)
+  {
+    m_convert = std::make_unique<CActiveAEResampleFFMPEG>();
+    return m_convert->Init(dstConfig, srcConfig, upmix, normalize, centerMix, remapLayout,
+                           quality, force_resample, sublevel);
+  }
+
+  // mix where there are fewer channels to filter
+  const bool mix = remapLayout || srcConfig.channels != dstConfig.channels ||
+                   srcConfig.channel_layout != dstConfig.channel_layout;
+  const bool mixBefore = mix && dstConfig.channels < srcConfig.channels;
+
+  SampleConfig filterConfig = mixBefore ? dstConfig : srcConfig;
+  filterConfig.fmt = AV_SAMPLE_FMT_FLTP;
+  filterConfig.bits_per_sample = 32;
+  filterConfig.dither_bits = 0;
+
+  if (mixBefore || !IsFloat(srcConfig.fmt))
+  {
+    SampleConfig config = filterConfig;
+    config.sample_rate = srcConfig.sample_rate;
+    m_preConvert = std::make_unique<CActiveAEResampleFFMPEG>();
+    if (!m_preConvert->Init(config, srcConfig, upmix && mixBefore, normalize, centerMix,
+                            mixBefore ? remapLayout : nullptr, quality, false,
+                            mixBefore ? sublevel : 0.0f))
+      return false;
+  }
+
+  if ((mix && !mixBefore) || !IsFloat(dstConfig.fmt))
+  {
+    SampleConfig config = filterConfig;
+    config.sample_rate = dstConfig.sample_rate;
+    m_postConvert = std::make_unique<CActiveAEResampleFFMPEG>();
+    if (!m_postConvert->Init(dstConfig, config, upmix && !mixBefore, normalize, centerMix,
+                             mixBefore ? nullptr : remapLayout, quality, false,
+                             mixBefore ? 0.0f : sublevel))
+      return false;
+  }
+
+  if (!m_resampler.Init(filterConfig.channels, srcConfig.sample_rate, dstConfig.sample_rate,
+                        GetFilter(quality)))
+  {
+    CLog::Log(LOGERROR, "CActiveAEResamplePolyphase::Init - invalid config");
+    return false;
+  }
+
+  CLog::Log(LOGDEBUG,
+            "CActiveAEResamplePolyphase::Init - {} -> {} Hz, {} channels, {} taps, {} phases{}",
+            srcConfig.sample_rate, dstConfig.sample_rate, filterConfig.channels,
+            m_resampler.GetTaps(), m_resampler.GetPhases(),
+            m_resampler.IsExact() ? "" : " interpolated");
+  return true;
+}
+
+int CActiveAEResamplePolyphase::Resample(
+    uint8_t** dst_buffer, int dst_samples, uint8_t** src_buffer, int src_samples, double ratio)
+{
+  if (m_convert)
+    return m_convert->Resample(dst_buffer, dst_samples, src_buffer, src_samples, ratio);
+
+  const unsigned int channels = m_resampler.GetChannels();
+
+  if (src_buffer && src_samples > 0)
+  {
+    if (m_preConvert)
+    {
+      float** planes = m_preBuffer.Get(channels, src_samples);
+      const int frames = m_preConvert->Resample(reinterpret_cast<uint8_t**>(planes), src_samples,
+                                                src_buffer, src_samples, 1.0);
+      if (frames < 0)
+        return -1;
+      m_resampler.Push(planes, frames);
+    }
+    else if (m_srcConfig.fmt == AV_SAMPLE_FMT_FLT)
+    {
+      float** planes = m_preBuffer.Get(channels, src_samples);
+      m_kernels.Deinterleave(planes, reinterpret_cast<const float*>(src_buffer[0]), channels,
+                             src_samples);
+      m_resampler.Push(planes, src_samples);
+    }
+    else
+      m_resampler.Push(reinterpret_cast<const float* const*>(src_buffer), src_samples);
+  }
+
+  if (dst_samples <= 0)
+    return 0;
+
+  const bool direct = !m_postConvert && m_dstConfig.fmt == AV_SAMPLE_FMT_FLTP;
+  float** planes =
+      direct ? reinterpret_cast<float**>(dst_buffer) : m_postBuffer.Get(channels, dst_samples);
+
+  unsigned int frames = m_resampler.Pull(planes, dst_samples, ratio);
+
+  // no input while draining, let the filter reach the last frame
+  if (!src_buffer && frames == 0 && m_resampler.GetDelay() > 0.0)
+  {
+    m_resampler.Flush();
+    frames = m_resampler.Pull(planes, dst_samples, ratio);
+  }
+
+  if (frames == 0 || direct)
+    return frames;
+
+  if (m_postConvert)
+    return m_postConvert->Resample(dst_buffer, dst_samples, reinterpret_cast<uint8_t**>(planes),
+                                   frames, 1.0);
+
+  m_kernels.Interleave(reinterpret_cast<float*>(dst_buffer[0]), planes, channels, frames);
+  return frames;
+}
+
+int64_t CActiveAEResamplePolyphase::GetDelay(int64_t base)
+{
+  if (m_convert)
+    return m_convert->GetDelay(base);
+
+  return std::llround(m_resampler.GetDelay() * base / m_srcConfig.sample_rate);
+}
+
+int CActiveAEResamplePolyphase::GetBufferedSamples()
+{
+  if (m_convert)
+    return m_convert->GetBufferedSamples();
+
+  return static_cast<int>(
+      std::ceil(m_resampler.GetDelay() * m_dstConfig.sample_rate / m_srcConfig.sample_rate));
+}
+
+int CActiveAEResamplePolyphase::CalcDstSampleCount(int src_samples, int dst_rate, int src_rate)
+{
+  return av_rescale_rnd(src_samples, dst_rate, src_rate, AV_ROUND_UP);
+}
+
+int CActiveAEResamplePolyphase::GetSrcBufferSize(int samples)
+{
+  return av_samples_get_buffer_size(nullptr, m_srcConfig.channels, samples, m_srcConfig.fmt, 1);
+}
+
+int CActiveAEResamplePolyphase::GetDstBufferSize(int samples)
+{
+  return av_samples_get_buffer_size(nullptr, m_dstConfig.channels, samples, m_dstConfig.fmt, 1);
+}
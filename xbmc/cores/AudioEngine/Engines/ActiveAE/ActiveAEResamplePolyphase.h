@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/AudioEngine/Interfaces/AE.h"
+#include "cores/AudioEngine/Interfaces/AEResample.h"
+#include "cores/AudioEngine/Utils/AEPolyphaseResampler.h"
+
+#include <memory>
+#include <vector>
+
+struct CAEKernels;
+
+namespace ActiveAE
+{
+
+class CActiveAEResampleFFMPEG;
+
+/*!
+ * \brief Resampler doing the rate conversion with CAEPolyphaseResampler.
+ *
+ * Sample format conversion and channel mixing are left to swresample, before the filter
+ * if that reduces the number of channels and after it otherwise. If neither the rate needs
+ * to be converted nor resampling is forced, everything is handed to swresample.
+ */
+class CActiveAEResamplePolyphase : public IAEResample
+{
+public:
+  const char* GetName() override { return "ActiveAEResamplePolyphase"; }
+  CActiveAEResamplePolyphase();
+  ~CActiveAEResamplePolyphase() override;
+  bool Init(SampleConfig dstConfig,
+            SampleConfig srcConfig,
+            bool upmix,
+            bool normalize,
+            double centerMix,
+            CAEChannelInfo* remapLayout,
+            AEQuality quality,
+            bool force_resample,
+            float sublevel) override;
+  int Resample(uint8_t** dst_buffer,
+               int dst_samples,
+               uint8_t** src_buffer,
+               int src_samples,
+               double ratio) override;
+  int64_t GetDelay(int64_t base) override;
+  int GetBufferedSamples() override;
+  bool WantsNewSamples(int samples) override { return GetBufferedSamples() <= samples * 2; }
+  int CalcDstSampleCount(int src_samples, int dst_rate, int src_rate) override;
+  int GetSrcBufferSize(int samples) override;
+  int GetDstBufferSize(int samples) override;
+
+protected:
+  class CPlanes
+  {
+  public:
+    float** Get(unsigned int channels, int samples);
+
+  private:
+    std::vector<float> m_data;
+    std::vector<float*> m_planes;
+  };
+
+  const CAEKernels& m_kernels;
+  SampleConfig m_srcConfig = {};
+  SampleConfig m_dstConfig = {};
+  CAEPolyphaseResampler m_resampler;
+  //! format and channel conversion at source rate
+  std::unique_ptr<CActiveAEResampleFFMPEG> m_preConvert;
+  //! format and channel conversion at destination rate
+  std::unique_ptr<CActiveAEResampleFFMPEG> m_postConvert;
+  //! everything, if no rate conversion is required
+  std::unique_ptr<CActiveAEResampleFFMPEG> m_convert;
+  CPlanes m_preBuffer;
+  CPlanes m_postBuffer;
+};
+
+}
@@ -39,6 +39,7 @@ CActiveAESettings::CActiveAESettings(CActiveAE &ae) : m_audioEngine(ae)
              CSettings::SETTING_AUDIOOUTPUT_PASSTHROUGH,
              CSettings::SETTING_AUDIOOUTPUT_CHANNELS,
              CSettings::SETTING_AUDIOOUTPUT_PROCESSQUALITY,
+             CSettings::SETTING_AUDIOOUTPUT_RESAMPLER,
              CSettings::SETTING_AUDIOOUTPUT_ATEMPOTHRESHOLD,
              CSettings::SETTING_AUDIOOUTPUT_GUISOUNDMODE,
              CSettings::SETTING_AUDIOOUTPUT_STEREOUPMIX,
@@ -52,6 +53,7 @@ CActiveAESettings::CActiveAESettings(CActiveAE &ae) : m_audioEngine(ae)
              CSettings::SETTING_AUDIOOUTPUT_PASSTHROUGHDEVICE,
              CSettings::SETTING_AUDIOOUTPUT_STREAMSILENCE,
              CSettings::SETTING_AUDIOOUTPUT_STREAMNOISE,
+             CSettings::SETTING_AUDIOOUTPUT_LOWLATENCY,
              CSettings::SETTING_AUDIOOUTPUT_MIXSUBLEVEL,
              CSettings::SETTING_AUDIOOUTPUT_MAINTAINORIGINALVOLUME,
              CSettings::SETTING_AUDIOOUTPUT_DTSHDCOREFALLBACK});
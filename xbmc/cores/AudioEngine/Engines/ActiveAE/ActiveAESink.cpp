@@ -259,6 +259,7 @@ void CActiveAESink::StateMachine(int signal, Protocol *port, Message *msg)
             m_requestedFormat = data->format;
             m_stats = data->stats;
             m_device = *(data->device);
+            SetLatencyMode(data->latencyMode);
           }
           m_extError = false;
           m_extSilenceTimer.Set(0ms);
@@ -896,6 +897,26 @@ void CActiveAESink::GetDeviceFriendlyName(const std::string& device)
   }
 }
 
+void CActiveAESink::SetLatencyMode(AELatencyMode mode)
+{
+  if (mode == m_latencyMode)
+    return;
+
+  m_latencyMode = mode;
+
+  // the sink thread has to keep the device fed with periods of a few ms
+  if (mode == AELatencyMode::LOW)
+  {
+    if (!SetRealtime(true))
+      SetPriority(ThreadPriority::HIGHEST);
+  }
+  else
+  {
+    SetRealtime(false);
+    SetPriority(ThreadPriority::ABOVE_NORMAL);
+  }
+}
+
 void CActiveAESink::OpenSink()
 {
   bool passthrough = (m_requestedFormat.m_dataFormat == AE_FMT_RAW);
@@ -935,6 +956,7 @@ void CActiveAESink::OpenSink()
   // WARNING: this changes format and does not use passthrough
   m_sinkFormat = m_requestedFormat;
   CLog::Log(LOGDEBUG, "CActiveAESink::OpenSink - trying to open device {}", device);
+  CAESinkFactory::SetLatencyMode(m_latencyMode);
   m_sink = CAESinkFactory::Create(device, m_sinkFormat);
 
   // try first device in out list
@@ -1030,46 +1052,45 @@ unsigned int CActiveAESink::OutputSamples(CSampleBuffer* samples)
 
   if (m_requestedFormat.m_dataFormat == AE_FMT_RAW)
   {
-    bool skipSwap = false;
     if (m_needIecPack)
     {
+      if (m_swapState == CHECK_SWAP)
+        SwapInit(samples);
+
+      bool swap = (m_swapState == NEED_BYTESWAP);
+      packBuffer = m_packer->GetBuffer();
+
       if (frames > 0)
       {
         m_packer->Reset();
-        m_packer->Pack(m_sinkFormat.m_streamInfo, buffer[0], frames);
+        // buffers of the stream pools are ours until returned, pack TrueHD right there
+        // in sink byte order instead of copying and swapping the large MAT frames
+        if (samples->pool &&
+            m_packer->PackInPlace(m_sinkFormat.m_streamInfo, buffer[0], frames, swap))
+        {
+          packBuffer = buffer[0];
+          swap = false;
+        }
+        else
+          m_packer->Pack(m_sinkFormat.m_streamInfo, buffer[0], frames);
       }
       else if (samples->pkt->pause_burst_ms > 0)
       {
         // construct a pause burst if we have already output valid audio
-        bool burst = m_extStreaming && (m_packer->GetBuffer()[0] != 0);
+        bool burst = m_extStreaming && m_packer->HasBurst();
         if (!m_packer->PackPause(m_sinkFormat.m_streamInfo, samples->pkt->pause_burst_ms, burst))
-          skipSwap = true;
+          swap = false;
       }
       else
         m_packer->Reset();
 
       unsigned int size = m_packer->GetSize();
-      packBuffer = m_packer->GetBuffer();
       buffer = &packBuffer;
       totalFrames = size / m_sinkFormat.m_frameSize;
       frames = totalFrames;
 
-      switch(m_swapState)
-      {
-        case SKIP_SWAP:
-          break;
-        case NEED_BYTESWAP:
-          if (!skipSwap)
-            Endian_Swap16_buf((uint16_t *)buffer[0], (uint16_t *)buffer[0], size / 2);
-          break;
-        case CHECK_SWAP:
-          SwapInit(samples);
-          if (m_swapState == NEED_BYTESWAP)
-            Endian_Swap16_buf((uint16_t *)buffer[0], (uint16_t *)buffer[0], size / 2);
-          break;
-        default:
-          break;
-      }
+      if (swap)
+        Endian_Swap16_buf((uint16_t*)buffer[0], (uint16_t*)buffer[0], size / 2);
     }
     else // Android IEC packer (RAW)
     {
@@ -33,6 +33,7 @@ struct SinkConfig
   AEAudioFormat format;
   CEngineStats *stats;
   const std::string *device;
+  AELatencyMode latencyMode;
 };
 
 struct SinkReply
@@ -114,6 +115,7 @@ protected:
   void PrintSinks(std::string& driver);
   void GetDeviceFriendlyName(const std::string& device);
   void OpenSink();
+  void SetLatencyMode(AELatencyMode mode);
   void ReturnBuffers();
   void SetSilenceTimer();
   bool NeedIECPacking();
@@ -155,6 +157,7 @@ protected:
   std::unique_ptr<CAEBitstreamPacker> m_packer;
   bool m_needIecPack{false};
   bool m_streamNoise;
+  AELatencyMode m_latencyMode = AELatencyMode::NORMAL;
 };
 
 }
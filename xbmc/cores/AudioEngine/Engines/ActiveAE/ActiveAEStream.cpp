@@ -54,22 +54,62 @@ CActiveAEStream::CActiveAEStream(AEAudioFormat* format, unsigned int streamid, C
 
 void CActiveAEStream::IncFreeBuffers()
 {
-  std::unique_lock lock(m_streamLock);
   m_streamFreeBuffers++;
 }
 
 void CActiveAEStream::DecFreeBuffers()
 {
-  std::unique_lock lock(m_streamLock);
   m_streamFreeBuffers--;
 }
 
 void CActiveAEStream::ResetFreeBuffers()
 {
-  std::unique_lock lock(m_streamLock);
   m_streamFreeBuffers = 0;
 }
 
+int64_t CActiveAEStream::GetDurationUs(const CSampleBuffer* buffer) const
+{
+  if (m_format.m_dataFormat == AE_FMT_RAW)
+    return buffer->pkt->nb_samples ? static_cast<int64_t>(m_format.m_streamInfo.GetDuration() * 1000)
+                                   : 0;
+
+  return static_cast<int64_t>(buffer->pkt->nb_samples) * 1000000 / buffer->pkt->config.sample_rate;
+}
+
+void CActiveAEStream::SendSample(CSampleBuffer* buffer)
+{
+  m_queuedTime += GetDurationUs(buffer);
+
+  // can't overflow, we never hold more buffers than the queue has room for
+  m_sampleQueue.Push(buffer);
+  m_activeAE->SignalStreamSample(this);
+}
+
+bool CActiveAEStream::WaitForBuffer(std::chrono::milliseconds timeout)
+{
+  // the engine only signals free buffers if we announced to wait. Check again after the
+  // announcement, a buffer may have been queued in between.
+  m_waitForBuffer = true;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!m_bufferQueue.Empty())
+  {
+    m_waitForBuffer = false;
+    return true;
+  }
+
+  const bool signaled = m_inMsgEvent.Wait(timeout);
+  m_waitForBuffer = false;
+  return signaled;
+}
+
+void CActiveAEStream::SignalFreeBuffers()
+{
+  // pairs with the fence in WaitForBuffer()
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_waitForBuffer.exchange(false))
+    m_inMsgEvent.Set();
+}
+
 void CActiveAEStream::InitRemapper()
 {
   // check if input format follows ffmpeg channel mask
@@ -220,7 +260,7 @@ unsigned int CActiveAEStream::GetSpace()
 
 unsigned int CActiveAEStream::AddData(const uint8_t* const *data, unsigned int offset, unsigned int frames, ExtData *extData)
 {
-  Message *msg;
+  CSampleBuffer* buffer;
   unsigned int copied = 0;
   int sourceFrames = frames;
   const uint8_t* const *buf = data;
@@ -302,35 +342,22 @@ unsigned int CActiveAEStream::AddData(const uint8_t* const *data, unsigned int o
 
       if (m_currentBuffer->pkt->nb_samples == m_currentBuffer->pkt->max_nb_samples || rawPktComplete)
       {
-        MsgStreamSample msgData;
-        msgData.buffer = m_currentBuffer;
-        msgData.stream = this;
         RemapBuffer();
-        m_streamPort->SendOutMessage(CActiveAEDataProtocol::STREAMSAMPLE, &msgData, sizeof(MsgStreamSample));
+        SendSample(m_currentBuffer);
         m_currentBuffer = nullptr;
       }
       continue;
     }
-    else if (m_streamPort->ReceiveInMessage(&msg))
+    else if (m_bufferQueue.Pop(buffer))
     {
-      if (msg->signal == CActiveAEDataProtocol::STREAMBUFFER)
-      {
-        m_currentBuffer = *((CSampleBuffer**)msg->data);
-        m_currentBuffer->timestamp = 0;
-        m_currentBuffer->pkt->nb_samples = 0;
-        m_currentBuffer->pkt->pause_burst_ms = 0;
-        msg->Release();
-        DecFreeBuffers();
-        continue;
-      }
-      else
-      {
-        CLog::Log(LOGERROR, "CActiveAEStream::AddData - unknown signal");
-        msg->Release();
-        break;
-      }
+      m_currentBuffer = buffer;
+      m_currentBuffer->timestamp = 0;
+      m_currentBuffer->pkt->nb_samples = 0;
+      m_currentBuffer->pkt->pause_burst_ms = 0;
+      DecFreeBuffers();
+      continue;
     }
-    if (!m_inMsgEvent.Wait(200ms))
+    if (!WaitForBuffer(200ms))
       break;
   }
   return copied;
@@ -350,6 +377,11 @@ CAESyncInfo CActiveAEStream::GetSyncInfo()
   return info;
 }
 
+CAEStreamLatency CActiveAEStream::GetLatency()
+{
+  return m_activeAE->GetStreamLatency(this);
+}
+
 bool CActiveAEStream::IsBuffering()
 {
   std::unique_lock lock(m_streamLock);
@@ -384,11 +416,16 @@ void CActiveAEStream::Resume()
 void CActiveAEStream::Drain(bool wait)
 {
   Message *msg;
+  CSampleBuffer* buffer;
   CActiveAEStream *stream = this;
 
   m_streamDraining = true;
   m_streamDrained = false;
 
+  // drop the drained signal of an earlier drain which was not waited for
+  while (m_streamPort->ReceiveInMessage(&msg))
+    msg->Release();
+
   Message *reply;
   if (m_streamPort->SendOutMessageSync(CActiveAEDataProtocol::DRAINSTREAM, &reply, 2s, &stream,
                                        sizeof(CActiveAEStream*)))
@@ -403,11 +440,8 @@ void CActiveAEStream::Drain(bool wait)
 
   if (m_currentBuffer)
   {
-    MsgStreamSample msgData;
-    msgData.buffer = m_currentBuffer;
-    msgData.stream = this;
     RemapBuffer();
-    m_streamPort->SendOutMessage(CActiveAEDataProtocol::STREAMSAMPLE, &msgData, sizeof(MsgStreamSample));
+    SendSample(m_currentBuffer);
     m_currentBuffer = NULL;
   }
 
@@ -417,27 +451,26 @@ void CActiveAEStream::Drain(bool wait)
   XbmcThreads::EndTime<> timer(2000ms);
   while (!timer.IsTimePast())
   {
-    if (m_streamPort->ReceiveInMessage(&msg))
+    // hand back free buffers unused, the engine returns them to the pool
+    if (m_bufferQueue.Pop(buffer))
     {
-      if (msg->signal == CActiveAEDataProtocol::STREAMBUFFER)
-      {
-        MsgStreamSample msgData;
-        msgData.stream = this;
-        msgData.buffer = *((CSampleBuffer**)msg->data);
-        msg->Reply(CActiveAEDataProtocol::STREAMSAMPLE, &msgData, sizeof(MsgStreamSample));
-        DecFreeBuffers();
-        continue;
-      }
-      else if (msg->signal == CActiveAEDataProtocol::STREAMDRAINED)
-      {
-        msg->Release();
+      buffer->pkt->nb_samples = 0;
+      SendSample(buffer);
+      DecFreeBuffers();
+      continue;
+    }
+    else if (m_streamPort->ReceiveInMessage(&msg))
+    {
+      const bool drained = msg->signal == CActiveAEDataProtocol::STREAMDRAINED;
+      msg->Release();
+      if (drained)
         return;
-      }
+      continue;
     }
     else if (!wait)
       return;
 
-    m_inMsgEvent.Wait(timer.GetTimeLeft());
+    WaitForBuffer(timer.GetTimeLeft());
   }
   CLog::Log(LOGERROR, "CActiveAEStream::Drain - timeout out");
 }
@@ -522,6 +555,11 @@ void CActiveAEStream::SetFFmpegInfo(int profile, enum AVMatrixEncoding matrix_en
   m_activeAE->SetStreamFFmpegInfo(this, profile, matrix_encoding, audio_service_type);
 }
 
+void CActiveAEStream::SetZones(unsigned int zones)
+{
+  m_activeAE->SetStreamZones(this, zones);
+}
+
 void CActiveAEStream::FadeVolume(float from, float target, unsigned int time)
 {
   if (time == 0 || (m_format.m_dataFormat == AE_FMT_RAW))
@@ -581,7 +619,8 @@ CActiveAEStreamBuffers::CActiveAEStreamBuffers(const AEAudioFormat& inputFormat,
   : m_inputFormat(inputFormat),
     m_resampleBuffers(
         std::make_unique<CActiveAEBufferPoolResample>(inputFormat, outputFormat, quality)),
-    m_atempoBuffers(std::make_unique<CActiveAEBufferPoolAtempo>(outputFormat))
+    m_atempoBuffers(std::make_unique<CActiveAEBufferPoolAtempo>(outputFormat)),
+    m_passthrough(inputFormat.m_dataFormat == AE_FMT_RAW)
 {
 }
 
@@ -604,6 +643,9 @@ bool CActiveAEStreamBuffers::Create(
   if (!m_resampleBuffers->Create(totaltime, remap, upmix, normalize, sublevel))
     return false;
 
+  if (m_passthrough)
+    return true;
+
   if (!m_atempoBuffers->Create(totaltime))
     return false;
 
@@ -620,6 +662,14 @@ bool CActiveAEStreamBuffers::ProcessBuffers()
   bool busy = false;
   CSampleBuffer *buf;
 
+  if (m_passthrough)
+  {
+    busy = !m_inputSamples.empty();
+    m_outputSamples.insert(m_outputSamples.end(), m_inputSamples.begin(), m_inputSamples.end());
+    m_inputSamples.clear();
+    return busy;
+  }
+
   while (!m_inputSamples.empty())
   {
     buf = m_inputSamples.front();
@@ -668,8 +718,11 @@ float CActiveAEStreamBuffers::GetDelay()
     delay += (float)buf->pkt->nb_samples / buf->pkt->config.sample_rate;
   }
 
-  delay += m_resampleBuffers->GetDelay();
-  delay += m_atempoBuffers->GetDelay();
+  if (!m_passthrough)
+  {
+    delay += m_resampleBuffers->GetDelay();
+    delay += m_atempoBuffers->GetDelay();
+  }
 
   for (auto &buf : m_outputSamples)
   {
@@ -717,6 +770,9 @@ bool CActiveAEStreamBuffers::IsDrained()
 
 void CActiveAEStreamBuffers::SetRR(double rr, double atempoThreshold)
 {
+  if (m_passthrough)
+    return;
+
   if (fabs(rr - 1.0) < atempoThreshold)
   {
     m_resampleBuffers->SetRR(rr);
@@ -14,6 +14,7 @@
 #include "cores/AudioEngine/Utils/AEAudioFormat.h"
 #include "cores/AudioEngine/Utils/AELimiter.h"
 #include "threads/Event.h"
+#include "threads/SPSCQueue.h"
 
 #include <atomic>
 #include <deque>
@@ -126,6 +127,9 @@ protected:
   std::unique_ptr<CActiveAEBufferPoolResample> m_resampleBuffers;
   std::unique_ptr<CActiveAEBufferPoolAtempo> m_atempoBuffers;
 
+  // bitstreams can't be resampled or stretched, they bypass both stages
+  bool m_passthrough;
+
 private:
   CActiveAEStreamBuffers(const CActiveAEStreamBuffers&) = delete;
   CActiveAEStreamBuffers& operator=(const CActiveAEStreamBuffers&) = delete;
@@ -142,6 +146,10 @@ protected:
   void IncFreeBuffers();
   void DecFreeBuffers();
   void ResetFreeBuffers();
+  void SendSample(CSampleBuffer* buffer);
+  bool WaitForBuffer(std::chrono::milliseconds timeout);
+  void SignalFreeBuffers();
+  int64_t GetDurationUs(const CSampleBuffer* buffer) const;
   void InitRemapper();
   void RemapBuffer();
   double CalcResampleRatio(double error);
@@ -152,6 +160,7 @@ public:
   unsigned int AddData(const uint8_t* const *data, unsigned int offset, unsigned int frames, ExtData *extData) override;
   double GetDelay() override;
   CAESyncInfo GetSyncInfo() override;
+  CAEStreamLatency GetLatency() override;
   bool IsBuffering() override;
   double GetCacheTime() override;
   double GetCacheTotal() override;
@@ -185,6 +194,7 @@ public:
   void UnRegisterAudioCallback() override;
   void FadeVolume(float from, float to, unsigned int time) override;
   bool IsFading() override;
+  void SetZones(unsigned int zones) override;
   void RegisterSlave(IAEStream *stream) override;
 
 protected:
@@ -201,7 +211,7 @@ protected:
   bool m_streamDraining;
   bool m_streamDrained;
   bool m_streamFading;
-  int m_streamFreeBuffers;
+  std::atomic_int m_streamFreeBuffers;
   bool m_streamIsBuffering;
   bool m_streamIsFlushed;
   IAEStream *m_streamSlave;
@@ -215,6 +225,16 @@ protected:
   double m_lastPtsJump;
   std::chrono::milliseconds m_errorInterval{1000};
 
+  // sample buffers are exchanged with the engine without locks, free ones from the engine
+  // in m_bufferQueue and filled ones back in m_sampleQueue. The engine never hands out more
+  // buffers than fit into a queue.
+  static constexpr size_t QUEUE_SIZE = 256;
+  CSPSCQueue<CSampleBuffer*> m_bufferQueue{QUEUE_SIZE};
+  CSPSCQueue<CSampleBuffer*> m_sampleQueue{QUEUE_SIZE};
+  std::atomic_bool m_waitForBuffer{false};
+  std::atomic<int64_t> m_queuedTime{0};
+  std::atomic_uint m_engineWakeups{0};
+
   // only accessed by engine
   std::unique_ptr<CActiveAEBufferPool> m_inputBuffers;
   std::unique_ptr<CActiveAEStreamBuffers> m_processingBuffers;
@@ -244,6 +264,9 @@ protected:
   CSyncError m_syncError;
   double m_lastSyncError;
   CAESyncInfo::AESyncState m_syncState;
+  //! zones the stream is heard in, the audio device is MAIN_ZONE
+  static constexpr unsigned int MAIN_ZONE = 1;
+  unsigned int m_zones = MAIN_ZONE;
 };
 }
 
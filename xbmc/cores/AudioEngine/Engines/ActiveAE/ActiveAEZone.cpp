@@ -0,0 +1,389 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ActiveAEZone.h"
+
+#include "cores/AudioEngine/Utils/AEKernels.h"
+#include "cores/AudioEngine/Utils/AELatencyProfile.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace ActiveAE;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+
+// audio a zone may hold in each of its pools, enough to line up with any main sink
+constexpr unsigned int BUFFER_MS = 1000;
+
+// controller gains, the error is in seconds and the integral runs once per mixed period
+constexpr double PROPORTIONAL = 0.1;
+constexpr double INTEGRAL = 0.001;
+
+bool SameFormat(const AEAudioFormat& lhs, const AEAudioFormat& rhs)
+{
+  return lhs.m_dataFormat == rhs.m_dataFormat && lhs.m_sampleRate == rhs.m_sampleRate &&
+         lhs.m_channelLayout == rhs.m_channelLayout && lhs.m_frames == rhs.m_frames;
+}
+
+} // namespace
+
+CActiveAEZoneClock::Action CActiveAEZoneClock::Update(double error)
+{
+  // start as far behind as the main sink is
+  if (!m_synced)
+  {
+    m_synced = true;
+    m_integral = 0.0;
+    m_ratio = 1.0;
+    return Action::PREFILL;
+  }
+
+  if (std::abs(error) > MAX_ERROR)
+  {
+    Reset();
+    return Action::RESYNC;
+  }
+
+  // a zone with more queued than the main sink has to play faster, i.e. produce fewer samples
+  m_integral = std::clamp(m_integral + error * INTEGRAL, -MAX_CORRECTION, MAX_CORRECTION);
+  const double correction = error * PROPORTIONAL + m_integral;
+  m_ratio = 1.0 - std::clamp(correction, -MAX_CORRECTION, MAX_CORRECTION);
+  return Action::CORRECT;
+}
+
+void CActiveAEZoneClock::Reset()
+{
+  m_synced = false;
+  m_integral = 0.0;
+  m_ratio = 1.0;
+}
+
+void CActiveAEZoneMixer::Configure(const AEAudioFormat& format)
+{
+  Flush();
+  m_buffers = std::make_unique<CActiveAEBufferPool>(format);
+  m_buffers->Create(BUFFER_MS);
+}
+
+std::unique_ptr<CActiveAEBufferPool> CActiveAEZoneMixer::Release()
+{
+  Flush();
+  return std::move(m_buffers);
+}
+
+void CActiveAEZoneMixer::Flush()
+{
+  if (m_mix)
+  {
+    m_mix->Return();
+    m_mix = nullptr;
+  }
+}
+
+void CActiveAEZoneMixer::AddSamples(const CSampleBuffer* buffer)
+{
+  if (!m_buffers)
+    return;
+
+  const CSoundPacket& src = *buffer->pkt;
+  if (!m_mix)
+  {
+    if (m_buffers->m_freeSamples.empty())
+    {
+      CLog::Log(LOGWARNING, "CActiveAEZoneMixer::{} - ran out of buffers", __func__);
+      return;
+    }
+
+    m_mix = m_buffers->GetFreeBuffer();
+    m_mix->timestamp = 0;
+    m_mix->pkt_start_offset = 0;
+    m_mix->pkt->nb_samples = std::min(src.nb_samples, m_mix->pkt->max_nb_samples);
+    const int bytes =
+        m_mix->pkt->nb_samples * src.config.channels / src.planes * src.bytes_per_sample;
+    for (int i = 0; i < m_mix->pkt->planes && i < src.planes; i++)
+      std::memcpy(m_mix->pkt->data[i], src.data[i], bytes);
+    m_needClamp = false;
+    return;
+  }
+
+  const CAEKernels& kernels = CAEKernels::Get();
+  const int samples = std::min(src.nb_samples, m_mix->pkt->nb_samples);
+  const int nb_floats = samples * src.config.channels / src.planes;
+  for (int i = 0; i < m_mix->pkt->planes && i < src.planes; i++)
+  {
+    float* dst = reinterpret_cast<float*>(m_mix->pkt->data[i]);
+    kernels.MulAddArray(dst, reinterpret_cast<const float*>(src.data[i]), 1.0f, nb_floats);
+    if (!m_needClamp && kernels.PeakArray(dst, nb_floats) > 1.0f)
+      m_needClamp = true;
+  }
+}
+
+CSampleBuffer* CActiveAEZoneMixer::TakeMix(int samples)
+{
+  CSampleBuffer* mix = m_mix;
+  m_mix = nullptr;
+
+  // the zone keeps pace with the main sink even while none of its streams play
+  if (!mix)
+    return GetSilence(samples);
+
+  if (m_needClamp)
+  {
+    const int nb_floats = mix->pkt->nb_samples * mix->pkt->config.channels / mix->pkt->planes;
+    for (int i = 0; i < mix->pkt->planes; i++)
+      CAEKernels::Get().SoftClipArray(reinterpret_cast<float*>(mix->pkt->data[i]), nb_floats);
+  }
+  return mix;
+}
+
+CSampleBuffer* CActiveAEZoneMixer::GetSilence(int samples)
+{
+  if (!m_buffers || m_buffers->m_freeSamples.empty())
+    return nullptr;
+
+  CSampleBuffer* silence = m_buffers->GetFreeBuffer();
+  silence->timestamp = 0;
+  silence->pkt_start_offset = 0;
+  for (int i = 0; i < silence->pkt->planes; i++)
+    std::memset(silence->pkt->data[i], 0, silence->pkt->linesize);
+  silence->pkt->nb_samples = std::min(samples, silence->pkt->max_nb_samples);
+  return silence;
+}
+
+CActiveAEZone::CActiveAEZone(unsigned int index, std::string device, CEvent* inMsgEvent)
+  : m_index(index), m_device(std::move(device)), m_sink(inMsgEvent)
+{
+  m_stats.Reset(44100, true);
+}
+
+CActiveAEZone::~CActiveAEZone()
+{
+  Dispose();
+}
+
+void CActiveAEZone::Start()
+{
+  m_sink.EnumerateSinkList(false, "");
+  m_sink.Start();
+}
+
+void CActiveAEZone::Dispose()
+{
+  m_mixer.Flush();
+  if (m_sinkBuffers)
+    m_sinkBuffers->Flush();
+  m_sink.Dispose();
+}
+
+bool CActiveAEZone::Configure(const AEAudioFormat& internalFormat,
+                              AEQuality quality,
+                              AELatencyMode latencyMode,
+                              float volume,
+                              std::list<std::unique_ptr<CActiveAEBufferPool>>& discarded)
+{
+  if (IsConfigured() && SameFormat(m_internalFormat, internalFormat))
+    return true;
+
+  Unconfigure(discarded);
+
+  SinkConfig config;
+  config.format = internalFormat;
+  config.stats = &m_stats;
+  config.device = &m_device;
+  config.latencyMode = latencyMode;
+
+  Message* reply;
+  if (!m_sink.m_controlPort.SendOutMessageSync(CSinkControlProtocol::CONFIGURE, &reply, 5s,
+                                               &config, sizeof(config)))
+  {
+    CLog::Log(LOGERROR, "CActiveAEZone::{} - zone {} failed to open {}", __func__, m_index,
+              m_device);
+    return false;
+  }
+
+  const bool success = reply->signal == CSinkControlProtocol::ACC;
+  const SinkReply* data = reinterpret_cast<SinkReply*>(reply->data);
+  if (success && data)
+  {
+    m_sinkFormat = data->format;
+    m_hasVolume = data->hasVolume;
+    m_stats.SetSinkCacheTotal(data->cacheTotal);
+    m_stats.SetSinkLatency(data->latency);
+  }
+  reply->Release();
+  if (!success || !data)
+  {
+    CLog::Log(LOGERROR, "CActiveAEZone::{} - zone {} returned error for {}", __func__, m_index,
+              m_device);
+    return false;
+  }
+
+  // limit buffer size in case of sink returns large buffer, like the main sink
+  const double maxBufferTime = AELatencyProfile::Get(latencyMode).maxPeriod;
+  if (static_cast<double>(m_sinkFormat.m_frames) / m_sinkFormat.m_sampleRate > maxBufferTime)
+    m_sinkFormat.m_frames = static_cast<unsigned int>(maxBufferTime * m_sinkFormat.m_sampleRate);
+
+  m_stats.SetCurrentSinkFormat(m_sinkFormat);
+  m_stats.SetLatencyMode(latencyMode);
+  m_stats.Reset(m_sinkFormat.m_sampleRate, true);
+  m_sink.m_controlPort.SendOutMessage(CSinkControlProtocol::VOLUME, &volume, sizeof(float));
+
+  m_internalFormat = internalFormat;
+  m_mixer.Configure(m_internalFormat);
+
+  // always resample, even to the same format, the ratio is what keeps the zone in time
+  m_sinkBuffers =
+      std::make_unique<CActiveAEBufferPoolResample>(m_internalFormat, m_sinkFormat, quality);
+  m_sinkBuffers->ForceResampler(true);
+  m_sinkBuffers->Create(BUFFER_MS, true, false);
+
+  m_clock.Reset();
+
+  CLog::Log(LOGINFO, "CActiveAEZone::{} - zone {} playing on {}, {} Hz", __func__, m_index,
+            m_device, m_sinkFormat.m_sampleRate);
+  return true;
+}
+
+void CActiveAEZone::Unconfigure(std::list<std::unique_ptr<CActiveAEBufferPool>>& discarded)
+{
+  if (!IsConfigured())
+    return;
+
+  m_mixer.Flush();
+  m_sinkBuffers->Flush();
+
+  Message* reply;
+  if (m_sink.m_controlPort.SendOutMessageSync(CSinkControlProtocol::UNCONFIGURE, &reply, 2s))
+    reply->Release();
+  else
+    CLog::Log(LOGERROR, "CActiveAEZone::{} - zone {} failed to close", __func__, m_index);
+
+  // the sink hands back what it still holds later on
+  discarded.push_back(m_mixer.Release());
+  discarded.push_back(std::move(m_sinkBuffers));
+}
+
+void CActiveAEZone::SetVolume(float volume)
+{
+  m_sink.m_controlPort.SendOutMessage(CSinkControlProtocol::VOLUME, &volume, sizeof(float));
+}
+
+void CActiveAEZone::SetStreaming(bool streaming)
+{
+  m_sink.m_controlPort.SendOutMessage(CSinkControlProtocol::STREAMING, &streaming, sizeof(bool));
+}
+
+void CActiveAEZone::Flush()
+{
+  m_mixer.Flush();
+  if (!IsConfigured())
+    return;
+
+  m_sinkBuffers->Flush();
+
+  Message* reply;
+  if (m_sink.m_controlPort.SendOutMessageSync(CSinkControlProtocol::FLUSH, &reply, 2s))
+    reply->Release();
+  else
+    CLog::Log(LOGERROR, "CActiveAEZone::{} - zone {} failed to flush", __func__, m_index);
+
+  m_stats.Reset(m_sinkFormat.m_sampleRate, true);
+  m_clock.Reset();
+}
+
+void CActiveAEZone::AddSamples(const CSampleBuffer* buffer)
+{
+  m_mixer.AddSamples(buffer);
+}
+
+CSampleBuffer* CActiveAEZone::TakeMix(int samples)
+{
+  return m_mixer.TakeMix(samples);
+}
+
+void CActiveAEZone::Output(CSampleBuffer* mix, double targetDelay)
+{
+  if (!m_sinkBuffers)
+  {
+    mix->Return();
+    return;
+  }
+
+  m_sinkBuffers->m_inputSamples.push_back(mix);
+
+  AEDelayStatus status;
+  m_stats.GetDelay(status);
+  const double error = status.GetDelay() + m_sinkBuffers->GetDelay() - targetDelay;
+
+  switch (m_clock.Update(error))
+  {
+    case CActiveAEZoneClock::Action::PREFILL:
+      if (error < 0.0)
+        Prefill(-error);
+      break;
+    case CActiveAEZoneClock::Action::RESYNC:
+      CLog::Log(LOGWARNING, "CActiveAEZone::{} - zone {} is {:.0f} ms off, resyncing", __func__,
+                m_index, error * 1000);
+      Flush();
+      return;
+    case CActiveAEZoneClock::Action::CORRECT:
+      break;
+  }
+
+  m_sinkBuffers->SetRR(m_clock.GetRatio());
+}
+
+bool CActiveAEZone::ProcessBuffers()
+{
+  if (!m_sinkBuffers)
+    return false;
+
+  bool busy = m_sinkBuffers->ResampleBuffers();
+  while (!m_sinkBuffers->m_outputSamples.empty())
+  {
+    CSampleBuffer* out = m_sinkBuffers->m_outputSamples.front();
+    m_sinkBuffers->m_outputSamples.pop_front();
+    m_stats.AddSamples(out->pkt->nb_samples, {});
+    m_sink.m_dataPort.SendOutMessage(CSinkDataProtocol::SAMPLE, &out, sizeof(CSampleBuffer*));
+    busy = true;
+  }
+  return busy;
+}
+
+bool CActiveAEZone::ReceiveSinkMessage()
+{
+  Message* msg = nullptr;
+  if (!m_sink.m_dataPort.ReceiveInMessage(&msg))
+    return false;
+
+  if (msg->signal == CSinkDataProtocol::RETURNSAMPLE)
+  {
+    CSampleBuffer** buffer = reinterpret_cast<CSampleBuffer**>(msg->data);
+    if (buffer)
+      (*buffer)->Return();
+  }
+  msg->Release();
+  return true;
+}
+
+void CActiveAEZone::Prefill(double seconds)
+{
+  int samples = static_cast<int>(seconds * m_internalFormat.m_sampleRate);
+  CSampleBuffer* silence;
+  while (samples > 0 && (silence = m_mixer.GetSilence(samples)))
+  {
+    samples -= silence->pkt->nb_samples;
+    m_sinkBuffers->m_inputSamples.push_front(silence);
+  }
+}
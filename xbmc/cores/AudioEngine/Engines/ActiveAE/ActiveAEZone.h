@@ -0,0 +1,179 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "ActiveAE.h"
+#include "ActiveAESink.h"
+
+#include <list>
+#include <memory>
+#include <string>
+
+namespace ActiveAE
+{
+
+/*!
+ * \brief Keeps the delay of a zone equal to the delay of the main sink
+ *
+ * A PI controller on the resample ratio of the zone, fed once per mixed period. The first
+ * error lines the zone up with silence, an error beyond MAX_ERROR has the zone flushed and
+ * lined up again instead of corrected.
+ */
+class CActiveAEZoneClock
+{
+public:
+  //! the zone plays at most this much faster or slower than its device clock
+  static constexpr double MAX_CORRECTION = 0.005;
+  //! error in seconds beyond which the zone is lined up again
+  static constexpr double MAX_ERROR = 0.5;
+
+  enum class Action
+  {
+    PREFILL, //!< the zone starts, queue silence for a negative error
+    CORRECT, //!< play at GetRatio()
+    RESYNC, //!< flush the zone, the next update lines it up again
+  };
+
+  /*!
+   * \brief Feed the error of a mixed period
+   * \param error delay of the zone minus the delay of the main sink in seconds
+   */
+  Action Update(double error);
+  void Reset();
+
+  //! resample ratio to play at, below 1.0 if the zone is behind the main sink
+  double GetRatio() const { return m_ratio; }
+
+private:
+  bool m_synced = false;
+  double m_integral = 0.0;
+  double m_ratio = 1.0;
+};
+
+/*!
+ * \brief Mixes the streams of a zone into one buffer per mixed period
+ */
+class CActiveAEZoneMixer
+{
+public:
+  void Configure(const AEAudioFormat& format);
+  //! the pool of the mixes, may still be out at the sink
+  std::unique_ptr<CActiveAEBufferPool> Release();
+  bool IsConfigured() const { return m_buffers != nullptr; }
+  void Flush();
+
+  /*!
+   * \brief Mix a stream buffer of this cycle, its volume is applied already
+   */
+  void AddSamples(const CSampleBuffer* buffer);
+
+  /*!
+   * \brief Mix of this cycle, silence if no stream played
+   * \param samples length of the cycle in frames
+   * \return nullptr if all buffers are out
+   */
+  CSampleBuffer* TakeMix(int samples);
+
+  /*!
+   * \brief Buffer of silence
+   * \param samples frames wanted, the buffer may hold less
+   */
+  CSampleBuffer* GetSilence(int samples);
+
+private:
+  std::unique_ptr<CActiveAEBufferPool> m_buffers;
+  CSampleBuffer* m_mix = nullptr;
+  bool m_needClamp = false;
+};
+
+/*!
+ * \brief An output of the engine besides the audio device, e.g. the speakers of another room
+ *
+ * Streams are decoded and resampled once, the engine hands their buffers to every zone they
+ * are routed to. A zone mixes them into buffers of its own and feeds its own sink, running in
+ * the clock domain of that device. The main sink stays the master clock: the delay of a zone
+ * is kept equal to the delay of the main sink by slightly resampling what it plays, so all
+ * rooms hear the same moment.
+ */
+class CActiveAEZone
+{
+public:
+  CActiveAEZone(unsigned int index, std::string device, CEvent* inMsgEvent);
+  ~CActiveAEZone();
+
+  //! bit of the zone in the mask streams are routed with
+  unsigned int GetMask() const { return 1u << m_index; }
+
+  void Start();
+  void Dispose();
+
+  /*!
+   * \brief Open the sink of the zone for what the engine mixes
+   * \param internalFormat format of the buffers handed to AddSamples
+   * \param discarded pools still out at the sink are moved there, like the engine does
+   * \return false if the device could not be opened, the zone stays silent then
+   */
+  bool Configure(const AEAudioFormat& internalFormat,
+                 AEQuality quality,
+                 AELatencyMode latencyMode,
+                 float volume,
+                 std::list<std::unique_ptr<CActiveAEBufferPool>>& discarded);
+  void Unconfigure(std::list<std::unique_ptr<CActiveAEBufferPool>>& discarded);
+  bool IsConfigured() const { return m_sinkBuffers != nullptr; }
+  bool HasVolume() const { return m_hasVolume; }
+  void SetVolume(float volume);
+  void SetStreaming(bool streaming);
+  void Flush();
+
+  /*!
+   * \brief Mix a stream buffer of this cycle, its volume is applied already
+   */
+  void AddSamples(const CSampleBuffer* buffer);
+
+  /*!
+   * \brief Mix of this cycle, silence if no stream of the zone played
+   * \param samples length of the cycle in frames of the internal format
+   */
+  CSampleBuffer* TakeMix(int samples);
+
+  /*!
+   * \brief Queue the mix of this cycle for the sink
+   * \param targetDelay delay of the main sink in seconds, the zone follows it
+   */
+  void Output(CSampleBuffer* mix, double targetDelay);
+
+  /*!
+   * \brief Resample queued audio to the device and pass it on
+   * \return true if there was work
+   */
+  bool ProcessBuffers();
+
+  /*!
+   * \brief Handle a buffer the sink of the zone has played
+   * \return false if there was no message
+   */
+  bool ReceiveSinkMessage();
+
+private:
+  void Prefill(double seconds);
+
+  unsigned int m_index;
+  std::string m_device;
+  CActiveAESink m_sink;
+  CEngineStats m_stats;
+  AEAudioFormat m_sinkFormat;
+  AEAudioFormat m_internalFormat;
+  bool m_hasVolume = false;
+
+  CActiveAEZoneMixer m_mixer;
+  std::unique_ptr<CActiveAEBufferPoolResample> m_sinkBuffers;
+  CActiveAEZoneClock m_clock;
+};
+
+} // namespace ActiveAE
@@ -0,0 +1,246 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "cores/AudioEngine/Engines/ActiveAE/ActiveAEZone.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ActiveAE;
+
+namespace
+{
+
+constexpr double PERIOD = 0.02;
+constexpr int FRAMES = 960;
+
+// a zone whose device plays faster than the main sink by drift, as a fraction
+double RunClock(CActiveAEZoneClock& clock, double& error, double drift, int periods)
+{
+  for (int i = 0; i < periods; ++i)
+  {
+    EXPECT_EQ(clock.Update(error), CActiveAEZoneClock::Action::CORRECT);
+    error += PERIOD * (clock.GetRatio() - 1.0 - drift);
+  }
+  return clock.GetRatio();
+}
+
+AEAudioFormat MakeFormat()
+{
+  AEAudioFormat format;
+  format.m_dataFormat = AE_FMT_FLOATP;
+  format.m_sampleRate = 48000;
+  format.m_frames = FRAMES;
+  format.m_channelLayout += AE_CH_FL;
+  format.m_channelLayout += AE_CH_FR;
+  return format;
+}
+
+void Fill(CSampleBuffer* buffer, float value, int samples = FRAMES)
+{
+  buffer->pkt->nb_samples = samples;
+  for (int i = 0; i < buffer->pkt->planes; i++)
+  {
+    float* data = reinterpret_cast<float*>(buffer->pkt->data[i]);
+    for (int j = 0; j < samples; j++)
+      data[j] = value;
+  }
+}
+
+float GetMaxDeviation(const CSampleBuffer* buffer, float value)
+{
+  float deviation = 0.0f;
+  for (int i = 0; i < buffer->pkt->planes; i++)
+  {
+    const float* data = reinterpret_cast<const float*>(buffer->pkt->data[i]);
+    for (int j = 0; j < buffer->pkt->nb_samples; j++)
+      deviation = std::max(deviation, std::abs(data[j] - value));
+  }
+  return deviation;
+}
+
+} // namespace
+
+TEST(TestActiveAEZoneClock, LinesUpFirst)
+{
+  CActiveAEZoneClock clock;
+  EXPECT_EQ(clock.Update(-0.2), CActiveAEZoneClock::Action::PREFILL);
+  EXPECT_EQ(clock.GetRatio(), 1.0);
+  EXPECT_EQ(clock.Update(0.0), CActiveAEZoneClock::Action::CORRECT);
+  EXPECT_EQ(clock.GetRatio(), 1.0);
+
+  clock.Reset();
+  EXPECT_EQ(clock.Update(0.0), CActiveAEZoneClock::Action::PREFILL);
+}
+
+TEST(TestActiveAEZoneClock, CorrectsTowardsMainSink)
+{
+  CActiveAEZoneClock clock;
+  clock.Update(0.0);
+
+  // more queued than the main sink, the zone produces fewer samples to catch up
+  EXPECT_EQ(clock.Update(0.01), CActiveAEZoneClock::Action::CORRECT);
+  EXPECT_LT(clock.GetRatio(), 1.0);
+
+  clock.Reset();
+  clock.Update(0.0);
+  EXPECT_EQ(clock.Update(-0.01), CActiveAEZoneClock::Action::CORRECT);
+  EXPECT_GT(clock.GetRatio(), 1.0);
+}
+
+TEST(TestActiveAEZoneClock, CorrectionIsLimited)
+{
+  CActiveAEZoneClock clock;
+  clock.Update(0.0);
+  for (int i = 0; i < 1000; ++i)
+  {
+    clock.Update(0.45);
+    EXPECT_GE(clock.GetRatio(), 1.0 - CActiveAEZoneClock::MAX_CORRECTION);
+  }
+  for (int i = 0; i < 1000; ++i)
+  {
+    clock.Update(-0.45);
+    EXPECT_LE(clock.GetRatio(), 1.0 + CActiveAEZoneClock::MAX_CORRECTION);
+  }
+}
+
+TEST(TestActiveAEZoneClock, FollowsDrift)
+{
+  for (const double drift : {0.002, -0.003, 0.0})
+  {
+    CActiveAEZoneClock clock;
+    clock.Update(0.0);
+    double error = 0.0;
+    // 200 s of 20 ms periods, the integral takes over the steady error of the proportional part
+    const double ratio = RunClock(clock, error, drift, 10000);
+    EXPECT_NEAR(ratio, 1.0 + drift, 1e-5) << "drift " << drift;
+    EXPECT_NEAR(error, 0.0, 0.001) << "drift " << drift;
+  }
+}
+
+TEST(TestActiveAEZoneClock, ResyncsWhenTooFarOff)
+{
+  CActiveAEZoneClock clock;
+  clock.Update(0.0);
+  EXPECT_EQ(clock.Update(CActiveAEZoneClock::MAX_ERROR * 0.9),
+            CActiveAEZoneClock::Action::CORRECT);
+  EXPECT_EQ(clock.Update(-CActiveAEZoneClock::MAX_ERROR * 1.1),
+            CActiveAEZoneClock::Action::RESYNC);
+  EXPECT_EQ(clock.GetRatio(), 1.0);
+
+  // lined up again, without the integral of before
+  EXPECT_EQ(clock.Update(-0.1), CActiveAEZoneClock::Action::PREFILL);
+  EXPECT_EQ(clock.Update(0.0), CActiveAEZoneClock::Action::CORRECT);
+  EXPECT_EQ(clock.GetRatio(), 1.0);
+}
+
+class TestActiveAEZoneMixer : public testing::Test
+{
+protected:
+  TestActiveAEZoneMixer() : m_streams(MakeFormat())
+  {
+    CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo());
+    m_streams.Create(100);
+    m_mixer.Configure(MakeFormat());
+  }
+  ~TestActiveAEZoneMixer() override
+  {
+    m_mixer.Flush();
+    CServiceBroker::UnregisterCPUInfo();
+  }
+
+  CSampleBuffer* MakeStreamBuffer(float value)
+  {
+    CSampleBuffer* buffer = m_streams.GetFreeBuffer();
+    Fill(buffer, value);
+    return buffer;
+  }
+
+  CActiveAEBufferPool m_streams;
+  CActiveAEZoneMixer m_mixer;
+};
+
+TEST_F(TestActiveAEZoneMixer, SilenceWithoutStreams)
+{
+  CSampleBuffer* mix = m_mixer.TakeMix(FRAMES / 2);
+  ASSERT_NE(mix, nullptr);
+  EXPECT_EQ(mix->pkt->nb_samples, FRAMES / 2);
+  EXPECT_EQ(GetMaxDeviation(mix, 0.0f), 0.0f);
+  mix->Return();
+
+  // never longer than a buffer
+  mix = m_mixer.TakeMix(FRAMES * 4);
+  ASSERT_NE(mix, nullptr);
+  EXPECT_EQ(mix->pkt->nb_samples, FRAMES);
+  mix->Return();
+}
+
+TEST_F(TestActiveAEZoneMixer, MixesStreams)
+{
+  CSampleBuffer* first = MakeStreamBuffer(0.25f);
+  CSampleBuffer* second = MakeStreamBuffer(-0.5f);
+  m_mixer.AddSamples(first);
+  m_mixer.AddSamples(second);
+  // the engine still owns the stream buffers, they are not changed
+  EXPECT_EQ(GetMaxDeviation(first, 0.25f), 0.0f);
+  first->Return();
+  second->Return();
+
+  CSampleBuffer* mix = m_mixer.TakeMix(FRAMES);
+  ASSERT_NE(mix, nullptr);
+  EXPECT_EQ(mix->pkt->nb_samples, FRAMES);
+  EXPECT_LT(GetMaxDeviation(mix, -0.25f), 1e-6f);
+  mix->Return();
+
+  // the next cycle starts over
+  mix = m_mixer.TakeMix(FRAMES);
+  ASSERT_NE(mix, nullptr);
+  EXPECT_EQ(GetMaxDeviation(mix, 0.0f), 0.0f);
+  mix->Return();
+}
+
+TEST_F(TestActiveAEZoneMixer, ClipsOverflow)
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    CSampleBuffer* buffer = MakeStreamBuffer(0.8f);
+    m_mixer.AddSamples(buffer);
+    buffer->Return();
+  }
+
+  CSampleBuffer* mix = m_mixer.TakeMix(FRAMES);
+  ASSERT_NE(mix, nullptr);
+  EXPECT_LE(GetMaxDeviation(mix, 0.0f), 1.0f);
+  EXPECT_GT(GetMaxDeviation(mix, 0.0f), 0.8f);
+  mix->Return();
+}
+
+TEST_F(TestActiveAEZoneMixer, RunsOutOfBuffers)
+{
+  std::vector<CSampleBuffer*> silence;
+  while (CSampleBuffer* buffer = m_mixer.GetSilence(FRAMES))
+    silence.push_back(buffer);
+  EXPECT_FALSE(silence.empty());
+
+  // a zone behind on its sink drops the mix rather than blocking the engine
+  CSampleBuffer* stream = MakeStreamBuffer(0.5f);
+  m_mixer.AddSamples(stream);
+  stream->Return();
+  EXPECT_EQ(m_mixer.TakeMix(FRAMES), nullptr);
+
+  for (CSampleBuffer* buffer : silence)
+    buffer->Return();
+  CSampleBuffer* mix = m_mixer.TakeMix(FRAMES);
+  ASSERT_NE(mix, nullptr);
+  mix->Return();
+}
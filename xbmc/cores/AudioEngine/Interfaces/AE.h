@@ -31,6 +31,7 @@ class IAESound;
 class IAESoundDeleter;
 class IAEPacketizer;
 class IAudioCallback;
+struct AEVisualizationFrame;
 class IAEClockCallback;
 class CAEStreamInfo;
 
@@ -227,6 +228,22 @@ public:
 
   virtual void UnregisterAudioCallback(IAudioCallback* pCallback) {}
 
+  /*!
+   * \brief Start the shared waveform and spectrum analysis of the output
+   *
+   * Every consumer registers once, the analysis runs as long as one is registered.
+   */
+  virtual void RegisterVisualizationConsumer() {}
+
+  virtual void UnregisterVisualizationConsumer() {}
+
+  /*!
+   * \brief Get the latest waveform and spectrum of the output
+   *
+   * \returns false if nothing is played or no consumer is registered
+   */
+  virtual bool GetVisualizationFrame(AEVisualizationFrame& frame) { return false; }
+
   /*!
    * \brief Returns true if AudioEngine supports specified quality level
    *
@@ -46,6 +46,18 @@ public:
   AESyncState state;
 };
 
+/**
+ * Latency statistics of a stream, updated by the engine whenever it takes data from the stream
+ */
+class CAEStreamLatency
+{
+public:
+  double queuedMs = 0; //!< handed over by the stream, not yet picked up by the engine
+  double estimatedOutputMs = 0; //!< from the stream to the speaker, estimated from buffer levels
+  double peakEstimatedOutputMs = 0; //!< highest estimatedOutputMs since the stream was added
+  double wakeupsPerSec = 0; //!< times per second the stream had to wake up the engine
+};
+
 /**
  * IAEStream Stream Interface for streaming audio
  */
@@ -264,6 +276,18 @@ public:
    */
   virtual bool IsFading() { return false; }
 
+  /**
+   * Select the outputs the stream is heard on
+   * @param zones bit mask, bit 0 is the audio device, bit n the nth zone of advancedsettings
+   */
+  virtual void SetZones(unsigned int zones) {}
+
+  /**
+   * Returns the latency statistics of the stream, for diagnostics
+   * @return CAEStreamLatency, all zero if the engine doesn't measure them
+   */
+  virtual CAEStreamLatency GetLatency() { return {}; }
+
   /**
    * Slave a stream to resume when this stream has drained
    */
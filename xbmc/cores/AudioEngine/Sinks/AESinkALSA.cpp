@@ -735,9 +735,13 @@ bool CAESinkALSA::InitializeHW(const ALSAConfig &inconfig, ALSAConfig &outconfig
    a periodSize of approx 50 ms. Choosing a higher bufferSize
    will cause problems with menu sounds. Buffer will be increased
    after those are fixed.
+   In low latency mode this shrinks to 20 ms with periods of 5 ms.
   */
-  periodSize  = std::min(periodSize, (snd_pcm_uframes_t) sampleRate / 20);
-  bufferSize  = std::min(bufferSize, (snd_pcm_uframes_t) sampleRate / 5);
+  const AELatencyProfile& latency = AE::CAESinkFactory::GetLatencyProfile();
+  periodSize = std::min(periodSize,
+                        static_cast<snd_pcm_uframes_t>(latency.GetPeriodFrames(sampleRate)));
+  bufferSize = std::min(bufferSize,
+                        static_cast<snd_pcm_uframes_t>(latency.GetBufferFrames(sampleRate)));
 
   /*
    According to upstream we should set buffer size first - so make sure it is always at least
@@ -0,0 +1,118 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AESinkNULL.h"
+
+#include "cores/AudioEngine/AESinkFactory.h"
+#include "cores/AudioEngine/Utils/AEUtil.h"
+#include "utils/XTimeUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+
+void CAESinkNULL::Register()
+{
+  AE::AESinkRegEntry entry;
+  entry.sinkName = "NULL";
+  entry.createFunc = CAESinkNULL::Create;
+  entry.enumerateFunc = CAESinkNULL::EnumerateDevicesEx;
+  AE::CAESinkFactory::RegisterSink(entry);
+}
+
+std::unique_ptr<IAESink> CAESinkNULL::Create(std::string& device, AEAudioFormat& desiredFormat)
+{
+  auto sink = std::make_unique<CAESinkNULL>();
+  if (sink->Initialize(desiredFormat, device))
+    return sink;
+
+  return {};
+}
+
+void CAESinkNULL::EnumerateDevicesEx(AEDeviceInfoList& list, bool force)
+{
+  CAEDeviceInfo info;
+  info.m_deviceName = "null";
+  info.m_displayName = "Null output";
+  info.m_deviceType = AE_DEVTYPE_PCM;
+  info.m_channels = AE_CH_LAYOUT_7_1;
+  info.m_sampleRates = {44100, 48000, 96000, 192000};
+  info.m_dataFormats = {AE_FMT_FLOAT, AE_FMT_S32NE, AE_FMT_S16NE};
+  info.m_wantsIECPassthrough = false;
+  list.push_back(info);
+}
+
+bool CAESinkNULL::Initialize(AEAudioFormat& format, std::string& device)
+{
+  if (format.m_dataFormat == AE_FMT_RAW)
+  {
+    // take the bursts of the iec packer
+    format.m_dataFormat = AE_FMT_S16NE;
+  }
+  else if (AE_IS_PLANAR(format.m_dataFormat) || format.m_dataFormat == AE_FMT_INVALID)
+    format.m_dataFormat = AE_FMT_FLOAT;
+
+  if (format.m_sampleRate == 0)
+    format.m_sampleRate = 48000;
+
+  const AELatencyProfile& profile = AE::CAESinkFactory::GetLatencyProfile();
+  format.m_frames = profile.GetPeriodFrames(format.m_sampleRate);
+  format.m_frameSize =
+      format.m_channelLayout.Count() * (CAEUtil::DataFormatToBits(format.m_dataFormat) >> 3);
+
+  m_format = format;
+  m_bufferTime = profile.sinkBuffer;
+  m_buffered = 0.0;
+  m_lastUpdate = std::chrono::steady_clock::now();
+
+  CLog::Log(LOGDEBUG, "CAESinkNULL::{} - period {} frames, buffer {:.3f}s", __FUNCTION__,
+            format.m_frames, m_bufferTime);
+
+  return true;
+}
+
+void CAESinkNULL::Deinitialize()
+{
+  m_buffered = 0.0;
+}
+
+double CAESinkNULL::UpdateBuffered()
+{
+  const auto now = std::chrono::steady_clock::now();
+  const std::chrono::duration<double> elapsed = now - m_lastUpdate;
+  m_lastUpdate = now;
+
+  m_buffered = std::max(0.0, m_buffered - elapsed.count());
+  return m_buffered;
+}
+
+void CAESinkNULL::GetDelay(AEDelayStatus& status)
+{
+  status.SetDelay(UpdateBuffered());
+}
+
+unsigned int CAESinkNULL::AddPackets(uint8_t** data, unsigned int frames, unsigned int offset)
+{
+  const unsigned int maxFrames =
+      std::max(1u, static_cast<unsigned int>(m_bufferTime * m_format.m_sampleRate));
+  frames = std::min(frames, maxFrames);
+  const double duration = static_cast<double>(frames) / m_format.m_sampleRate;
+
+  // block like a device until there is room for the packet
+  const double wait = UpdateBuffered() + duration - m_bufferTime;
+  if (wait > 0.0)
+    KODI::TIME::Sleep(std::chrono::duration<double>(wait));
+
+  m_buffered = UpdateBuffered() + duration;
+  return frames;
+}
+
+void CAESinkNULL::Drain()
+{
+  KODI::TIME::Sleep(std::chrono::duration<double>(UpdateBuffered()));
+  m_buffered = 0.0;
+}
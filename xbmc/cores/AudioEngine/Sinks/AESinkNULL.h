@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/AudioEngine/Interfaces/AESink.h"
+#include "cores/AudioEngine/Utils/AEDeviceInfo.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+/*!
+ * \brief Sink without an audio device.
+ *
+ * Audio is discarded, but consumed in realtime like a device would do with the buffer
+ * sizes of the current latency profile. Used for headless operation and to test the
+ * timing of the engine. Not registered by default.
+ */
+class CAESinkNULL : public IAESink
+{
+public:
+  const char* GetName() override { return "NULL"; }
+
+  CAESinkNULL() = default;
+  ~CAESinkNULL() override = default;
+
+  static void Register();
+  static std::unique_ptr<IAESink> Create(std::string& device, AEAudioFormat& desiredFormat);
+  static void EnumerateDevicesEx(AEDeviceInfoList& list, bool force = false);
+
+  bool Initialize(AEAudioFormat& format, std::string& device) override;
+  void Deinitialize() override;
+
+  double GetCacheTotal() override { return m_bufferTime; }
+  void GetDelay(AEDelayStatus& status) override;
+  unsigned int AddPackets(uint8_t** data, unsigned int frames, unsigned int offset) override;
+  void Drain() override;
+
+private:
+  /*!
+   * \brief Advance the virtual playback position
+   * \return seconds of audio buffered
+   */
+  double UpdateBuffered();
+
+  AEAudioFormat m_format;
+  double m_bufferTime = 0.0;
+  double m_buffered = 0.0;
+  std::chrono::steady_clock::time_point m_lastUpdate;
+};
@@ -237,11 +237,6 @@ std::chrono::duration<double, std::ratio<1>> PWTimeToAEDelay(const pw_time& time
   return delay;
 }
 
-constexpr std::chrono::duration<double, std::ratio<1>> DEFAULT_BUFFER_DURATION = 0.200s;
-constexpr int DEFAULT_PERIODS = 4;
-constexpr std::chrono::duration<double, std::ratio<1>> DEFAULT_PERIOD_DURATION =
-    DEFAULT_BUFFER_DURATION / DEFAULT_PERIODS;
-
 constexpr int DEFAULT_LATENCY_DIVIDER = 3;
 
 } // namespace
@@ -421,8 +416,11 @@ bool CAESinkPipewire::Initialize(AEAudioFormat& format, std::string& device)
 
   m_stream = std::make_unique<PIPEWIRE::CPipewireStream>(core);
 
-  m_latency = DEFAULT_BUFFER_DURATION;
-  uint32_t frames = std::nearbyint(DEFAULT_PERIOD_DURATION.count() * format.m_sampleRate);
+  // 200ms in periods of 50ms, or 20ms in periods of 5ms in low latency mode
+  const AELatencyProfile& profile = AE::CAESinkFactory::GetLatencyProfile();
+  m_latency = std::chrono::duration<double, std::ratio<1>>(profile.sinkBuffer);
+  m_period = std::chrono::duration<double, std::ratio<1>>(profile.sinkPeriod);
+  uint32_t frames = profile.GetPeriodFrames(format.m_sampleRate);
   std::string fraction =
       StringUtils::Format("{}/{}", frames / DEFAULT_LATENCY_DIVIDER, format.m_sampleRate);
 
@@ -601,7 +599,7 @@ unsigned int CAESinkPipewire::AddPackets(uint8_t** data, unsigned int frames, un
 
     const auto now = std::chrono::steady_clock::now();
 
-    if ((delay <= (DEFAULT_BUFFER_DURATION - DEFAULT_PERIOD_DURATION)) || ((now - start) >= period))
+    if ((delay <= (m_latency - m_period)) || ((now - start) >= period))
       break;
 
     loop.Wait(5ms);
@@ -0,0 +1,157 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/AESinkFactory.h"
+#include "cores/AudioEngine/Sinks/AESinkNULL.h"
+#include "cores/AudioEngine/Utils/AEUtil.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+constexpr unsigned int SAMPLE_RATE = 48000;
+
+// scheduling on a loaded build machine is coarse, keep the bounds generous
+constexpr double TOLERANCE = 0.002;
+
+AEAudioFormat MakeFormat()
+{
+  AEAudioFormat format;
+  format.m_dataFormat = AE_FMT_FLOAT;
+  format.m_sampleRate = SAMPLE_RATE;
+  format.m_channelLayout = AE_CH_LAYOUT_2_0;
+  return format;
+}
+
+struct PlaybackResult
+{
+  double elapsed = 0.0;
+  double maxDelay = 0.0;
+};
+
+// feed duration seconds of silence in periods of the sink, like CActiveAESink does
+PlaybackResult Play(IAESink& sink, const AEAudioFormat& format, double duration)
+{
+  std::vector<uint8_t> buffer(format.m_frames * format.m_frameSize);
+  uint8_t* planes[] = {buffer.data()};
+
+  PlaybackResult result;
+  const auto start = std::chrono::steady_clock::now();
+  unsigned int remaining = static_cast<unsigned int>(duration * format.m_sampleRate);
+  while (remaining > 0)
+  {
+    const unsigned int frames = std::min(remaining, format.m_frames);
+    const unsigned int written = sink.AddPackets(planes, frames, 0);
+    EXPECT_GT(written, 0u);
+    remaining -= written;
+
+    AEDelayStatus status;
+    sink.GetDelay(status);
+    result.maxDelay = std::max(result.maxDelay, status.GetDelay());
+  }
+  result.elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
+
+} // namespace
+
+class TestAESinkNULL : public testing::Test
+{
+protected:
+  ~TestAESinkNULL() override { AE::CAESinkFactory::SetLatencyMode(AELatencyMode::NORMAL); }
+};
+
+TEST_F(TestAESinkNULL, LatencyProfile)
+{
+  const AELatencyProfile& normal = AELatencyProfile::Get(AELatencyMode::NORMAL);
+  const AELatencyProfile& low = AELatencyProfile::Get(AELatencyMode::LOW);
+
+  EXPECT_EQ(normal.GetPeriodFrames(SAMPLE_RATE), 2400u);
+  EXPECT_EQ(normal.GetBufferFrames(SAMPLE_RATE), 9600u);
+  EXPECT_EQ(low.GetPeriodFrames(SAMPLE_RATE), 240u);
+  EXPECT_EQ(low.GetBufferFrames(SAMPLE_RATE), 960u);
+
+  EXPECT_LT(low.streamCache, normal.streamCache);
+  EXPECT_LT(low.waterLevel, normal.waterLevel);
+  EXPECT_LT(low.maxPeriod, normal.maxPeriod);
+
+  // the whole path of the engine must stay below what is noticeable for games and karaoke
+  EXPECT_LE(low.GetMaxLatency(), 0.1);
+  EXPECT_LE(low.sinkPeriod, low.maxPeriod);
+  EXPECT_LE(normal.sinkPeriod, normal.maxPeriod);
+}
+
+TEST_F(TestAESinkNULL, Initialize)
+{
+  for (AELatencyMode mode : {AELatencyMode::NORMAL, AELatencyMode::LOW})
+  {
+    AE::CAESinkFactory::SetLatencyMode(mode);
+    const AELatencyProfile& profile = AELatencyProfile::Get(mode);
+
+    AEAudioFormat format = MakeFormat();
+    format.m_dataFormat = AE_FMT_FLOATP;
+    std::string device = "null";
+    std::unique_ptr<IAESink> sink = CAESinkNULL::Create(device, format);
+    ASSERT_TRUE(sink);
+
+    EXPECT_EQ(format.m_dataFormat, AE_FMT_FLOAT);
+    EXPECT_EQ(format.m_frames, profile.GetPeriodFrames(SAMPLE_RATE));
+    EXPECT_EQ(format.m_frameSize, 2 * sizeof(float));
+    EXPECT_DOUBLE_EQ(sink->GetCacheTotal(), profile.sinkBuffer);
+  }
+}
+
+TEST_F(TestAESinkNULL, LowLatencyTiming)
+{
+  AE::CAESinkFactory::SetLatencyMode(AELatencyMode::LOW);
+  const AELatencyProfile& profile = AELatencyProfile::Get(AELatencyMode::LOW);
+
+  AEAudioFormat format = MakeFormat();
+  std::string device = "null";
+  std::unique_ptr<IAESink> sink = CAESinkNULL::Create(device, format);
+  ASSERT_TRUE(sink);
+
+  constexpr double duration = 0.5;
+  const PlaybackResult result = Play(*sink, format, duration);
+
+  // the sink never holds more than its buffer
+  EXPECT_LE(result.maxDelay, profile.sinkBuffer + TOLERANCE);
+  EXPECT_GT(result.maxDelay, profile.sinkBuffer - profile.sinkPeriod - TOLERANCE);
+
+  // writing blocks once the buffer is full, so playback runs in realtime
+  EXPECT_GE(result.elapsed, duration - profile.sinkBuffer - TOLERANCE);
+  EXPECT_LE(result.elapsed, duration + 0.25);
+
+  sink->Drain();
+  AEDelayStatus status;
+  sink->GetDelay(status);
+  EXPECT_DOUBLE_EQ(status.GetDelay(), 0.0);
+  sink->Deinitialize();
+}
+
+TEST_F(TestAESinkNULL, NormalLatencyBuffersMore)
+{
+  AE::CAESinkFactory::SetLatencyMode(AELatencyMode::NORMAL);
+  const AELatencyProfile& profile = AELatencyProfile::Get(AELatencyMode::NORMAL);
+
+  AEAudioFormat format = MakeFormat();
+  std::string device = "null";
+  std::unique_ptr<IAESink> sink = CAESinkNULL::Create(device, format);
+  ASSERT_TRUE(sink);
+
+  // filling the buffer of the normal profile doesn't block
+  const PlaybackResult result = Play(*sink, format, profile.sinkBuffer);
+  EXPECT_LT(result.elapsed, profile.sinkBuffer / 2);
+  EXPECT_GT(result.maxDelay, AELatencyProfile::Get(AELatencyMode::LOW).sinkBuffer);
+  sink->Deinitialize();
+}
@@ -71,6 +71,19 @@ void CAEBitstreamPacker::Pack(CAEStreamInfo &info, uint8_t* data, int size)
     default:
       CLog::Log(LOGERROR, "CAEBitstreamPacker::Pack - no pack function");
   }
+
+  m_hasBurst = m_dataSize > 0;
+}
+
+bool CAEBitstreamPacker::PackInPlace(CAEStreamInfo& info, uint8_t* data, int size, bool byteSwap)
+{
+  if (info.m_type != CAEStreamInfo::STREAM_TYPE_TRUEHD || size != MAX_IEC61937_PACKET)
+    return false;
+
+  m_pauseDuration = 0;
+  m_dataSize = CAEPackIEC61937::PackTrueHDInPlace(data, byteSwap);
+  m_hasBurst = true;
+  return true;
 }
 
 bool CAEBitstreamPacker::PackPause(CAEStreamInfo &info, unsigned int millis, bool iecBursts)
@@ -106,6 +119,7 @@ bool CAEBitstreamPacker::PackPause(CAEStreamInfo &info, unsigned int millis, boo
   {
     memset(m_packedBuffer, 0, m_dataSize);
   }
+  m_hasBurst = iecBursts;
 
   return true;
 }
@@ -125,6 +139,7 @@ void CAEBitstreamPacker::Reset()
   m_dataSize = 0;
   m_pauseDuration = 0;
   m_packedBuffer[0] = 0;
+  m_hasBurst = false;
 }
 
 void CAEBitstreamPacker::PackDTSHD(CAEStreamInfo &info, uint8_t* data, int size)
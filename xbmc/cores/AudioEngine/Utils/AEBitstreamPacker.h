@@ -24,10 +24,24 @@ public:
   ~CAEBitstreamPacker();
 
   void Pack(CAEStreamInfo &info, uint8_t* data, int size);
+
+  /*!
+   * \brief Pack the frame in the buffer it was delivered in, saving the copy into the
+   * internal buffer. Only possible for TrueHD, whose MAT frames leave room for the IEC header.
+   * \param byteSwap output byte swapped for a sink with the opposite endianness of the host
+   * \return false if the frame has to go through Pack()
+   */
+  bool PackInPlace(CAEStreamInfo& info, uint8_t* data, int size, bool byteSwap);
+
   bool PackPause(CAEStreamInfo &info, unsigned int millis, bool iecBursts);
   void Reset();
   uint8_t* GetBuffer();
   unsigned int GetSize() const;
+
+  /*!
+   * \brief True if the last packed output carried IEC bursts
+   */
+  bool HasBurst() const { return m_hasBurst; }
   static unsigned int GetOutputRate(const CAEStreamInfo& info);
   static CAEChannelInfo GetOutputChannelMap(const CAEStreamInfo& info);
 
@@ -46,5 +60,6 @@ private:
   unsigned int  m_dataSize = 0;
   uint8_t       m_packedBuffer[MAX_IEC61937_PACKET];
   unsigned int m_pauseDuration = 0;
+  bool m_hasBurst = false;
 };
 
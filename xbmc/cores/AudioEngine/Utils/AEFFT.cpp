@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEFFT.h"
+
+#include "AEKernels.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numbers>
+
+CAEFFT::CAEFFT(unsigned int size) : m_kernels(CAEKernels::Get()), m_size(std::bit_floor(size))
+{
+  m_window.resize(m_size);
+  for (unsigned int i = 0; i < m_size; ++i)
+    m_window[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * std::numbers::pi * i / m_size));
+
+  m_twiddles.resize(m_size / 2);
+  for (unsigned int i = 0; i < m_size / 2; ++i)
+    m_twiddles[i] = std::polar(1.0f, static_cast<float>(-2.0 * std::numbers::pi * i / m_size));
+
+  const unsigned int bits = std::countr_zero(m_size);
+  m_reversed.resize(m_size);
+  for (uint32_t i = 0; i < m_size; ++i)
+  {
+    uint32_t reversed = 0;
+    for (unsigned int bit = 0; bit < bits; ++bit)
+      reversed |= ((i >> bit) & 1) << (bits - 1 - bit);
+    m_reversed[i] = reversed;
+  }
+
+  m_spectrum.resize(m_size);
+}
+
+void CAEFFT::Transform(const float* samples, unsigned int stride /* = 1 */)
+{
+  for (unsigned int i = 0; i < m_size; ++i)
+    m_spectrum[m_reversed[i]] = samples[static_cast<size_t>(i) * stride] * m_window[i];
+
+  // iterative radix 2, the input is in bit reversed order already
+  for (unsigned int size = 2; size <= m_size; size *= 2)
+  {
+    const unsigned int half = size / 2;
+    const unsigned int step = m_size / size;
+    for (unsigned int start = 0; start < m_size; start += size)
+    {
+      for (unsigned int i = 0; i < half; ++i)
+      {
+        const std::complex<float> odd = m_twiddles[i * step] * m_spectrum[start + i + half];
+        m_spectrum[start + i + half] = m_spectrum[start + i] - odd;
+        m_spectrum[start + i] += odd;
+      }
+    }
+  }
+}
+
+float CAEFFT::GetEnergy(unsigned int first, unsigned int last) const
+{
+  last = std::min(last, m_size / 2 + 1);
+  if (last <= first)
+    return 0.0f;
+
+  // real and imaginary parts are adjacent floats, the dot product with itself squares both
+  const float* data = reinterpret_cast<const float*>(m_spectrum.data() + first);
+  return m_kernels.DotProduct(data, data, (last - first) * 2);
+}
+
+unsigned int CAEFFT::GetBin(double frequency, unsigned int sampleRate) const
+{
+  const long bin = std::lround(frequency * m_size / sampleRate);
+  return static_cast<unsigned int>(std::clamp<long>(bin, 0, m_size / 2));
+}
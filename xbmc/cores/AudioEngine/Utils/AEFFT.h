@@ -0,0 +1,60 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <complex>
+#include <stdint.h>
+#include <vector>
+
+struct CAEKernels;
+
+/*!
+ * \brief Hann windowed fft of real audio, for analysis rather than filtering.
+ *
+ * Window, twiddles and the bit reversal table are built once per size. Band energies are
+ * summed with the dot product of the audio engine kernels.
+ */
+class CAEFFT
+{
+public:
+  /*!
+   * \param size number of samples per transform, a power of two
+   */
+  explicit CAEFFT(unsigned int size);
+
+  unsigned int GetSize() const { return m_size; }
+
+  /*!
+   * \brief Transform GetSize() samples, every stride-th value of samples is used
+   */
+  void Transform(const float* samples, unsigned int stride = 1);
+
+  /*!
+   * \brief Bins of the last transform, the first GetSize() / 2 + 1 are meaningful
+   */
+  const std::vector<std::complex<float>>& GetSpectrum() const { return m_spectrum; }
+
+  /*!
+   * \brief Sum of the squared magnitudes of the bins [first, last)
+   */
+  float GetEnergy(unsigned int first, unsigned int last) const;
+
+  /*!
+   * \brief Bin of a frequency at the given sample rate, rounded to nearest
+   */
+  unsigned int GetBin(double frequency, unsigned int sampleRate) const;
+
+private:
+  const CAEKernels& m_kernels;
+  unsigned int m_size;
+  std::vector<float> m_window;
+  std::vector<std::complex<float>> m_twiddles;
+  std::vector<uint32_t> m_reversed;
+  std::vector<std::complex<float>> m_spectrum;
+};
@@ -0,0 +1,207 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEFingerprint.h"
+
+#include "utils/Base64.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace
+{
+
+// frames mixed down and resampled at a time
+constexpr unsigned int CHUNK_FRAMES = 4096;
+
+// leading samples below -60dBFS are skipped
+constexpr float SILENCE = 0.001f;
+
+constexpr double LOW_FREQUENCY = 300.0;
+constexpr double HIGH_FREQUENCY = 2000.0;
+
+} // namespace
+
+CAEFingerprint::CAEFingerprint() : m_fft(FRAME_SIZE)
+{
+  // log spaced bands, as the ear hears them
+  for (unsigned int band = 0; band <= BANDS; ++band)
+  {
+    const double freq =
+        LOW_FREQUENCY * std::pow(HIGH_FREQUENCY / LOW_FREQUENCY, static_cast<double>(band) / BANDS);
+    m_bandBins[band] = m_fft.GetBin(freq, SAMPLE_RATE);
+  }
+}
+
+CAEFingerprint::~CAEFingerprint() = default;
+
+bool CAEFingerprint::Init(unsigned int channels, unsigned int sampleRate)
+{
+  if (channels == 0 || sampleRate == 0)
+    return false;
+
+  m_channels = channels;
+  m_resampler.reset();
+  if (sampleRate != SAMPLE_RATE)
+  {
+    m_resampler = std::make_unique<CAEPolyphaseResampler>();
+    m_resampler->Init(1, sampleRate, SAMPLE_RATE, CAEPolyphaseResampler::Filter());
+  }
+
+  m_mono.resize(CHUNK_FRAMES);
+  m_resampled.resize(CHUNK_FRAMES);
+
+  Reset();
+  return true;
+}
+
+void CAEFingerprint::Reset()
+{
+  if (m_resampler)
+    m_resampler->Reset();
+  m_started = false;
+  m_pending.clear();
+  m_haveLast = false;
+  m_words.clear();
+}
+
+bool CAEFingerprint::AddSamples(const float* samples, unsigned int frames)
+{
+  if (m_channels == 0)
+    return false;
+
+  while (frames > 0 && !IsComplete())
+  {
+    const unsigned int chunk = std::min(frames, CHUNK_FRAMES);
+    for (unsigned int i = 0; i < chunk; ++i)
+    {
+      float sum = 0.0f;
+      for (unsigned int ch = 0; ch < m_channels; ++ch)
+        sum += *samples++;
+      m_mono[i] = sum / m_channels;
+    }
+    frames -= chunk;
+
+    unsigned int start = 0;
+    if (!m_started)
+    {
+      while (start < chunk && std::fabs(m_mono[start]) < SILENCE)
+        start++;
+      if (start == chunk)
+        continue;
+      m_started = true;
+    }
+
+    AddMono(m_mono.data() + start, chunk - start);
+  }
+
+  return !IsComplete();
+}
+
+void CAEFingerprint::AddMono(const float* samples, unsigned int frames)
+{
+  if (!m_resampler)
+  {
+    m_pending.insert(m_pending.end(), samples, samples + frames);
+  }
+  else
+  {
+    m_resampler->Push(&samples, frames);
+    float* out = m_resampled.data();
+    unsigned int pulled;
+    while ((pulled = m_resampler->Pull(&out, static_cast<unsigned int>(m_resampled.size()))) > 0)
+      m_pending.insert(m_pending.end(), out, out + pulled);
+  }
+
+  ProcessFrames();
+}
+
+void CAEFingerprint::ProcessFrames()
+{
+  size_t pos = 0;
+  while (m_pending.size() - pos >= FRAME_SIZE && !IsComplete())
+  {
+    m_fft.Transform(m_pending.data() + pos);
+    for (unsigned int band = 0; band < BANDS; ++band)
+      m_energies[band] = m_fft.GetEnergy(m_bandBins[band], m_bandBins[band + 1]);
+
+    if (m_haveLast)
+    {
+      uint32_t word = 0;
+      for (unsigned int band = 0; band < BANDS - 1; ++band)
+      {
+        const double diff = (m_energies[band] - m_energies[band + 1]) -
+                            (m_lastEnergies[band] - m_lastEnergies[band + 1]);
+        if (diff > 0.0)
+          word |= 1u << band;
+      }
+      m_words.push_back(word);
+    }
+
+    std::copy(std::begin(m_energies), std::end(m_energies), std::begin(m_lastEnergies));
+    m_haveLast = true;
+    pos += HOP_SIZE;
+  }
+
+  m_pending.erase(m_pending.begin(), m_pending.begin() + pos);
+}
+
+float CAEFingerprint::Compare(const std::vector<uint32_t>& a,
+                              const std::vector<uint32_t>& b,
+                              unsigned int maxShift)
+{
+  const ptrdiff_t sizeA = static_cast<ptrdiff_t>(a.size());
+  const ptrdiff_t sizeB = static_cast<ptrdiff_t>(b.size());
+  const ptrdiff_t minOverlap = std::max<ptrdiff_t>(1, std::min(sizeA, sizeB) / 2);
+  float best = 1.0f;
+
+  const ptrdiff_t shift = maxShift;
+  for (ptrdiff_t offset = -shift; offset <= shift; ++offset)
+  {
+    // a[i] lines up with b[i + offset]
+    const ptrdiff_t first = std::max<ptrdiff_t>(0, -offset);
+    const ptrdiff_t last = std::min(sizeA, sizeB - offset);
+    if (last - first < minOverlap)
+      continue;
+
+    unsigned int errors = 0;
+    for (ptrdiff_t i = first; i < last; ++i)
+      errors += std::popcount(a[i] ^ b[i + offset]);
+    best = std::min(best, static_cast<float>(errors) / (32.0f * (last - first)));
+  }
+
+  return best;
+}
+
+std::string CAEFingerprint::Serialize(const std::vector<uint32_t>& words)
+{
+  std::string data;
+  data.reserve(words.size() * 4);
+  for (const uint32_t word : words)
+  {
+    data.push_back(static_cast<char>(word & 0xff));
+    data.push_back(static_cast<char>((word >> 8) & 0xff));
+    data.push_back(static_cast<char>((word >> 16) & 0xff));
+    data.push_back(static_cast<char>(word >> 24));
+  }
+  return Base64::Encode(data);
+}
+
+bool CAEFingerprint::Deserialize(const std::string& data, std::vector<uint32_t>& words)
+{
+  const std::string decoded = Base64::Decode(data);
+  if (decoded.size() % 4 != 0)
+    return false;
+
+  words.resize(decoded.size() / 4);
+  const auto* bytes = reinterpret_cast<const uint8_t*>(decoded.data());
+  for (size_t i = 0; i < words.size(); ++i, bytes += 4)
+    words[i] = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+  return true;
+}
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "AEFFT.h"
+#include "AEPolyphaseResampler.h"
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Compact acoustic fingerprint of the beginning of a song.
+ *
+ * Audio is mixed down to mono, resampled to 11025Hz and cut into frames of 2048 samples
+ * every 512 samples. The energies of 33 bands between 300Hz and 2kHz give one 32 bit word
+ * per frame, every bit tells if the energy difference of two neighbouring bands grew or
+ * shrank since the last frame. This survives lossy encoding, other sample rates and gain,
+ * so two files of the same recording have only a few bits that differ.
+ *
+ * Leading silence is skipped, which lines up files with a different encoder delay. Only
+ * the first minute is used, about 5kB.
+ */
+class CAEFingerprint
+{
+public:
+  //! changes whenever the same audio would give another fingerprint
+  static constexpr unsigned int VERSION = 1;
+  static constexpr unsigned int SAMPLE_RATE = 11025;
+  static constexpr unsigned int FRAME_SIZE = 2048;
+  static constexpr unsigned int HOP_SIZE = 512;
+  static constexpr unsigned int MAX_SECONDS = 60;
+  //! words of a complete fingerprint
+  static constexpr unsigned int MAX_WORDS = (MAX_SECONDS * SAMPLE_RATE - FRAME_SIZE) / HOP_SIZE;
+
+  CAEFingerprint();
+  ~CAEFingerprint();
+
+  /*!
+   * \brief Set up for audio of the given format
+   * \return false if the channel count or the rate is 0
+   */
+  bool Init(unsigned int channels, unsigned int sampleRate);
+
+  /*!
+   * \brief Forget everything added
+   */
+  void Reset();
+
+  /*!
+   * \brief Add interleaved float samples
+   * \return false once the fingerprint is complete and no more audio is needed
+   */
+  bool AddSamples(const float* samples, unsigned int frames);
+
+  bool IsComplete() const { return m_words.size() >= MAX_WORDS; }
+
+  /*!
+   * \brief Words of everything added, songs shorter than a minute give fewer
+   */
+  const std::vector<uint32_t>& GetFingerprint() const { return m_words; }
+
+  /*!
+   * \brief Bit error rate of the best alignment of two fingerprints
+   * \param maxShift largest offset in words to try in either direction
+   * \return about 0.5 for unrelated audio, below 0.35 for the same recording, 1.0 if the
+   * fingerprints do not overlap by half of the shorter one
+   */
+  static float Compare(const std::vector<uint32_t>& a,
+                       const std::vector<uint32_t>& b,
+                       unsigned int maxShift = 16);
+
+  static std::string Serialize(const std::vector<uint32_t>& words);
+  static bool Deserialize(const std::string& data, std::vector<uint32_t>& words);
+
+private:
+  static constexpr unsigned int BANDS = 33;
+
+  void AddMono(const float* samples, unsigned int frames);
+  void ProcessFrames();
+
+  unsigned int m_channels = 0;
+  std::unique_ptr<CAEPolyphaseResampler> m_resampler;
+  bool m_started = false;
+
+  std::vector<float> m_mono;
+  std::vector<float> m_resampled;
+  //! resampled audio not fully consumed by frames yet
+  std::vector<float> m_pending;
+
+  CAEFFT m_fft;
+  unsigned int m_bandBins[BANDS + 1] = {};
+
+  double m_energies[BANDS] = {};
+  double m_lastEnergies[BANDS] = {};
+  bool m_haveLast = false;
+  std::vector<uint32_t> m_words;
+};
@@ -0,0 +1,347 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+// built with AVX2 and FMA enabled, only called if the cpu supports both
+
+#include "AEKernels.h"
+
+#include <math.h>
+
+#include <immintrin.h>
+
+namespace
+{
+
+// keep everything local, the linker could pick up a copy of a shared inline function built
+// with AVX2 for the rest of the application
+inline float Clamp(float value, float lo, float hi)
+{
+  return value < lo ? lo : (value > hi ? hi : value);
+}
+
+void MulArray(float* data, float mul, uint32_t count)
+{
+  const __m256 m = _mm256_set1_ps(mul);
+
+  uint32_t i = 0;
+  for (; i + 16 <= count; i += 16)
+  {
+    _mm256_storeu_ps(data + i, _mm256_mul_ps(_mm256_loadu_ps(data + i), m));
+    _mm256_storeu_ps(data + i + 8, _mm256_mul_ps(_mm256_loadu_ps(data + i + 8), m));
+  }
+  for (; i + 8 <= count; i += 8)
+    _mm256_storeu_ps(data + i, _mm256_mul_ps(_mm256_loadu_ps(data + i), m));
+
+  for (; i < count; ++i)
+    data[i] *= mul;
+}
+
+void MulAddArray(float* data, const float* add, float mul, uint32_t count)
+{
+  const __m256 m = _mm256_set1_ps(mul);
+
+  uint32_t i = 0;
+  for (; i + 16 <= count; i += 16)
+  {
+    const __m256 sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(add + i), m, _mm256_loadu_ps(data + i));
+    const __m256 sum1 =
+        _mm256_fmadd_ps(_mm256_loadu_ps(add + i + 8), m, _mm256_loadu_ps(data + i + 8));
+    _mm256_storeu_ps(data + i, sum0);
+    _mm256_storeu_ps(data + i + 8, sum1);
+  }
+  for (; i + 8 <= count; i += 8)
+    _mm256_storeu_ps(data + i,
+                     _mm256_fmadd_ps(_mm256_loadu_ps(add + i), m, _mm256_loadu_ps(data + i)));
+
+  for (; i < count; ++i)
+    data[i] = fmaf(add[i], mul, data[i]);
+}
+
+void ClampArray(float* data, uint32_t count)
+{
+  const __m256 lo = _mm256_set1_ps(-1.0f);
+  const __m256 hi = _mm256_set1_ps(1.0f);
+
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+    _mm256_storeu_ps(data + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(data + i), lo), hi));
+
+  for (; i < count; ++i)
+    data[i] = Clamp(data[i], -1.0f, 1.0f);
+}
+
+void SoftClipArray(float* data, uint32_t count)
+{
+  const __m256 lo = _mm256_set1_ps(-3.0f);
+  const __m256 hi = _mm256_set1_ps(3.0f);
+  const __m256 c1 = _mm256_set1_ps(27.0f);
+  const __m256 c9 = _mm256_set1_ps(9.0f);
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 minusOne = _mm256_set1_ps(-1.0f);
+
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m256 x = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(data + i), lo), hi);
+    const __m256 y = _mm256_mul_ps(x, x);
+    const __m256 num = _mm256_mul_ps(x, _mm256_add_ps(c1, y));
+    const __m256 den = _mm256_fmadd_ps(c9, y, c1);
+    _mm256_storeu_ps(data + i,
+                     _mm256_min_ps(_mm256_max_ps(_mm256_div_ps(num, den), minusOne), one));
+  }
+
+  for (; i < count; ++i)
+  {
+    const float x = Clamp(data[i], -3.0f, 3.0f);
+    const float y = x * x;
+    data[i] = Clamp(x * (27.0f + y) / (27.0f + 9.0f * y), -1.0f, 1.0f);
+  }
+}
+
+float PeakArray(const float* data, uint32_t count)
+{
+  const __m256 sign = _mm256_set1_ps(-0.0f);
+  __m256 peak = _mm256_setzero_ps();
+
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+    peak = _mm256_max_ps(peak, _mm256_andnot_ps(sign, _mm256_loadu_ps(data + i)));
+
+  __m128 half = _mm_max_ps(_mm256_castps256_ps128(peak), _mm256_extractf128_ps(peak, 1));
+  half = _mm_max_ps(half, _mm_movehl_ps(half, half));
+  half = _mm_max_ss(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 1, 1, 1)));
+  float result = _mm_cvtss_f32(half);
+
+  for (; i < count; ++i)
+    result = fabsf(data[i]) > result ? fabsf(data[i]) : result;
+
+  return result;
+}
+
+float DotProduct(const float* a, const float* b, uint32_t count)
+{
+  __m256 sum0 = _mm256_setzero_ps();
+  __m256 sum1 = _mm256_setzero_ps();
+
+  uint32_t i = 0;
+  for (; i + 16 <= count; i += 16)
+  {
+    sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum0);
+    sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), sum1);
+  }
+  for (; i + 8 <= count; i += 8)
+    sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum0);
+
+  sum0 = _mm256_add_ps(sum0, sum1);
+  __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+  half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+  half = _mm_add_ss(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 1, 1, 1)));
+  float result = _mm_cvtss_f32(half);
+
+  for (; i < count; ++i)
+    result = fmaf(a[i], b[i], result);
+
+  return result;
+}
+
+// rows become columns
+inline void Transpose8(__m256& r0,
+                       __m256& r1,
+                       __m256& r2,
+                       __m256& r3,
+                       __m256& r4,
+                       __m256& r5,
+                       __m256& r6,
+                       __m256& r7)
+{
+  const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+  const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+  const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+  const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+  const __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+  const __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+  const __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+  const __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+  const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+  r0 = _mm256_permute2f128_ps(s0, s4, 0x20);
+  r1 = _mm256_permute2f128_ps(s1, s5, 0x20);
+  r2 = _mm256_permute2f128_ps(s2, s6, 0x20);
+  r3 = _mm256_permute2f128_ps(s3, s7, 0x20);
+  r4 = _mm256_permute2f128_ps(s0, s4, 0x31);
+  r5 = _mm256_permute2f128_ps(s1, s5, 0x31);
+  r6 = _mm256_permute2f128_ps(s2, s6, 0x31);
+  r7 = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+void Interleave(float* dst, const float* const* src, unsigned int channels, uint32_t frames)
+{
+  uint32_t i = 0;
+  if (channels == 2)
+  {
+    for (; i + 8 <= frames; i += 8, dst += 16)
+    {
+      const __m256 left = _mm256_loadu_ps(src[0] + i);
+      const __m256 right = _mm256_loadu_ps(src[1] + i);
+      const __m256 lo = _mm256_unpacklo_ps(left, right);
+      const __m256 hi = _mm256_unpackhi_ps(left, right);
+      _mm256_storeu_ps(dst, _mm256_permute2f128_ps(lo, hi, 0x20));
+      _mm256_storeu_ps(dst + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+  }
+  else if (channels == 8)
+  {
+    for (; i + 8 <= frames; i += 8, dst += 64)
+    {
+      __m256 r0 = _mm256_loadu_ps(src[0] + i);
+      __m256 r1 = _mm256_loadu_ps(src[1] + i);
+      __m256 r2 = _mm256_loadu_ps(src[2] + i);
+      __m256 r3 = _mm256_loadu_ps(src[3] + i);
+      __m256 r4 = _mm256_loadu_ps(src[4] + i);
+      __m256 r5 = _mm256_loadu_ps(src[5] + i);
+      __m256 r6 = _mm256_loadu_ps(src[6] + i);
+      __m256 r7 = _mm256_loadu_ps(src[7] + i);
+      Transpose8(r0, r1, r2, r3, r4, r5, r6, r7);
+      _mm256_storeu_ps(dst, r0);
+      _mm256_storeu_ps(dst + 8, r1);
+      _mm256_storeu_ps(dst + 16, r2);
+      _mm256_storeu_ps(dst + 24, r3);
+      _mm256_storeu_ps(dst + 32, r4);
+      _mm256_storeu_ps(dst + 40, r5);
+      _mm256_storeu_ps(dst + 48, r6);
+      _mm256_storeu_ps(dst + 56, r7);
+    }
+  }
+
+  for (; i < frames; ++i)
+  {
+    for (unsigned int ch = 0; ch < channels; ++ch)
+      *dst++ = src[ch][i];
+  }
+}
+
+void Deinterleave(float* const* dst, const float* src, unsigned int channels, uint32_t frames)
+{
+  uint32_t i = 0;
+  if (channels == 2)
+  {
+    for (; i + 8 <= frames; i += 8, src += 16)
+    {
+      const __m256 v0 = _mm256_loadu_ps(src);
+      const __m256 v1 = _mm256_loadu_ps(src + 8);
+      const __m256 lo = _mm256_permute2f128_ps(v0, v1, 0x20);
+      const __m256 hi = _mm256_permute2f128_ps(v0, v1, 0x31);
+      _mm256_storeu_ps(dst[0] + i, _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+      _mm256_storeu_ps(dst[1] + i, _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+  }
+  else if (channels == 8)
+  {
+    for (; i + 8 <= frames; i += 8, src += 64)
+    {
+      __m256 r0 = _mm256_loadu_ps(src);
+      __m256 r1 = _mm256_loadu_ps(src + 8);
+      __m256 r2 = _mm256_loadu_ps(src + 16);
+      __m256 r3 = _mm256_loadu_ps(src + 24);
+      __m256 r4 = _mm256_loadu_ps(src + 32);
+      __m256 r5 = _mm256_loadu_ps(src + 40);
+      __m256 r6 = _mm256_loadu_ps(src + 48);
+      __m256 r7 = _mm256_loadu_ps(src + 56);
+      Transpose8(r0, r1, r2, r3, r4, r5, r6, r7);
+      _mm256_storeu_ps(dst[0] + i, r0);
+      _mm256_storeu_ps(dst[1] + i, r1);
+      _mm256_storeu_ps(dst[2] + i, r2);
+      _mm256_storeu_ps(dst[3] + i, r3);
+      _mm256_storeu_ps(dst[4] + i, r4);
+      _mm256_storeu_ps(dst[5] + i, r5);
+      _mm256_storeu_ps(dst[6] + i, r6);
+      _mm256_storeu_ps(dst[7] + i, r7);
+    }
+  }
+
+  for (; i < frames; ++i)
+  {
+    for (unsigned int ch = 0; ch < channels; ++ch)
+      dst[ch][i] = *src++;
+  }
+}
+
+void FloatToS16(int16_t* dst, const float* src, uint32_t count)
+{
+  const __m256 scale = _mm256_set1_ps(32768.0f);
+  const __m256 lo = _mm256_set1_ps(-32768.0f);
+  const __m256 hi = _mm256_set1_ps(32767.0f);
+
+  uint32_t i = 0;
+  for (; i + 16 <= count; i += 16)
+  {
+    const __m256 f0 = _mm256_mul_ps(_mm256_loadu_ps(src + i), scale);
+    const __m256 f1 = _mm256_mul_ps(_mm256_loadu_ps(src + i + 8), scale);
+    const __m256i s0 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(f0, lo), hi));
+    const __m256i s1 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(f1, lo), hi));
+    // packs works per 128 bit lane, put the quadwords back in order
+    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(s0, s1), 0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), packed);
+  }
+
+  for (; i < count; ++i)
+  {
+    const float sample = Clamp(src[i] * 32768.0f, -32768.0f, 32767.0f);
+    dst[i] = static_cast<int16_t>(lrintf(sample));
+  }
+}
+
+void FloatToS32(int32_t* dst, const float* src, uint32_t count)
+{
+  const __m256 scale = _mm256_set1_ps(2147483648.0f);
+  const __m256 lo = _mm256_set1_ps(-2147483648.0f);
+  const __m256 hi = _mm256_set1_ps(2147483520.0f);
+
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m256 f = _mm256_mul_ps(_mm256_loadu_ps(src + i), scale);
+    const __m256i s = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(f, lo), hi));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), s);
+  }
+
+  for (; i < count; ++i)
+  {
+    const float sample = Clamp(src[i] * 2147483648.0f, -2147483648.0f, 2147483520.0f);
+    dst[i] = static_cast<int32_t>(lrintf(sample));
+  }
+}
+
+const CAEKernels avx2Kernels = {
+    "avx2",
+    MulArray,
+    MulAddArray,
+    ClampArray,
+    SoftClipArray,
+    PeakArray,
+    DotProduct,
+    Interleave,
+    Deinterleave,
+    FloatToS16,
+    FloatToS32,
+};
+
+} // namespace
+
+const CAEKernels& GetAVX2Kernels()
+{
+  return avx2Kernels;
+}
@@ -0,0 +1,311 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+#include "ServiceBroker.h"
+#include "utils/CPUInfo.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#if defined(HAVE_SSE) && defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+#if defined(HAS_AE_KERNELS_AVX2)
+const CAEKernels& GetAVX2Kernels();
+#endif
+
+#if defined(HAS_AE_KERNELS_NEON)
+const CAEKernels& GetNEONKernels();
+#endif
+
+namespace
+{
+
+inline float SoftClip(float x)
+{
+  /*
+     This is a rational function to approximate a tanh-like soft clipper.
+     It is based on the pade-approximation of the tanh function with tweaked coefficients.
+     See: http://www.musicdsp.org/showone.php?id=238
+  */
+  x = std::clamp(x, -3.0f, 3.0f);
+  const float y = x * x;
+  // mathematically within [-1, 1], but rounding can overshoot close to +-3
+  return std::clamp(x * (27.0f + y) / (27.0f + 9.0f * y), -1.0f, 1.0f);
+}
+
+#if defined(HAVE_SSE) && defined(__SSE__)
+void MulArray(float* data, float mul, uint32_t count)
+{
+  const __m128 m = _mm_set1_ps(mul);
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    _mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), m));
+
+  for (; i < count; ++i)
+    data[i] *= mul;
+}
+
+void MulAddArray(float* data, const float* add, float mul, uint32_t count)
+{
+  const __m128 m = _mm_set1_ps(mul);
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 sum = _mm_add_ps(_mm_loadu_ps(data + i), _mm_mul_ps(_mm_loadu_ps(add + i), m));
+    _mm_storeu_ps(data + i, sum);
+  }
+
+  for (; i < count; ++i)
+    data[i] += add[i] * mul;
+}
+
+void ClampArray(float* data, uint32_t count)
+{
+  const __m128 lo = _mm_set1_ps(-1.0f);
+  const __m128 hi = _mm_set1_ps(1.0f);
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    _mm_storeu_ps(data + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(data + i), lo), hi));
+
+  for (; i < count; ++i)
+    data[i] = std::clamp(data[i], -1.0f, 1.0f);
+}
+
+void SoftClipArray(float* data, uint32_t count)
+{
+  const __m128 lo = _mm_set1_ps(-3.0f);
+  const __m128 hi = _mm_set1_ps(3.0f);
+  const __m128 c1 = _mm_set1_ps(27.0f);
+  const __m128 c9 = _mm_set1_ps(9.0f);
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 minusOne = _mm_set1_ps(-1.0f);
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(data + i), lo), hi);
+    const __m128 y = _mm_mul_ps(x, x);
+    const __m128 num = _mm_mul_ps(x, _mm_add_ps(c1, y));
+    const __m128 den = _mm_add_ps(c1, _mm_mul_ps(c9, y));
+    _mm_storeu_ps(data + i, _mm_min_ps(_mm_max_ps(_mm_div_ps(num, den), minusOne), one));
+  }
+
+  for (; i < count; ++i)
+    data[i] = SoftClip(data[i]);
+}
+
+float PeakArray(const float* data, uint32_t count)
+{
+  const __m128 sign = _mm_set1_ps(-0.0f);
+  __m128 peak = _mm_setzero_ps();
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    peak = _mm_max_ps(peak, _mm_andnot_ps(sign, _mm_loadu_ps(data + i)));
+
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, peak);
+  float result = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+
+  for (; i < count; ++i)
+    result = std::max(result, std::fabs(data[i]));
+
+  return result;
+}
+
+float DotProduct(const float* a, const float* b, uint32_t count)
+{
+  __m128 sum0 = _mm_setzero_ps();
+  __m128 sum1 = _mm_setzero_ps();
+
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+  }
+  for (; i + 4 <= count; i += 4)
+    sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, _mm_add_ps(sum0, sum1));
+  float result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+
+  for (; i < count; ++i)
+    result += a[i] * b[i];
+
+  return result;
+}
+#else
+void MulArray(float* data, float mul, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] *= mul;
+}
+
+void MulAddArray(float* data, const float* add, float mul, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] += add[i] * mul;
+}
+
+void ClampArray(float* data, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] = std::clamp(data[i], -1.0f, 1.0f);
+}
+
+void SoftClipArray(float* data, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] = SoftClip(data[i]);
+}
+
+float PeakArray(const float* data, uint32_t count)
+{
+  float result = 0.0f;
+  for (uint32_t i = 0; i < count; ++i)
+    result = std::max(result, std::fabs(data[i]));
+
+  return result;
+}
+
+float DotProduct(const float* a, const float* b, uint32_t count)
+{
+  // independent sums let the compiler keep several multiplies in flight
+  float sum[4] = {};
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    sum[0] += a[i] * b[i];
+    sum[1] += a[i + 1] * b[i + 1];
+    sum[2] += a[i + 2] * b[i + 2];
+    sum[3] += a[i + 3] * b[i + 3];
+  }
+
+  float result = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+  for (; i < count; ++i)
+    result += a[i] * b[i];
+
+  return result;
+}
+#endif
+
+void Interleave(float* dst, const float* const* src, unsigned int channels, uint32_t frames)
+{
+  for (unsigned int ch = 0; ch < channels; ++ch)
+  {
+    const float* in = src[ch];
+    float* out = dst + ch;
+    for (uint32_t i = 0; i < frames; ++i, out += channels)
+      *out = in[i];
+  }
+}
+
+void Deinterleave(float* const* dst, const float* src, unsigned int channels, uint32_t frames)
+{
+  for (unsigned int ch = 0; ch < channels; ++ch)
+  {
+    const float* in = src + ch;
+    float* out = dst[ch];
+    for (uint32_t i = 0; i < frames; ++i, in += channels)
+      out[i] = *in;
+  }
+}
+
+void FloatToS16(int16_t* dst, const float* src, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const float sample = std::clamp(src[i] * 32768.0f, -32768.0f, 32767.0f);
+    dst[i] = static_cast<int16_t>(std::lrint(sample));
+  }
+}
+
+void FloatToS32(int32_t* dst, const float* src, uint32_t count)
+{
+  // 2^31 - 128 is the largest float below 2^31
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const float sample = std::clamp(src[i] * 2147483648.0f, -2147483648.0f, 2147483520.0f);
+    dst[i] = static_cast<int32_t>(std::lrint(sample));
+  }
+}
+
+const CAEKernels genericKernels = {
+#if defined(HAVE_SSE) && defined(__SSE__)
+    "sse",
+#else
+    "generic",
+#endif
+    MulArray,
+    MulAddArray,
+    ClampArray,
+    SoftClipArray,
+    PeakArray,
+    DotProduct,
+    Interleave,
+    Deinterleave,
+    FloatToS16,
+    FloatToS32,
+};
+
+} // namespace
+
+const CAEKernels& CAEKernels::GetGeneric()
+{
+  return genericKernels;
+}
+
+std::vector<const CAEKernels*> CAEKernels::GetAvailable()
+{
+  std::vector<const CAEKernels*> kernels{&genericKernels};
+
+  const std::shared_ptr<CCPUInfo> cpuInfo = CServiceBroker::GetCPUInfo();
+  [[maybe_unused]] const unsigned int features = cpuInfo ? cpuInfo->GetCPUFeatures() : 0;
+
+#if defined(HAS_AE_KERNELS_AVX2)
+  if ((features & CPU_FEATURE_AVX2) && (features & CPU_FEATURE_FMA3))
+    kernels.push_back(&GetAVX2Kernels());
+#endif
+
+#if defined(HAS_AE_KERNELS_NEON)
+  if (features & CPU_FEATURE_NEON)
+    kernels.push_back(&GetNEONKernels());
+#endif
+
+  return kernels;
+}
+
+const CAEKernels& CAEKernels::Get()
+{
+  static std::atomic<const CAEKernels*> selected{nullptr};
+
+  if (const CAEKernels* kernels = selected.load(std::memory_order_acquire))
+    return *kernels;
+
+  // without the cpu features only the baseline is known to work, select once they are known
+  if (!CServiceBroker::GetCPUInfo())
+    return genericKernels;
+
+  const CAEKernels* best = GetAvailable().back();
+  const CAEKernels* expected = nullptr;
+  if (selected.compare_exchange_strong(expected, best, std::memory_order_acq_rel))
+    CLog::Log(LOGINFO, "CAEKernels: using {} kernels", best->name);
+
+  return *best;
+}
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+/*!
+ * \brief Sample processing kernels of the audio engine.
+ *
+ * Every kernel exists for the baseline of the build target (SSE or plain C++) and
+ * optionally as AVX2/FMA and NEON version. The fastest set the cpu supports is selected
+ * at runtime from the CPUInfo feature flags. Buffers don't need any alignment.
+ */
+struct CAEKernels
+{
+  const char* name;
+
+  //! data[i] *= mul
+  void (*MulArray)(float* data, float mul, uint32_t count);
+
+  //! data[i] += add[i] * mul
+  void (*MulAddArray)(float* data, const float* add, float mul, uint32_t count);
+
+  //! limit to [-1, 1]
+  void (*ClampArray)(float* data, uint32_t count);
+
+  //! tanh like soft clipper, a rational approximation which reaches +-1 at +-3
+  void (*SoftClipArray)(float* data, uint32_t count);
+
+  //! largest absolute value, 0 for an empty array
+  float (*PeakArray)(const float* data, uint32_t count);
+
+  //! sum of a[i] * b[i], the inner loop of fir filters
+  float (*DotProduct)(const float* a, const float* b, uint32_t count);
+
+  //! planar to interleaved, dst holds frames * channels samples
+  void (*Interleave)(float* dst, const float* const* src, unsigned int channels, uint32_t frames);
+
+  //! interleaved to planar, every plane of dst holds frames samples
+  void (*Deinterleave)(float* const* dst, const float* src, unsigned int channels, uint32_t frames);
+
+  //! [-1, 1] float to integer samples, rounded to nearest and saturated
+  void (*FloatToS16)(int16_t* dst, const float* src, uint32_t count);
+  void (*FloatToS32)(int32_t* dst, const float* src, uint32_t count);
+
+  /*!
+   * \brief Get the fastest kernels for the running cpu, selected on first use once CPUInfo is
+   * registered, the baseline kernels until then
+   */
+  static const CAEKernels& Get();
+
+  /*!
+   * \brief Get the baseline kernels, always available
+   */
+  static const CAEKernels& GetGeneric();
+
+  /*!
+   * \brief Get all kernel sets usable on the running cpu, baseline first
+   */
+  static std::vector<const CAEKernels*> GetAvailable();
+};
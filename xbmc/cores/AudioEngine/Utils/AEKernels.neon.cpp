@@ -0,0 +1,296 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+// built with NEON enabled, only called if the cpu supports it
+
+#include "AEKernels.h"
+
+#include <math.h>
+
+#include <arm_neon.h>
+
+namespace
+{
+
+// keep everything local, the linker could pick up a copy of a shared inline function built
+// with NEON for the rest of the application
+inline float Clamp(float value, float lo, float hi)
+{
+  return value < lo ? lo : (value > hi ? hi : value);
+}
+
+inline float32x4_t Divide(float32x4_t num, float32x4_t den)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return vdivq_f32(num, den);
+#else
+  // no divide on armv7, refine the reciprocal estimate twice for full precision
+  float32x4_t rcp = vrecpeq_f32(den);
+  rcp = vmulq_f32(vrecpsq_f32(den, rcp), rcp);
+  rcp = vmulq_f32(vrecpsq_f32(den, rcp), rcp);
+  return vmulq_f32(num, rcp);
+#endif
+}
+
+inline int32x4_t Round(float32x4_t value)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return vcvtnq_s32_f32(value);
+#else
+  // armv7 only truncates, round half away from zero
+  const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(value), vdupq_n_u32(0x80000000));
+  const uint32x4_t half = vorrq_u32(vreinterpretq_u32_f32(vdupq_n_f32(0.5f)), sign);
+  return vcvtq_s32_f32(vaddq_f32(value, vreinterpretq_f32_u32(half)));
+#endif
+}
+
+void MulArray(float* data, float mul, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    vst1q_f32(data + i, vmulq_n_f32(vld1q_f32(data + i), mul));
+    vst1q_f32(data + i + 4, vmulq_n_f32(vld1q_f32(data + i + 4), mul));
+  }
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(data + i, vmulq_n_f32(vld1q_f32(data + i), mul));
+
+  for (; i < count; ++i)
+    data[i] *= mul;
+}
+
+void MulAddArray(float* data, const float* add, float mul, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    vst1q_f32(data + i, vmlaq_n_f32(vld1q_f32(data + i), vld1q_f32(add + i), mul));
+    vst1q_f32(data + i + 4, vmlaq_n_f32(vld1q_f32(data + i + 4), vld1q_f32(add + i + 4), mul));
+  }
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(data + i, vmlaq_n_f32(vld1q_f32(data + i), vld1q_f32(add + i), mul));
+
+  for (; i < count; ++i)
+    data[i] += add[i] * mul;
+}
+
+void ClampArray(float* data, uint32_t count)
+{
+  const float32x4_t lo = vdupq_n_f32(-1.0f);
+  const float32x4_t hi = vdupq_n_f32(1.0f);
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(data + i, vminq_f32(vmaxq_f32(vld1q_f32(data + i), lo), hi));
+
+  for (; i < count; ++i)
+    data[i] = Clamp(data[i], -1.0f, 1.0f);
+}
+
+void SoftClipArray(float* data, uint32_t count)
+{
+  const float32x4_t lo = vdupq_n_f32(-3.0f);
+  const float32x4_t hi = vdupq_n_f32(3.0f);
+  const float32x4_t c1 = vdupq_n_f32(27.0f);
+  const float32x4_t one = vdupq_n_f32(1.0f);
+  const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t x = vminq_f32(vmaxq_f32(vld1q_f32(data + i), lo), hi);
+    const float32x4_t y = vmulq_f32(x, x);
+    const float32x4_t num = vmulq_f32(x, vaddq_f32(c1, y));
+    const float32x4_t den = vmlaq_n_f32(c1, y, 9.0f);
+    vst1q_f32(data + i, vminq_f32(vmaxq_f32(Divide(num, den), minusOne), one));
+  }
+
+  for (; i < count; ++i)
+  {
+    const float x = Clamp(data[i], -3.0f, 3.0f);
+    const float y = x * x;
+    data[i] = Clamp(x * (27.0f + y) / (27.0f + 9.0f * y), -1.0f, 1.0f);
+  }
+}
+
+float PeakArray(const float* data, uint32_t count)
+{
+  float32x4_t peak = vdupq_n_f32(0.0f);
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    peak = vmaxq_f32(peak, vabsq_f32(vld1q_f32(data + i)));
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+  float result = vmaxvq_f32(peak);
+#else
+  float32x2_t half = vpmax_f32(vget_low_f32(peak), vget_high_f32(peak));
+  half = vpmax_f32(half, half);
+  float result = vget_lane_f32(half, 0);
+#endif
+
+  for (; i < count; ++i)
+    result = fabsf(data[i]) > result ? fabsf(data[i]) : result;
+
+  return result;
+}
+
+float DotProduct(const float* a, const float* b, uint32_t count)
+{
+  float32x4_t sum0 = vdupq_n_f32(0.0f);
+  float32x4_t sum1 = vdupq_n_f32(0.0f);
+
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    sum0 = vmlaq_f32(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+    sum1 = vmlaq_f32(sum1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+  }
+  for (; i + 4 <= count; i += 4)
+    sum0 = vmlaq_f32(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+
+  sum0 = vaddq_f32(sum0, sum1);
+#if defined(__aarch64__) || defined(_M_ARM64)
+  float result = vaddvq_f32(sum0);
+#else
+  float32x2_t half = vadd_f32(vget_low_f32(sum0), vget_high_f32(sum0));
+  half = vpadd_f32(half, half);
+  float result = vget_lane_f32(half, 0);
+#endif
+
+  for (; i < count; ++i)
+    result += a[i] * b[i];
+
+  return result;
+}
+
+void Interleave(float* dst, const float* const* src, unsigned int channels, uint32_t frames)
+{
+  uint32_t i = 0;
+  if (channels == 2)
+  {
+    for (; i + 4 <= frames; i += 4, dst += 8)
+    {
+      float32x4x2_t v;
+      v.val[0] = vld1q_f32(src[0] + i);
+      v.val[1] = vld1q_f32(src[1] + i);
+      vst2q_f32(dst, v);
+    }
+  }
+  else if (channels == 4)
+  {
+    for (; i + 4 <= frames; i += 4, dst += 16)
+    {
+      float32x4x4_t v;
+      v.val[0] = vld1q_f32(src[0] + i);
+      v.val[1] = vld1q_f32(src[1] + i);
+      v.val[2] = vld1q_f32(src[2] + i);
+      v.val[3] = vld1q_f32(src[3] + i);
+      vst4q_f32(dst, v);
+    }
+  }
+
+  for (; i < frames; ++i)
+  {
+    for (unsigned int ch = 0; ch < channels; ++ch)
+      *dst++ = src[ch][i];
+  }
+}
+
+void Deinterleave(float* const* dst, const float* src, unsigned int channels, uint32_t frames)
+{
+  uint32_t i = 0;
+  if (channels == 2)
+  {
+    for (; i + 4 <= frames; i += 4, src += 8)
+    {
+      const float32x4x2_t v = vld2q_f32(src);
+      vst1q_f32(dst[0] + i, v.val[0]);
+      vst1q_f32(dst[1] + i, v.val[1]);
+    }
+  }
+  else if (channels == 4)
+  {
+    for (; i + 4 <= frames; i += 4, src += 16)
+    {
+      const float32x4x4_t v = vld4q_f32(src);
+      vst1q_f32(dst[0] + i, v.val[0]);
+      vst1q_f32(dst[1] + i, v.val[1]);
+      vst1q_f32(dst[2] + i, v.val[2]);
+      vst1q_f32(dst[3] + i, v.val[3]);
+    }
+  }
+
+  for (; i < frames; ++i)
+  {
+    for (unsigned int ch = 0; ch < channels; ++ch)
+      dst[ch][i] = *src++;
+  }
+}
+
+void FloatToS16(int16_t* dst, const float* src, uint32_t count)
+{
+  const float32x4_t lo = vdupq_n_f32(-32768.0f);
+  const float32x4_t hi = vdupq_n_f32(32767.0f);
+
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const float32x4_t f0 = vmulq_n_f32(vld1q_f32(src + i), 32768.0f);
+    const float32x4_t f1 = vmulq_n_f32(vld1q_f32(src + i + 4), 32768.0f);
+    const int32x4_t s0 = Round(vminq_f32(vmaxq_f32(f0, lo), hi));
+    const int32x4_t s1 = Round(vminq_f32(vmaxq_f32(f1, lo), hi));
+    vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(s0), vqmovn_s32(s1)));
+  }
+
+  for (; i < count; ++i)
+  {
+    const float sample = Clamp(src[i] * 32768.0f, -32768.0f, 32767.0f);
+    dst[i] = static_cast<int16_t>(lrintf(sample));
+  }
+}
+
+void FloatToS32(int32_t* dst, const float* src, uint32_t count)
+{
+  const float32x4_t lo = vdupq_n_f32(-2147483648.0f);
+  const float32x4_t hi = vdupq_n_f32(2147483520.0f);
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t f = vmulq_n_f32(vld1q_f32(src + i), 2147483648.0f);
+    vst1q_s32(dst + i, Round(vminq_f32(vmaxq_f32(f, lo), hi)));
+  }
+
+  for (; i < count; ++i)
+  {
+    const float sample = Clamp(src[i] * 2147483648.0f, -2147483648.0f, 2147483520.0f);
+    dst[i] = static_cast<int32_t>(lrintf(sample));
+  }
+}
+
+const CAEKernels neonKernels = {
+    "neon",
+    MulArray,
+    MulAddArray,
+    ClampArray,
+    SoftClipArray,
+    PeakArray,
+    DotProduct,
+    Interleave,
+    Deinterleave,
+    FloatToS16,
+    FloatToS32,
+};
+
+} // namespace
+
+const CAEKernels& GetNEONKernels()
+{
+  return neonKernels;
+}
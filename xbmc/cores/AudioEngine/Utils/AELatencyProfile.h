@@ -0,0 +1,60 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cmath>
+
+enum class AELatencyMode
+{
+  NORMAL,
+  LOW,
+};
+
+/*!
+ * \brief Buffer sizes of the audio path, all times in seconds.
+ *
+ * The normal profile trades latency for robustness against scheduling hiccups and slow
+ * devices, the low latency profile is meant for games, karaoke and the like.
+ */
+struct AELatencyProfile
+{
+  //! audio a stream may buffer ahead of the engine
+  double streamCache;
+  //! audio buffered by the engine after the stream stages
+  double waterLevel;
+  //! longest sink period the engine accepts
+  double maxPeriod;
+  //! period sinks should negotiate with the device
+  double sinkPeriod;
+  //! total buffer sinks should negotiate with the device
+  double sinkBuffer;
+
+  unsigned int GetPeriodFrames(unsigned int sampleRate) const
+  {
+    return static_cast<unsigned int>(std::lround(sinkPeriod * sampleRate));
+  }
+
+  unsigned int GetBufferFrames(unsigned int sampleRate) const
+  {
+    return static_cast<unsigned int>(std::lround(sinkBuffer * sampleRate));
+  }
+
+  /*!
+   * \brief Upper bound of the delay from a stream to the device, not counting the
+   *        latency of the hardware itself
+   */
+  double GetMaxLatency() const { return streamCache + waterLevel + sinkBuffer; }
+
+  static const AELatencyProfile& Get(AELatencyMode mode)
+  {
+    static constexpr AELatencyProfile normal = {0.4, 0.2, 0.1, 0.05, 0.2};
+    static constexpr AELatencyProfile low = {0.04, 0.02, 0.01, 0.005, 0.02};
+    return mode == AELatencyMode::LOW ? low : normal;
+  }
+};
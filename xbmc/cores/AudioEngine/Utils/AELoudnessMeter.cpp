@@ -0,0 +1,258 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AELoudnessMeter.h"
+
+#include "AEChannelInfo.h"
+#include "AEKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace
+{
+
+constexpr double ABSOLUTE_GATE = -70.0;
+constexpr double RELATIVE_GATE = -10.0;
+
+// frames handed to the oversampler at a time
+constexpr unsigned int CHUNK_FRAMES = 4096;
+
+double ToLoudness(double meanSquare)
+{
+  return -0.691 + 10.0 * std::log10(meanSquare);
+}
+
+double ToMeanSquare(double loudness)
+{
+  return std::pow(10.0, (loudness + 0.691) / 10.0);
+}
+
+double GetWeight(AEChannel channel)
+{
+  switch (channel)
+  {
+    case AE_CH_LFE:
+      return 0.0;
+    case AE_CH_BL:
+    case AE_CH_BR:
+    case AE_CH_SL:
+    case AE_CH_SR:
+    case AE_CH_BC:
+      return 1.41;
+    default:
+      return 1.0;
+  }
+}
+
+unsigned int GetOversampling(unsigned int sampleRate)
+{
+  if (sampleRate < 96000)
+    return 4;
+  if (sampleRate < 192000)
+    return 2;
+  return 1;
+}
+
+} // namespace
+
+CAELoudnessMeter::CAELoudnessMeter() : m_kernels(CAEKernels::Get())
+{
+}
+
+CAELoudnessMeter::~CAELoudnessMeter() = default;
+
+bool CAELoudnessMeter::Init(const CAEChannelInfo& layout, unsigned int sampleRate)
+{
+  if (layout.Count() == 0 || sampleRate == 0)
+    return false;
+
+  m_channels = layout.Count();
+  m_state.assign(m_channels, {});
+  for (unsigned int ch = 0; ch < m_channels; ++ch)
+    m_state[ch].weight = GetWeight(layout[ch]);
+
+  // the two stages of the K filter, derived from their analog prototypes so that any rate
+  // works, not only the 48kHz the coefficients are published for
+  {
+    const double f0 = 1681.974450955533;
+    const double gain = 3.999843853973347;
+    const double q = 0.7071752369554196;
+    const double k = std::tan(std::numbers::pi * f0 / sampleRate);
+    const double vh = std::pow(10.0, gain / 20.0);
+    const double vb = std::pow(vh, 0.4996667741545416);
+    const double a0 = 1.0 + k / q + k * k;
+    m_shelf.b0 = (vh + vb * k / q + k * k) / a0;
+    m_shelf.b1 = 2.0 * (k * k - vh) / a0;
+    m_shelf.b2 = (vh - vb * k / q + k * k) / a0;
+    m_shelf.a1 = 2.0 * (k * k - 1.0) / a0;
+    m_shelf.a2 = (1.0 - k / q + k * k) / a0;
+  }
+  {
+    const double f0 = 38.13547087602444;
+    const double q = 0.5003270373238773;
+    const double k = std::tan(std::numbers::pi * f0 / sampleRate);
+    const double a0 = 1.0 + k / q + k * k;
+    m_highpass.b0 = 1.0;
+    m_highpass.b1 = -2.0;
+    m_highpass.b2 = 1.0;
+    m_highpass.a1 = 2.0 * (k * k - 1.0) / a0;
+    m_highpass.a2 = (1.0 - k / q + k * k) / a0;
+  }
+
+  m_stepFrames = std::max(1u, (sampleRate + 5) / 10);
+
+  m_oversampler.reset();
+  const unsigned int oversampling = GetOversampling(sampleRate);
+  if (oversampling > 1)
+  {
+    CAEPolyphaseResampler::Filter filter;
+    filter.taps = 16;
+    m_oversampler = std::make_unique<CAEPolyphaseResampler>();
+    m_oversampler->Init(m_channels, sampleRate, sampleRate * oversampling, filter);
+    const unsigned int outFrames = CHUNK_FRAMES * oversampling;
+    m_inData.resize(static_cast<size_t>(m_channels) * CHUNK_FRAMES);
+    m_outData.resize(static_cast<size_t>(m_channels) * outFrames);
+    m_inPlanes.resize(m_channels);
+    m_outPlanes.resize(m_channels);
+    for (unsigned int ch = 0; ch < m_channels; ++ch)
+    {
+      m_inPlanes[ch] = m_inData.data() + static_cast<size_t>(ch) * CHUNK_FRAMES;
+      m_outPlanes[ch] = m_outData.data() + static_cast<size_t>(ch) * outFrames;
+    }
+  }
+
+  Reset();
+  return true;
+}
+
+void CAELoudnessMeter::Reset()
+{
+  for (auto& state : m_state)
+    std::fill(std::begin(state.z), std::end(state.z), 0.0);
+
+  m_stepCount = 0;
+  m_stepSum = 0.0;
+  m_stepsDone = 0;
+  m_blocks.clear();
+
+  if (m_oversampler)
+    m_oversampler->Reset();
+  m_truePeak = 0.0f;
+}
+
+void CAELoudnessMeter::AddSamples(const float* samples, unsigned int frames)
+{
+  if (m_channels == 0)
+    return;
+
+  UpdateTruePeak(samples, frames);
+
+  const Biquad s = m_shelf;
+  const Biquad h = m_highpass;
+  for (unsigned int frame = 0; frame < frames; ++frame)
+  {
+    double sum = 0.0;
+    for (unsigned int ch = 0; ch < m_channels; ++ch)
+    {
+      Channel& state = m_state[ch];
+      const double x = *samples++;
+
+      // transposed direct form II
+      const double y1 = s.b0 * x + state.z[0];
+      state.z[0] = s.b1 * x - s.a1 * y1 + state.z[1];
+      state.z[1] = s.b2 * x - s.a2 * y1;
+
+      const double y2 = h.b0 * y1 + state.z[2];
+      state.z[2] = h.b1 * y1 - h.a1 * y2 + state.z[3];
+      state.z[3] = h.b2 * y1 - h.a2 * y2;
+
+      sum += state.weight * y2 * y2;
+    }
+
+    m_stepSum += sum;
+    if (++m_stepCount < m_stepFrames)
+      continue;
+
+    m_steps[m_stepsDone % 4] = m_stepSum / m_stepFrames;
+    m_stepsDone++;
+    m_stepSum = 0.0;
+    m_stepCount = 0;
+
+    // the filters decay into denormals on silence, which are very slow to compute
+    for (auto& state : m_state)
+    {
+      for (double& z : state.z)
+      {
+        if (std::fabs(z) < 1e-30)
+          z = 0.0;
+      }
+    }
+
+    if (m_stepsDone >= 4)
+      m_blocks.push_back(
+          static_cast<float>((m_steps[0] + m_steps[1] + m_steps[2] + m_steps[3]) / 4.0));
+  }
+}
+
+void CAELoudnessMeter::UpdateTruePeak(const float* samples, unsigned int frames)
+{
+  m_truePeak = std::max(m_truePeak, m_kernels.PeakArray(samples, frames * m_channels));
+  if (!m_oversampler)
+    return;
+
+  const unsigned int outFrames = static_cast<unsigned int>(m_outData.size() / m_channels);
+  while (frames > 0)
+  {
+    const unsigned int chunk = std::min(frames, CHUNK_FRAMES);
+    m_kernels.Deinterleave(m_inPlanes.data(), samples, m_channels, chunk);
+    m_oversampler->Push(m_inPlanes.data(), chunk);
+
+    unsigned int pulled;
+    while ((pulled = m_oversampler->Pull(m_outPlanes.data(), outFrames)) > 0)
+    {
+      for (unsigned int ch = 0; ch < m_channels; ++ch)
+        m_truePeak = std::max(m_truePeak, m_kernels.PeakArray(m_outPlanes[ch], pulled));
+    }
+
+    samples += static_cast<size_t>(chunk) * m_channels;
+    frames -= chunk;
+  }
+}
+
+double CAELoudnessMeter::GetIntegratedLoudness(const std::vector<float>& blocks)
+{
+  auto gatedMean = [&blocks](double threshold, double& mean)
+  {
+    double sum = 0.0;
+    size_t count = 0;
+    for (const float block : blocks)
+    {
+      if (block > threshold)
+      {
+        sum += block;
+        count++;
+      }
+    }
+    mean = count ? sum / count : 0.0;
+    return count > 0;
+  };
+
+  const double absolute = ToMeanSquare(ABSOLUTE_GATE);
+  double mean;
+  if (!gatedMean(absolute, mean))
+    return -std::numeric_limits<double>::infinity();
+
+  const double relative = ToMeanSquare(ToLoudness(mean) + RELATIVE_GATE);
+  if (!gatedMean(std::max(absolute, relative), mean))
+    return -std::numeric_limits<double>::infinity();
+
+  return ToLoudness(mean);
+}
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "AEPolyphaseResampler.h"
+
+#include <memory>
+#include <vector>
+
+class CAEChannelInfo;
+struct CAEKernels;
+
+/*!
+ * \brief Loudness and true peak measurement after ITU-R BS.1770 / EBU R128.
+ *
+ * Audio is K-weighted and cut into 400ms blocks overlapping by 75%. Only the mean square of
+ * every block is kept, so measuring a long file needs a few kilobytes. The blocks of several
+ * files can be combined to measure them as a whole, which gives the album loudness.
+ */
+class CAELoudnessMeter
+{
+public:
+  //! changes whenever the same audio would measure differently
+  static constexpr unsigned int VERSION = 1;
+  //! loudness ReplayGain 2.0 normalises to
+  static constexpr double REFERENCE_LOUDNESS = -18.0;
+
+  CAELoudnessMeter();
+  ~CAELoudnessMeter();
+
+  /*!
+   * \brief Set up the filters, the lfe channel does not count
+   * \return false if the layout is empty or the rate is 0
+   */
+  bool Init(const CAEChannelInfo& layout, unsigned int sampleRate);
+
+  /*!
+   * \brief Forget everything measured
+   */
+  void Reset();
+
+  /*!
+   * \brief Measure interleaved float samples
+   */
+  void AddSamples(const float* samples, unsigned int frames);
+
+  /*!
+   * \brief Gated loudness of everything added in LUFS, -infinity if it was silent
+   */
+  double GetIntegratedLoudness() const { return GetIntegratedLoudness(m_blocks); }
+
+  /*!
+   * \brief Largest absolute value of the signal between the samples, 1.0 is full scale
+   */
+  float GetTruePeak() const { return m_truePeak; }
+
+  /*!
+   * \brief Mean square of every complete block
+   */
+  const std::vector<float>& GetBlocks() const { return m_blocks; }
+
+  /*!
+   * \brief Gated loudness of blocks of one or more meters in LUFS, -infinity for silence
+   */
+  static double GetIntegratedLoudness(const std::vector<float>& blocks);
+
+private:
+  struct Biquad
+  {
+    double b0, b1, b2, a1, a2;
+  };
+
+  struct Channel
+  {
+    double weight = 1.0;
+    double z[4] = {};
+  };
+
+  void UpdateTruePeak(const float* samples, unsigned int frames);
+
+  const CAEKernels& m_kernels;
+  unsigned int m_channels = 0;
+  Biquad m_shelf = {};
+  Biquad m_highpass = {};
+  std::vector<Channel> m_state;
+
+  //! frames of a 100ms step, every block covers four of them
+  unsigned int m_stepFrames = 0;
+  unsigned int m_stepCount = 0;
+  double m_stepSum = 0.0;
+  double m_steps[4] = {};
+  unsigned int m_stepsDone = 0;
+  std::vector<float> m_blocks;
+
+  // true peak by oversampling, plain sample peak at high rates
+  std::unique_ptr<CAEPolyphaseResampler> m_oversampler;
+  std::vector<float> m_inData;
+  std::vector<float> m_outData;
+  std::vector<float*> m_inPlanes;
+  std::vector<float*> m_outPlanes;
+  float m_truePeak = 0.0f;
+};
@@ -112,6 +112,32 @@ int CAEPackIEC61937::PackTrueHD(const uint8_t* data, unsigned int size, uint8_t*
   return OUT_FRAMESTOBYTES(TRUEHD_FRAME_SIZE);
 }
 
+int CAEPackIEC61937::PackTrueHDInPlace(uint8_t* dest, bool byteSwap)
+{
+  /* dest holds a full MAT frame behind the room for the header */
+  struct IEC61937Packet* packet = (struct IEC61937Packet*)dest;
+  packet->m_preamble1 = IEC61937_PREAMBLE1;
+  packet->m_preamble2 = IEC61937_PREAMBLE2;
+  packet->m_type = IEC61937_TYPE_TRUEHD;
+  packet->m_length = 61424;
+
+  /* the payload is a BE bitstream, only touch it if the output words are LE */
+  bool swapPayload = byteSwap;
+
+#ifndef __BIG_ENDIAN__
+  swapPayload ^= true;
+#endif
+
+  if (swapPayload)
+    SwapEndian((uint16_t*)packet->m_data, (uint16_t*)packet->m_data,
+               (OUT_FRAMESTOBYTES(TRUEHD_FRAME_SIZE) - IEC61937_DATA_OFFSET) >> 1);
+
+  if (byteSwap)
+    SwapEndian((uint16_t*)dest, (uint16_t*)dest, IEC61937_DATA_OFFSET >> 1);
+
+  return OUT_FRAMESTOBYTES(TRUEHD_FRAME_SIZE);
+}
+
 int CAEPackIEC61937::PackDTSHD(uint8_t *data, unsigned int size, uint8_t *dest, unsigned int period)
 {
   unsigned int subtype;
@@ -0,0 +1,214 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEPolyphaseResampler.h"
+
+#include "AEKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+
+namespace
+{
+
+// below this many phases the bank is extended to a multiple of the exact phase count,
+// above the maximum the phases are interpolated
+constexpr unsigned int MIN_PHASES = 256;
+constexpr unsigned int MAX_EXACT_PHASES = 1024;
+
+// consumed input is only dropped in chunks
+constexpr size_t COMPACT_FRAMES = 4096;
+
+// modified bessel function of the first kind, order 0
+double BesselI0(double x)
+{
+  double sum = 1.0;
+  double term = 1.0;
+  const double y = x * x / 4.0;
+  for (int k = 1; k < 50 && term > sum * 1e-12; ++k)
+  {
+    term *= y / (static_cast<double>(k) * k);
+    sum += term;
+  }
+  return sum;
+}
+
+double Sinc(double x)
+{
+  if (std::fabs(x) < 1e-9)
+    return 1.0;
+  return std::sin(std::numbers::pi * x) / (std::numbers::pi * x);
+}
+
+} // namespace
+
+CAEPolyphaseResampler::CAEPolyphaseResampler() : m_kernels(CAEKernels::Get())
+{
+}
+
+bool CAEPolyphaseResampler::Init(unsigned int channels,
+                                 unsigned int srcRate,
+                                 unsigned int dstRate,
+                                 const Filter& filter)
+{
+  if (channels == 0 || srcRate == 0 || dstRate == 0)
+    return false;
+
+  m_channels = channels;
+
+  const unsigned int gcd = std::gcd(srcRate, dstRate);
+  const unsigned int up = dstRate / gcd;
+  const unsigned int down = srcRate / gcd;
+
+  if (up <= MAX_EXACT_PHASES)
+  {
+    const unsigned int factor = (MIN_PHASES + up - 1) / up;
+    m_phases = up * factor;
+    m_step = static_cast<double>(down) * factor;
+    m_exact = true;
+  }
+  else
+  {
+    m_phases = MIN_PHASES;
+    m_step = static_cast<double>(MIN_PHASES) * srcRate / dstRate;
+    m_exact = false;
+  }
+
+  // when downsampling the cutoff moves down and the filter gets longer by the same factor
+  const double scale = std::min(1.0, static_cast<double>(dstRate) / srcRate);
+  const double cutoff = filter.cutoff * scale;
+  const double taps = std::max(8.0, std::ceil(filter.taps / scale));
+  m_taps = (static_cast<unsigned int>(taps) + 7) & ~7u;
+
+  const double center = m_taps / 2 - 1;
+  const double halfWidth = m_taps / 2.0;
+  const double norm = BesselI0(filter.beta);
+
+  m_coeffs.assign(static_cast<size_t>(m_phases + 1) * m_taps, 0.0f);
+  std::vector<double> row(m_taps);
+  for (unsigned int phase = 0; phase <= m_phases; ++phase)
+  {
+    double sum = 0.0;
+    for (unsigned int tap = 0; tap < m_taps; ++tap)
+    {
+      const double x = tap - center - static_cast<double>(phase) / m_phases;
+      const double w = x / halfWidth;
+      const double window =
+          w * w < 1.0 ? BesselI0(filter.beta * std::sqrt(1.0 - w * w)) / norm : 0.0;
+      row[tap] = cutoff * Sinc(cutoff * x) * window;
+      sum += row[tap];
+    }
+
+    // unity gain at dc for every phase
+    float* coeffs = m_coeffs.data() + static_cast<size_t>(phase) * m_taps;
+    for (unsigned int tap = 0; tap < m_taps; ++tap)
+      coeffs[tap] = static_cast<float>(row[tap] / sum);
+  }
+
+  Reset();
+  return true;
+}
+
+void CAEPolyphaseResampler::Reset()
+{
+  // silence before the first frame, so that the first output is centered on it
+  m_end = m_taps / 2 - 1;
+  m_input.assign(m_channels, std::vector<float>(m_end, 0.0f));
+  m_pos = 0;
+  m_phase = 0.0;
+}
+
+void CAEPolyphaseResampler::Push(const float* const* planes, unsigned int frames)
+{
+  for (unsigned int ch = 0; ch < m_channels; ++ch)
+  {
+    // replace silence of a previous flush
+    m_input[ch].resize(m_end);
+    m_input[ch].insert(m_input[ch].end(), planes[ch], planes[ch] + frames);
+  }
+  m_end += frames;
+}
+
+void CAEPolyphaseResampler::Flush()
+{
+  for (unsigned int ch = 0; ch < m_channels; ++ch)
+    m_input[ch].resize(m_end + m_taps / 2, 0.0f);
+}
+
+unsigned int CAEPolyphaseResampler::Pull(float* const* planes, unsigned int frames, double ratio)
+{
+  if (m_channels == 0)
+    return 0;
+
+  double step = m_step;
+  if (ratio != 1.0)
+    step /= ratio;
+  else if (m_exact)
+  {
+    // back on the exact grid after a sync adjustment
+    m_phase = std::round(m_phase);
+    if (m_phase >= m_phases)
+    {
+      m_phase -= m_phases;
+      m_pos++;
+    }
+  }
+
+  const size_t available = m_input[0].size();
+  unsigned int count = 0;
+  for (; count < frames && m_pos + m_taps <= available; ++count)
+  {
+    const unsigned int index = static_cast<unsigned int>(m_phase);
+    const float frac = static_cast<float>(m_phase - index);
+    const float* coeffs = m_coeffs.data() + static_cast<size_t>(index) * m_taps;
+
+    for (unsigned int ch = 0; ch < m_channels; ++ch)
+    {
+      const float* input = m_input[ch].data() + m_pos;
+      float sample = m_kernels.DotProduct(input, coeffs, m_taps);
+      if (frac > 0.0f)
+      {
+        const float next = m_kernels.DotProduct(input, coeffs + m_taps, m_taps);
+        sample += frac * (next - sample);
+      }
+      planes[ch][count] = sample;
+    }
+
+    m_phase += step;
+    if (m_phase >= m_phases)
+    {
+      const double advance = std::floor(m_phase / m_phases);
+      m_phase -= advance * m_phases;
+      m_pos += static_cast<size_t>(advance);
+    }
+  }
+
+  Compact();
+  return count;
+}
+
+double CAEPolyphaseResampler::GetDelay() const
+{
+  const double center = m_pos + m_taps / 2 - 1 + m_phase / m_phases;
+  return std::max(0.0, static_cast<double>(m_end) - center);
+}
+
+void CAEPolyphaseResampler::Compact()
+{
+  if (m_pos < COMPACT_FRAMES)
+    return;
+
+  // a large step can move the window past the end of the input
+  const size_t drop = std::min(m_pos, m_input[0].size());
+  for (auto& input : m_input)
+    input.erase(input.begin(), input.begin() + drop);
+  m_end -= std::min(m_end, drop);
+  m_pos -= drop;
+}
@@ -0,0 +1,110 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+struct CAEKernels;
+
+/*!
+ * \brief Polyphase windowed-sinc sample rate converter for planar float audio.
+ *
+ * The filter bank is built once per rate pair. If the rates have a reasonably large common
+ * divisor (44.1k/48k and all the usual pairs) every output sample falls exactly on a phase
+ * of the bank and costs one dot product per channel. Otherwise, and while the ratio is
+ * being adjusted, the two neighbouring phases are interpolated. Adjusting the ratio only
+ * changes the step through the bank, nothing has to be rebuilt.
+ */
+class CAEPolyphaseResampler
+{
+public:
+  struct Filter
+  {
+    //! taps per phase for upsampling, scaled up for downsampling
+    unsigned int taps = 32;
+    //! passband edge relative to the nyquist frequency of the lower rate
+    double cutoff = 0.9;
+    //! kaiser window parameter, trades stopband attenuation for transition width
+    double beta = 8.0;
+  };
+
+  CAEPolyphaseResampler();
+
+  /*!
+   * \brief Build the filter bank and reset the converter
+   * \return false if a rate or the channel count is 0
+   */
+  bool Init(unsigned int channels,
+            unsigned int srcRate,
+            unsigned int dstRate,
+            const Filter& filter);
+
+  /*!
+   * \brief Drop all buffered input
+   */
+  void Reset();
+
+  /*!
+   * \brief Append input frames
+   */
+  void Push(const float* const* planes, unsigned int frames);
+
+  /*!
+   * \brief Pad the input with silence so the filter can reach the last frame pushed
+   */
+  void Flush();
+
+  /*!
+   * \brief Convert buffered input
+   * \param planes output, one plane per channel
+   * \param frames space in every plane
+   * \param ratio speed up output by this factor, used to follow an external clock
+   * \return number of frames written
+   */
+  unsigned int Pull(float* const* planes, unsigned int frames, double ratio = 1.0);
+
+  /*!
+   * \brief Input frames buffered which have not been converted yet
+   */
+  double GetDelay() const;
+
+  unsigned int GetChannels() const { return m_channels; }
+  unsigned int GetTaps() const { return m_taps; }
+  unsigned int GetPhases() const { return m_phases; }
+
+  /*!
+   * \brief True if the output hits the phases of the bank exactly at ratio 1.0
+   */
+  bool IsExact() const { return m_exact; }
+
+private:
+  void Compact();
+
+  const CAEKernels& m_kernels;
+  unsigned int m_channels = 0;
+  unsigned int m_taps = 0;
+  unsigned int m_phases = 0;
+  bool m_exact = false;
+
+  //! phases to advance per output frame at ratio 1.0
+  double m_step = 0.0;
+
+  //! (phases + 1) rows of taps, the last row is phase 0 of the next input frame
+  std::vector<float> m_coeffs;
+
+  std::vector<std::vector<float>> m_input;
+  //! first input frame of the filter window
+  size_t m_pos = 0;
+  //! position between m_pos and m_pos + 1 in phases
+  double m_phase = 0.0;
+  //! end of the pushed input, silence appended by Flush() follows
+  size_t m_end = 0;
+};
@@ -0,0 +1,178 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEVisualizationAnalyzer.h"
+
+#include "AEKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+
+constexpr double LOW_FREQUENCY = 50.0;
+constexpr double HIGH_FREQUENCY = 16000.0;
+
+// levels shown, in dB below full scale
+constexpr float RANGE = 60.0f;
+
+// bands fall at most this much per transform instead of jumping down
+constexpr float FALLOFF = 0.04f;
+
+} // namespace
+
+CAEVisualizationAnalyzer::CAEVisualizationAnalyzer()
+  : m_kernels(CAEKernels::Get()),
+    m_fft(FFT_SIZE),
+    m_fftInput(FFT_SIZE),
+    m_waveform(WAVEFORM_POINTS),
+    m_spectrum(SPECTRUM_BANDS)
+{
+}
+
+void CAEVisualizationAnalyzer::OnInitialize(int channels, int samplesPerSec, int bitsPerSample)
+{
+  m_channels = std::max(channels, 1);
+  m_sampleRate = std::max(samplesPerSec, 1);
+  m_pointFrames = std::max(1u, m_sampleRate / WAVEFORM_RATE);
+
+  // log spaced, but every band gets a bin of its own
+  for (unsigned int band = 0; band <= SPECTRUM_BANDS; ++band)
+  {
+    const double freq = LOW_FREQUENCY * std::pow(HIGH_FREQUENCY / LOW_FREQUENCY,
+                                                 static_cast<double>(band) / SPECTRUM_BANDS);
+    unsigned int bin = m_fft.GetBin(freq, m_sampleRate);
+    if (band > 0)
+      bin = std::max(bin, m_bandBins[band - 1] + 1);
+    m_bandBins[band] = std::min(bin, FFT_SIZE / 2 + 1);
+  }
+
+  Reset();
+}
+
+void CAEVisualizationAnalyzer::Reset()
+{
+  m_pointCount = 0;
+  m_pointPeak = 0.0f;
+  m_fftFill = 0;
+
+  std::unique_lock lock(m_section);
+  if (!m_valid)
+    return;
+  std::fill(m_waveform.begin(), m_waveform.end(), 0.0f);
+  std::fill(m_spectrum.begin(), m_spectrum.end(), 0.0f);
+  m_waveformPos = 0;
+  m_valid = false;
+}
+
+void CAEVisualizationAnalyzer::OnAudioData(const float* audioData, unsigned int audioDataLength)
+{
+  if (m_channels == 0)
+    return;
+
+  const unsigned int frames = audioDataLength / m_channels;
+  AddWaveform(audioData, frames);
+  AddSpectrum(audioData, frames);
+}
+
+void CAEVisualizationAnalyzer::AddWaveform(const float* samples, unsigned int frames)
+{
+  float points[WAVEFORM_POINTS];
+  unsigned int count = 0;
+
+  while (frames > 0)
+  {
+    const unsigned int chunk = std::min(frames, m_pointFrames - m_pointCount);
+    m_pointPeak = std::max(m_pointPeak, m_kernels.PeakArray(samples, chunk * m_channels));
+    m_pointCount += chunk;
+    samples += static_cast<size_t>(chunk) * m_channels;
+    frames -= chunk;
+
+    if (m_pointCount == m_pointFrames)
+    {
+      // a very large buffer only keeps its last points
+      points[count++ % WAVEFORM_POINTS] = std::min(m_pointPeak, 1.0f);
+      m_pointCount = 0;
+      m_pointPeak = 0.0f;
+    }
+  }
+
+  if (count == 0)
+    return;
+
+  std::unique_lock lock(m_section);
+  const unsigned int first = count > WAVEFORM_POINTS ? count - WAVEFORM_POINTS : 0;
+  for (unsigned int i = first; i < count; ++i)
+  {
+    m_waveform[m_waveformPos] = points[i % WAVEFORM_POINTS];
+    m_waveformPos = (m_waveformPos + 1) % WAVEFORM_POINTS;
+  }
+  m_valid = true;
+}
+
+void CAEVisualizationAnalyzer::AddSpectrum(const float* samples, unsigned int frames)
+{
+  // a full scale sine, hann windowed, sums up to this over half the bins
+  const float reference = 3.0f * FFT_SIZE * FFT_SIZE / 32.0f;
+
+  while (frames > 0)
+  {
+    const unsigned int chunk = std::min(frames, FFT_SIZE - m_fftFill);
+    float* input = m_fftInput.data() + m_fftFill;
+    for (unsigned int i = 0; i < chunk; ++i)
+    {
+      float sum = 0.0f;
+      for (unsigned int ch = 0; ch < m_channels; ++ch)
+        sum += *samples++;
+      input[i] = sum / m_channels;
+    }
+    m_fftFill += chunk;
+    frames -= chunk;
+
+    if (m_fftFill < FFT_SIZE)
+      break;
+
+    m_fft.Transform(m_fftInput.data());
+
+    float levels[SPECTRUM_BANDS];
+    for (unsigned int band = 0; band < SPECTRUM_BANDS; ++band)
+    {
+      const float energy = m_fft.GetEnergy(m_bandBins[band], m_bandBins[band + 1]);
+      const float db = 10.0f * std::log10(energy / reference + 1e-12f);
+      levels[band] = std::clamp(1.0f + db / RANGE, 0.0f, 1.0f);
+    }
+
+    {
+      std::unique_lock lock(m_section);
+      for (unsigned int band = 0; band < SPECTRUM_BANDS; ++band)
+        m_spectrum[band] = std::max(levels[band], m_spectrum[band] - FALLOFF);
+      m_valid = true;
+    }
+
+    // half overlapping transforms
+    std::memmove(m_fftInput.data(), m_fftInput.data() + FFT_SIZE / 2,
+                 FFT_SIZE / 2 * sizeof(float));
+    m_fftFill = FFT_SIZE / 2;
+  }
+}
+
+bool CAEVisualizationAnalyzer::GetFrame(AEVisualizationFrame& frame) const
+{
+  std::unique_lock lock(m_section);
+  if (!m_valid)
+    return false;
+
+  frame.waveform.resize(WAVEFORM_POINTS);
+  std::rotate_copy(m_waveform.begin(), m_waveform.begin() + m_waveformPos, m_waveform.end(),
+                   frame.waveform.begin());
+  frame.spectrum = m_spectrum;
+  return true;
+}
@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "AEFFT.h"
+#include "cores/AudioEngine/Interfaces/IAudioCallback.h"
+#include "threads/CriticalSection.h"
+
+#include <vector>
+
+struct CAEKernels;
+
+/*!
+ * \brief Waveform and spectrum of the audio being played, computed once for all consumers.
+ */
+struct AEVisualizationFrame
+{
+  //! peak of every 10ms of the last WAVEFORM_POINTS, oldest first, 1.0 is full scale
+  std::vector<float> waveform;
+  //! level of log spaced bands from 50Hz to 16kHz, 0.0 is -60dB and 1.0 full scale
+  std::vector<float> spectrum;
+};
+
+/*!
+ * \brief Analyses the visualisation stream of the audio engine.
+ *
+ * Registered as one more audio callback, so it gets the same resampled stereo audio in
+ * sync with the output as visualisation add-ons do. Peaks and band energies are computed
+ * with the vectorised kernels of the engine. Consumers like skin controls poll the last
+ * frame instead of analysing raw audio themselves.
+ */
+class CAEVisualizationAnalyzer : public IAudioCallback
+{
+public:
+  static constexpr unsigned int WAVEFORM_POINTS = 256;
+  static constexpr unsigned int WAVEFORM_RATE = 100;
+  static constexpr unsigned int SPECTRUM_BANDS = 32;
+  static constexpr unsigned int FFT_SIZE = 2048;
+
+  CAEVisualizationAnalyzer();
+
+  // implementation of IAudioCallback
+  void OnInitialize(int channels, int samplesPerSec, int bitsPerSample) override;
+  void OnAudioData(const float* audioData, unsigned int audioDataLength) override;
+
+  /*!
+   * \brief Forget the audio analysed, called when playback stops
+   */
+  void Reset();
+
+  /*!
+   * \brief Copy the latest waveform and spectrum
+   * \return false if nothing was analysed since the last reset
+   */
+  bool GetFrame(AEVisualizationFrame& frame) const;
+
+private:
+  void AddWaveform(const float* samples, unsigned int frames);
+  void AddSpectrum(const float* samples, unsigned int frames);
+
+  const CAEKernels& m_kernels;
+  unsigned int m_channels = 0;
+  unsigned int m_sampleRate = 0;
+
+  // analysis state, only used from the audio engine thread
+  unsigned int m_pointFrames = 0;
+  unsigned int m_pointCount = 0;
+  float m_pointPeak = 0.0f;
+  CAEFFT m_fft;
+  std::vector<float> m_fftInput;
+  unsigned int m_fftFill = 0;
+  unsigned int m_bandBins[SPECTRUM_BANDS + 1] = {};
+
+  // published results
+  mutable CCriticalSection m_section;
+  std::vector<float> m_waveform;
+  unsigned int m_waveformPos = 0;
+  std::vector<float> m_spectrum;
+  bool m_valid = false;
+};
@@ -0,0 +1,163 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "cores/AudioEngine/Utils/AEFingerprint.h"
+#include "utils/CPUInfo.h"
+
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+struct Note
+{
+  double freq[3];
+  double amplitude[3];
+};
+
+// a new chord every quarter second, computed from the time so any rate gives the same audio
+class CSong
+{
+public:
+  explicit CSong(unsigned int seed, double seconds = 62.0)
+  {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> freq(100.0, 400.0);
+    std::uniform_real_distribution<double> amplitude(0.05, 0.3);
+    m_notes.resize(static_cast<size_t>(seconds * 4) + 1);
+    for (Note& note : m_notes)
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        note.freq[i] = freq(gen);
+        note.amplitude[i] = amplitude(gen);
+      }
+    }
+    m_seconds = seconds;
+  }
+
+  std::vector<float> Render(unsigned int rate,
+                            unsigned int channels,
+                            double gain = 1.0,
+                            double silence = 0.0,
+                            double noise = 0.0) const
+  {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dither(-noise, noise);
+    const size_t lead = static_cast<size_t>(silence * rate);
+    const size_t frames = lead + static_cast<size_t>(m_seconds * rate);
+    std::vector<float> samples(frames * channels, 0.0f);
+    for (size_t i = lead; i < frames; ++i)
+    {
+      const double t = static_cast<double>(i - lead) / rate;
+      const size_t index = static_cast<size_t>(t * 4);
+      const double pos = t * 4 - index;
+      // fade every note in and out to keep clicks out of the spectrum
+      const double envelope = std::sin(std::numbers::pi * pos);
+      double sample = 0.0;
+      for (int n = 0; n < 3; ++n)
+      {
+        for (int harmonic = 1; harmonic <= HARMONICS; ++harmonic)
+          sample += m_notes[index].amplitude[n] / harmonic *
+                    std::sin(2.0 * std::numbers::pi * m_notes[index].freq[n] * harmonic * t);
+      }
+      sample = gain * envelope * sample + dither(gen);
+      for (unsigned int ch = 0; ch < channels; ++ch)
+        samples[i * channels + ch] = static_cast<float>(sample);
+    }
+    return samples;
+  }
+
+private:
+  static constexpr int HARMONICS = 6;
+
+  std::vector<Note> m_notes;
+  double m_seconds;
+};
+
+std::vector<uint32_t> Fingerprint(const std::vector<float>& samples,
+                                  unsigned int rate,
+                                  unsigned int channels)
+{
+  CAEFingerprint fingerprint;
+  EXPECT_TRUE(fingerprint.Init(channels, rate));
+
+  constexpr unsigned int CHUNK = 3000;
+  const size_t frames = samples.size() / channels;
+  for (size_t pos = 0; pos < frames; pos += CHUNK)
+  {
+    const size_t chunk = std::min<size_t>(CHUNK, frames - pos);
+    if (!fingerprint.AddSamples(samples.data() + pos * channels, static_cast<unsigned int>(chunk)))
+      break;
+  }
+  return fingerprint.GetFingerprint();
+}
+
+} // namespace
+
+class TestAEFingerprint : public testing::Test
+{
+protected:
+  TestAEFingerprint() { CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo()); }
+  ~TestAEFingerprint() override { CServiceBroker::UnregisterCPUInfo(); }
+};
+
+TEST_F(TestAEFingerprint, SameRecording)
+{
+  const CSong song(1);
+  const auto original = Fingerprint(song.Render(44100, 2), 44100, 2);
+  EXPECT_EQ(original.size(), CAEFingerprint::MAX_WORDS);
+
+  // another rate, quieter, some noise and a different delay
+  const auto copy = Fingerprint(song.Render(48000, 1, 0.5, 0.7, 0.003), 48000, 1);
+  EXPECT_EQ(copy.size(), CAEFingerprint::MAX_WORDS);
+  EXPECT_LT(CAEFingerprint::Compare(original, copy), 0.15f);
+
+  // already at the fingerprint rate, nothing to resample
+  const auto direct = Fingerprint(song.Render(11025, 2), 11025, 2);
+  EXPECT_LT(CAEFingerprint::Compare(original, direct), 0.1f);
+}
+
+TEST_F(TestAEFingerprint, DifferentRecordings)
+{
+  const auto a = Fingerprint(CSong(1, 20.0).Render(44100, 2), 44100, 2);
+  const auto b = Fingerprint(CSong(2, 20.0).Render(44100, 2), 44100, 2);
+  EXPECT_GT(CAEFingerprint::Compare(a, b), 0.4f);
+}
+
+TEST_F(TestAEFingerprint, Length)
+{
+  // a short song gives a short fingerprint, silence none at all
+  const auto shortSong = Fingerprint(CSong(3, 10.0).Render(44100, 2), 44100, 2);
+  EXPECT_NEAR(shortSong.size(), 10.0 * CAEFingerprint::SAMPLE_RATE / CAEFingerprint::HOP_SIZE, 5);
+
+  const auto silence = Fingerprint(std::vector<float>(44100 * 2 * 5, 0.0f), 44100, 2);
+  EXPECT_TRUE(silence.empty());
+
+  // lined up within the shift, nothing to compare without an overlap
+  const std::vector<uint32_t> shifted(shortSong.begin() + 5, shortSong.end());
+  EXPECT_FLOAT_EQ(CAEFingerprint::Compare(shortSong, shifted), 0.0f);
+  EXPECT_GT(CAEFingerprint::Compare(shortSong, shifted, 4), 0.2f);
+  EXPECT_FLOAT_EQ(CAEFingerprint::Compare(shortSong, {}), 1.0f);
+}
+
+TEST_F(TestAEFingerprint, Serialize)
+{
+  const std::vector<uint32_t> words = {0, 1, 0x80000000, 0xdeadbeef, 0xffffffff};
+  std::vector<uint32_t> result;
+  ASSERT_TRUE(CAEFingerprint::Deserialize(CAEFingerprint::Serialize(words), result));
+  EXPECT_EQ(result, words);
+
+  EXPECT_FALSE(CAEFingerprint::Deserialize("AAE=", result));
+}
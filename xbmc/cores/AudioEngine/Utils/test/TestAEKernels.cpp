@@ -0,0 +1,289 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "cores/AudioEngine/Utils/AEKernels.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+// odd sizes to exercise the scalar tails of the vector loops
+constexpr uint32_t SIZES[] = {0, 1, 3, 7, 8, 15, 16, 33, 1023};
+constexpr unsigned int CHANNELS[] = {1, 2, 4, 6, 8};
+
+std::vector<float> MakeSamples(uint32_t count, float range)
+{
+  std::mt19937 gen(count);
+  std::uniform_real_distribution<float> dist(-range, range);
+  std::vector<float> samples(count);
+  for (float& sample : samples)
+    sample = dist(gen);
+  return samples;
+}
+
+} // namespace
+
+class TestAEKernels : public testing::Test
+{
+protected:
+  TestAEKernels() { CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo()); }
+  ~TestAEKernels() override { CServiceBroker::UnregisterCPUInfo(); }
+};
+
+TEST_F(TestAEKernels, Available)
+{
+  const std::vector<const CAEKernels*> kernels = CAEKernels::GetAvailable();
+  ASSERT_FALSE(kernels.empty());
+  EXPECT_EQ(kernels.front(), &CAEKernels::GetGeneric());
+  EXPECT_EQ(&CAEKernels::Get(), kernels.back());
+}
+
+TEST_F(TestAEKernels, SelectedOnceCPUInfoIsRegistered)
+{
+  CServiceBroker::UnregisterCPUInfo();
+  const CAEKernels& kernels = CAEKernels::Get();
+  EXPECT_TRUE(&kernels == &CAEKernels::GetGeneric() ||
+              &kernels == CAEKernels::GetAvailable().back());
+
+  CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo());
+  EXPECT_EQ(&CAEKernels::Get(), CAEKernels::GetAvailable().back());
+}
+
+TEST_F(TestAEKernels, MulArray)
+{
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    for (uint32_t size : SIZES)
+    {
+      std::vector<float> data = MakeSamples(size, 1.0f);
+      const std::vector<float> ref = data;
+      kernels->MulArray(data.data(), 0.7f, size);
+      for (uint32_t i = 0; i < size; ++i)
+        EXPECT_FLOAT_EQ(data[i], ref[i] * 0.7f) << kernels->name << " size " << size;
+    }
+  }
+}
+
+TEST_F(TestAEKernels, MulAddArray)
+{
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    for (uint32_t size : SIZES)
+    {
+      std::vector<float> data = MakeSamples(size, 1.0f);
+      const std::vector<float> add = MakeSamples(size + 1, 1.0f);
+      const std::vector<float> ref = data;
+      kernels->MulAddArray(data.data(), add.data(), 0.3f, size);
+      // fused multiply add rounds once, allow a few ulp
+      for (uint32_t i = 0; i < size; ++i)
+        EXPECT_NEAR(data[i], ref[i] + add[i] * 0.3f, 1e-6f) << kernels->name << " size " << size;
+    }
+  }
+}
+
+TEST_F(TestAEKernels, ClampArray)
+{
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    for (uint32_t size : SIZES)
+    {
+      std::vector<float> data = MakeSamples(size, 2.0f);
+      const std::vector<float> ref = data;
+      kernels->ClampArray(data.data(), size);
+      for (uint32_t i = 0; i < size; ++i)
+        EXPECT_EQ(data[i], std::clamp(ref[i], -1.0f, 1.0f)) << kernels->name << " size " << size;
+    }
+  }
+}
+
+TEST_F(TestAEKernels, SoftClipArray)
+{
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    for (uint32_t size : SIZES)
+    {
+      std::vector<float> data = MakeSamples(size, 5.0f);
+      const std::vector<float> ref = data;
+      kernels->SoftClipArray(data.data(), size);
+      for (uint32_t i = 0; i < size; ++i)
+      {
+        const float x = std::clamp(ref[i], -3.0f, 3.0f);
+        const float expected = x * (27.0f + x * x) / (27.0f + 9.0f * x * x);
+        EXPECT_NEAR(data[i], expected, 1e-6f) << kernels->name << " size " << size;
+        EXPECT_LE(std::fabs(data[i]), 1.0f);
+      }
+    }
+  }
+}
+
+TEST_F(TestAEKernels, PeakArray)
+{
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    for (uint32_t size : SIZES)
+    {
+      std::vector<float> data = MakeSamples(size, 1.0f);
+      float expected = 0.0f;
+      for (float sample : data)
+        expected = std::max(expected, std::fabs(sample));
+      EXPECT_EQ(kernels->PeakArray(data.data(), size), expected)
+          << kernels->name << " size " << size;
+
+      // a peak in the tail must be found as well
+      if (size > 0)
+      {
+        data.back() = -4.0f;
+        EXPECT_EQ(kernels->PeakArray(data.data(), size), 4.0f) << kernels->name << " size " << size;
+      }
+    }
+  }
+}
+
+TEST_F(TestAEKernels, DotProduct)
+{
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    for (uint32_t size : SIZES)
+    {
+      const std::vector<float> a = MakeSamples(size, 1.0f);
+      const std::vector<float> b = MakeSamples(size + 1, 1.0f);
+      double expected = 0.0;
+      for (uint32_t i = 0; i < size; ++i)
+        expected += static_cast<double>(a[i]) * b[i];
+      // summation order differs between the kernels
+      EXPECT_NEAR(kernels->DotProduct(a.data(), b.data(), size), expected, 1e-4)
+          << kernels->name << " size " << size;
+    }
+  }
+}
+
+TEST_F(TestAEKernels, Interleave)
+{
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    for (unsigned int channels : CHANNELS)
+    {
+      for (uint32_t frames : SIZES)
+      {
+        const std::vector<float> interleaved = MakeSamples(frames * channels, 1.0f);
+
+        std::vector<std::vector<float>> planes(channels, std::vector<float>(frames));
+        std::vector<float*> planePtrs;
+        for (std::vector<float>& plane : planes)
+          planePtrs.push_back(plane.data());
+
+        kernels->Deinterleave(planePtrs.data(), interleaved.data(), channels, frames);
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+          for (unsigned int ch = 0; ch < channels; ++ch)
+            ASSERT_EQ(planes[ch][i], interleaved[i * channels + ch])
+                << kernels->name << " channels " << channels << " frames " << frames;
+        }
+
+        std::vector<float> result(frames * channels, 0.0f);
+        std::vector<const float*> constPlanePtrs(planePtrs.begin(), planePtrs.end());
+        kernels->Interleave(result.data(), constPlanePtrs.data(), channels, frames);
+        EXPECT_EQ(result, interleaved)
+            << kernels->name << " channels " << channels << " frames " << frames;
+      }
+    }
+  }
+}
+
+TEST_F(TestAEKernels, FloatToS16)
+{
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    for (uint32_t size : SIZES)
+    {
+      std::vector<float> data = MakeSamples(size, 1.2f);
+      std::vector<int16_t> result(size);
+      kernels->FloatToS16(result.data(), data.data(), size);
+      for (uint32_t i = 0; i < size; ++i)
+      {
+        const float expected = std::clamp(data[i] * 32768.0f, -32768.0f, 32767.0f);
+        EXPECT_NEAR(result[i], expected, 1.0f) << kernels->name << " size " << size;
+      }
+    }
+
+    const float limits[] = {-2.0f, -1.0f, 0.0f, 1.0f, 2.0f, -1.0f, 1.0f, 0.5f};
+    int16_t result[8];
+    kernels->FloatToS16(result, limits, 8);
+    EXPECT_EQ(result[0], -32768) << kernels->name;
+    EXPECT_EQ(result[1], -32768) << kernels->name;
+    EXPECT_EQ(result[2], 0) << kernels->name;
+    EXPECT_EQ(result[3], 32767) << kernels->name;
+    EXPECT_EQ(result[4], 32767) << kernels->name;
+    EXPECT_EQ(result[7], 16384) << kernels->name;
+  }
+}
+
+TEST_F(TestAEKernels, FloatToS32)
+{
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    const float limits[] = {-2.0f, -1.0f, 0.0f, 1.0f, 2.0f, 0.5f, -0.5f, 0.25f};
+    int32_t result[8];
+    kernels->FloatToS32(result, limits, 8);
+    EXPECT_EQ(result[0], INT32_MIN) << kernels->name;
+    EXPECT_EQ(result[1], INT32_MIN) << kernels->name;
+    EXPECT_EQ(result[2], 0) << kernels->name;
+    EXPECT_EQ(result[3], 2147483520) << kernels->name;
+    EXPECT_EQ(result[4], 2147483520) << kernels->name;
+    EXPECT_EQ(result[5], 1073741824) << kernels->name;
+    EXPECT_EQ(result[6], -1073741824) << kernels->name;
+    EXPECT_EQ(result[7], 536870912) << kernels->name;
+  }
+}
+
+// Mixing benchmark, the work ActiveAE does per period for a 7.1 stream at 192kHz with
+// a second stream and a gui sound mixed in. Run with
+//   kodi-test --gtest_also_run_disabled_tests --gtest_filter=TestAEKernels.DISABLED_Benchmark
+TEST_F(TestAEKernels, DISABLED_Benchmark)
+{
+  constexpr unsigned int channels = 8;
+  constexpr uint32_t frames = 192000 / 100;
+  constexpr uint32_t samples = frames * channels;
+  constexpr int periods = 100 * 60;
+
+  const std::vector<float> stream1 = MakeSamples(samples, 0.8f);
+  const std::vector<float> stream2 = MakeSamples(samples, 0.8f);
+  const std::vector<float> sound = MakeSamples(samples, 0.5f);
+  std::vector<float> out(samples);
+
+  for (const CAEKernels* kernels : CAEKernels::GetAvailable())
+  {
+    const auto start = std::chrono::steady_clock::now();
+    float peak = 0.0f;
+    for (int i = 0; i < periods; ++i)
+    {
+      std::fill(out.begin(), out.end(), 0.0f);
+      kernels->MulAddArray(out.data(), stream1.data(), 0.9f, samples);
+      kernels->MulAddArray(out.data(), stream2.data(), 0.6f, samples);
+      kernels->MulAddArray(out.data(), sound.data(), 0.3f, samples);
+      peak = std::max(peak, kernels->PeakArray(out.data(), samples));
+      kernels->MulArray(out.data(), 0.8f, samples);
+      kernels->SoftClipArray(out.data(), samples);
+    }
+    const std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    std::cout << kernels->name << ": " << elapsed.count() / 60.0
+              << " us per second of 7.1/192kHz audio (peak " << peak << ")" << std::endl;
+  }
+}
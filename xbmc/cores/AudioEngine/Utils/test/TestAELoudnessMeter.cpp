@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "cores/AudioEngine/Utils/AEChannelInfo.h"
+#include "cores/AudioEngine/Utils/AELoudnessMeter.h"
+#include "utils/CPUInfo.h"
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+// interleaved stereo sine, amplitude in dBFS, the right channel muted if requested
+std::vector<float> MakeSine(
+    double freq, double dbfs, unsigned int rate, double seconds, bool right = true, double phase = 0)
+{
+  const double amplitude = std::pow(10.0, dbfs / 20.0);
+  const unsigned int frames = static_cast<unsigned int>(rate * seconds);
+  std::vector<float> samples(frames * 2);
+  for (unsigned int i = 0; i < frames; ++i)
+  {
+    const float sample =
+        static_cast<float>(amplitude * std::sin(2.0 * std::numbers::pi * freq * i / rate + phase));
+    samples[i * 2] = sample;
+    samples[i * 2 + 1] = right ? sample : 0.0f;
+  }
+  return samples;
+}
+
+void Add(CAELoudnessMeter& meter, const std::vector<float>& samples)
+{
+  // odd chunks, blocks must not depend on how the audio is handed in
+  constexpr unsigned int CHUNK = 1000;
+  for (size_t pos = 0; pos < samples.size(); pos += CHUNK * 2)
+  {
+    const size_t frames = std::min<size_t>(CHUNK, (samples.size() - pos) / 2);
+    meter.AddSamples(samples.data() + pos, static_cast<unsigned int>(frames));
+  }
+}
+
+} // namespace
+
+class TestAELoudnessMeter : public testing::Test
+{
+protected:
+  TestAELoudnessMeter() { CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo()); }
+  ~TestAELoudnessMeter() override { CServiceBroker::UnregisterCPUInfo(); }
+};
+
+TEST_F(TestAELoudnessMeter, SineReference)
+{
+  // EBU Tech 3341: stereo 1kHz at -20dBFS reads -20 LUFS
+  for (unsigned int rate : {44100u, 48000u, 96000u})
+  {
+    CAELoudnessMeter meter;
+    ASSERT_TRUE(meter.Init(CAEChannelInfo(AE_CH_LAYOUT_2_0), rate));
+    Add(meter, MakeSine(1000.0, -20.0, rate, 5.0));
+    EXPECT_NEAR(meter.GetIntegratedLoudness(), -20.0, 0.1) << rate;
+  }
+
+  // BS.1770: 997Hz at full scale in one channel reads -3.01 LKFS
+  CAELoudnessMeter meter;
+  ASSERT_TRUE(meter.Init(CAEChannelInfo(AE_CH_LAYOUT_2_0), 48000));
+  Add(meter, MakeSine(997.0, 0.0, 48000, 5.0, false));
+  EXPECT_NEAR(meter.GetIntegratedLoudness(), -3.01, 0.05);
+}
+
+TEST_F(TestAELoudnessMeter, Gating)
+{
+  CAELoudnessMeter meter;
+  ASSERT_TRUE(meter.Init(CAEChannelInfo(AE_CH_LAYOUT_2_0), 48000));
+  EXPECT_TRUE(std::isinf(meter.GetIntegratedLoudness()));
+
+  // silence is below the absolute gate, a quiet part below the relative gate
+  Add(meter, MakeSine(1000.0, -20.0, 48000, 10.0));
+  Add(meter, std::vector<float>(48000 * 2 * 10, 0.0f));
+  Add(meter, MakeSine(1000.0, -40.0, 48000, 10.0));
+  EXPECT_NEAR(meter.GetIntegratedLoudness(), -20.0, 0.1);
+
+  // 400ms blocks every 100ms
+  EXPECT_EQ(meter.GetBlocks().size(), 297u);
+
+  meter.Reset();
+  EXPECT_TRUE(meter.GetBlocks().empty());
+  Add(meter, std::vector<float>(48000 * 2, 0.0f));
+  EXPECT_TRUE(std::isinf(meter.GetIntegratedLoudness()));
+}
+
+TEST_F(TestAELoudnessMeter, Album)
+{
+  CAELoudnessMeter loud;
+  CAELoudnessMeter quiet;
+  ASSERT_TRUE(loud.Init(CAEChannelInfo(AE_CH_LAYOUT_2_0), 44100));
+  ASSERT_TRUE(quiet.Init(CAEChannelInfo(AE_CH_LAYOUT_2_0), 44100));
+  Add(loud, MakeSine(1000.0, -20.0, 44100, 10.0));
+  Add(quiet, MakeSine(1000.0, -30.0, 44100, 10.0));
+
+  std::vector<float> album = loud.GetBlocks();
+  album.insert(album.end(), quiet.GetBlocks().begin(), quiet.GetBlocks().end());
+
+  // energy average of both, the quiet one is within the relative gate
+  EXPECT_NEAR(CAELoudnessMeter::GetIntegratedLoudness(album), 10.0 * std::log10(0.0055), 0.1);
+}
+
+TEST_F(TestAELoudnessMeter, TruePeak)
+{
+  // a quarter of the sample rate, sampled 45 degrees off its peaks
+  CAELoudnessMeter meter;
+  ASSERT_TRUE(meter.Init(CAEChannelInfo(AE_CH_LAYOUT_2_0), 48000));
+  Add(meter, MakeSine(12000.0, -1.0, 48000, 1.0, true, std::numbers::pi / 4));
+  EXPECT_NEAR(meter.GetTruePeak(), std::pow(10.0, -1.0 / 20.0), 0.02);
+
+  // without oversampling the peak of the samples
+  ASSERT_TRUE(meter.Init(CAEChannelInfo(AE_CH_LAYOUT_2_0), 192000));
+  Add(meter, MakeSine(1000.0, -6.0, 192000, 1.0));
+  EXPECT_NEAR(meter.GetTruePeak(), std::pow(10.0, -6.0 / 20.0), 0.001);
+}
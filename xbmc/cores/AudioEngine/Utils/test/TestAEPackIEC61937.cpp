@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AEPackIEC61937.h"
+
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+std::vector<uint8_t> MakeMATFrame()
+{
+  // payload behind the room for the IEC header, like CPackerMAT delivers it
+  std::vector<uint8_t> frame(MAX_IEC61937_PACKET, 0);
+  for (size_t i = IEC61937_DATA_OFFSET; i < frame.size(); ++i)
+    frame[i] = static_cast<uint8_t>(i * 7 + 3);
+  return frame;
+}
+
+std::vector<uint8_t> PackCopy(const std::vector<uint8_t>& frame)
+{
+  std::vector<uint8_t> packed(MAX_IEC61937_PACKET);
+  EXPECT_EQ(CAEPackIEC61937::PackTrueHD(frame.data() + IEC61937_DATA_OFFSET,
+                                        frame.size() - IEC61937_DATA_OFFSET, packed.data()),
+            MAX_IEC61937_PACKET);
+  return packed;
+}
+
+} // namespace
+
+TEST(TestAEPackIEC61937, TrueHDInPlace)
+{
+  std::vector<uint8_t> frame = MakeMATFrame();
+  const std::vector<uint8_t> expected = PackCopy(frame);
+
+  EXPECT_EQ(CAEPackIEC61937::PackTrueHDInPlace(frame.data(), false), MAX_IEC61937_PACKET);
+  EXPECT_EQ(frame, expected);
+}
+
+TEST(TestAEPackIEC61937, TrueHDInPlaceByteSwapped)
+{
+  std::vector<uint8_t> frame = MakeMATFrame();
+  std::vector<uint8_t> expected = PackCopy(frame);
+  for (size_t i = 0; i < expected.size(); i += 2)
+    std::swap(expected[i], expected[i + 1]);
+
+  EXPECT_EQ(CAEPackIEC61937::PackTrueHDInPlace(frame.data(), true), MAX_IEC61937_PACKET);
+  EXPECT_EQ(frame, expected);
+}
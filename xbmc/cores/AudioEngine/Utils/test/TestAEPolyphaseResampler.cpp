@@ -0,0 +1,228 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "cores/AudioEngine/Utils/AEPolyphaseResampler.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+constexpr unsigned int CHUNK = 1024;
+
+std::vector<float> MakeSine(double freq, unsigned int rate, unsigned int frames)
+{
+  std::vector<float> samples(frames);
+  for (unsigned int i = 0; i < frames; ++i)
+    samples[i] = static_cast<float>(0.5 * std::sin(2.0 * std::numbers::pi * freq * i / rate));
+  return samples;
+}
+
+// push the same signal to all channels in chunks and collect the output of the first one
+std::vector<float> Convert(CAEPolyphaseResampler& resampler,
+                           const std::vector<float>& input,
+                           double ratio = 1.0,
+                           bool flush = true)
+{
+  const unsigned int channels = resampler.GetChannels();
+  std::vector<std::vector<float>> out(channels, std::vector<float>(CHUNK * 4));
+  std::vector<float*> outPlanes;
+  for (auto& plane : out)
+    outPlanes.push_back(plane.data());
+
+  std::vector<float> result;
+  auto pull = [&]()
+  {
+    unsigned int frames;
+    while ((frames = resampler.Pull(outPlanes.data(), CHUNK * 4, ratio)) > 0)
+      result.insert(result.end(), out[0].begin(), out[0].begin() + frames);
+  };
+
+  for (size_t pos = 0; pos < input.size(); pos += CHUNK)
+  {
+    const unsigned int frames = std::min<size_t>(CHUNK, input.size() - pos);
+    std::vector<const float*> inPlanes(channels, input.data() + pos);
+    resampler.Push(inPlanes.data(), frames);
+    pull();
+  }
+
+  if (flush)
+  {
+    resampler.Flush();
+    pull();
+  }
+  return result;
+}
+
+double Rms(const std::vector<float>& samples, size_t start, size_t end)
+{
+  double sum = 0.0;
+  for (size_t i = start; i < end; ++i)
+    sum += static_cast<double>(samples[i]) * samples[i];
+  return std::sqrt(sum / (end - start));
+}
+
+} // namespace
+
+class TestAEPolyphaseResampler : public testing::Test
+{
+protected:
+  TestAEPolyphaseResampler() { CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo()); }
+  ~TestAEPolyphaseResampler() override { CServiceBroker::UnregisterCPUInfo(); }
+};
+
+TEST_F(TestAEPolyphaseResampler, FilterBank)
+{
+  CAEPolyphaseResampler resampler;
+  EXPECT_FALSE(resampler.Init(0, 44100, 48000, {}));
+  EXPECT_FALSE(resampler.Init(2, 0, 48000, {}));
+
+  ASSERT_TRUE(resampler.Init(2, 44100, 48000, {}));
+  EXPECT_TRUE(resampler.IsExact());
+  EXPECT_EQ(resampler.GetPhases(), 320u);
+  EXPECT_EQ(resampler.GetTaps(), 32u);
+
+  // longer filter for the lower cutoff
+  ASSERT_TRUE(resampler.Init(2, 192000, 48000, {}));
+  EXPECT_TRUE(resampler.IsExact());
+  EXPECT_EQ(resampler.GetTaps(), 128u);
+
+  ASSERT_TRUE(resampler.Init(2, 44100, 47999, {}));
+  EXPECT_FALSE(resampler.IsExact());
+}
+
+TEST_F(TestAEPolyphaseResampler, Upsample)
+{
+  constexpr unsigned int srcRate = 44100;
+  constexpr unsigned int dstRate = 48000;
+
+  CAEPolyphaseResampler resampler;
+  ASSERT_TRUE(resampler.Init(2, srcRate, dstRate, {}));
+
+  const std::vector<float> output = Convert(resampler, MakeSine(1000.0, srcRate, srcRate));
+  EXPECT_NEAR(output.size(), dstRate, 1.0);
+
+  // output frame n is input time n / dstRate
+  const std::vector<float> reference = MakeSine(1000.0, dstRate, output.size());
+  double error = 0.0;
+  for (size_t i = resampler.GetTaps(); i < output.size() - resampler.GetTaps(); ++i)
+    error = std::max(error, std::fabs(static_cast<double>(output[i]) - reference[i]));
+  EXPECT_LT(error, 1e-3);
+}
+
+TEST_F(TestAEPolyphaseResampler, DownsampleRejectsAliases)
+{
+  constexpr unsigned int srcRate = 96000;
+  constexpr unsigned int dstRate = 44100;
+
+  CAEPolyphaseResampler resampler;
+  ASSERT_TRUE(resampler.Init(1, srcRate, dstRate, {}));
+
+  // 30kHz is above the nyquist frequency of the output and would alias to 14.1kHz
+  const std::vector<float> aliased = Convert(resampler, MakeSine(30000.0, srcRate, srcRate));
+  ASSERT_GT(aliased.size(), 1000u);
+  EXPECT_LT(Rms(aliased, 500, aliased.size() - 500), 0.5 * 1e-3);
+
+  resampler.Reset();
+  const std::vector<float> passed = Convert(resampler, MakeSine(10000.0, srcRate, srcRate));
+  EXPECT_NEAR(Rms(passed, 500, passed.size() - 500), 0.5 * std::numbers::sqrt2 / 2, 0.01);
+}
+
+TEST_F(TestAEPolyphaseResampler, Ratio)
+{
+  constexpr unsigned int rate = 48000;
+
+  CAEPolyphaseResampler resampler;
+  ASSERT_TRUE(resampler.Init(2, rate, rate, {}));
+
+  const std::vector<float> input = MakeSine(440.0, rate, rate);
+
+  // speeding up the output produces more frames, the signal stays clean
+  const std::vector<float> faster = Convert(resampler, input, 1.01);
+  EXPECT_NEAR(faster.size(), rate * 1.01, 2.0);
+  const std::vector<float> reference = MakeSine(440.0 / 1.01, rate, faster.size());
+  double error = 0.0;
+  for (size_t i = resampler.GetTaps(); i < faster.size() - resampler.GetTaps(); ++i)
+    error = std::max(error, std::fabs(static_cast<double>(faster[i]) - reference[i]));
+  EXPECT_LT(error, 1e-3);
+
+  resampler.Reset();
+  const std::vector<float> slower = Convert(resampler, input, 0.99);
+  EXPECT_NEAR(slower.size(), rate * 0.99, 2.0);
+
+  // back at 1.0 every output frame is an input frame again
+  resampler.Reset();
+  const std::vector<float> same = Convert(resampler, input, 1.0);
+  ASSERT_EQ(same.size(), input.size());
+  for (size_t i = resampler.GetTaps(); i < same.size() - resampler.GetTaps(); ++i)
+    ASSERT_NEAR(same[i], input[i], 1e-3) << i;
+}
+
+TEST_F(TestAEPolyphaseResampler, DelayAndFlush)
+{
+  constexpr unsigned int srcRate = 48000;
+  constexpr unsigned int dstRate = 44100;
+  constexpr unsigned int frames = 4800;
+
+  CAEPolyphaseResampler resampler;
+  ASSERT_TRUE(resampler.Init(2, srcRate, dstRate, {}));
+  EXPECT_DOUBLE_EQ(resampler.GetDelay(), 0.0);
+
+  const std::vector<float> input(frames, 0.25f);
+
+  // without flush the filter keeps half of its length as look ahead
+  const std::vector<float> output = Convert(resampler, input, 1.0, false);
+  EXPECT_LE(resampler.GetDelay(), resampler.GetTaps() / 2 + 1.0);
+  EXPECT_GT(resampler.GetDelay(), resampler.GetTaps() / 2 - 2.0);
+
+  resampler.Flush();
+  std::vector<float> left(1024), right(1024);
+  float* planes[] = {left.data(), right.data()};
+  const unsigned int tail = resampler.Pull(planes, 1024);
+  EXPECT_NEAR(output.size() + tail, frames * dstRate / srcRate, 1.0);
+  EXPECT_DOUBLE_EQ(resampler.GetDelay(), 0.0);
+  EXPECT_EQ(resampler.Pull(planes, 1024), 0u);
+
+  // dc passes at unity gain
+  for (size_t i = resampler.GetTaps(); i < output.size(); ++i)
+    ASSERT_NEAR(output[i], 0.25f, 1e-4) << i;
+}
+
+// Cost of converting one minute of stereo 44.1kHz to 48kHz. Run with
+//   kodi-test --gtest_also_run_disabled_tests --gtest_filter=TestAEPolyphaseResampler.*
+TEST_F(TestAEPolyphaseResampler, DISABLED_Benchmark)
+{
+  constexpr unsigned int srcRate = 44100;
+  constexpr unsigned int dstRate = 48000;
+
+  const std::vector<float> input = MakeSine(1000.0, srcRate, srcRate * 60);
+  for (unsigned int taps : {16u, 32u, 64u})
+  {
+    CAEPolyphaseResampler resampler;
+    CAEPolyphaseResampler::Filter filter;
+    filter.taps = taps;
+    ASSERT_TRUE(resampler.Init(2, srcRate, dstRate, filter));
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<float> output = Convert(resampler, input);
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    std::cout << taps << " taps: " << elapsed.count() << " ms per minute, " << output.size()
+              << " frames" << std::endl;
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "cores/AudioEngine/Utils/AEVisualizationAnalyzer.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+constexpr unsigned int RATE = 44100;
+
+// interleaved stereo sine
+std::vector<float> MakeSine(double freq, float amplitude, double seconds)
+{
+  const unsigned int frames = static_cast<unsigned int>(RATE * seconds);
+  std::vector<float> samples(frames * 2);
+  for (unsigned int i = 0; i < frames; ++i)
+  {
+    samples[i * 2] = samples[i * 2 + 1] =
+        amplitude * static_cast<float>(std::sin(2.0 * std::numbers::pi * freq * i / RATE));
+  }
+  return samples;
+}
+
+} // namespace
+
+class TestAEVisualizationAnalyzer : public testing::Test
+{
+protected:
+  TestAEVisualizationAnalyzer() { CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo()); }
+  ~TestAEVisualizationAnalyzer() override { CServiceBroker::UnregisterCPUInfo(); }
+};
+
+TEST_F(TestAEVisualizationAnalyzer, Sine)
+{
+  CAEVisualizationAnalyzer analyzer;
+  analyzer.OnInitialize(2, RATE, 32);
+
+  AEVisualizationFrame frame;
+  EXPECT_FALSE(analyzer.GetFrame(frame));
+
+  // delivered in buffers of an odd size, like the engine does
+  const std::vector<float> samples = MakeSine(1000.0, 0.5f, 3.0);
+  for (size_t pos = 0; pos < samples.size(); pos += 2 * 1000)
+  {
+    const size_t count = std::min<size_t>(2 * 1000, samples.size() - pos);
+    analyzer.OnAudioData(samples.data() + pos, static_cast<unsigned int>(count));
+  }
+
+  ASSERT_TRUE(analyzer.GetFrame(frame));
+  ASSERT_EQ(CAEVisualizationAnalyzer::WAVEFORM_POINTS, frame.waveform.size());
+  ASSERT_EQ(CAEVisualizationAnalyzer::SPECTRUM_BANDS, frame.spectrum.size());
+
+  // three seconds of audio fill all points
+  for (const float peak : frame.waveform)
+    EXPECT_NEAR(0.5f, peak, 0.01f);
+
+  // -6dB shows as 0.9 in the band holding 1kHz, far away bands see only window leakage
+  const auto loudest = std::max_element(frame.spectrum.begin(), frame.spectrum.end());
+  EXPECT_NEAR(0.9f, *loudest, 0.05f);
+  const size_t band = loudest - frame.spectrum.begin();
+  for (size_t i = 0; i < frame.spectrum.size(); ++i)
+  {
+    if (i + 4 < band || i > band + 4)
+      EXPECT_LT(frame.spectrum[i], 0.3f) << "band " << i;
+  }
+
+  analyzer.Reset();
+  EXPECT_FALSE(analyzer.GetFrame(frame));
+}
+
+TEST_F(TestAEVisualizationAnalyzer, Falloff)
+{
+  CAEVisualizationAnalyzer analyzer;
+  analyzer.OnInitialize(2, RATE, 32);
+
+  const std::vector<float> loud = MakeSine(1000.0, 1.0f, 0.5);
+  analyzer.OnAudioData(loud.data(), static_cast<unsigned int>(loud.size()));
+  AEVisualizationFrame before;
+  ASSERT_TRUE(analyzer.GetFrame(before));
+
+  // a few transforms of silence lower the bands gradually
+  const std::vector<float> silence(2 * 4096, 0.0f);
+  analyzer.OnAudioData(silence.data(), static_cast<unsigned int>(silence.size()));
+  AEVisualizationFrame after;
+  ASSERT_TRUE(analyzer.GetFrame(after));
+
+  const auto loudest = std::max_element(before.spectrum.begin(), before.spectrum.end());
+  const float level = after.spectrum[loudest - before.spectrum.begin()];
+  EXPECT_LT(level, *loudest);
+  EXPECT_GT(level, 0.5f);
+  EXPECT_NEAR(0.0f, after.waveform.back(), 1e-6f);
+}
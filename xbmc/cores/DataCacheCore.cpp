@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "cores/EdlEdit.h"
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
 #include <utility>
@@ -322,6 +323,45 @@ bool CDataCacheCore::IsRenderClockSync()
   return m_renderInfo.m_isClockSync;
 }
 
+void CDataCacheCore::AddRenderFrameStats(int queued, bool late, int skipped)
+{
+  std::unique_lock lock(m_renderSection);
+
+  SRenderFrameStats& stats = m_renderInfo.m_frameStats;
+  const size_t depth = static_cast<size_t>(std::max(queued, 0));
+  if (stats.queueDepthHistogram.size() <= depth)
+    stats.queueDepthHistogram.resize(depth + 1, 0);
+  stats.queueDepthHistogram[depth]++;
+
+  if (late)
+    stats.lateFrames++;
+  if (skipped > 0)
+    stats.droppedFrames += skipped;
+}
+
+void CDataCacheCore::AddRenderDroppedFrames(int dropped)
+{
+  std::unique_lock lock(m_renderSection);
+
+  if (dropped > 0)
+    m_renderInfo.m_frameStats.droppedFrames += dropped;
+}
+
+void CDataCacheCore::SetRenderAheadDepth(int depth, int maxDepth)
+{
+  std::unique_lock lock(m_renderSection);
+
+  m_renderInfo.m_frameStats.renderAheadDepth = depth;
+  m_renderInfo.m_frameStats.renderAheadMaxDepth = maxDepth;
+}
+
+CDataCacheCore::SRenderFrameStats CDataCacheCore::GetRenderFrameStats()
+{
+  std::unique_lock lock(m_renderSection);
+
+  return m_renderInfo.m_frameStats;
+}
+
 // player states
 void CDataCacheCore::SeekFinished(int64_t offset)
 {
@@ -336,6 +376,33 @@ int64_t CDataCacheCore::GetSeekOffSet() const
   return m_stateInfo.m_lastSeekOffset;
 }
 
+void CDataCacheCore::AddPlayerOperationTime(PlayerOperation operation,
+                                            std::chrono::milliseconds duration,
+                                            bool pipelined)
+{
+  if (operation >= PlayerOperation::MAX)
+    return;
+
+  std::unique_lock lock(m_stateSection);
+  SPlayerOperationTiming& timing = m_stateInfo.m_operationTiming[static_cast<size_t>(operation)];
+  timing.count++;
+  if (pipelined)
+    timing.pipelined++;
+  timing.last = duration;
+  timing.max = std::max(timing.max, duration);
+  timing.total += duration;
+}
+
+CDataCacheCore::SPlayerOperationTiming CDataCacheCore::GetPlayerOperationTiming(
+    PlayerOperation operation) const
+{
+  if (operation >= PlayerOperation::MAX)
+    return {};
+
+  std::unique_lock lock(m_stateSection);
+  return m_stateInfo.m_operationTiming[static_cast<size_t>(operation)];
+}
+
 bool CDataCacheCore::HasPerformedSeek(int64_t lastSecondInterval) const
 {
   std::unique_lock lock(m_stateSection);
@@ -11,6 +11,7 @@
 #include "EdlEdit.h"
 #include "threads/CriticalSection.h"
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <string>
@@ -19,6 +20,47 @@
 class CDataCacheCore
 {
 public:
+  /*!
+   * @brief Frame timing statistics of the video render queue
+   */
+  struct SRenderFrameStats
+  {
+    /*!< number of presented frames per render queue depth, indexed by depth */
+    std::vector<uint64_t> queueDepthHistogram;
+    /*!< number of frames presented after their due time */
+    uint64_t lateFrames{0};
+    /*!< number of frames dropped by the decoder or skipped by the renderer */
+    uint64_t droppedFrames{0};
+    /*!< current render-ahead depth and the maximum the renderer was configured for */
+    int renderAheadDepth{0};
+    int renderAheadMaxDepth{0};
+  };
+
+  /*!
+   * @brief Player operations that interrupt playback and are timed
+   */
+  enum class PlayerOperation
+  {
+    AUDIO_STREAM_SWITCH,
+    SUBTITLE_STREAM_SWITCH,
+    CHAPTER_SKIP,
+    MAX
+  };
+
+  /*!
+   * @brief Timing of a player operation, from the request until playback continued
+   */
+  struct SPlayerOperationTiming
+  {
+    /*!< number of completed operations */
+    uint64_t count{0};
+    /*!< number of operations done without flushing the whole pipeline */
+    uint64_t pipelined{0};
+    std::chrono::milliseconds last{0};
+    std::chrono::milliseconds max{0};
+    std::chrono::milliseconds total{0};
+  };
+
   CDataCacheCore();
   virtual ~CDataCacheCore();
   static CDataCacheCore& GetInstance();
@@ -118,6 +160,33 @@ public:
   void SetRenderClockSync(bool enabled);
   bool IsRenderClockSync();
 
+  /*!
+   * @brief Account a presented frame in the render frame stats.
+   * @param queued Number of frames left in the render queue
+   * @param late True if the frame was presented after its due time
+   * @param skipped Number of late frames the renderer skipped to present this one
+   */
+  void AddRenderFrameStats(int queued, bool late, int skipped);
+
+  /*!
+   * @brief Account frames dropped by the decoder or player in the render frame stats.
+   * @param dropped Number of dropped frames
+   */
+  void AddRenderDroppedFrames(int dropped);
+
+  /*!
+   * @brief Set the render-ahead depth of the video render queue.
+   * @param depth The number of buffers currently allowed to be queued
+   * @param maxDepth The number of buffers the renderer was configured for
+   */
+  void SetRenderAheadDepth(int depth, int maxDepth);
+
+  /*!
+   * @brief Get the render frame stats accumulated since the last reset.
+   * @return A copy of the render frame stats
+   */
+  SRenderFrameStats GetRenderFrameStats();
+
   // player states
   /*!
    * @brief Notifies the cache core that a seek operation has finished
@@ -141,6 +210,23 @@ public:
   */
   int64_t GetSeekOffSet() const;
 
+  /*!
+   * @brief Account a completed stream switch or chapter skip
+   * @param operation - the operation that completed
+   * @param duration - time from the request until playback continued
+   * @param pipelined - true if the operation did not flush the whole pipeline
+   */
+  void AddPlayerOperationTime(PlayerOperation operation,
+                              std::chrono::milliseconds duration,
+                              bool pipelined);
+
+  /*!
+   * @brief Gets the timing of an operation accumulated since the last reset
+   * @param operation - the operation
+   * @return a copy of the timing
+   */
+  SPlayerOperationTiming GetPlayerOperationTiming(PlayerOperation operation) const;
+
   void SetSpeed(float tempo, float speed);
   float GetSpeed();
   float GetTempo();
@@ -306,6 +392,7 @@ protected:
   struct SRenderInfo
   {
     bool m_isClockSync;
+    SRenderFrameStats m_frameStats;
   } m_renderInfo{};
 
   mutable CCriticalSection m_stateSection;
@@ -323,6 +410,9 @@ protected:
         std::chrono::time_point<std::chrono::system_clock>{}};
     /*! Last seek offset */
     int64_t m_lastSeekOffset{0};
+    /*! Timing of stream switches and chapter skips */
+    std::array<SPlayerOperationTiming, static_cast<size_t>(PlayerOperation::MAX)>
+        m_operationTiming{};
   } m_stateInfo;
 
   struct STimeInfo
@@ -221,6 +221,12 @@ public:
     caps.assign(1, IPlayerAudioCaps::ALL);
   }
 
+  /*!
+   * \brief Peaks of the whole playing song, 1.0 is full scale
+   * \return false if the player does not know them (yet)
+   */
+  virtual bool GetWaveform(std::vector<float>& peaks) const { return false; }
+
   /*!
    * \brief Define the subtitle capabilities of the player
    */
@@ -497,6 +497,9 @@ void CRPRenderManager::RenderInternal(const std::shared_ptr<CRPBaseRenderer>& re
     renderBuffer->Release();
   }
 
+  // the GUI drawn so far has to be below the frame
+  m_renderContext.FlushBatchedDraws();
+
   renderer->RenderFrame(bClear, alpha);
 }
 
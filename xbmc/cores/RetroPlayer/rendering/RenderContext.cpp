@@ -71,6 +71,11 @@ void CRenderContext::ApplyStateBlock()
   m_rendering->ApplyStateBlock();
 }
 
+void CRenderContext::FlushBatchedDraws()
+{
+  m_rendering->FlushBatchedDraws();
+}
+
 bool CRenderContext::IsExtSupported(const char* extension)
 {
   return m_rendering->IsExtSupported(extension);
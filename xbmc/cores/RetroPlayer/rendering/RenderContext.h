@@ -62,6 +62,7 @@ public:
   void SetScissors(const CRect& rect);
   void CaptureStateBlock();
   void ApplyStateBlock();
+  void FlushBatchedDraws();
   bool IsExtSupported(const char* extension);
 
   // OpenGL(ES) rendering functions
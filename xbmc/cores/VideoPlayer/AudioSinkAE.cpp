@@ -256,6 +256,14 @@ double CAudioSinkAE::GetCacheTime()
   return m_pAudioStream->GetCacheTime();
 }
 
+CAEStreamLatency CAudioSinkAE::GetLatency()
+{
+  std::unique_lock lock(m_critSection);
+  if (!m_pAudioStream)
+    return {};
+  return m_pAudioStream->GetLatency();
+}
+
 double CAudioSinkAE::GetCacheTotal()
 {
   std::unique_lock lock(m_critSection);
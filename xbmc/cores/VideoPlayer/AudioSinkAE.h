@@ -46,6 +46,7 @@ public:
   double GetMaxDelay(); // returns total time of audio in AE for the stream
   double GetDelay(); // returns the time it takes to play a packet if we add one at this time
   double GetSyncError();
+  CAEStreamLatency GetLatency();
   void SetSyncErrorCorrection(double correction);
 
   /*!
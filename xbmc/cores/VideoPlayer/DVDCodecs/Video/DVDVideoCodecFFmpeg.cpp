@@ -11,6 +11,7 @@
 #include "DVDCodecs/DVDCodecs.h"
 #include "DVDCodecs/DVDFactoryCodec.h"
 #include "DVDStreamInfo.h"
+#include "DVDVideoCodecThreading.h"
 #include "ServiceBroker.h"
 #include "cores/FFmpeg.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
@@ -383,12 +384,33 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
     }
     else
     {
-      int num_threads = CServiceBroker::GetCPUInfo()->GetCPUCount() * 3 / 2;
-      num_threads = std::max(1, std::min(num_threads, 16));
-      m_pCodecContext->thread_count = num_threads;
+      CDVDVideoCodecThreading::Stream stream;
+      stream.width = hints.width;
+      stream.height = hints.height;
+      stream.hasFrameThreads = (pCodec->capabilities & AV_CODEC_CAP_FRAME_THREADS) != 0;
+      stream.hasSliceThreads = (pCodec->capabilities & AV_CODEC_CAP_SLICE_THREADS) != 0;
+      stream.lowDelay = m_processInfo.IsRealtimeStream();
+
+      const CDVDVideoCodecThreading::Config config = CDVDVideoCodecThreading::GetConfig();
+      const CDVDVideoCodecThreading::Result threading =
+          CDVDVideoCodecThreading::Select(config, stream, m_threadBoost);
+
+      // a boost is only worth a reopen if it gives the decoder more resources
+      const bool adaptive = CServiceBroker::GetSettingsComponent()
+                                ->GetAdvancedSettings()
+                                ->m_videoAdaptiveDecodeThreads;
+      m_threadBoostAvailable = adaptive && !m_threadBoost &&
+                               CDVDVideoCodecThreading::Select(config, stream, true) != threading;
+      m_threadStats = {};
+
+      m_pCodecContext->thread_count = threading.threadCount;
+      m_pCodecContext->thread_type =
+          threading.type == CDVDVideoCodecThreading::ThreadType::SLICE ? FF_THREAD_SLICE
+                                                                       : FF_THREAD_FRAME;
       m_decoderState = STATE_SW_MULTI;
-      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open frame threaded with {} threads",
-                num_threads);
+      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open {} threaded with {} threads{}",
+                CDVDVideoCodecThreading::ThreadTypeToString(threading.type),
+                threading.threadCount, m_threadBoost ? " (boosted)" : "");
     }
   }
   else
@@ -792,6 +814,30 @@ CDVDVideoCodec::VCReturn CDVDVideoCodecFFmpeg::GetPicture(VideoPicture* pVideoPi
   }
   m_dropCtrl.Process(framePTS, m_pCodecContext->skip_frame > AVDISCARD_DEFAULT);
 
+  // player asks to drop frames when we can't keep up, reopen with more threads if that
+  // happens for a significant share of the frames
+  if (m_threadBoostAvailable)
+  {
+    m_threadStats.frames++;
+    if (m_pCodecContext->skip_frame > AVDISCARD_DEFAULT)
+      m_threadStats.dropped++;
+
+    if (m_threadStats.frames >= 250)
+    {
+      if (m_threadStats.dropped * 10 > m_threadStats.frames)
+      {
+        CLog::Log(LOGINFO,
+                  "CDVDVideoCodecFFmpeg::GetPicture - decoder falling behind ({} of {} frames "
+                  "dropped), reopening with more threads",
+                  m_threadStats.dropped, m_threadStats.frames);
+        m_threadBoost = true;
+        m_threadBoostAvailable = false;
+        return VC_REOPEN;
+      }
+      m_threadStats = {};
+    }
+  }
+
   if (m_pDecodedFrame->flags & AV_FRAME_FLAG_KEY)
   {
     m_started = true;
@@ -99,6 +99,14 @@ protected:
   CDVDStreamInfo m_hints;
   CDVDCodecOptions m_options;
 
+  bool m_threadBoost = false;
+  bool m_threadBoostAvailable = false;
+  struct
+  {
+    int frames = 0;
+    int dropped = 0;
+  } m_threadStats;
+
   struct CDropControl
   {
     CDropControl();
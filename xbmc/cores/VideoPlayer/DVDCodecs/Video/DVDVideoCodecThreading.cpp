@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DVDVideoCodecThreading.h"
+
+#include "ServiceBroker.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/CPUInfo.h"
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace
+{
+// streams up to this size don't scale beyond a few threads
+constexpr int SD_PIXELS = 720 * 576;
+constexpr int SD_MAX_THREADS = 4;
+} // namespace
+
+CDVDVideoCodecThreading::Result CDVDVideoCodecThreading::Select(const Config& config,
+                                                                const Stream& stream,
+                                                                bool boost)
+{
+  Result result;
+
+  int cores = std::max(1, config.cpuCount);
+  if (!boost)
+    cores = std::max(1, cores - config.reservedCores);
+
+  // frame threading hides decode latency best, slice threading keeps the delay of one frame
+  ThreadType type = config.type;
+  if (type == ThreadType::AUTO)
+  {
+    if (stream.lowDelay && stream.hasSliceThreads && !boost)
+      type = ThreadType::SLICE;
+    else
+      type = stream.hasFrameThreads ? ThreadType::FRAME : ThreadType::SLICE;
+  }
+  if (type == ThreadType::FRAME && !stream.hasFrameThreads)
+    type = ThreadType::SLICE;
+  else if (type == ThreadType::SLICE && !stream.hasSliceThreads)
+    type = ThreadType::FRAME;
+  result.type = type;
+
+  int threads = config.maxThreads;
+  if (threads <= 0)
+  {
+    // frame threads block on each other's references, oversubscribe a bit
+    threads = type == ThreadType::FRAME ? cores * 3 / 2 : cores;
+    if (!boost && stream.width * stream.height > 0 && stream.width * stream.height <= SD_PIXELS)
+      threads = std::min(threads, SD_MAX_THREADS);
+  }
+  result.threadCount = std::clamp(threads, 1, MAX_THREADS);
+
+  return result;
+}
+
+CDVDVideoCodecThreading::Config CDVDVideoCodecThreading::GetConfig()
+{
+  const std::shared_ptr<CAdvancedSettings> advancedSettings =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+
+  Config config;
+  if (const std::shared_ptr<CCPUInfo> cpuInfo = CServiceBroker::GetCPUInfo())
+    config.cpuCount = cpuInfo->GetCPUCount();
+  config.reservedCores = advancedSettings->m_videoDecodeReservedCores;
+  config.maxThreads = advancedSettings->m_videoDecodeThreads;
+  config.type = ParseThreadType(advancedSettings->m_videoDecodeThreadType);
+  return config;
+}
+
+CDVDVideoCodecThreading::ThreadType CDVDVideoCodecThreading::ParseThreadType(
+    const std::string& type)
+{
+  if (StringUtils::EqualsNoCase(type, "frame"))
+    return ThreadType::FRAME;
+  else if (StringUtils::EqualsNoCase(type, "slice"))
+    return ThreadType::SLICE;
+
+  return ThreadType::AUTO;
+}
+
+const char* CDVDVideoCodecThreading::ThreadTypeToString(ThreadType type)
+{
+  switch (type)
+  {
+    case ThreadType::FRAME:
+      return "frame";
+    case ThreadType::SLICE:
+      return "slice";
+    default:
+      return "auto";
+  }
+}
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+
+/*!
+ * \brief Selects the threading model of software video decoders.
+ *
+ * The policy is independent of ffmpeg so it can be used by other decoders and
+ * exercised without a codec context. Cores can be reserved for the GUI and
+ * audio engine threads; a boosted selection ignores the reservation and
+ * resolution caps and is used by decoders that fall behind.
+ */
+class CDVDVideoCodecThreading
+{
+public:
+  enum class ThreadType
+  {
+    AUTO,
+    FRAME,
+    SLICE,
+  };
+
+  struct Config
+  {
+    int cpuCount = 1;
+    int reservedCores = 0;
+    int maxThreads = 0; //!< 0 = auto
+    ThreadType type = ThreadType::AUTO;
+  };
+
+  struct Stream
+  {
+    int width = 0;
+    int height = 0;
+    bool hasFrameThreads = true; //!< codec supports frame threading
+    bool hasSliceThreads = true; //!< codec supports slice threading
+    bool lowDelay = false; //!< e.g. live streams, frame threading adds a frame of delay per thread
+  };
+
+  struct Result
+  {
+    int threadCount = 1;
+    ThreadType type = ThreadType::FRAME;
+
+    bool operator==(const Result& other) const
+    {
+      return threadCount == other.threadCount && type == other.type;
+    }
+    bool operator!=(const Result& other) const { return !(*this == other); }
+  };
+
+  /*!
+   * \brief Get the threading model for a stream.
+   * \param config The user and system configuration
+   * \param stream Properties of the stream and the codec
+   * \param boost True if the decoder fell behind with the normal selection
+   * \return The number of threads and the thread type to use
+   */
+  static Result Select(const Config& config, const Stream& stream, bool boost);
+
+  /*!
+   * \brief Get a config from advanced settings and the number of available cores
+   */
+  static Config GetConfig();
+
+  static ThreadType ParseThreadType(const std::string& type);
+  static const char* ThreadTypeToString(ThreadType type);
+
+  static constexpr int MAX_THREADS = 16;
+};
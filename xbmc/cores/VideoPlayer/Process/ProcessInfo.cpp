@@ -459,6 +459,24 @@ void CProcessInfo::GetRenderBuffers(int &queued, int &discard, int &free)
   free = m_renderBufFree;
 }
 
+void CProcessInfo::UpdateRenderFrameStats(int queued, bool late, int skipped)
+{
+  if (m_dataCache)
+    m_dataCache->AddRenderFrameStats(queued, late, skipped);
+}
+
+void CProcessInfo::UpdateRenderAhead(int depth, int maxDepth)
+{
+  if (m_dataCache)
+    m_dataCache->SetRenderAheadDepth(depth, maxDepth);
+}
+
+void CProcessInfo::AddDroppedFrames(int dropped)
+{
+  if (m_dataCache)
+    m_dataCache->AddRenderDroppedFrames(dropped);
+}
+
 std::vector<AVPixelFormat> CProcessInfo::GetRenderFormats()
 {
   std::vector<AVPixelFormat> formats;
@@ -476,6 +494,14 @@ void CProcessInfo::SeekFinished(int64_t offset)
     m_dataCache->SeekFinished(offset);
 }
 
+void CProcessInfo::PlayerOperationFinished(CDataCacheCore::PlayerOperation operation,
+                                           std::chrono::milliseconds duration,
+                                           bool pipelined)
+{
+  if (m_dataCache)
+    m_dataCache->AddPlayerOperationTime(operation, duration, pipelined);
+}
+
 void CProcessInfo::SetStateSeeking(bool active)
 {
   std::unique_lock lock(m_renderSection);
@@ -8,18 +8,19 @@
 
 #pragma once
 
+#include "cores/DataCacheCore.h"
 #include "cores/VideoPlayer/Buffers/VideoBuffer.h"
 #include "cores/VideoPlayer/VideoRenderers/RenderInfo.h"
 #include "cores/VideoSettings.h"
 #include "threads/CriticalSection.h"
 
 #include <atomic>
+#include <chrono>
 #include <list>
 #include <map>
 #include <string>
 
 class CProcessInfo;
-class CDataCacheCore;
 
 using CreateProcessControl = CProcessInfo* (*)();
 
@@ -79,6 +80,9 @@ public:
   void UpdateRenderInfo(CRenderInfo &info);
   void UpdateRenderBuffers(int queued, int discard, int free);
   void GetRenderBuffers(int &queued, int &discard, int &free);
+  void UpdateRenderFrameStats(int queued, bool late, int skipped);
+  void UpdateRenderAhead(int depth, int maxDepth);
+  void AddDroppedFrames(int dropped);
   virtual std::vector<AVPixelFormat> GetRenderFormats();
 
   // player states
@@ -88,6 +92,16 @@ public:
   */
   void SeekFinished(int64_t offset);
 
+  /*!
+   * @brief Notifies that a stream switch or chapter skip has completed
+   * @param operation - the operation that completed
+   * @param duration - time from the request until playback continued
+   * @param pipelined - true if the operation did not flush the whole pipeline
+   */
+  void PlayerOperationFinished(CDataCacheCore::PlayerOperation operation,
+                               std::chrono::milliseconds duration,
+                               bool pipelined);
+
   void SetStateSeeking(bool active);
   bool IsSeeking();
   void SetStateRealtime(bool state);
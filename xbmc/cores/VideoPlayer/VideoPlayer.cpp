@@ -780,6 +780,8 @@ CVideoPlayer::~CVideoPlayer()
   {
     CThread::Sleep(10ms);
   }
+
+  m_nextItem.Drop();
 }
 
 bool CVideoPlayer::OpenFile(const CFileItem& file, const CPlayerOptions &options)
@@ -860,6 +862,116 @@ bool CVideoPlayer::IsPlaying() const
   return !m_bStop;
 }
 
+bool CVideoPlayer::QueueNextFile(const CFileItem& file)
+{
+  CLog::Log(LOGINFO, "VideoPlayer::QueueNextFile: {}", CURL::GetRedacted(file.GetDynPath()));
+
+  // always accept, the item is played by the playlist player if it can't be opened ahead
+  IVideoPlayer* player = this;
+  m_nextItem.Queue(file,
+                   [player](const CFileItem& item) { return PreOpenNextItem(player, item); });
+  return true;
+}
+
+CVideoPlayerNextItem::OpenedItem CVideoPlayer::PreOpenNextItem(IVideoPlayer* player,
+                                                               const CFileItem& file)
+{
+  CFileItem item(file);
+  item.SetMimeTypeForInternetFile();
+
+  // only plain files, everything else needs the player for opening
+  std::shared_ptr<CDVDInputStream> inputStream =
+      CDVDFactoryInputStream::CreateInputStream(player, item, true);
+  if (!inputStream || !(inputStream->IsStreamType(DVDSTREAM_TYPE_FILE) ||
+                        inputStream->IsStreamType(DVDSTREAM_TYPE_FFMPEG)))
+  {
+    CLog::Log(LOGDEBUG, "VideoPlayer::PreOpenNextItem - not opening ahead [{}]",
+              CURL::GetRedacted(item.GetDynPath()));
+    return {};
+  }
+
+  if (!inputStream->Open())
+  {
+    CLog::Log(LOGERROR, "VideoPlayer::PreOpenNextItem - error opening [{}]",
+              CURL::GetRedacted(item.GetDynPath()));
+    return {};
+  }
+
+  std::unique_ptr<CDVDDemux> demuxer(CDVDFactoryDemuxer::CreateDemuxer(inputStream));
+  if (!demuxer)
+  {
+    CLog::Log(LOGERROR, "VideoPlayer::PreOpenNextItem - error creating demuxer for [{}]",
+              CURL::GetRedacted(item.GetDynPath()));
+    return {};
+  }
+
+  CLog::Log(LOGINFO, "VideoPlayer::PreOpenNextItem - opened [{}]",
+            CURL::GetRedacted(item.GetDynPath()));
+  return {std::move(inputStream), std::move(demuxer)};
+}
+
+void CVideoPlayer::CheckQueueNextItem()
+{
+  // time before the end when the next item is requested, leaves time for opening it
+  constexpr int64_t PRE_OPEN_TIME = 20000; // ms
+
+  if (m_nextItemRequested || !m_pInputStream || !m_pDemuxer)
+    return;
+
+  if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoPreOpenNextItem)
+    return;
+
+  if (m_pInputStream->IsRealtime() || IsInMenuInternal() ||
+      m_pInputStream->IsStreamType(DVDSTREAM_TYPE_DVD) ||
+      m_pInputStream->IsStreamType(DVDSTREAM_TYPE_BLURAY) ||
+      m_pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER))
+    return;
+
+  if (m_State.timeMax <= 0 || m_State.timeMax - m_State.time > PRE_OPEN_TIME)
+    return;
+
+  m_nextItemRequested = true;
+
+  IPlayerCallback *cb = &m_callback;
+  m_outboundEvents->Submit([=]() {
+    cb->OnQueueNextItem();
+  });
+}
+
+bool CVideoPlayer::HandOverToNextItem()
+{
+  if (!m_nextItemRequested)
+    return false;
+
+  CDVDMsgOpenFile::FileParams params;
+  switch (m_nextItem.CheckHandOver(params.m_item))
+  {
+    case CVideoPlayerNextItem::HandOver::NONE:
+      // playback ends, the playlist player opens the next item
+      return false;
+    case CVideoPlayerNextItem::HandOver::WAIT:
+      // give the next item a moment if it is still being opened
+      CThread::Sleep(50ms);
+      return true;
+    case CVideoPlayerNextItem::HandOver::READY:
+      break;
+  }
+
+  CLog::Log(LOGINFO, "VideoPlayer: continuing with next item [{}]",
+            CURL::GetRedacted(params.m_item.GetDynPath()));
+
+  params.m_options = m_playerOptions;
+  params.m_options.starttime = 0;
+  params.m_options.startpercent = 0;
+  params.m_options.state.clear();
+  params.m_item.SetMimeTypeForInternetFile();
+  m_messenger.Put(std::make_shared<CDVDMsgOpenFile>(params), 1);
+
+  // don't hand over twice, Prepare() resets this for the next item
+  m_nextItemRequested = false;
+  return true;
+}
+
 void CVideoPlayer::OnStartup()
 {
   m_CurrentVideo.Clear();
@@ -878,9 +990,21 @@ bool CVideoPlayer::OpenInputStream()
     throw std::runtime_error("m_pInputStream reference count is greater than 1");
   m_pInputStream.reset();
 
-  CLog::Log(LOGINFO, "Creating InputStream");
+  // take over the next item if it was opened ahead, drop it otherwise
+  CVideoPlayerNextItem::OpenedItem preOpened = m_nextItem.Take(m_item.GetDynPath());
+  m_pInputStream = std::move(preOpened.inputStream);
+  m_pPreOpenedDemuxer = std::move(preOpened.demuxer);
+
+  if (m_pInputStream)
+  {
+    CLog::Log(LOGINFO, "Using pre-opened InputStream");
+  }
+  else
+  {
+    CLog::Log(LOGINFO, "Creating InputStream");
 
-  m_pInputStream = CDVDFactoryInputStream::CreateInputStream(this, m_item, true);
+    m_pInputStream = CDVDFactoryInputStream::CreateInputStream(this, m_item, true);
+  }
   if (m_pInputStream == nullptr)
   {
     CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - unable to create input stream for [{}]",
@@ -888,7 +1012,7 @@ bool CVideoPlayer::OpenInputStream()
     return false;
   }
 
-  if (!m_pInputStream->Open())
+  if (!m_pPreOpenedDemuxer && !m_pInputStream->Open())
   {
     CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - error opening [{}]",
               CURL::GetRedacted(m_item.GetPath()));
@@ -940,9 +1064,16 @@ bool CVideoPlayer::OpenDemuxStream()
 {
   CloseDemuxer();
 
-  CLog::Log(LOGINFO, "Creating Demuxer");
-
   int attempts = 10;
+  if (m_pPreOpenedDemuxer)
+  {
+    CLog::Log(LOGINFO, "Using pre-opened Demuxer");
+    m_pDemuxer = std::move(m_pPreOpenedDemuxer);
+    attempts = 0;
+  }
+  else
+    CLog::Log(LOGINFO, "Creating Demuxer");
+
   while (!m_bStop && attempts-- > 0)
   {
     m_pDemuxer.reset(CDVDFactoryDemuxer::CreateDemuxer(m_pInputStream));
@@ -1340,6 +1471,7 @@ void CVideoPlayer::Prepare()
   m_offset_pts = 0;
   m_CurrentAudio.lastdts = DVD_NOPTS_VALUE;
   m_CurrentVideo.lastdts = DVD_NOPTS_VALUE;
+  m_nextItemRequested = false;
 
   IPlayerCallback *cb = &m_callback;
   CFileItem fileItem = m_item;
@@ -1536,10 +1668,14 @@ void CVideoPlayer::Process()
 
     // handle eventual seeks due to playspeed
     HandlePlaySpeed();
+    CheckPlayerOperation();
 
     // update player state
     UpdatePlayState(200);
 
+    // request the next playlist item to open it ahead
+    CheckQueueNextItem();
+
     // make sure we run subtitle process here
     m_VideoPlayerSubtitle->Process(m_clock.GetClock() + m_State.time_offset - m_VideoPlayerVideo->GetSubtitleDelay(), m_State.time_offset);
 
@@ -1562,8 +1698,10 @@ void CVideoPlayer::Process()
     }
 
     // if the queues are full, no need to read more
+    // video packets are skipped while catching up after a pipelined stream switch
     if ((!m_VideoPlayerAudio->AcceptsData() && m_CurrentAudio.id >= 0) ||
-        (!m_VideoPlayerVideo->AcceptsData() && m_CurrentVideo.id >= 0))
+        (!m_VideoPlayerVideo->AcceptsData() && m_CurrentVideo.id >= 0 &&
+         !m_CurrentVideo.IsSkipping()))
     {
       if (m_playSpeed == DVD_PLAYSPEED_PAUSE &&
           m_demuxerSpeed != DVD_PLAYSPEED_PAUSE)
@@ -1675,6 +1813,10 @@ void CVideoPlayer::Process()
       if (!m_pInputStream->IsEOF())
         CLog::Log(LOGINFO, "{} - eof reading from demuxer", __FUNCTION__);
 
+      // continue with the next playlist item if it was opened ahead
+      if (HandOverToNextItem())
+        continue;
+
       break;
     }
 
@@ -1755,7 +1897,9 @@ void CVideoPlayer::ProcessPacket(CDemuxStream* pStream, DemuxPacket* pPacket)
   // process packet if it belongs to selected stream.
   // for dvd's don't allow automatic opening of streams*/
 
-  if (CheckIsCurrent(m_CurrentAudio, pStream, pPacket))
+  if (CheckPipelinedSkip(pStream, pPacket))
+    CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+  else if (CheckIsCurrent(m_CurrentAudio, pStream, pPacket))
     ProcessAudioData(pStream, pPacket);
   else if (CheckIsCurrent(m_CurrentVideo, pStream, pPacket))
     ProcessVideoData(pStream, pPacket);
@@ -2871,6 +3015,9 @@ void CVideoPlayer::HandleMessages()
              m_messenger.GetPacketCount(CDVDMsg::PLAYER_SEEK_CHAPTER) == 0)
     {
       m_processInfo->SeekFinished(0);
+      // unlike stream switches, chapter skips aren't pipelined: the chapter is hardly ever within
+      // the queued data, so the queues are flushed and refilled like for any other seek
+      BeginPlayerOperation(CDataCacheCore::PlayerOperation::CHAPTER_SKIP);
       SetCaching(CACHESTATE_FLUSH);
 
       CDVDMsgPlayerSeekChapter& msg(*std::static_pointer_cast<CDVDMsgPlayerSeekChapter>(pMsg));
@@ -2963,17 +3110,23 @@ void CVideoPlayer::HandleMessages()
         }
         else
         {
-          CloseStream(m_CurrentAudio, false);
-          OpenStream(m_CurrentAudio, st.demuxerId, st.id, st.source);
-          AdaptForcedSubtitles();
+          BeginPlayerOperation(CDataCacheCore::PlayerOperation::AUDIO_STREAM_SWITCH);
+          if (SwitchStreamPipelined(m_CurrentAudio, st))
+            AdaptForcedSubtitles();
+          else
+          {
+            CloseStream(m_CurrentAudio, false);
+            OpenStream(m_CurrentAudio, st.demuxerId, st.id, st.source);
+            AdaptForcedSubtitles();
 
-          CDVDMsgPlayerSeek::CMode mode;
-          mode.time = (int)GetUpdatedTime();
-          mode.backward = true;
-          mode.accurate = true;
-          mode.trickplay = true;
-          mode.sync = true;
-          m_messenger.Put(std::make_shared<CDVDMsgPlayerSeek>(mode));
+            CDVDMsgPlayerSeek::CMode mode;
+            mode.time = (int)GetUpdatedTime();
+            mode.backward = true;
+            mode.accurate = true;
+            mode.trickplay = true;
+            mode.sync = true;
+            m_messenger.Put(std::make_shared<CDVDMsgPlayerSeek>(mode));
+          }
         }
       }
     }
@@ -3032,8 +3185,12 @@ void CVideoPlayer::HandleMessages()
         }
         else
         {
-          CloseStream(m_CurrentSubtitle, false);
-          OpenStream(m_CurrentSubtitle, st.demuxerId, st.id, st.source);
+          BeginPlayerOperation(CDataCacheCore::PlayerOperation::SUBTITLE_STREAM_SWITCH);
+          if (!SwitchStreamPipelined(m_CurrentSubtitle, st))
+          {
+            CloseStream(m_CurrentSubtitle, false);
+            OpenStream(m_CurrentSubtitle, st.demuxerId, st.id, st.source);
+          }
         }
       }
     }
@@ -3452,6 +3609,25 @@ void CVideoPlayer::GetGeneralInfo(std::string& strGeneralInfo)
                                     m_State.cache_offset * 100.0);
     }
 
+    const CDataCacheCore::SRenderFrameStats stats =
+        CServiceBroker::GetDataCacheCore().GetRenderFrameStats();
+    strBuf += StringUtils::Format(", render-ahead: {}/{} late: {} dropped: {}",
+                                  stats.renderAheadDepth, stats.renderAheadMaxDepth,
+                                  stats.lateFrames, stats.droppedFrames);
+
+    // render queue depth when frames were presented, at 0 the next frame wasn't ready yet
+    uint64_t frames = 0;
+    uint64_t depthSum = 0;
+    for (size_t depth = 0; depth < stats.queueDepthHistogram.size(); ++depth)
+    {
+      frames += stats.queueDepthHistogram[depth];
+      depthSum += stats.queueDepthHistogram[depth] * depth;
+    }
+    if (frames > 0)
+      strBuf += StringUtils::Format(
+          " queue: {:.1f} empty: {:.1f}%", static_cast<double>(depthSum) / frames,
+          100.0 * stats.queueDepthHistogram[0] / frames);
+
     strGeneralInfo = StringUtils::Format("Player: a/v:{: 6.3f}, {}", dDiff, strBuf);
   }
 }
@@ -4091,6 +4267,125 @@ bool CVideoPlayer::CloseStream(CCurrentStream& current, bool bWaitForBuffers)
   return true;
 }
 
+bool CVideoPlayer::SwitchStreamPipelined(CCurrentStream& current, const SelectionStream& st)
+{
+  // the reseek only brings back data of the main demuxer and needs the other streams playing
+  if (STREAM_SOURCE_MASK(st.source) != STREAM_SOURCE_DEMUX || !m_pDemuxer || !m_State.canseek ||
+      m_pInputStream->IsRealtime() || m_pInputStream->IsStreamType(DVDSTREAM_TYPE_DVD) ||
+      IsInMenuInternal() || m_playSpeed != DVD_PLAYSPEED_NORMAL || m_caching != CACHESTATE_DONE)
+    return false;
+
+  if (m_CurrentVideo.id < 0 || m_CurrentVideo.syncState != IDVDStreamPlayer::SYNC_INSYNC)
+    return false;
+
+  double time = (m_clock.GetClock() + m_State.time_offset) / 1000;
+  if (m_pInputStream->GetIPosTime() == nullptr)
+    time -= m_State.time_offset / 1000;
+
+  CLog::Log(LOGDEBUG, "CVideoPlayer::SwitchStreamPipelined - demuxer seek to: {:f}", time);
+  if (!m_pDemuxer->SeekTime(time, true))
+    return false;
+
+  // streams that keep playing skip what they already have queued
+  for (CCurrentStream* stream : {&m_CurrentAudio, &m_CurrentVideo, &m_CurrentSubtitle,
+                                 &m_CurrentTeletext, &m_CurrentRadioRDS, &m_CurrentAudioID3})
+  {
+    if (stream != &current && stream->id >= 0 &&
+        STREAM_SOURCE_MASK(stream->source) == STREAM_SOURCE_DEMUX)
+      stream->BeginSkip();
+  }
+
+  if (current.type == STREAM_AUDIO)
+  {
+    // keep the audio player running, it reopens the codec in place if needed
+    SetEnableStream(current, false);
+    m_VideoPlayerAudio->Flush(true);
+    if (!OpenStream(current, st.demuxerId, st.id, st.source))
+      CloseStream(current, false);
+  }
+  else
+  {
+    CloseStream(current, false);
+    OpenStream(current, st.demuxerId, st.id, st.source);
+  }
+
+  // start at the play position, the audio player resyncs to the running clock
+  current.dts = DVD_NOPTS_VALUE;
+  current.skipdts = DVD_NOPTS_VALUE;
+  current.startpts = m_clock.GetClock();
+  current.inited = false;
+  current.packets = 0;
+  if (current.type == STREAM_AUDIO)
+    current.syncState = IDVDStreamPlayer::SYNC_STARTING;
+
+  m_playerOperation.pipelined = true;
+  return true;
+}
+
+bool CVideoPlayer::CheckPipelinedSkip(CDemuxStream* stream, DemuxPacket* pPacket)
+{
+  for (CCurrentStream* current : {&m_CurrentAudio, &m_CurrentVideo, &m_CurrentSubtitle,
+                                  &m_CurrentTeletext, &m_CurrentRadioRDS, &m_CurrentAudioID3})
+  {
+    if (!current->IsSkipping() || !CheckIsCurrent(*current, stream, pPacket))
+      continue;
+
+    if (current->SkipPacket(pPacket->dts, pPacket->pts))
+      return true;
+
+    // caught up, continue with the stream where it left off
+    CLog::Log(LOGDEBUG, "CVideoPlayer::CheckPipelinedSkip - stream {} caught up at dts: {:f}",
+              current->player, pPacket->dts != DVD_NOPTS_VALUE ? pPacket->dts : pPacket->pts);
+    return false;
+  }
+  return false;
+}
+
+void CVideoPlayer::BeginPlayerOperation(CDataCacheCore::PlayerOperation operation)
+{
+  m_playerOperation.active = true;
+  m_playerOperation.pipelined = false;
+  m_playerOperation.operation = operation;
+  m_playerOperation.start = std::chrono::steady_clock::now();
+}
+
+void CVideoPlayer::CheckPlayerOperation()
+{
+  if (!m_playerOperation.active || m_caching != CACHESTATE_DONE)
+    return;
+
+  const bool audioInSync =
+      m_CurrentAudio.id < 0 || m_CurrentAudio.syncState == IDVDStreamPlayer::SYNC_INSYNC;
+  const bool videoInSync =
+      m_CurrentVideo.id < 0 || m_CurrentVideo.syncState == IDVDStreamPlayer::SYNC_INSYNC;
+
+  switch (m_playerOperation.operation)
+  {
+    case CDataCacheCore::PlayerOperation::AUDIO_STREAM_SWITCH:
+      if (!audioInSync)
+        return;
+      break;
+    case CDataCacheCore::PlayerOperation::SUBTITLE_STREAM_SWITCH:
+      // subtitles are complete once the demuxer caught up after a reseek
+      if (m_CurrentVideo.IsSkipping() || m_CurrentAudio.IsSkipping())
+        return;
+      break;
+    default:
+      if (!audioInSync || !videoInSync)
+        return;
+      break;
+  }
+
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - m_playerOperation.start);
+  CLog::Log(LOGDEBUG, "CVideoPlayer::CheckPlayerOperation - operation {} took {} ms{}",
+            static_cast<int>(m_playerOperation.operation), duration.count(),
+            m_playerOperation.pipelined ? " (pipelined)" : "");
+  m_processInfo->PlayerOperationFinished(m_playerOperation.operation, duration,
+                                         m_playerOperation.pipelined);
+  m_playerOperation.active = false;
+}
+
 void CVideoPlayer::FlushBuffers(double pts, bool accurate, bool sync)
 {
   CLog::Log(LOGDEBUG, "CVideoPlayer::FlushBuffers - flushing buffers");
@@ -4117,26 +4412,32 @@ void CVideoPlayer::FlushBuffers(double pts, bool accurate, bool sync)
   }
 
   m_CurrentAudio.dts         = DVD_NOPTS_VALUE;
+  m_CurrentAudio.skipdts = DVD_NOPTS_VALUE;
   m_CurrentAudio.startpts    = startpts;
   m_CurrentAudio.packets = 0;
 
   m_CurrentVideo.dts         = DVD_NOPTS_VALUE;
+  m_CurrentVideo.skipdts = DVD_NOPTS_VALUE;
   m_CurrentVideo.startpts    = startpts;
   m_CurrentVideo.packets = 0;
 
   m_CurrentSubtitle.dts      = DVD_NOPTS_VALUE;
+  m_CurrentSubtitle.skipdts = DVD_NOPTS_VALUE;
   m_CurrentSubtitle.startpts = startpts;
   m_CurrentSubtitle.packets = 0;
 
   m_CurrentTeletext.dts      = DVD_NOPTS_VALUE;
+  m_CurrentTeletext.skipdts = DVD_NOPTS_VALUE;
   m_CurrentTeletext.startpts = startpts;
   m_CurrentTeletext.packets = 0;
 
   m_CurrentRadioRDS.dts      = DVD_NOPTS_VALUE;
+  m_CurrentRadioRDS.skipdts = DVD_NOPTS_VALUE;
   m_CurrentRadioRDS.startpts = startpts;
   m_CurrentRadioRDS.packets = 0;
 
   m_CurrentAudioID3.dts = DVD_NOPTS_VALUE;
+  m_CurrentAudioID3.skipdts = DVD_NOPTS_VALUE;
   m_CurrentAudioID3.startpts = startpts;
   m_CurrentAudioID3.packets = 0;
 
@@ -5291,6 +5592,16 @@ void CVideoPlayer::UpdateRenderBuffers(int queued, int discard, int free)
   m_processInfo->UpdateRenderBuffers(queued, discard, free);
 }
 
+void CVideoPlayer::UpdateRenderFrameStats(int queued, bool late, int skipped)
+{
+  m_processInfo->UpdateRenderFrameStats(queued, late, skipped);
+}
+
+void CVideoPlayer::UpdateRenderAhead(int depth, int maxDepth)
+{
+  m_processInfo->UpdateRenderAhead(depth, maxDepth);
+}
+
 void CVideoPlayer::UpdateGuiRender(bool gui)
 {
   m_processInfo->SetGuiRender(gui);
@@ -14,9 +14,11 @@
 #include "FileItem.h"
 #include "IVideoPlayer.h"
 #include "VideoPlayerAudioID3.h"
+#include "VideoPlayerNextItem.h"
 #include "VideoPlayerRadioRDS.h"
 #include "VideoPlayerSubtitle.h"
 #include "VideoPlayerTeletext.h"
+#include "cores/DataCacheCore.h"
 #include "cores/IPlayer.h"
 #include "cores/MenuType.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
@@ -126,6 +128,8 @@ public:
   // stuff to handle starting after seek
   double startpts;
   double lastdts;
+  // packets up to this dts were queued before a pipelined stream switch reseeked the demuxer
+  double skipdts;
 
   enum
   {
@@ -158,6 +162,7 @@ public:
     starttime = DVD_NOPTS_VALUE;
     startpts = DVD_NOPTS_VALUE;
     lastdts = DVD_NOPTS_VALUE;
+    skipdts = DVD_NOPTS_VALUE;
     avsync = AV_SYNC_FORCE;
   }
 
@@ -169,6 +174,24 @@ public:
       return dts;
     return dts + dur;
   }
+
+  // skip the packets already queued when the demuxer is reseeked by a pipelined stream switch
+  void BeginSkip() { skipdts = dts; }
+  bool IsSkipping() const { return skipdts != DVD_NOPTS_VALUE; }
+
+  // returns true if the packet was queued already, skipping ends with the first new packet
+  bool SkipPacket(double packetDts, double packetPts)
+  {
+    if (skipdts == DVD_NOPTS_VALUE)
+      return false;
+
+    const double time = packetDts != DVD_NOPTS_VALUE ? packetDts : packetPts;
+    if (time == DVD_NOPTS_VALUE || time <= skipdts)
+      return true;
+
+    skipdts = DVD_NOPTS_VALUE;
+    return false;
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -258,6 +281,7 @@ public:
   ~CVideoPlayer() override;
   bool OpenFile(const CFileItem& file, const CPlayerOptions &options) override;
   bool CloseFile(bool reopen = false) override;
+  bool QueueNextFile(const CFileItem& file) override;
   bool IsPlaying() const override;
   void Pause() override;
   bool HasVideo() const override;
@@ -384,6 +408,8 @@ protected:
   void UpdateClockSync(bool enabled) override;
   void UpdateRenderInfo(CRenderInfo &info) override;
   void UpdateRenderBuffers(int queued, int discard, int free) override;
+  void UpdateRenderFrameStats(int queued, bool late, int skipped) override;
+  void UpdateRenderAhead(int depth, int maxDepth) override;
   void UpdateGuiRender(bool gui) override;
   void UpdateVideoRender(bool video) override;
 
@@ -405,6 +431,26 @@ protected:
   void AdaptForcedSubtitles();
   bool CloseStream(CCurrentStream& current, bool bWaitForBuffers);
 
+  /*!
+   * \brief Switch an audio or subtitle stream without flushing the other streams.
+   *
+   * The demuxer is reseeked to the current play position while the other streams keep
+   * playing from their queues. Their packets are skipped until the demuxer has caught up
+   * with what they already queued, the audio player is kept open and changes codec in place.
+   * \param current The stream to switch
+   * \param st The stream to switch to
+   * \return false if the switch is not possible, the caller falls back to close, open and seek
+   */
+  bool SwitchStreamPipelined(CCurrentStream& current, const SelectionStream& st);
+
+  /*!
+   * \brief Check if a packet was already queued before a pipelined stream switch.
+   */
+  bool CheckPipelinedSkip(CDemuxStream* stream, DemuxPacket* pPacket);
+
+  void BeginPlayerOperation(CDataCacheCore::PlayerOperation operation);
+  void CheckPlayerOperation();
+
   bool CheckIsCurrent(const CCurrentStream& current, CDemuxStream* stream, DemuxPacket* pkg);
   void ProcessPacket(CDemuxStream* pStream, DemuxPacket* pPacket);
   void ProcessAudioData(CDemuxStream* pStream, DemuxPacket* pPacket);
@@ -467,6 +513,23 @@ protected:
 
   bool OpenInputStream();
   bool OpenDemuxStream();
+
+  /*!
+   * \brief Ask for the next playlist item when the end of the current one is near.
+   */
+  void CheckQueueNextItem();
+
+  /*!
+   * \brief Open input stream and demuxer of the next item, runs on the job queue of m_nextItem.
+   */
+  static CVideoPlayerNextItem::OpenedItem PreOpenNextItem(IVideoPlayer* player,
+                                                          const CFileItem& item);
+
+  /*!
+   * \brief Switch to the pre-opened next item at the end of the current one.
+   * \return true if the player continues with the next item or waits for it to be opened
+   */
+  bool HandOverToNextItem();
   void CloseDemuxer();
   void OpenDefaultStreams(bool reset = true);
 
@@ -493,6 +556,15 @@ protected:
   ECacheState  m_caching;
   XbmcThreads::EndTime<> m_cachingTimer;
 
+  // stream switch or chapter skip in progress, timed until playback continued
+  struct SPlayerOperation
+  {
+    bool active{false};
+    bool pipelined{false};
+    CDataCacheCore::PlayerOperation operation{CDataCacheCore::PlayerOperation::CHAPTER_SKIP};
+    std::chrono::steady_clock::time_point start;
+  } m_playerOperation;
+
   std::unique_ptr<CProcessInfo> m_processInfo;
 
   CCurrentStream m_CurrentAudio;
@@ -540,6 +612,11 @@ protected:
   CDVDMessageQueue m_messenger;
   std::unique_ptr<CJobQueue> m_outboundEvents;
 
+  // next playlist item, opened in the background near the end of the current one
+  CVideoPlayerNextItem m_nextItem;
+  bool m_nextItemRequested{false};
+  std::unique_ptr<CDVDDemux> m_pPreOpenedDemuxer;
+
   IDVDStreamPlayerVideo *m_VideoPlayerVideo;
   IDVDStreamPlayerAudio *m_VideoPlayerAudio;
   CVideoPlayerSubtitle *m_VideoPlayerSubtitle;
@@ -214,6 +214,11 @@ void CVideoPlayerAudio::UpdatePlayerInfo()
   else if (m_synctype == SYNC_RESAMPLE)
     s << ", rr:" << std::fixed << std::setprecision(5) << 1.0 / m_audioSink.GetResampleRatio();
 
+  const CAEStreamLatency latency = m_audioSink.GetLatency();
+  if (latency.estimatedOutputMs > 0)
+    s << ", est. latency:" << std::fixed << std::setprecision(0) << latency.estimatedOutputMs
+      << "ms";
+
   SInfo info;
   info.info        = s.str();
   info.pts         = m_audioSink.GetPlayingPts();
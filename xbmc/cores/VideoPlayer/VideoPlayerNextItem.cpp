@@ -0,0 +1,128 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoPlayerNextItem.h"
+
+#include "DVDDemuxers/DVDDemux.h"
+#include "DVDInputStreams/DVDInputStream.h"
+#include "FileItem.h"
+#include "URL.h"
+#include "utils/XTimeUtils.h"
+#include "utils/log.h"
+
+#include <mutex>
+#include <utility>
+
+using namespace std::chrono_literals;
+
+CVideoPlayerNextItem::CVideoPlayerNextItem(std::chrono::milliseconds handOverTimeout)
+  : m_handOverTimeout(handOverTimeout)
+{
+}
+
+CVideoPlayerNextItem::~CVideoPlayerNextItem()
+{
+  Drop();
+
+  // the job refers to this
+  while (m_jobs.IsProcessing())
+  {
+    KODI::TIME::Sleep(10ms);
+  }
+}
+
+void CVideoPlayerNextItem::Queue(const CFileItem& item, Opener opener)
+{
+  unsigned int generation;
+  {
+    std::unique_lock lock(m_section);
+    DropLocked();
+    m_item = std::make_unique<CFileItem>(item);
+    m_opening = true;
+    generation = m_generation;
+  }
+
+  m_jobs.Submit([this, item, opener = std::move(opener), generation]()
+                { Open(item, opener, generation); });
+}
+
+CVideoPlayerNextItem::HandOver CVideoPlayerNextItem::CheckHandOver(CFileItem& item)
+{
+  std::unique_lock lock(m_section);
+  if (m_item && m_opened.inputStream)
+  {
+    item = *m_item;
+    return HandOver::READY;
+  }
+
+  if (!m_opening)
+    return HandOver::NONE;
+
+  const auto now = std::chrono::steady_clock::now();
+  if (!m_handOverDeadline)
+    m_handOverDeadline = now + m_handOverTimeout;
+  else if (now >= *m_handOverDeadline)
+  {
+    CLog::Log(LOGWARNING, "CVideoPlayerNextItem - gave up waiting for [{}] to be opened",
+              CURL::GetRedacted(m_item->GetDynPath()));
+    DropLocked();
+    return HandOver::NONE;
+  }
+  return HandOver::WAIT;
+}
+
+CVideoPlayerNextItem::OpenedItem CVideoPlayerNextItem::Take(const std::string& path)
+{
+  OpenedItem opened;
+  std::unique_lock lock(m_section);
+  if (m_item && m_item->GetDynPath() == path)
+    opened = std::move(m_opened);
+  DropLocked();
+  return opened;
+}
+
+void CVideoPlayerNextItem::Drop()
+{
+  OpenedItem opened;
+  std::unique_lock lock(m_section);
+  // closed outside of the lock
+  opened = std::move(m_opened);
+  DropLocked();
+}
+
+void CVideoPlayerNextItem::Open(const CFileItem& item, const Opener& opener, unsigned int generation)
+{
+  {
+    std::unique_lock lock(m_section);
+    if (generation != m_generation)
+      return;
+  }
+
+  OpenedItem opened = opener(item);
+
+  std::unique_lock lock(m_section);
+  if (generation != m_generation)
+  {
+    CLog::Log(LOGDEBUG, "CVideoPlayerNextItem - dropping [{}], it isn't needed anymore",
+              CURL::GetRedacted(item.GetDynPath()));
+    return;
+  }
+
+  m_opening = false;
+  if (opened.inputStream)
+    m_opened = std::move(opened);
+}
+
+void CVideoPlayerNextItem::DropLocked()
+{
+  m_generation++;
+  m_item.reset();
+  m_opened = {};
+  m_opening = false;
+  m_handOverDeadline.reset();
+}
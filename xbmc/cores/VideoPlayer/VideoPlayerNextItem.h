@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "utils/JobManager.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
+class CDVDDemux;
+class CDVDInputStream;
+class CFileItem;
+
+/*!
+ \brief The next playlist item, opened ahead on a job queue so playback continues with it at the
+ end of the current item
+
+ Opening a network file can hang, so the player waits for an item still being opened only for a
+ limited time at the end of the current item. After that the item is dropped and the playlist
+ player opens it the usual way.
+ */
+class CVideoPlayerNextItem
+{
+public:
+  struct OpenedItem
+  {
+    std::shared_ptr<CDVDInputStream> inputStream;
+    std::unique_ptr<CDVDDemux> demuxer;
+  };
+
+  /*!
+   \brief Opens input stream and demuxer of the item, an empty item if it can't be opened ahead
+   */
+  using Opener = std::function<OpenedItem(const CFileItem& item)>;
+
+  enum class HandOver
+  {
+    NONE, ///< no item to continue with
+    WAIT, ///< the item is still being opened
+    READY, ///< the item is opened
+  };
+
+  static constexpr std::chrono::milliseconds HAND_OVER_TIMEOUT{5000};
+
+  explicit CVideoPlayerNextItem(std::chrono::milliseconds handOverTimeout = HAND_OVER_TIMEOUT);
+
+  /*!
+   \brief Drops the item, waiting for an item being opened
+   */
+  ~CVideoPlayerNextItem();
+
+  /*!
+   \brief Open an item ahead, replacing the item queued before
+   */
+  void Queue(const CFileItem& item, Opener opener);
+
+  /*!
+   \brief Check at the end of the current item whether playback continues with the next one
+   \param item set to the next item if it is ready
+   \return WAIT while the item is being opened, up to the hand over timeout since the first check
+   returning WAIT. Once that passed the item is dropped and NONE is returned.
+   */
+  HandOver CheckHandOver(CFileItem& item);
+
+  /*!
+   \brief Take input stream and demuxer of the item opened ahead, any item queued is dropped
+   \param path dynamic path of the item being opened by the player
+   \return the opened item, empty if the item opened ahead is another one or isn't opened yet
+   */
+  OpenedItem Take(const std::string& path);
+
+  /*!
+   \brief Drop the item, an item being opened is closed once that is done
+   */
+  void Drop();
+
+private:
+  void Open(const CFileItem& item, const Opener& opener, unsigned int generation);
+  void DropLocked();
+
+  CJobQueue m_jobs{false, 1, CJob::PRIORITY_NORMAL};
+  const std::chrono::milliseconds m_handOverTimeout;
+
+  CCriticalSection m_section;
+  std::unique_ptr<CFileItem> m_item;
+  OpenedItem m_opened;
+  bool m_opening{false};
+  unsigned int m_generation{0};
+  std::optional<std::chrono::steady_clock::time_point> m_handOverDeadline;
+};
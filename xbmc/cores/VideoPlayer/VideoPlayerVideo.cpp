@@ -560,6 +560,7 @@ void CVideoPlayerVideo::Process()
       if (iDropDirective & DROP_DROPPED)
       {
         m_iDroppedFrames++;
+        m_processInfo.AddDroppedFrames(1);
         m_ptsTracker.Flush();
       }
       if (m_messageQueue.GetDataSize() == 0 ||  m_speed < 0)
@@ -582,8 +583,12 @@ void CVideoPlayerVideo::Process()
         codecControl |= DVD_CODEC_CTRL_ROTATE;
       m_pVideoCodec->SetCodecControl(codecControl);
 
+      const auto decodeStart = std::chrono::steady_clock::now();
       if (m_pVideoCodec->AddData(*pPacket))
       {
+        m_decodeTime += std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - decodeStart);
+
         // buffer packets so we can recover should decoder flush for some reason
         if (m_pVideoCodec->GetConvergeCount() > 0)
         {
@@ -611,7 +616,10 @@ void CVideoPlayerVideo::Process()
 
 bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
 {
+  const auto decodeStart = std::chrono::steady_clock::now();
   CDVDVideoCodec::VCReturn decoderState = m_pVideoCodec->GetPicture(&m_picture);
+  m_decodeTime += std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - decodeStart);
 
   if (decoderState == CDVDVideoCodec::VC_BUFFER)
   {
@@ -678,6 +686,9 @@ bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
   {
     bool hasTimestamp = true;
 
+    m_renderManager.AddDecodeTime(m_decodeTime);
+    m_decodeTime = std::chrono::microseconds::zero();
+
     m_picture.iDuration = frametime;
 
     // validate picture timing,
@@ -759,6 +770,7 @@ bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
     else if ((m_outputSate == OUTPUT_DROPPED) && !(m_picture.iFlags & DVP_FLAG_DROPPED))
     {
       m_iDroppedFrames++;
+      m_processInfo.AddDroppedFrames(1);
       m_ptsTracker.Flush();
     }
 
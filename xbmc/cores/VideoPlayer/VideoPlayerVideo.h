@@ -20,6 +20,7 @@
 #include "utils/BitstreamStats.h"
 
 #include <atomic>
+#include <chrono>
 
 #define DROP_DROPPED 1
 #define DROP_VERYLATE 2
@@ -140,6 +141,7 @@ protected:
   CDroppingStats m_droppingStats;
   CRenderManager& m_renderManager;
   VideoPicture m_picture;
+  std::chrono::microseconds m_decodeTime{0}; // time spent in the decoder for the next picture
 
   EOutputState m_outputSate{OUTPUT_NORMAL};
 };
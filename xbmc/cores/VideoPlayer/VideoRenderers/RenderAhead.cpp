@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RenderAhead.h"
+
+#include <algorithm>
+#include <cmath>
+
+void CRenderAheadController::Configure(int minDepth, int maxDepth)
+{
+  m_maxDepth = maxDepth;
+  m_minDepth = std::min(minDepth, maxDepth);
+  m_depth = m_minDepth;
+  m_mean = 0.0;
+  m_variance = 0.0;
+  m_framesSinceChange = 0;
+}
+
+bool CRenderAheadController::AddDecodeTime(double decodeTime, double frameTime)
+{
+  if (frameTime <= 0.0)
+    return false;
+
+  // exponentially weighted mean and variance of the decode time
+  constexpr double alpha = 0.05;
+  const double diff = decodeTime - m_mean;
+  m_mean += alpha * diff;
+  m_variance = (1.0 - alpha) * (m_variance + alpha * diff * diff);
+  m_framesSinceChange++;
+
+  const double spread = m_mean + 2.0 * GetStdDev();
+
+  int depth = m_depth;
+  if (spread > frameTime)
+  {
+    // decode spikes exceed a frame interval, give the decoder more room to run ahead
+    if (m_framesSinceChange >= 10 && depth < m_maxDepth)
+      depth++;
+  }
+  else if (spread < frameTime / 2)
+  {
+    // shrink again after ~10s of stable decoding
+    if (m_framesSinceChange >= static_cast<int>(10000.0 / frameTime) && depth > m_minDepth)
+      depth--;
+  }
+  else
+    m_framesSinceChange = 0;
+
+  if (depth == m_depth)
+    return false;
+
+  m_depth = depth;
+  m_framesSinceChange = 0;
+  return true;
+}
+
+double CRenderAheadController::GetStdDev() const
+{
+  return std::sqrt(m_variance);
+}
@@ -0,0 +1,49 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+/*!
+ * @brief Adaptive render-ahead depth of the video render queue
+ *
+ * Tracks an exponentially weighted mean and variance of the decode time of pictures. The depth
+ * grows when decode times spread (mean + 2 stddev) beyond a frame interval and shrinks again
+ * after about 10s of stable decoding.
+ */
+class CRenderAheadController
+{
+public:
+  /*!
+   * @brief Reset the decode timing and start at the minimum depth
+   * @param minDepth The depth used while decoding is stable
+   * @param maxDepth The number of buffers the renderer was configured for
+   */
+  void Configure(int minDepth, int maxDepth);
+
+  /*!
+   * @brief Account the decode time of a picture
+   * @param decodeTime The time it took to decode the picture in ms
+   * @param frameTime The frame interval of the stream in ms
+   * @return true if the depth changed
+   */
+  bool AddDecodeTime(double decodeTime, double frameTime);
+
+  int GetDepth() const { return m_depth; }
+  int GetMinDepth() const { return m_minDepth; }
+  int GetMaxDepth() const { return m_maxDepth; }
+  double GetMean() const { return m_mean; }
+  double GetStdDev() const;
+
+private:
+  double m_mean = 0.0; // ms
+  double m_variance = 0.0;
+  int m_framesSinceChange = 0;
+  int m_depth = 2;
+  int m_minDepth = 2;
+  int m_maxDepth = 2;
+};
@@ -17,6 +17,7 @@
 #include "application/Application.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
 #include "messaging/ApplicationMessenger.h"
+#include "rendering/RenderSystem.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
@@ -27,6 +28,8 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <mutex>
 
@@ -188,9 +191,9 @@ bool CRenderManager::Configure()
   {
     CRenderInfo info = m_pRenderer->GetRenderInfo();
     int renderbuffers = info.max_buffer_size;
-    m_QueueSize = renderbuffers;
+    m_QueueSize = std::min(renderbuffers, GetRenderAheadDepth());
     if (m_NumberBuffers > 0)
-      m_QueueSize = std::min(m_NumberBuffers, renderbuffers);
+      m_QueueSize = std::min(m_NumberBuffers, m_QueueSize);
 
     if(m_QueueSize < 2)
     {
@@ -202,6 +205,12 @@ bool CRenderManager::Configure()
     m_pRenderer->SetBufferSize(m_QueueSize);
     m_pRenderer->Update();
 
+    // adaptive render-ahead allocates the full depth but starts with the default queue
+    m_adaptiveRenderAhead =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoAdaptiveRenderAhead;
+    m_renderAhead.Configure(m_adaptiveRenderAhead ? 4 : m_QueueSize, m_QueueSize);
+    m_playerPort->UpdateRenderAhead(m_renderAhead.GetDepth(), m_QueueSize);
+
     m_playerPort->UpdateRenderInfo(info);
     m_playerPort->UpdateGuiRender(true);
     m_playerPort->UpdateVideoRender(!m_pRenderer->IsGuiLayer());
@@ -229,7 +238,8 @@ bool CRenderManager::Configure()
 
     m_renderState = STATE_CONFIGURED;
 
-    CLog::Log(LOGDEBUG, "CRenderManager::Configure - {}", m_QueueSize);
+    CLog::Log(LOGDEBUG, "CRenderManager::Configure - {} (render-ahead {})", m_QueueSize,
+              m_renderAhead.GetDepth());
   }
   else
     m_renderState = STATE_UNCONFIGURED;
@@ -372,6 +382,7 @@ void CRenderManager::PreInit()
   UpdateLatencyTweak();
 
   m_QueueSize   = 2;
+  m_renderAhead.Configure(2, 2);
   m_QueueSkip   = 0;
   m_presentstep = PRESENT_IDLE;
   m_bRenderGUI = true;
@@ -708,6 +719,9 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
   if (!gui && m_pRenderer->IsGuiLayer())
     return;
 
+  // the GUI drawn so far has to be below the video
+  CServiceBroker::GetRenderSystem()->FlushBatchedDraws();
+
   if (!gui || m_pRenderer->IsGuiLayer())
   {
     SPresent& m = m_Queue[m_presentsource];
@@ -1108,7 +1122,7 @@ int CRenderManager::WaitForBuffer(volatile std::atomic_bool& bStop,
   }
 
   XbmcThreads::EndTime<> endtime{timeout};
-  while(m_free.empty())
+  while (!HasFreeBuffer())
   {
     m_presentevent.wait(lock, std::min(50ms, timeout));
     if (endtime.IsTimePast() || bStop)
@@ -1209,12 +1223,14 @@ void CRenderManager::PrepareNextRender()
     }
 
     // skip late frames
+    int skipped = 0;
     while (m_queued.front() != idx)
     {
       if (m_presentsourcePast >= 0)
       {
         m_discard.push_back(m_presentsourcePast);
         m_QueueSkip++;
+        skipped++;
       }
       m_presentsourcePast = m_queued.front();
       m_queued.pop_front();
@@ -1235,6 +1251,7 @@ void CRenderManager::PrepareNextRender()
     m_presentevent.notifyAll();
 
     m_playerPort->UpdateRenderBuffers(m_queued.size(), m_discard.size(), m_free.size());
+    m_playerPort->UpdateRenderFrameStats(m_queued.size(), lateframes > 0, skipped);
   }
   else if (!combined && renderPts > (nextFramePts - frametime))
   {
@@ -1245,6 +1262,8 @@ void CRenderManager::PrepareNextRender()
     m_queued.pop_front();
     m_presentpts = m_Queue[m_presentsource].pts - m_displayLatency - frametime / 2;
     m_presentevent.notifyAll();
+
+    m_playerPort->UpdateRenderFrameStats(m_queued.size(), false, 0);
   }
 }
 
@@ -1263,6 +1282,26 @@ void CRenderManager::DiscardBuffer()
   m_presentevent.notifyAll();
 }
 
+void CRenderManager::AddDecodeTime(std::chrono::microseconds decodeTime)
+{
+  if (!m_adaptiveRenderAhead || m_fps <= 0)
+    return;
+
+  std::unique_lock lock(m_presentlock);
+
+  const int depth = m_renderAhead.GetDepth();
+  const double frametime = 1000.0 / static_cast<double>(m_fps);
+  if (m_renderAhead.AddDecodeTime(decodeTime.count() / 1000.0, frametime))
+  {
+    CLog::Log(LOGDEBUG,
+              "CRenderManager::AddDecodeTime - render-ahead {} -> {}, decode time mean: {:.2f}ms "
+              "stddev: {:.2f}ms",
+              depth, m_renderAhead.GetDepth(), m_renderAhead.GetMean(), m_renderAhead.GetStdDev());
+    m_playerPort->UpdateRenderAhead(m_renderAhead.GetDepth(), m_QueueSize);
+    m_presentevent.notifyAll();
+  }
+}
+
 bool CRenderManager::GetStats(int &lateframes, double &pts, int &queued, int &discard)
 {
   std::unique_lock lock(m_presentlock);
@@ -1273,6 +1312,36 @@ bool CRenderManager::GetStats(int &lateframes, double &pts, int &queued, int &di
   return true;
 }
 
+int CRenderManager::GetRenderAheadDepth() const
+{
+  const std::shared_ptr<CAdvancedSettings> advancedSettings =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+
+  int depth = advancedSettings->m_videoRenderAheadFrames;
+
+  // bound the depth by the memory budget, assuming 4:2:0 planar frames
+  const int budget = advancedSettings->m_videoRenderAheadMemory;
+  if (budget > 0 && m_pConfigPicture)
+  {
+    const uint64_t bytesPerSample = m_pConfigPicture->colorBits > 8 ? 2 : 1;
+    const uint64_t frameSize = static_cast<uint64_t>(m_pConfigPicture->iWidth) *
+                               m_pConfigPicture->iHeight * bytesPerSample * 3 / 2;
+    if (frameSize > 0)
+    {
+      const uint64_t frames = static_cast<uint64_t>(budget) * 1024 * 1024 / frameSize;
+      depth = static_cast<int>(std::min(frames, static_cast<uint64_t>(depth)));
+    }
+  }
+
+  return std::max(depth, 2);
+}
+
+bool CRenderManager::HasFreeBuffer() const
+{
+  // buffers held back by adaptive render-ahead are not handed out to the player
+  return static_cast<int>(m_free.size()) > m_QueueSize - m_renderAhead.GetDepth();
+}
+
 void CRenderManager::CheckEnableClockSync()
 {
   // refresh rate can be a multiple of video fps
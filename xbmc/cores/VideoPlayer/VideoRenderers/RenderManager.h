@@ -10,6 +10,7 @@
 
 #include "DVDClock.h"
 #include "DebugRenderer.h"
+#include "RenderAhead.h"
 #include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoCodec.h"
 #include "cores/VideoPlayer/VideoRenderers/BaseRenderer.h"
 #include "cores/VideoPlayer/VideoRenderers/OverlayRenderer.h"
@@ -47,6 +48,8 @@ protected:
   virtual void UpdateClockSync(bool enabled) = 0;
   virtual void UpdateRenderInfo(CRenderInfo &info) = 0;
   virtual void UpdateRenderBuffers(int queued, int discard, int free) = 0;
+  virtual void UpdateRenderFrameStats(int queued, bool late, int skipped) = 0;
+  virtual void UpdateRenderAhead(int depth, int maxDepth) = 0;
   virtual void UpdateGuiRender(bool gui) = 0;
   virtual void UpdateVideoRender(bool video) = 0;
   virtual CVideoSettings GetVideoSettings() const = 0;
@@ -116,6 +119,13 @@ public:
    */
   bool GetStats(int &lateframes, double &pts, int &queued, int &discard);
 
+  /**
+   * Player reports the time it took to decode a picture. With adaptive render-ahead
+   * enabled the number of frames the decoder may queue ahead of presentation is
+   * grown when decode times fluctuate by more than a frame interval.
+   */
+  void AddDecodeTime(std::chrono::microseconds decodeTime);
+
   /**
    * Video player call this on flush in order to discard any queued frames
    */
@@ -143,6 +153,8 @@ protected:
 
   void UpdateLatencyTweak();
   void CheckEnableClockSync();
+  int GetRenderAheadDepth() const;
+  bool HasFreeBuffer() const;
 
   CBaseRenderer *m_pRenderer = nullptr;
   OVERLAY::CRenderer m_overlays;
@@ -192,6 +204,10 @@ protected:
 
   int m_QueueSize = 2;
   int m_QueueSkip = 0;
+  /// Decides how many of the m_QueueSize buffers the player may fill, between the configured
+  /// render-ahead depth and m_QueueSize depending on how steady decode times are
+  CRenderAheadController m_renderAhead;
+  bool m_adaptiveRenderAhead = false;
 
   struct SPresent
   {
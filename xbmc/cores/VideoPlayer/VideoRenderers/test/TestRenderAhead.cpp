@@ -0,0 +1,126 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/VideoRenderers/RenderAhead.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// 25 fps
+constexpr double FRAME_TIME = 40.0;
+} // namespace
+
+TEST(TestRenderAhead, StartsAtMinimumDepth)
+{
+  CRenderAheadController controller;
+  controller.Configure(4, 16);
+  EXPECT_EQ(controller.GetDepth(), 4);
+  EXPECT_EQ(controller.GetMinDepth(), 4);
+  EXPECT_EQ(controller.GetMaxDepth(), 16);
+
+  // the minimum is bounded by the buffers of the renderer
+  controller.Configure(4, 3);
+  EXPECT_EQ(controller.GetDepth(), 3);
+  EXPECT_EQ(controller.GetMinDepth(), 3);
+}
+
+TEST(TestRenderAhead, StableDecodingKeepsDepth)
+{
+  CRenderAheadController controller;
+  controller.Configure(4, 16);
+  for (int i = 0; i < 1000; ++i)
+    EXPECT_FALSE(controller.AddDecodeTime(5.0, FRAME_TIME));
+  EXPECT_EQ(controller.GetDepth(), 4);
+  EXPECT_NEAR(controller.GetMean(), 5.0, 0.01);
+  EXPECT_NEAR(controller.GetStdDev(), 0.0, 0.01);
+}
+
+TEST(TestRenderAhead, GrowsOnDecodeSpikes)
+{
+  CRenderAheadController controller;
+  controller.Configure(4, 6);
+
+  // every fourth picture takes three frame intervals to decode
+  int changes = 0;
+  for (int i = 0; i < 200; ++i)
+  {
+    if (controller.AddDecodeTime(i % 4 == 0 ? 3 * FRAME_TIME : 5.0, FRAME_TIME))
+      changes++;
+  }
+  EXPECT_EQ(changes, 2);
+  // but not beyond the buffers of the renderer
+  EXPECT_EQ(controller.GetDepth(), 6);
+}
+
+TEST(TestRenderAhead, GrowsOneStepPerTenFrames)
+{
+  CRenderAheadController controller;
+  controller.Configure(2, 16);
+
+  for (int i = 0; i < 9; ++i)
+    EXPECT_FALSE(controller.AddDecodeTime(10 * FRAME_TIME, FRAME_TIME));
+  EXPECT_TRUE(controller.AddDecodeTime(10 * FRAME_TIME, FRAME_TIME));
+  EXPECT_EQ(controller.GetDepth(), 3);
+
+  for (int i = 0; i < 9; ++i)
+    EXPECT_FALSE(controller.AddDecodeTime(10 * FRAME_TIME, FRAME_TIME));
+  EXPECT_TRUE(controller.AddDecodeTime(10 * FRAME_TIME, FRAME_TIME));
+  EXPECT_EQ(controller.GetDepth(), 4);
+}
+
+TEST(TestRenderAhead, ShrinksAfterStableDecoding)
+{
+  CRenderAheadController controller;
+  controller.Configure(4, 8);
+  for (int i = 0; i < 100; ++i)
+    controller.AddDecodeTime(10 * FRAME_TIME, FRAME_TIME);
+  ASSERT_EQ(controller.GetDepth(), 8);
+
+  // the first step down follows ~10s after the decode times settled
+  int frames = 0;
+  while (!controller.AddDecodeTime(1.0, FRAME_TIME))
+    ASSERT_LT(++frames, 10000);
+  EXPECT_EQ(controller.GetDepth(), 7);
+  EXPECT_GE(frames, 250 - 1);
+
+  // every further step down takes 10s as well
+  for (int i = 0; i < 249; ++i)
+    EXPECT_FALSE(controller.AddDecodeTime(1.0, FRAME_TIME));
+  EXPECT_TRUE(controller.AddDecodeTime(1.0, FRAME_TIME));
+  EXPECT_EQ(controller.GetDepth(), 6);
+
+  // never below the minimum
+  for (int i = 0; i < 10000; ++i)
+    controller.AddDecodeTime(1.0, FRAME_TIME);
+  EXPECT_EQ(controller.GetDepth(), 4);
+}
+
+TEST(TestRenderAhead, ModerateSpreadHoldsDepth)
+{
+  CRenderAheadController controller;
+  controller.Configure(2, 4);
+  for (int i = 0; i < 100; ++i)
+    controller.AddDecodeTime(10 * FRAME_TIME, FRAME_TIME);
+  ASSERT_EQ(controller.GetDepth(), 4);
+
+  // decode times between half and a full frame interval don't shrink the queue
+  for (int i = 0; i < 1000; ++i)
+    controller.AddDecodeTime(0.75 * FRAME_TIME, FRAME_TIME);
+  EXPECT_EQ(controller.GetDepth(), 4);
+}
+
+TEST(TestRenderAhead, IgnoresUnknownFrameRate)
+{
+  CRenderAheadController controller;
+  controller.Configure(2, 16);
+  for (int i = 0; i < 100; ++i)
+    EXPECT_FALSE(controller.AddDecodeTime(1000.0, 0.0));
+  EXPECT_EQ(controller.GetDepth(), 2);
+  EXPECT_EQ(controller.GetMean(), 0.0);
+}
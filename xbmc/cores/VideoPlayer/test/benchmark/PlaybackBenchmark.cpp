@@ -0,0 +1,461 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PlaybackBenchmark.h"
+
+#include "FileItem.h"
+#include "cores/VideoPlayer/DVDCodecs/Audio/DVDAudioCodec.h"
+#include "cores/VideoPlayer/DVDCodecs/DVDFactoryCodec.h"
+#include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoCodec.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemux.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDFactoryDemuxer.h"
+#include "cores/VideoPlayer/DVDInputStreams/DVDFactoryInputStream.h"
+#include "cores/VideoPlayer/DVDInputStreams/DVDInputStream.h"
+#include "cores/VideoPlayer/DVDMessage.h"
+#include "cores/VideoPlayer/DVDStreamInfo.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "cores/VideoPlayer/Process/ProcessInfo.h"
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// same queue sizes as the players use by default
+constexpr int VIDEO_QUEUE_SIZE = 40 * 1024 * 1024;
+constexpr int AUDIO_QUEUE_SIZE = 6 * 1024 * 1024;
+constexpr double QUEUE_TIME_SIZE = 8.0;
+
+double ToMsec(std::chrono::steady_clock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+/*!
+ * Peak resident set size of the process in kB, 0 if unknown
+ */
+uint64_t GetPeakRss()
+{
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line))
+  {
+    if (line.compare(0, 6, "VmHWM:") == 0)
+      return std::strtoull(line.c_str() + 6, nullptr, 10);
+  }
+  return 0;
+}
+} // namespace
+
+void CPlaybackBenchmark::CStageTiming::Add(std::chrono::steady_clock::duration duration)
+{
+  count++;
+  total += duration;
+  max = std::max(max, duration);
+}
+
+CVariant CPlaybackBenchmark::CStageTiming::ToVariant() const
+{
+  CVariant result(CVariant::VariantTypeObject);
+  result["count"] = count;
+  result["totalms"] = ToMsec(total);
+  result["averagems"] = count ? ToMsec(total) / count : 0.0;
+  result["maxms"] = ToMsec(max);
+  return result;
+}
+
+void CPlaybackBenchmark::CLevel::Add(int level)
+{
+  samples++;
+  sum += level;
+  max = std::max(max, level);
+}
+
+CVariant CPlaybackBenchmark::CLevel::ToVariant() const
+{
+  CVariant result(CVariant::VariantTypeObject);
+  result["average"] = samples ? static_cast<double>(sum) / samples : 0.0;
+  result["max"] = max;
+  return result;
+}
+
+CPlaybackBenchmark::CPlaybackBenchmark(Options options) : m_options(std::move(options))
+{
+}
+
+CPlaybackBenchmark::~CPlaybackBenchmark() = default;
+
+bool CPlaybackBenchmark::Open()
+{
+  CFileItem item(m_options.file, false);
+  m_inputStream = CDVDFactoryInputStream::CreateInputStream(nullptr, item);
+  if (!m_inputStream || !m_inputStream->Open())
+    return false;
+
+  m_demuxer.reset(CDVDFactoryDemuxer::CreateDemuxer(m_inputStream, true));
+  if (!m_demuxer)
+    return false;
+
+  m_processInfo.reset(CProcessInfo::CreateInstance());
+  std::vector<AVPixelFormat> pixFmts{AV_PIX_FMT_YUV420P};
+  m_processInfo->SetPixFormats(pixFmts);
+
+  for (CDemuxStream* stream : m_demuxer->GetStreams())
+  {
+    if (!stream)
+      continue;
+
+    if (stream->type == STREAM_VIDEO && m_videoStreamId < 0)
+    {
+      CDVDStreamInfo hint(*stream, true);
+      m_videoCodec = CDVDFactoryCodec::CreateVideoCodec(hint, *m_processInfo);
+      if (m_videoCodec)
+      {
+        m_videoStreamId = stream->uniqueId;
+        if (hint.fpsrate > 0 && hint.fpsscale > 0)
+          m_frameTime = DVD_TIME_BASE * static_cast<double>(hint.fpsscale) / hint.fpsrate;
+        continue;
+      }
+    }
+    else if (stream->type == STREAM_AUDIO && m_audioStreamId < 0)
+    {
+      CDVDStreamInfo hint(*stream, true);
+      m_audioCodec = CDVDFactoryCodec::CreateAudioCodec(hint, *m_processInfo, false, false,
+                                                        CAEStreamInfo::STREAM_TYPE_NULL);
+      if (m_audioCodec)
+      {
+        m_audioStreamId = stream->uniqueId;
+        continue;
+      }
+    }
+    m_demuxer->EnableStream(stream->demuxerId, stream->uniqueId, false);
+  }
+
+  if (m_frameTime <= 0)
+    m_frameTime = DVD_TIME_BASE / 25.0;
+
+  return m_videoCodec || m_audioCodec;
+}
+
+bool CPlaybackBenchmark::Run()
+{
+  if (!Open())
+    return false;
+
+  m_videoQueue.SetMaxDataSize(VIDEO_QUEUE_SIZE);
+  m_videoQueue.SetMaxTimeSize(QUEUE_TIME_SIZE);
+  m_audioQueue.SetMaxDataSize(AUDIO_QUEUE_SIZE);
+  m_audioQueue.SetMaxTimeSize(QUEUE_TIME_SIZE);
+  m_videoQueue.Init();
+  m_audioQueue.Init();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  m_running = 1;
+  threads.emplace_back(&CPlaybackBenchmark::RunLoop, this, &CPlaybackBenchmark::DemuxLoop);
+  if (m_videoCodec)
+  {
+    m_running += 2;
+    threads.emplace_back(&CPlaybackBenchmark::RunLoop, this, &CPlaybackBenchmark::VideoLoop);
+    threads.emplace_back(&CPlaybackBenchmark::RunLoop, this, &CPlaybackBenchmark::RenderLoop);
+  }
+  if (m_audioCodec)
+  {
+    m_running++;
+    threads.emplace_back(&CPlaybackBenchmark::RunLoop, this, &CPlaybackBenchmark::AudioLoop);
+  }
+
+  {
+    std::unique_lock lock(m_runLock);
+    if (m_options.timeoutSeconds > 0)
+    {
+      const std::chrono::duration<double> timeout(m_options.timeoutSeconds);
+      if (!m_runCond.wait_for(lock, timeout, [this] { return m_running == 0; }))
+      {
+        lock.unlock();
+        Abort("timeout");
+      }
+    }
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  m_wallTime = std::chrono::steady_clock::now() - start;
+
+  m_videoQueue.End();
+  m_audioQueue.End();
+
+  return true;
+}
+
+void CPlaybackBenchmark::RunLoop(void (CPlaybackBenchmark::*loop)())
+{
+  (this->*loop)();
+
+  std::unique_lock lock(m_runLock);
+  m_running--;
+  m_runCond.notify_all();
+}
+
+void CPlaybackBenchmark::Abort(const std::string& error)
+{
+  {
+    std::unique_lock lock(m_runLock);
+    if (m_error.empty())
+      m_error = error;
+  }
+
+  m_abort = true;
+  m_videoQueue.Abort();
+  m_audioQueue.Abort();
+
+  std::unique_lock lock(m_renderLock);
+  m_renderCond.notify_all();
+}
+
+void CPlaybackBenchmark::DemuxLoop()
+{
+  double firstDts = DVD_NOPTS_VALUE;
+
+  while (!m_abort)
+  {
+    // like the player, don't read ahead while the decoders have enough data
+    if ((m_videoCodec && m_videoQueue.IsFull()) || (m_audioCodec && m_audioQueue.IsFull()))
+    {
+      m_videoQueueLevel.Add(m_videoQueue.GetLevel());
+      m_audioQueueLevel.Add(m_audioQueue.GetLevel());
+      std::this_thread::sleep_for(1ms);
+      continue;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    DemuxPacket* packet = m_demuxer->Read();
+    m_demuxTiming.Add(std::chrono::steady_clock::now() - start);
+    if (!packet)
+      break;
+
+    if (packet->dts != DVD_NOPTS_VALUE)
+    {
+      if (firstDts == DVD_NOPTS_VALUE)
+        firstDts = packet->dts;
+      m_streamSeconds = std::max(m_streamSeconds, (packet->dts - firstDts) / DVD_TIME_BASE);
+    }
+
+    if (packet->iStreamId == m_videoStreamId)
+      m_videoQueue.Put(std::make_shared<CDVDMsgDemuxerPacket>(packet));
+    else if (packet->iStreamId == m_audioStreamId)
+      m_audioQueue.Put(std::make_shared<CDVDMsgDemuxerPacket>(packet));
+    else
+      CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+    m_videoQueueLevel.Add(m_videoQueue.GetLevel());
+    m_audioQueueLevel.Add(m_audioQueue.GetLevel());
+
+    if (m_options.maxSeconds > 0 && m_streamSeconds >= m_options.maxSeconds)
+      break;
+  }
+
+  m_videoQueue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_EOF));
+  m_audioQueue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_EOF));
+}
+
+void CPlaybackBenchmark::VideoLoop()
+{
+  VideoPicture picture = {};
+
+  while (!m_abort)
+  {
+    std::shared_ptr<CDVDMsg> msg;
+    if (MSGQ_IS_ERROR(m_videoQueue.Get(msg, 1000ms)) || !msg)
+      continue;
+
+    const bool eof = msg->IsType(CDVDMsg::GENERAL_EOF);
+    auto start = std::chrono::steady_clock::now();
+    if (eof)
+      m_videoCodec->SetCodecControl(DVD_CODEC_CTRL_DRAIN);
+    else if (msg->IsType(CDVDMsg::DEMUXER_PACKET))
+      m_videoCodec->AddData(*std::static_pointer_cast<CDVDMsgDemuxerPacket>(msg)->GetPacket());
+    else
+      continue;
+
+    CDVDVideoCodec::VCReturn state;
+    while ((state = m_videoCodec->GetPicture(&picture)) == CDVDVideoCodec::VC_PICTURE)
+    {
+      m_videoDecodeTiming.Add(std::chrono::steady_clock::now() - start);
+      m_framesDecoded++;
+      if (picture.iFlags & DVP_FLAG_DROPPED)
+      {
+        m_framesDroppedDecoder++;
+        continue;
+      }
+
+      // null renderer, block like CRenderManager::AddVideoPicture when the queue is full
+      std::unique_lock lock(m_renderLock);
+      m_renderCond.wait(lock, [this] {
+        return m_abort || m_renderQueue.size() < static_cast<size_t>(m_options.renderQueueSize);
+      });
+      m_renderQueue.push_back(picture.pts);
+      m_renderQueueLevel.Add(static_cast<int>(m_renderQueue.size()));
+      m_renderCond.notify_all();
+      lock.unlock();
+
+      // don't count the time blocked on the renderer as decode time
+      start = std::chrono::steady_clock::now();
+    }
+    if (state == CDVDVideoCodec::VC_ERROR)
+    {
+      Abort("video decoder error");
+      break;
+    }
+    if (state == CDVDVideoCodec::VC_REOPEN)
+      m_videoCodec->Reopen();
+
+    if (eof)
+      break;
+  }
+
+  std::unique_lock lock(m_renderLock);
+  m_videoEof = true;
+  m_renderCond.notify_all();
+}
+
+void CPlaybackBenchmark::RenderLoop()
+{
+  while (true)
+  {
+    double pts;
+    {
+      std::unique_lock lock(m_renderLock);
+      m_renderCond.wait(lock, [this] { return m_abort || m_videoEof || !m_renderQueue.empty(); });
+      if (m_renderQueue.empty())
+        break;
+      pts = m_renderQueue.front();
+    }
+
+    if (m_options.realtime && pts != DVD_NOPTS_VALUE)
+    {
+      StartClock(pts);
+      if (ClockNow() - pts > m_frameTime)
+        m_framesDroppedLate++;
+      else
+      {
+        WaitForClock(pts);
+        m_framesRendered++;
+      }
+    }
+    else
+      m_framesRendered++;
+
+    std::unique_lock lock(m_renderLock);
+    m_renderQueue.pop_front();
+    m_renderCond.notify_all();
+  }
+}
+
+void CPlaybackBenchmark::AudioLoop()
+{
+  DVDAudioFrame frame = {};
+
+  while (!m_abort)
+  {
+    std::shared_ptr<CDVDMsg> msg;
+    if (MSGQ_IS_ERROR(m_audioQueue.Get(msg, 1000ms)) || !msg)
+      continue;
+
+    if (msg->IsType(CDVDMsg::GENERAL_EOF))
+      break;
+    if (!msg->IsType(CDVDMsg::DEMUXER_PACKET))
+      continue;
+
+    auto start = std::chrono::steady_clock::now();
+    m_audioCodec->AddData(*std::static_pointer_cast<CDVDMsgDemuxerPacket>(msg)->GetPacket());
+    while (true)
+    {
+      m_audioCodec->GetData(frame);
+      if (!frame.nb_frames)
+        break;
+      m_audioDecodeTiming.Add(std::chrono::steady_clock::now() - start);
+
+      // null sink, consume in realtime when pacing
+      if (m_options.realtime && frame.hasTimestamp)
+      {
+        StartClock(frame.pts);
+        WaitForClock(frame.pts);
+      }
+      m_audioSeconds += frame.duration / DVD_TIME_BASE;
+      start = std::chrono::steady_clock::now();
+    }
+  }
+}
+
+void CPlaybackBenchmark::StartClock(double pts)
+{
+  std::call_once(m_clockStarted, [this, pts] {
+    m_startPts = pts;
+    m_clockStart = std::chrono::steady_clock::now();
+  });
+}
+
+double CPlaybackBenchmark::ClockNow() const
+{
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_clockStart;
+  return m_startPts + elapsed.count() * DVD_TIME_BASE;
+}
+
+void CPlaybackBenchmark::WaitForClock(double pts) const
+{
+  const double wait = pts - ClockNow();
+  if (wait > 0)
+    std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int64_t>(wait)));
+}
+
+CVariant CPlaybackBenchmark::GetResults() const
+{
+  CVariant result(CVariant::VariantTypeObject);
+  result["file"] = m_options.file;
+  result["realtime"] = m_options.realtime;
+  result["walltimems"] = ToMsec(m_wallTime);
+  result["streamseconds"] = m_streamSeconds;
+  result["audioseconds"] = m_audioSeconds;
+  {
+    std::unique_lock lock(m_runLock);
+    result["error"] = m_error;
+  }
+
+  CVariant& stages = result["stages"];
+  stages["demux"] = m_demuxTiming.ToVariant();
+  stages["videodecode"] = m_videoDecodeTiming.ToVariant();
+  stages["audiodecode"] = m_audioDecodeTiming.ToVariant();
+
+  CVariant& queues = result["queues"];
+  queues["video"] = m_videoQueueLevel.ToVariant();
+  queues["audio"] = m_audioQueueLevel.ToVariant();
+  queues["render"] = m_renderQueueLevel.ToVariant();
+
+  CVariant& frames = result["frames"];
+  frames["decoded"] = m_framesDecoded;
+  frames["rendered"] = m_framesRendered;
+  frames["droppeddecoder"] = m_framesDroppedDecoder;
+  frames["droppedlate"] = m_framesDroppedLate;
+  const double seconds = std::chrono::duration<double>(m_wallTime).count();
+  frames["fps"] = seconds > 0 ? m_framesRendered / seconds : 0.0;
+
+  result["peakrsskb"] = GetPeakRss();
+
+  return result;
+}
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+class CDVDAudioCodec;
+class CDVDDemux;
+class CDVDInputStream;
+class CDVDVideoCodec;
+class CProcessInfo;
+class CVariant;
+
+/*!
+ * \brief Headless playback pipeline for benchmarking.
+ *
+ * Runs the VideoPlayer pipeline (input stream, demuxer, message queues, audio and
+ * video decoders) without a display or audio device. The render stage is a null
+ * renderer with a bounded queue like CRenderManager, the audio stage a null sink.
+ * In realtime mode both are paced by the stream clock and late frames are dropped,
+ * otherwise the pipeline runs as fast as it can.
+ */
+class CPlaybackBenchmark
+{
+public:
+  struct Options
+  {
+    std::string file;
+    bool realtime = false;
+    double maxSeconds = 0; //!< stop after this much stream time, 0 = whole file
+    int renderQueueSize = 4;
+    double timeoutSeconds = 0; //!< abort after this much wall time, 0 = no timeout
+  };
+
+  explicit CPlaybackBenchmark(Options options);
+  ~CPlaybackBenchmark();
+
+  /*!
+   * \brief Play the file to the end (or maxSeconds)
+   *
+   * All stages stop when one of them fails or the timeout expires, the reason is reported in
+   * the results.
+   * \return false if the file could not be opened
+   */
+  bool Run();
+
+  /*!
+   * \brief Get the results of the last run
+   * \return Object with per stage timings, queue levels, dropped frames and memory usage
+   */
+  CVariant GetResults() const;
+
+private:
+  struct CStageTiming
+  {
+    void Add(std::chrono::steady_clock::duration duration);
+    CVariant ToVariant() const;
+
+    uint64_t count = 0;
+    std::chrono::steady_clock::duration total{};
+    std::chrono::steady_clock::duration max{};
+  };
+
+  struct CLevel
+  {
+    void Add(int level);
+    CVariant ToVariant() const;
+
+    uint64_t samples = 0;
+    uint64_t sum = 0;
+    int max = 0;
+  };
+
+  bool Open();
+  void DemuxLoop();
+  void VideoLoop();
+  void AudioLoop();
+  void RenderLoop();
+  void RunLoop(void (CPlaybackBenchmark::*loop)());
+  void Abort(const std::string& error);
+
+  void StartClock(double pts);
+  double ClockNow() const;
+  void WaitForClock(double pts) const;
+
+  Options m_options;
+
+  std::shared_ptr<CDVDInputStream> m_inputStream;
+  std::unique_ptr<CDVDDemux> m_demuxer;
+  std::unique_ptr<CProcessInfo> m_processInfo;
+  std::unique_ptr<CDVDVideoCodec> m_videoCodec;
+  std::unique_ptr<CDVDAudioCodec> m_audioCodec;
+  int m_videoStreamId = -1;
+  int m_audioStreamId = -1;
+  double m_frameTime = 0;
+
+  CDVDMessageQueue m_videoQueue{"BenchmarkVideo"};
+  CDVDMessageQueue m_audioQueue{"BenchmarkAudio"};
+
+  // null renderer
+  std::mutex m_renderLock;
+  std::condition_variable m_renderCond;
+  std::deque<double> m_renderQueue;
+  bool m_videoEof = false;
+
+  std::atomic_bool m_abort{false};
+  mutable std::mutex m_runLock;
+  std::condition_variable m_runCond;
+  int m_running = 0;
+  std::string m_error; //!< protected by m_runLock
+  std::once_flag m_clockStarted;
+  double m_startPts = 0;
+  std::chrono::steady_clock::time_point m_clockStart;
+
+  // results
+  std::chrono::steady_clock::duration m_wallTime{};
+  CStageTiming m_demuxTiming;
+  CStageTiming m_videoDecodeTiming;
+  CStageTiming m_audioDecodeTiming;
+  CLevel m_videoQueueLevel;
+  CLevel m_audioQueueLevel;
+  CLevel m_renderQueueLevel;
+  uint64_t m_framesDecoded = 0;
+  uint64_t m_framesRendered = 0;
+  uint64_t m_framesDroppedDecoder = 0;
+  uint64_t m_framesDroppedLate = 0;
+  double m_audioSeconds = 0;
+  double m_streamSeconds = 0;
+};
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PlaybackBenchmark.h"
+#include "ServiceBroker.h"
+#include "utils/CPUInfo.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+class TestPlaybackBenchmark : public testing::Test
+{
+protected:
+  TestPlaybackBenchmark() { CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo()); }
+  ~TestPlaybackBenchmark() override { CServiceBroker::UnregisterCPUInfo(); }
+};
+
+TEST_F(TestPlaybackBenchmark, MissingFile)
+{
+  CPlaybackBenchmark::Options options;
+  options.file = "special://xbmc/xbmc/cores/VideoPlayer/test/benchmark/doesnotexist.mkv";
+  CPlaybackBenchmark benchmark(options);
+  EXPECT_FALSE(benchmark.Run());
+}
+
+// Headless playback benchmark, run with
+//   KODI_PLAYBACK_BENCHMARK_FILE=<sample> kodi-test --gtest_also_run_disabled_tests
+//     --gtest_filter=TestPlaybackBenchmark.DISABLED_Playback
+// Optional:
+//   KODI_PLAYBACK_BENCHMARK_OUTPUT=<file>  write the JSON results to a file
+//   KODI_PLAYBACK_BENCHMARK_REALTIME=1     pace audio and video by the stream clock
+//   KODI_PLAYBACK_BENCHMARK_SECONDS=<n>    only play the first n seconds
+//   KODI_PLAYBACK_BENCHMARK_TIMEOUT=<n>    stop all stages after n seconds of wall time
+TEST_F(TestPlaybackBenchmark, DISABLED_Playback)
+{
+  const char* file = std::getenv("KODI_PLAYBACK_BENCHMARK_FILE");
+  ASSERT_NE(file, nullptr) << "KODI_PLAYBACK_BENCHMARK_FILE not set";
+
+  CPlaybackBenchmark::Options options;
+  options.file = file;
+  if (const char* realtime = std::getenv("KODI_PLAYBACK_BENCHMARK_REALTIME"))
+    options.realtime = std::atoi(realtime) != 0;
+  if (const char* seconds = std::getenv("KODI_PLAYBACK_BENCHMARK_SECONDS"))
+    options.maxSeconds = std::atof(seconds);
+  if (const char* timeout = std::getenv("KODI_PLAYBACK_BENCHMARK_TIMEOUT"))
+    options.timeoutSeconds = std::atof(timeout);
+
+  CPlaybackBenchmark benchmark(options);
+  ASSERT_TRUE(benchmark.Run()) << "failed to open " << file;
+
+  const CVariant results = benchmark.GetResults();
+  std::string json;
+  ASSERT_TRUE(CJSONVariantWriter::Write(results, json, false));
+  std::cout << json << std::endl;
+  EXPECT_TRUE(results["error"].empty()) << results["error"].asString();
+
+  if (const char* output = std::getenv("KODI_PLAYBACK_BENCHMARK_OUTPUT"))
+  {
+    std::ofstream stream(output);
+    stream << json << std::endl;
+    EXPECT_TRUE(stream.good()) << "failed to write " << output;
+  }
+}
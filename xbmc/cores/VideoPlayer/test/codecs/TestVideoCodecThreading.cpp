@@ -0,0 +1,231 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "ServiceBroker.h"
+#include "cores/VideoPlayer/DVDCodecs/DVDFactoryCodec.h"
+#include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoCodec.h"
+#include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoCodecThreading.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemux.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDFactoryDemuxer.h"
+#include "cores/VideoPlayer/DVDInputStreams/DVDFactoryInputStream.h"
+#include "cores/VideoPlayer/DVDInputStreams/DVDInputStream.h"
+#include "cores/VideoPlayer/DVDStreamInfo.h"
+#include "cores/VideoPlayer/Process/ProcessInfo.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using ThreadType = CDVDVideoCodecThreading::ThreadType;
+
+namespace
+{
+CDVDVideoCodecThreading::Stream HDStream()
+{
+  CDVDVideoCodecThreading::Stream stream;
+  stream.width = 1920;
+  stream.height = 1080;
+  return stream;
+}
+
+CDVDVideoCodecThreading::Config Cores(int cores, int reserved = 0)
+{
+  CDVDVideoCodecThreading::Config config;
+  config.cpuCount = cores;
+  config.reservedCores = reserved;
+  return config;
+}
+
+/*!
+ * Decodes up to maxFrames pictures of the first video stream in file and returns
+ * the decode rate in frames per second.
+ */
+double DecodeFps(const std::string& file, int maxFrames)
+{
+  CFileItem item(file, false);
+  auto inputStream = CDVDFactoryInputStream::CreateInputStream(nullptr, item);
+  if (!inputStream || !inputStream->Open())
+    return 0.0;
+
+  std::unique_ptr<CDVDDemux> demuxer{CDVDFactoryDemuxer::CreateDemuxer(inputStream, true)};
+  if (!demuxer)
+    return 0.0;
+
+  CDemuxStream* videoStream = nullptr;
+  for (CDemuxStream* stream : demuxer->GetStreams())
+  {
+    if (stream && stream->type == STREAM_VIDEO && !videoStream)
+      videoStream = stream;
+    else if (stream)
+      demuxer->EnableStream(stream->demuxerId, stream->uniqueId, false);
+  }
+  if (!videoStream)
+    return 0.0;
+
+  std::unique_ptr<CProcessInfo> processInfo(CProcessInfo::CreateInstance());
+  std::vector<AVPixelFormat> pixFmts{AV_PIX_FMT_YUV420P};
+  processInfo->SetPixFormats(pixFmts);
+
+  CDVDStreamInfo hint(*videoStream, true);
+  std::unique_ptr<CDVDVideoCodec> codec = CDVDFactoryCodec::CreateVideoCodec(hint, *processInfo);
+  if (!codec)
+    return 0.0;
+
+  const int streamId = videoStream->uniqueId;
+  VideoPicture picture = {};
+  int frames = 0;
+  const auto start = std::chrono::steady_clock::now();
+  while (frames < maxFrames)
+  {
+    DemuxPacket* packet = demuxer->Read();
+    if (!packet)
+      break;
+
+    if (packet->iStreamId == streamId)
+      codec->AddData(*packet);
+    CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+    CDVDVideoCodec::VCReturn state;
+    while ((state = codec->GetPicture(&picture)) == CDVDVideoCodec::VC_PICTURE)
+      frames++;
+    if (state == CDVDVideoCodec::VC_REOPEN)
+      codec->Reopen();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  return elapsed.count() > 0 ? frames / elapsed.count() : 0.0;
+}
+} // namespace
+
+class TestVideoCodecThreading : public testing::Test
+{
+protected:
+  TestVideoCodecThreading() { CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo()); }
+  ~TestVideoCodecThreading() override { CServiceBroker::UnregisterCPUInfo(); }
+};
+
+TEST_F(TestVideoCodecThreading, AutoUsesFrameThreads)
+{
+  const auto result = CDVDVideoCodecThreading::Select(Cores(4), HDStream(), false);
+  EXPECT_EQ(result.type, ThreadType::FRAME);
+  EXPECT_EQ(result.threadCount, 6);
+}
+
+TEST_F(TestVideoCodecThreading, LowDelayUsesSliceThreads)
+{
+  auto stream = HDStream();
+  stream.lowDelay = true;
+  const auto result = CDVDVideoCodecThreading::Select(Cores(4), stream, false);
+  EXPECT_EQ(result.type, ThreadType::SLICE);
+  EXPECT_EQ(result.threadCount, 4);
+
+  stream.hasSliceThreads = false;
+  EXPECT_EQ(CDVDVideoCodecThreading::Select(Cores(4), stream, false).type, ThreadType::FRAME);
+}
+
+TEST_F(TestVideoCodecThreading, ForcedTypeFallsBackToCapability)
+{
+  auto config = Cores(4);
+  config.type = ThreadType::FRAME;
+  auto stream = HDStream();
+  stream.hasFrameThreads = false;
+  EXPECT_EQ(CDVDVideoCodecThreading::Select(config, stream, false).type, ThreadType::SLICE);
+}
+
+TEST_F(TestVideoCodecThreading, ReservedCores)
+{
+  const auto result = CDVDVideoCodecThreading::Select(Cores(4, 2), HDStream(), false);
+  EXPECT_EQ(result.threadCount, 3);
+
+  // never below one thread
+  EXPECT_EQ(CDVDVideoCodecThreading::Select(Cores(2, 4), HDStream(), false).threadCount, 1);
+}
+
+TEST_F(TestVideoCodecThreading, SmallStreamsAreCapped)
+{
+  CDVDVideoCodecThreading::Stream stream;
+  stream.width = 720;
+  stream.height = 576;
+  EXPECT_EQ(CDVDVideoCodecThreading::Select(Cores(16), stream, false).threadCount, 4);
+  EXPECT_EQ(CDVDVideoCodecThreading::Select(Cores(16), HDStream(), false).threadCount,
+            CDVDVideoCodecThreading::MAX_THREADS);
+}
+
+TEST_F(TestVideoCodecThreading, BoostIgnoresReservationAndCaps)
+{
+  const auto config = Cores(4, 2);
+  const auto normal = CDVDVideoCodecThreading::Select(config, HDStream(), false);
+  const auto boosted = CDVDVideoCodecThreading::Select(config, HDStream(), true);
+  EXPECT_NE(normal, boosted);
+  EXPECT_EQ(boosted.threadCount, 6);
+
+  // nothing to gain without reserved cores
+  EXPECT_EQ(CDVDVideoCodecThreading::Select(Cores(4), HDStream(), false),
+            CDVDVideoCodecThreading::Select(Cores(4), HDStream(), true));
+}
+
+TEST_F(TestVideoCodecThreading, ExplicitThreadCount)
+{
+  auto config = Cores(4);
+  config.maxThreads = 2;
+  EXPECT_EQ(CDVDVideoCodecThreading::Select(config, HDStream(), true).threadCount, 2);
+}
+
+TEST_F(TestVideoCodecThreading, ParseThreadType)
+{
+  EXPECT_EQ(CDVDVideoCodecThreading::ParseThreadType("Frame"), ThreadType::FRAME);
+  EXPECT_EQ(CDVDVideoCodecThreading::ParseThreadType("slice"), ThreadType::SLICE);
+  EXPECT_EQ(CDVDVideoCodecThreading::ParseThreadType("whatever"), ThreadType::AUTO);
+}
+
+TEST_F(TestVideoCodecThreading, ConfigWithoutCPUInfo)
+{
+  EXPECT_GE(CDVDVideoCodecThreading::GetConfig().cpuCount, 1);
+
+  CServiceBroker::UnregisterCPUInfo();
+  EXPECT_EQ(CDVDVideoCodecThreading::GetConfig().cpuCount, 1);
+}
+
+// Headless decode benchmark, run with
+//   KODI_DECODE_BENCHMARK_FILE=<sample> kodi-test --gtest_also_run_disabled_tests
+//     --gtest_filter=TestVideoCodecThreading.DISABLED_DecodeBenchmark
+TEST_F(TestVideoCodecThreading, DISABLED_DecodeBenchmark)
+{
+  const char* file = std::getenv("KODI_DECODE_BENCHMARK_FILE");
+  ASSERT_NE(file, nullptr) << "KODI_DECODE_BENCHMARK_FILE not set";
+
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  const int savedThreads = advancedSettings->m_videoDecodeThreads;
+  const std::string savedType = advancedSettings->m_videoDecodeThreadType;
+
+  const int cpus = CServiceBroker::GetCPUInfo()->GetCPUCount();
+  for (const char* type : {"frame", "slice"})
+  {
+    for (int threads = 1; threads <= std::min(cpus * 3 / 2, CDVDVideoCodecThreading::MAX_THREADS);
+         threads *= 2)
+    {
+      advancedSettings->m_videoDecodeThreads = threads;
+      advancedSettings->m_videoDecodeThreadType = type;
+      std::cout << "type: " << type << " threads: " << threads
+                << " fps: " << DecodeFps(file, 500) << std::endl;
+    }
+  }
+
+  advancedSettings->m_videoDecodeThreads = savedThreads;
+  advancedSettings->m_videoDecodeThreadType = savedType;
+}
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "cores/VideoPlayer/VideoPlayer.h"
+
+#include <gtest/gtest.h>
+
+TEST(TestCurrentStream, NoSkipByDefault)
+{
+  CCurrentStream stream(STREAM_VIDEO, VideoPlayer_VIDEO);
+  EXPECT_FALSE(stream.IsSkipping());
+  EXPECT_FALSE(stream.SkipPacket(0.0, 0.0));
+  EXPECT_FALSE(stream.SkipPacket(DVD_NOPTS_VALUE, DVD_NOPTS_VALUE));
+}
+
+TEST(TestCurrentStream, SkipsQueuedPackets)
+{
+  CCurrentStream stream(STREAM_VIDEO, VideoPlayer_VIDEO);
+  stream.dts = 5 * DVD_TIME_BASE;
+  stream.BeginSkip();
+  EXPECT_TRUE(stream.IsSkipping());
+
+  // the demuxer was reseeked to the play position, behind what is queued already
+  EXPECT_TRUE(stream.SkipPacket(3 * DVD_TIME_BASE, 3 * DVD_TIME_BASE));
+  EXPECT_TRUE(stream.SkipPacket(4 * DVD_TIME_BASE, DVD_NOPTS_VALUE));
+  EXPECT_TRUE(stream.SkipPacket(5 * DVD_TIME_BASE, 6 * DVD_TIME_BASE));
+  EXPECT_TRUE(stream.IsSkipping());
+
+  // the first new packet ends skipping, later packets are never skipped
+  EXPECT_FALSE(stream.SkipPacket(5.04 * DVD_TIME_BASE, 5.1 * DVD_TIME_BASE));
+  EXPECT_FALSE(stream.IsSkipping());
+  EXPECT_FALSE(stream.SkipPacket(5 * DVD_TIME_BASE, 5 * DVD_TIME_BASE));
+}
+
+TEST(TestCurrentStream, SkipUsesPtsWithoutDts)
+{
+  CCurrentStream stream(STREAM_SUBTITLE, VideoPlayer_SUBTITLE);
+  stream.dts = 10 * DVD_TIME_BASE;
+  stream.BeginSkip();
+
+  EXPECT_TRUE(stream.SkipPacket(DVD_NOPTS_VALUE, 9 * DVD_TIME_BASE));
+  // packets without any timestamp can't be placed and are skipped until caught up
+  EXPECT_TRUE(stream.SkipPacket(DVD_NOPTS_VALUE, DVD_NOPTS_VALUE));
+  EXPECT_FALSE(stream.SkipPacket(DVD_NOPTS_VALUE, 11 * DVD_TIME_BASE));
+  EXPECT_FALSE(stream.IsSkipping());
+}
+
+TEST(TestCurrentStream, NoSkipWithoutQueuedPackets)
+{
+  // nothing was demuxed for the stream yet, so nothing is queued
+  CCurrentStream stream(STREAM_AUDIO, VideoPlayer_AUDIO);
+  stream.BeginSkip();
+  EXPECT_FALSE(stream.IsSkipping());
+  EXPECT_FALSE(stream.SkipPacket(1 * DVD_TIME_BASE, 1 * DVD_TIME_BASE));
+}
+
+TEST(TestCurrentStream, ClearEndsSkip)
+{
+  CCurrentStream stream(STREAM_AUDIO, VideoPlayer_AUDIO);
+  stream.dts = 5 * DVD_TIME_BASE;
+  stream.BeginSkip();
+  ASSERT_TRUE(stream.IsSkipping());
+
+  stream.Clear();
+  EXPECT_FALSE(stream.IsSkipping());
+  EXPECT_FALSE(stream.SkipPacket(1 * DVD_TIME_BASE, 1 * DVD_TIME_BASE));
+}
@@ -0,0 +1,149 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "ServiceBroker.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemux.h"
+#include "cores/VideoPlayer/DVDInputStreams/DVDInputStreamFile.h"
+#include "cores/VideoPlayer/VideoPlayerNextItem.h"
+#include "test/MtTestUtils.h"
+#include "threads/Event.h"
+#include "utils/JobManager.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using namespace ConditionPoll;
+using namespace std::chrono_literals;
+
+namespace
+{
+CVideoPlayerNextItem::OpenedItem OpenItem(const CFileItem& item)
+{
+  return {std::make_shared<CDVDInputStreamFile>(item, 0), nullptr};
+}
+
+CVideoPlayerNextItem::HandOver WaitForHandOver(CVideoPlayerNextItem& nextItem, CFileItem& item)
+{
+  CVideoPlayerNextItem::HandOver handOver = CVideoPlayerNextItem::HandOver::WAIT;
+  poll(
+      [&]()
+      {
+        handOver = nextItem.CheckHandOver(item);
+        return handOver != CVideoPlayerNextItem::HandOver::WAIT;
+      });
+  return handOver;
+}
+} // namespace
+
+class TestVideoPlayerNextItem : public testing::Test
+{
+protected:
+  TestVideoPlayerNextItem() { CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>()); }
+
+  ~TestVideoPlayerNextItem() override
+  {
+    CServiceBroker::GetJobManager()->CancelJobs();
+    CServiceBroker::UnregisterJobManager();
+  }
+};
+
+TEST_F(TestVideoPlayerNextItem, NothingQueued)
+{
+  CVideoPlayerNextItem nextItem;
+  CFileItem item;
+  EXPECT_EQ(nextItem.CheckHandOver(item), CVideoPlayerNextItem::HandOver::NONE);
+  EXPECT_EQ(nextItem.Take("/next.mkv").inputStream, nullptr);
+}
+
+TEST_F(TestVideoPlayerNextItem, HandsOverOpenedItem)
+{
+  CVideoPlayerNextItem nextItem;
+  nextItem.Queue(CFileItem("/next.mkv", false), OpenItem);
+
+  CFileItem item;
+  ASSERT_EQ(WaitForHandOver(nextItem, item), CVideoPlayerNextItem::HandOver::READY);
+  EXPECT_EQ(item.GetDynPath(), "/next.mkv");
+
+  // the player opens the item it was handed over
+  EXPECT_NE(nextItem.Take(item.GetDynPath()).inputStream, nullptr);
+  EXPECT_EQ(nextItem.CheckHandOver(item), CVideoPlayerNextItem::HandOver::NONE);
+}
+
+TEST_F(TestVideoPlayerNextItem, DropsOnOtherItem)
+{
+  CVideoPlayerNextItem nextItem;
+  nextItem.Queue(CFileItem("/next.mkv", false), OpenItem);
+
+  CFileItem item;
+  ASSERT_EQ(WaitForHandOver(nextItem, item), CVideoPlayerNextItem::HandOver::READY);
+
+  // another item was started, the one opened ahead isn't needed anymore
+  EXPECT_EQ(nextItem.Take("/other.mkv").inputStream, nullptr);
+  EXPECT_EQ(nextItem.CheckHandOver(item), CVideoPlayerNextItem::HandOver::NONE);
+  EXPECT_EQ(nextItem.Take("/next.mkv").inputStream, nullptr);
+}
+
+TEST_F(TestVideoPlayerNextItem, NoHandOverIfOpeningFails)
+{
+  CVideoPlayerNextItem nextItem;
+  nextItem.Queue(CFileItem("/next.mkv", false),
+                 [](const CFileItem&) { return CVideoPlayerNextItem::OpenedItem{}; });
+
+  CFileItem item;
+  EXPECT_EQ(WaitForHandOver(nextItem, item), CVideoPlayerNextItem::HandOver::NONE);
+  EXPECT_EQ(nextItem.Take("/next.mkv").inputStream, nullptr);
+}
+
+TEST_F(TestVideoPlayerNextItem, GivesUpOnHangingOpen)
+{
+  CEvent release;
+  std::atomic<bool> opened{false};
+  CVideoPlayerNextItem nextItem(100ms);
+  nextItem.Queue(CFileItem("/next.mkv", false),
+                 [&](const CFileItem& item)
+                 {
+                   release.Wait();
+                   opened = true;
+                   return OpenItem(item);
+                 });
+
+  CFileItem item;
+  EXPECT_EQ(nextItem.CheckHandOver(item), CVideoPlayerNextItem::HandOver::WAIT);
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(WaitForHandOver(nextItem, item), CVideoPlayerNextItem::HandOver::NONE);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 50ms);
+
+  // opened too late, the playlist player opens the item
+  release.Set();
+  ASSERT_TRUE(poll([&]() -> bool { return opened; }));
+  EXPECT_EQ(nextItem.CheckHandOver(item), CVideoPlayerNextItem::HandOver::NONE);
+  EXPECT_EQ(nextItem.Take("/next.mkv").inputStream, nullptr);
+}
+
+TEST_F(TestVideoPlayerNextItem, ReplacesQueuedItem)
+{
+  CEvent release;
+  CVideoPlayerNextItem nextItem;
+  nextItem.Queue(CFileItem("/first.mkv", false),
+                 [&](const CFileItem& item)
+                 {
+                   release.Wait();
+                   return OpenItem(item);
+                 });
+  nextItem.Queue(CFileItem("/second.mkv", false), OpenItem);
+  release.Set();
+
+  CFileItem item;
+  ASSERT_EQ(WaitForHandOver(nextItem, item), CVideoPlayerNextItem::HandOver::READY);
+  EXPECT_EQ(item.GetDynPath(), "/second.mkv");
+  EXPECT_NE(nextItem.Take("/second.mkv").inputStream, nullptr);
+}
@@ -20,12 +20,20 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cmath>
 #include <mutex>
 
 using namespace KODI;
+using namespace std::chrono_literals;
 
-CAudioDecoder::CAudioDecoder()
+namespace
+{
+// buffered audio to consider a stream queued, as long as the buffer is large enough
+constexpr auto QUEUED_TIME = 1800ms;
+} // namespace
+
+CAudioDecoder::CAudioDecoder() : CThread("AudioDecoder")
 {
   m_codec = NULL;
   m_rawBuffer = nullptr;
@@ -50,6 +58,8 @@ CAudioDecoder::~CAudioDecoder()
 
 void CAudioDecoder::Destroy()
 {
+  StopThread(true);
+
   std::unique_lock lock(m_critSection);
   m_status = STATUS_NO_FILE;
 
@@ -60,9 +70,12 @@ void CAudioDecoder::Destroy()
   m_codec = NULL;
 
   m_canPlay = false;
+  m_decodeError = false;
 }
 
-bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
+bool CAudioDecoder::Create(const CFileItem& file,
+                           int64_t seekOffset,
+                           std::chrono::milliseconds bufferTime)
 {
   Destroy();
 
@@ -70,6 +83,7 @@ bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
 
   // reset our playback timing variables
   m_eof = false;
+  m_maxReadTime = 0;
 
   // get correct cache size
   const std::shared_ptr<CSettings> settings = CServiceBroker::GetSettingsComponent()->GetSettings();
@@ -82,7 +96,7 @@ bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
     filecache = settings->GetInt(CSettings::SETTING_CACHEAUDIO_LAN);
 
   // create our codec
-  m_codec=CodecFactory::CreateCodecDemux(file, filecache * 1024);
+  m_codec = CreateCodec(file, filecache * 1024);
 
   if (!m_codec || !m_codec->Init(file, filecache * 1024))
   {
@@ -100,8 +114,12 @@ bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
     return false;
   }
 
-  /* allocate the pcmBuffer for 2 seconds of audio */
-  m_pcmBuffer.Create(2 * blockSize * m_codec->m_format.m_sampleRate);
+  /* allocate the pcmBuffer, at least for 2 seconds of audio */
+  const unsigned int bytesPerSecond = blockSize * m_codec->m_format.m_sampleRate;
+  bufferTime = std::max(bufferTime, std::chrono::milliseconds(2000));
+  m_pcmBuffer.Create(static_cast<unsigned int>(bytesPerSecond * bufferTime.count() / 1000));
+  m_queuedSize = static_cast<unsigned int>(
+      std::min<int64_t>(bytesPerSecond * QUEUED_TIME.count() / 1000, m_pcmBuffer.getSize() * 0.9));
 
   if (file.HasMusicInfoTag())
   {
@@ -151,10 +169,44 @@ unsigned int CAudioDecoder::GetChannels()
   return GetFormat().m_channelLayout.Count();
 }
 
+ICodec* CAudioDecoder::CreateCodec(const CFileItem& file, unsigned int filecache)
+{
+  return CodecFactory::CreateCodecDemux(file, filecache);
+}
+
+void CAudioDecoder::StartDecodeThread()
+{
+  if (!m_codec || m_codec->m_format.m_dataFormat == AE_FMT_RAW || IsRunning())
+    return;
+
+  CThread::Create();
+}
+
+void CAudioDecoder::Process()
+{
+  while (!m_bStop)
+  {
+    const int result = DecodeSamples(PACKET_SIZE);
+    if (result == RET_ERROR)
+    {
+      m_decodeError = true;
+      break;
+    }
+
+    // buffer full or end of file, wait for the player to consume data or seek
+    if (result == RET_SLEEP)
+      AbortableWait(m_spaceEvent, 100ms);
+  }
+}
+
 int64_t CAudioDecoder::Seek(int64_t time)
 {
+  // the decode thread must not write data of the old position after the buffer was cleared
+  std::unique_lock lock(m_critSection);
+
   m_pcmBuffer.Clear();
   m_rawBufferSize = 0;
+  m_spaceEvent.Set();
   if (!m_codec)
     return 0;
   if (time < 0) time = 0;
@@ -186,16 +238,15 @@ unsigned int CAudioDecoder::GetDataSize(bool checkPktSize)
     if (m_status == STATUS_ENDING)
     {
       if (m_pcmBuffer.getMaxReadSize() == 0)
-        m_status = STATUS_ENDED;
+        ChangeStatus(STATUS_ENDING, STATUS_ENDED);
       else if (checkPktSize && m_pcmBuffer.getMaxReadSize() < PACKET_SIZE)
-        m_status = STATUS_ENDED;
+        ChangeStatus(STATUS_ENDING, STATUS_ENDED);
     }
     return std::min(m_pcmBuffer.getMaxReadSize() / (m_codec->m_bitsPerSample >> 3), (unsigned int)OUTPUT_SAMPLES);
   }
   else
   {
-    if (m_status == STATUS_ENDING)
-      m_status = STATUS_ENDED;
+    ChangeStatus(STATUS_ENDING, STATUS_ENDED);
     return m_rawBufferSize;
   }
 }
@@ -220,8 +271,10 @@ void *CAudioDecoder::GetData(unsigned int samples)
 
   if (m_pcmBuffer.ReadData((char *)m_outputBuffer, size))
   {
-    if (m_status == STATUS_ENDING && m_pcmBuffer.getMaxReadSize() == 0)
-      m_status = STATUS_ENDED;
+    m_spaceEvent.Set();
+
+    if (m_pcmBuffer.getMaxReadSize() == 0)
+      ChangeStatus(STATUS_ENDING, STATUS_ENDED);
 
     return m_outputBuffer;
   }
@@ -232,8 +285,7 @@ void *CAudioDecoder::GetData(unsigned int samples)
 
 uint8_t *CAudioDecoder::GetRawData(int &size)
 {
-  if (m_status == STATUS_ENDING)
-    m_status = STATUS_ENDED;
+  ChangeStatus(STATUS_ENDING, STATUS_ENDED);
 
   if (m_rawBufferSize)
   {
@@ -245,13 +297,24 @@ uint8_t *CAudioDecoder::GetRawData(int &size)
 }
 
 int CAudioDecoder::ReadSamples(int numsamples)
+{
+  // the decode thread is doing the work
+  if (m_decodeError)
+    return RET_ERROR;
+  if (IsRunning())
+    return RET_SLEEP;
+
+  return DecodeSamples(numsamples);
+}
+
+int CAudioDecoder::DecodeSamples(int numsamples)
 {
   if (m_status == STATUS_NO_FILE || m_status == STATUS_ENDING || m_status == STATUS_ENDED)
     return RET_SLEEP;             // nothing loaded yet
 
   // start playing once we're fully queued and we're ready to go
-  if (m_status == STATUS_QUEUED && m_canPlay)
-    m_status = STATUS_PLAYING;
+  if (m_canPlay)
+    ChangeStatus(STATUS_QUEUED, STATUS_PLAYING);
 
   // grab a lock to ensure the codec is created at this point.
   std::unique_lock lock(m_critSection);
@@ -265,9 +328,14 @@ int CAudioDecoder::ReadSamples(int numsamples)
     if (numsamples)
     {
       size_t readSize = 0;
+      const auto start = std::chrono::steady_clock::now();
       int result = m_codec->ReadPCM(
           m_pcmInputBuffer, static_cast<size_t>(numsamples * (m_codec->m_bitsPerSample >> 3)),
           &readSize);
+      const auto readTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start);
+      if (readTime.count() > m_maxReadTime)
+        m_maxReadTime = readTime.count();
 
       if (result != READ_ERROR && readSize)
       {
@@ -275,18 +343,15 @@ int CAudioDecoder::ReadSamples(int numsamples)
         m_pcmBuffer.WriteData((char *)m_pcmInputBuffer, readSize);
 
         // update status
-        if (m_status == STATUS_QUEUING && m_pcmBuffer.getMaxReadSize() > m_pcmBuffer.getSize() * 0.9)
-        {
+        if (m_pcmBuffer.getMaxReadSize() > m_queuedSize &&
+            ChangeStatus(STATUS_QUEUING, STATUS_QUEUED))
           CLog::Log(LOGINFO, "AudioDecoder: File is queued");
-          m_status = STATUS_QUEUED;
-        }
 
         if (result == READ_EOF) // EOF reached
         {
           // setup ending if we're within set time of the end (currently just EOF)
           m_eof = true;
-          if (m_status < STATUS_ENDING)
-            m_status = STATUS_ENDING;
+          SetEnding();
         }
 
         return RET_SUCCESS;
@@ -301,8 +366,7 @@ int CAudioDecoder::ReadSamples(int numsamples)
       {
         m_eof = true;
         // setup ending if we're within set time of the end (currently just EOF)
-        if (m_status < STATUS_ENDING)
-          m_status = STATUS_ENDING;
+        SetEnding();
       }
     }
   }
@@ -314,10 +378,7 @@ int CAudioDecoder::ReadSamples(int numsamples)
       if (result == READ_SUCCESS && m_rawBufferSize)
       {
         //! @todo trash this useless ringbuffer
-        if (m_status == STATUS_QUEUING)
-        {
-          m_status = STATUS_QUEUED;
-        }
+        ChangeStatus(STATUS_QUEUING, STATUS_QUEUED);
         return RET_SUCCESS;
       }
       else if (result == READ_ERROR)
@@ -330,14 +391,26 @@ int CAudioDecoder::ReadSamples(int numsamples)
       {
         m_eof = true;
         // setup ending if we're within set time of the end (currently just EOF)
-        if (m_status < STATUS_ENDING)
-          m_status = STATUS_ENDING;
+        SetEnding();
       }
     }
   }
   return RET_SLEEP; // nothing to do
 }
 
+bool CAudioDecoder::ChangeStatus(int from, int to)
+{
+  return m_status.compare_exchange_strong(from, to);
+}
+
+void CAudioDecoder::SetEnding()
+{
+  int status = m_status;
+  while (status < STATUS_ENDING && !m_status.compare_exchange_weak(status, STATUS_ENDING))
+  {
+  }
+}
+
 bool CAudioDecoder::CanSeek()
 {
   if (m_codec)
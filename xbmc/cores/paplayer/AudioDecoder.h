@@ -9,8 +9,13 @@
 #pragma once
 
 #include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
 #include "utils/RingBuffer.h"
 
+#include <atomic>
+#include <chrono>
+
 struct AEAudioFormat;
 class CFileItem;
 class ICodec;
@@ -37,15 +42,30 @@ class ICodec;
 #define RET_SUCCESS 0
 #define RET_SLEEP 1
 
-class CAudioDecoder
+class CAudioDecoder : private CThread
 {
 public:
   CAudioDecoder();
-  ~CAudioDecoder();
-
-  bool Create(const CFileItem &file, int64_t seekOffset);
+  ~CAudioDecoder() override;
+
+  /*!
+   * \brief Open the file
+   * \param bufferTime length of the pcm buffer, decoding runs this far ahead of playback
+   */
+  bool Create(const CFileItem& file,
+              int64_t seekOffset,
+              std::chrono::milliseconds bufferTime = std::chrono::milliseconds(2000));
   void Destroy();
 
+  /*!
+   * \brief Decode into the pcm buffer on a thread of the decoder instead of in ReadSamples().
+   * Raw streams are always read by the caller.
+   */
+  void StartDecodeThread();
+
+  /*!
+   * \brief Decode more data, or with a running decode thread only report its state
+   */
   int ReadSamples(int numsamples);
 
   bool CanSeek();
@@ -53,7 +73,7 @@ public:
   int64_t TotalTime();
   void SetTotalTime(int64_t time);
   void Start() { m_canPlay = true;}; // cause a pre-buffered stream to start.
-  int GetStatus() { return m_status; }
+  int GetStatus() const { return m_status; }
   void SetStatus(int status) { m_status = status; }
 
   AEAudioFormat GetFormat();
@@ -65,9 +85,41 @@ public:
   ICodec *GetCodec() const { return m_codec; }
   float GetReplayGain(float &peakVal);
 
+  /*!
+   * \brief Longest time a single read from the codec took since Create()
+   */
+  std::chrono::milliseconds GetMaxReadTime() const
+  {
+    return std::chrono::milliseconds(m_maxReadTime.load());
+  }
+
+protected:
+  /*!
+   * \brief Create the codec for a file, the decoder takes ownership
+   */
+  virtual ICodec* CreateCodec(const CFileItem& file, unsigned int filecache);
+
+  // implementation of CThread
+  void Process() override;
+
 private:
+  int DecodeSamples(int numsamples);
+
+  /*!
+   * \brief The decode thread and the reader both change the status, only change it if it is
+   * still the one the change was decided on
+   * \return false if the status was changed in the meantime
+   */
+  bool ChangeStatus(int from, int to);
+
+  /*!
+   * \brief Move to STATUS_ENDING, unless the reader moved on to STATUS_ENDED already
+   */
+  void SetEnding();
+
   // pcm buffer
   CRingBuffer m_pcmBuffer;
+  unsigned int m_queuedSize = 0; // buffered bytes to become STATUS_QUEUED
 
   // output buffer (for transferring data from the Pcm Buffer to the rest of the audio chain)
   float m_outputBuffer[OUTPUT_SAMPLES];
@@ -81,8 +133,13 @@ private:
 
   // status
   bool m_eof;
-  int m_status;
-  bool m_canPlay;
+  std::atomic_int m_status;
+  std::atomic_bool m_canPlay;
+
+  // decode thread
+  std::atomic_bool m_decodeError = false;
+  std::atomic<int64_t> m_maxReadTime = 0;
+  CEvent m_spaceEvent;
 
   // the codec we're using
   ICodec* m_codec;
@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "ICodec.h"
+#include "TrackWaveform.h"
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "Util.h"
@@ -22,6 +23,7 @@
 #include "messaging/ApplicationMessenger.h"
 #include "music/MusicFileItemClassify.h"
 #include "music/tags/MusicInfoTag.h"
+#include "network/NetworkFileItemClassify.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
@@ -30,6 +32,8 @@
 #include "utils/log.h"
 #include "video/Bookmark.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -325,7 +329,8 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     starttime = 0; // No resume point
   }
 
-  if (!si->m_decoder.Create(file, si->m_startOffset))
+  const auto openStart = std::chrono::steady_clock::now();
+  if (!si->m_decoder.Create(file, si->m_startOffset, m_sourceLatency.GetDecodeBufferTime()))
   {
     CLog::Log(LOGWARNING, "PAPlayer::QueueNextFileEx - Failed to create the decoder");
 
@@ -339,6 +344,7 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
 
   /* decode until there is data-available */
   si->m_decoder.Start();
+  si->m_decoder.StartDecodeThread();
   while (si->m_decoder.GetDataSize(true) == 0)
   {
     int status = si->m_decoder.GetStatus();
@@ -360,6 +366,9 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     CThread::Sleep(1ms);
   }
 
+  UpdateSourceLatency(std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - openStart));
+
   // set m_upcomingCrossfadeMS depending on type of file and user settings
   UpdateCrossfadeTime(*si->m_fileItem);
 
@@ -378,6 +387,7 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
   si->m_volume = (fadeIn && m_upcomingCrossfadeMS) ? 0.0f : 1.0f;
   si->m_fadeOutTriggered = false;
   si->m_isSlaved = false;
+  RequestWaveform(*si);
 
   si->m_decoderTotal = si->m_decoder.TotalTime();
   int64_t streamTotalTime = si->m_decoderTotal;
@@ -404,10 +414,7 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
   si->m_prepareNextAtFrame = 0;
   // cd drives don't really like it to be crossfaded or prepared
   if (!MUSIC::IsCDDA(file))
-  {
-    if (streamTotalTime >= TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
-      si->m_prepareNextAtFrame = (int)((streamTotalTime - TIME_TO_CACHE_NEXT_FILE - m_defaultCrossfadeMS) * si->m_audioFormat.m_sampleRate / 1000.0f);
-  }
+    si->m_prepareNextAtFrame = CalcPrepareNextAtFrame(*si, streamTotalTime);
 
   if (m_currentStream && ((m_currentStream->m_audioFormat.m_dataFormat == AE_FMT_RAW) || (si->m_audioFormat.m_dataFormat == AE_FMT_RAW)))
   {
@@ -445,6 +452,28 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
   return true;
 }
 
+int PAPlayer::CalcPrepareNextAtFrame(const StreamInfo& si, int64_t streamTotalTime) const
+{
+  if (streamTotalTime < TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
+    return 0;
+
+  // a slow source needs more time to open the next song and to fill its buffers
+  const int64_t cacheTime =
+      m_sourceLatency.GetCacheNextFileTime(std::chrono::milliseconds(TIME_TO_CACHE_NEXT_FILE))
+          .count();
+  const int64_t prepareTime = std::max<int64_t>(streamTotalTime - cacheTime - m_defaultCrossfadeMS, 0);
+
+  // frame 0 disables preparing, so a short song prepares the next right after its start
+  return std::max(1, static_cast<int>(prepareTime * si.m_audioFormat.m_sampleRate / 1000.0f));
+}
+
+void PAPlayer::UpdateSourceLatency(std::chrono::milliseconds latency)
+{
+  if (m_sourceLatency.Update(latency))
+    CLog::Log(LOGDEBUG, "PAPlayer::UpdateSourceLatency - source latency {} ms",
+              m_sourceLatency.Get().count());
+}
+
 void PAPlayer::UpdateStreamInfoPlayNextAtFrame(StreamInfo *si, unsigned int crossFadingTime)
 {
   // if no crossfading or cue sheet, wait for eof
@@ -480,6 +509,18 @@ inline bool PAPlayer::PrepareStream(StreamInfo *si)
   }
 
   si->m_stream->SetVolume(si->m_volume);
+
+  // music is heard in the audio zones that want it, bit 0 is the audio device
+  const auto& zones = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioZones;
+  unsigned int zoneMask = 1;
+  for (unsigned int i = 0; i < zones.size() && i + 1 < 32; i++)
+  {
+    if (zones[i].music)
+      zoneMask |= 1u << (i + 1);
+  }
+  if (zoneMask != 1)
+    si->m_stream->SetZones(zoneMask);
+
   float peak = 1.0;
   float gain = si->m_decoder.GetReplayGain(peak);
   if (peak * gain <= 1.0f)
@@ -678,6 +719,7 @@ inline void PAPlayer::ProcessStreams(double &freeBufferTime)
 
       /* unregister the audio callback */
       si->m_stream->UnRegisterAudioCallback();
+      UpdateSourceLatency(si->m_decoder.GetMaxReadTime());
       si->m_decoder.Destroy();
       si->m_stream->Drain(false);
       m_finishing.push_back(si);
@@ -804,15 +846,14 @@ inline bool PAPlayer::ProcessStream(StreamInfo *si, double &freeBufferTime)
 
       *si->m_fileItem = *si->m_nextFileItem;
       si->m_nextFileItem.reset();
+      RequestWaveform(*si);
 
       int64_t streamTotalTime = si->m_decoder.TotalTime() - si->m_startOffset;
       if (si->m_endOffset)
         streamTotalTime = si->m_endOffset - si->m_startOffset;
 
       // calculate time when to prepare next stream
-      si->m_prepareNextAtFrame = 0;
-      if (streamTotalTime >= TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
-        si->m_prepareNextAtFrame = (int)((streamTotalTime - TIME_TO_CACHE_NEXT_FILE - m_defaultCrossfadeMS) * si->m_audioFormat.m_sampleRate / 1000.0f);
+      si->m_prepareNextAtFrame = CalcPrepareNextAtFrame(*si, streamTotalTime);
 
       si->m_prepareTriggered = false;
       si->m_playNextAtFrame = 0;
@@ -1054,6 +1095,15 @@ void PAPlayer::GetAudioStreamInfo(int index, AudioStreamInfo& info) const
   info.bitspersample = m_playerGUIData.m_bitsPerSample;
 }
 
+bool PAPlayer::GetWaveform(std::vector<float>& peaks) const
+{
+  std::unique_lock lock(m_streamsLock);
+  if (!m_currentStream || !m_currentStream->m_waveform)
+    return false;
+
+  return m_currentStream->m_waveform->Get(peaks);
+}
+
 bool PAPlayer::CanSeek() const
 {
   return m_playerGUIData.m_canSeek;
@@ -1173,6 +1223,21 @@ void PAPlayer::CloseFileCB(StreamInfo &si)
                                           CJob::PRIORITY_NORMAL);
 }
 
+void PAPlayer::RequestWaveform(StreamInfo& si)
+{
+  si.m_waveform.reset();
+
+  // only songs of the library, browsing files or listening to radio should not decode twice
+  const CFileItem& item = *si.m_fileItem;
+  if (!item.HasMusicInfoTag() || item.GetMusicInfoTag()->GetDatabaseId() <= 0 ||
+      MUSIC::IsCDDA(item) || NETWORK::IsInternetStream(item) ||
+      !CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+          CSettings::SETTING_MUSICPLAYER_WAVEFORMCACHE))
+    return;
+
+  si.m_waveform = CTrackWaveform::Request(item.GetDynPath(), si.m_startOffset, si.m_endOffset);
+}
+
 void PAPlayer::AdvancePlaylistOnError(CFileItem &fileItem)
 {
   if (m_signalStarted)
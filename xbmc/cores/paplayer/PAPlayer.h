@@ -9,6 +9,7 @@
 #pragma once
 
 #include "AudioDecoder.h"
+#include "SourceLatency.h"
 #include "cores/AudioEngine/Interfaces/AE.h"
 #include "cores/AudioEngine/Interfaces/IAudioCallback.h"
 #include "cores/IPlayer.h"
@@ -17,12 +18,14 @@
 #include "utils/Job.h"
 
 #include <atomic>
+#include <chrono>
 #include <list>
 #include <vector>
 
 class IAEStream;
 class CFileItem;
 class CProcessInfo;
+class CTrackWaveform;
 
 class PAPlayer : public IPlayer, public CThread, public IJobCallback
 {
@@ -51,6 +54,7 @@ public:
   void SetTime(int64_t time) override;
   void SeekTime(int64_t iTime = 0) override;
   void GetAudioCapabilities(std::vector<IPlayerAudioCaps>& caps) const override {}
+  bool GetWaveform(std::vector<float>& peaks) const override;
 
   int GetAudioStreamCount() const override { return 1; }
   int GetAudioStream() override { return 0; }
@@ -107,6 +111,8 @@ private:
 
     bool m_isSlaved;                     /* true if the stream has been slaved to another */
     bool m_waitOnDrain;                  /* wait for stream being drained in AE */
+
+    std::shared_ptr<CTrackWaveform> m_waveform; /* peaks of the whole song, if cached */
   };
 
   typedef std::list<StreamInfo*> StreamList;
@@ -120,11 +126,12 @@ private:
   bool m_fullScreen;
   unsigned int m_defaultCrossfadeMS = 0; /* how long the default crossfade is in ms */
   unsigned int m_upcomingCrossfadeMS = 0; /* how long the upcoming crossfade is in ms */
+  CSourceLatency m_sourceLatency; /* slowest open or read of the recent songs */
   CEvent              m_startEvent;          /* event for playback start */
   StreamInfo* m_currentStream = nullptr;
   IAudioCallback*     m_audioCallback;       /* the viz audio callback */
 
-  CCriticalSection    m_streamsLock;         /* lock for the stream list */
+  mutable CCriticalSection m_streamsLock; /* lock for the stream list */
   StreamList          m_streams;             /* playing streams */
   StreamList          m_finishing;           /* finishing streams */
   int m_jobCounter = 0;
@@ -144,7 +151,10 @@ private:
   int64_t GetTotalTime64();
   void UpdateCrossfadeTime(const CFileItem& file);
   void UpdateStreamInfoPlayNextAtFrame(StreamInfo *si, unsigned int crossFadingTime);
+  int CalcPrepareNextAtFrame(const StreamInfo& si, int64_t streamTotalTime) const;
+  void UpdateSourceLatency(std::chrono::milliseconds latency);
   void UpdateGUIData(StreamInfo *si);
+  void RequestWaveform(StreamInfo& si);
   int64_t GetTimeInternal();
   bool SetTimeInternal(int64_t time);
   bool SetTotalTimeInternal(int64_t time);
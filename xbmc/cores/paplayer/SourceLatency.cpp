@@ -0,0 +1,44 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SourceLatency.h"
+
+#include <algorithm>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr auto MAX_CACHE_NEXT_FILE = 30000ms; // never open the next song more than 30s early
+constexpr auto MIN_DECODE_BUFFER = 2000ms; // decode at least 2 seconds ahead
+constexpr auto MAX_DECODE_BUFFER = 8000ms; // and at most 8 seconds
+} // namespace
+
+bool CSourceLatency::Update(std::chrono::milliseconds latency)
+{
+  // one stall on a network source is likely to be followed by more
+  const auto measured = static_cast<unsigned int>(std::max<int64_t>(latency.count(), 0));
+  const unsigned int current = m_latencyMS;
+  const unsigned int updated = std::max(measured, (current * 3 + measured) / 4);
+  if (updated == current)
+    return false;
+
+  m_latencyMS = updated;
+  return true;
+}
+
+std::chrono::milliseconds CSourceLatency::GetDecodeBufferTime() const
+{
+  return std::clamp(MIN_DECODE_BUFFER + 2 * Get(), MIN_DECODE_BUFFER, MAX_DECODE_BUFFER);
+}
+
+std::chrono::milliseconds CSourceLatency::GetCacheNextFileTime(
+    std::chrono::milliseconds minTime) const
+{
+  return std::min(minTime + 2 * Get(), std::max(minTime, MAX_CACHE_NEXT_FILE));
+}
@@ -0,0 +1,43 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+/*!
+ * \brief Latency of the source songs are played from, slowest open or read of the recent songs
+ *
+ * Slow sources open the next song earlier and decode further ahead of playback.
+ */
+class CSourceLatency
+{
+public:
+  /*!
+   * \brief Account a measured latency. An increase is followed at once, it decays slowly.
+   * \return true if the latency changed
+   */
+  bool Update(std::chrono::milliseconds latency);
+
+  std::chrono::milliseconds Get() const { return std::chrono::milliseconds(m_latencyMS.load()); }
+
+  /*!
+   * \brief Length of the decode buffer, 2 to 8 seconds
+   */
+  std::chrono::milliseconds GetDecodeBufferTime() const;
+
+  /*!
+   * \brief How long before the end of a song the next one is opened, at most 30 seconds
+   * \param minTime the time for a source without latency
+   */
+  std::chrono::milliseconds GetCacheNextFileTime(std::chrono::milliseconds minTime) const;
+
+private:
+  std::atomic_uint m_latencyMS{0};
+};
@@ -0,0 +1,148 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TrackWaveform.h"
+
+#include "ServiceBroker.h"
+#include "TrackWaveformCache.h"
+#include "cores/AudioEngine/Utils/AEKernels.h"
+#include "filesystem/File.h"
+#include "music/MusicFileDecoder.h"
+#include "utils/JobManager.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+
+// frames of one decoded peak, before these are combined into the points
+constexpr unsigned int BLOCK_FRAMES = 1024;
+
+} // namespace
+
+std::shared_ptr<CTrackWaveform> CTrackWaveform::Request(const std::string& path,
+                                                        int64_t startOffset,
+                                                        int64_t endOffset)
+{
+  auto waveform = std::make_shared<CTrackWaveform>();
+  std::weak_ptr<CTrackWaveform> weak = waveform;
+  CServiceBroker::GetJobManager()->Submit([weak, path, startOffset, endOffset]()
+                                          { Create(weak, path, startOffset, endOffset); },
+                                          CJob::PRIORITY_LOW_PAUSABLE);
+  return waveform;
+}
+
+bool CTrackWaveform::Get(std::vector<float>& peaks) const
+{
+  std::unique_lock lock(m_section);
+  if (m_peaks.empty())
+    return false;
+
+  peaks = m_peaks;
+  return true;
+}
+
+void CTrackWaveform::Set(std::vector<float> peaks)
+{
+  std::unique_lock lock(m_section);
+  m_peaks = std::move(peaks);
+}
+
+void CTrackWaveform::Create(std::weak_ptr<CTrackWaveform> waveform,
+                            const std::string& path,
+                            int64_t startOffset,
+                            int64_t endOffset)
+{
+  if (waveform.expired())
+    return;
+
+  // a changed file invalidates its waveform
+  struct __stat64 st = {};
+  if (XFILE::CFile::Stat(path, &st) != 0)
+    return;
+
+  CTrackWaveformCache cache;
+  const std::string key = StringUtils::Format("{}|{}|{}", path, startOffset, endOffset);
+
+  std::vector<float> peaks;
+  if (!cache.Load(key, st.st_size, st.st_mtime, peaks))
+  {
+    if (!Decode(waveform, path, startOffset, endOffset, peaks))
+      return;
+    cache.Save(key, st.st_size, st.st_mtime, peaks);
+  }
+
+  if (auto owner = waveform.lock())
+    owner->Set(std::move(peaks));
+}
+
+bool CTrackWaveform::Decode(const std::weak_ptr<CTrackWaveform>& waveform,
+                            const std::string& path,
+                            int64_t startOffset,
+                            int64_t endOffset,
+                            std::vector<float>& peaks)
+{
+  CMusicFileDecoder decoder;
+  if (!decoder.Open(path, static_cast<int>(startOffset), static_cast<int>(endOffset)))
+    return false;
+
+  const CAEKernels& kernels = CAEKernels::Get();
+  const unsigned int channels = decoder.GetChannels();
+  std::vector<float> blocks;
+  unsigned int blockFrames = 0;
+  float blockPeak = 0.0f;
+
+  const float* samples;
+  int frames = 0;
+  while ((frames = decoder.Read(samples)) > 0)
+  {
+    // nobody is going to draw it
+    if (waveform.expired())
+      return false;
+
+    unsigned int left = static_cast<unsigned int>(frames);
+    while (left > 0)
+    {
+      const unsigned int chunk = std::min(left, BLOCK_FRAMES - blockFrames);
+      blockPeak = std::max(blockPeak, kernels.PeakArray(samples, chunk * channels));
+      samples += static_cast<size_t>(chunk) * channels;
+      left -= chunk;
+      blockFrames += chunk;
+      if (blockFrames == BLOCK_FRAMES)
+      {
+        blocks.push_back(blockPeak);
+        blockFrames = 0;
+        blockPeak = 0.0f;
+      }
+    }
+  }
+
+  if (frames < 0)
+  {
+    CLog::Log(LOGDEBUG, "CTrackWaveform::{} - error decoding {}", __func__, path);
+    return false;
+  }
+  if (blockFrames > 0)
+    blocks.push_back(blockPeak);
+  if (blocks.empty())
+    return false;
+
+  // every point is the loudest of the blocks it covers
+  const size_t points = std::min<size_t>(POINTS, blocks.size());
+  peaks.resize(points);
+  for (size_t i = 0; i < points; ++i)
+  {
+    const size_t first = i * blocks.size() / points;
+    const size_t last = (i + 1) * blocks.size() / points;
+    peaks[i] = std::min(*std::max_element(blocks.begin() + first, blocks.begin() + last), 1.0f);
+  }
+  return true;
+}
@@ -0,0 +1,62 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Peaks of a whole song, as a seek bar draws them.
+ *
+ * The song is decoded once in a low priority job and its peaks are kept in
+ * a CTrackWaveformCache, so the next time it is played they are just read back.
+ * The job gives up as soon as nobody holds the waveform any more.
+ */
+class CTrackWaveform
+{
+public:
+  //! points of a complete waveform, shorter songs may have fewer
+  static constexpr unsigned int POINTS = 1000;
+
+  /*!
+   * \brief Load or compute the waveform of a song in the background
+   * \param path full path of the file
+   * \param startOffset start of the song in the file in ms, 0 if it is the whole file
+   * \param endOffset end of the song in the file in ms, 0 if it is the whole file
+   */
+  static std::shared_ptr<CTrackWaveform> Request(const std::string& path,
+                                                 int64_t startOffset,
+                                                 int64_t endOffset);
+
+  /*!
+   * \brief Copy the peaks, 1.0 is full scale
+   * \return false if they are not known yet
+   */
+  bool Get(std::vector<float>& peaks) const;
+
+private:
+  void Set(std::vector<float> peaks);
+
+  static void Create(std::weak_ptr<CTrackWaveform> waveform,
+                     const std::string& path,
+                     int64_t startOffset,
+                     int64_t endOffset);
+  static bool Decode(const std::weak_ptr<CTrackWaveform>& waveform,
+                     const std::string& path,
+                     int64_t startOffset,
+                     int64_t endOffset,
+                     std::vector<float>& peaks);
+
+  mutable CCriticalSection m_section;
+  std::vector<float> m_peaks;
+};
@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TrackWaveformCache.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+
+constexpr char MAGIC[4] = {'K', 'W', 'F', '1'};
+constexpr auto CACHE_EXTENSION = ".peaks";
+
+struct CacheHeader
+{
+  char magic[4];
+  uint32_t points;
+  int64_t size;
+  int64_t mtime;
+};
+
+} // namespace
+
+CTrackWaveformCache::CTrackWaveformCache(std::string path, size_t maxFiles)
+  : m_path(std::move(path)),
+    m_maxFiles(maxFiles)
+{
+}
+
+bool CTrackWaveformCache::Load(const std::string& key,
+                               int64_t size,
+                               int64_t mtime,
+                               std::vector<float>& peaks) const
+{
+  const std::string cacheFile = GetCacheFile(key);
+  std::vector<uint8_t> data;
+  XFILE::CFile file;
+  if (!XFILE::CFile::Exists(cacheFile, false) || file.LoadFile(cacheFile, data) <= 0 ||
+      data.size() < sizeof(CacheHeader))
+    return false;
+
+  CacheHeader header;
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.size != size ||
+      header.mtime != mtime || header.points == 0 ||
+      data.size() != sizeof(header) + header.points)
+    return false;
+
+  peaks.resize(header.points);
+  for (uint32_t i = 0; i < header.points; ++i)
+    peaks[i] = data[sizeof(header) + i] / 255.0f;
+  return true;
+}
+
+void CTrackWaveformCache::Save(const std::string& key,
+                               int64_t size,
+                               int64_t mtime,
+                               const std::vector<float>& peaks)
+{
+  if (!XFILE::CDirectory::Exists(m_path) && !XFILE::CDirectory::Create(m_path))
+    return;
+
+  CacheHeader header = {};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.points = static_cast<uint32_t>(peaks.size());
+  header.size = size;
+  header.mtime = mtime;
+
+  // a byte per point is finer than any seek bar
+  std::vector<uint8_t> data(sizeof(header) + peaks.size());
+  std::memcpy(data.data(), &header, sizeof(header));
+  for (size_t i = 0; i < peaks.size(); ++i)
+    data[sizeof(header) + i] = static_cast<uint8_t>(std::lround(peaks[i] * 255.0f));
+
+  const std::string cacheFile = GetCacheFile(key);
+  XFILE::CFile file;
+  if (!file.OpenForWrite(cacheFile, true) ||
+      file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+  {
+    CLog::Log(LOGWARNING, "CTrackWaveformCache::{} - unable to write {}", __func__, cacheFile);
+    return;
+  }
+  file.Close();
+
+  Evict(cacheFile);
+}
+
+std::string CTrackWaveformCache::GetCacheFile(const std::string& key) const
+{
+  return URIUtils::AddFileToFolder(
+      m_path, StringUtils::Format("{:08x}{}", Crc32::Compute(key), CACHE_EXTENSION));
+}
+
+void CTrackWaveformCache::Evict(const std::string& keep)
+{
+  CFileItemList items;
+  if (!XFILE::CDirectory::GetDirectory(m_path, items, CACHE_EXTENSION,
+                                       XFILE::DIR_FLAG_NO_FILE_DIRS) ||
+      static_cast<size_t>(items.Size()) <= m_maxFiles)
+    return;
+
+  // the file just written is kept, whatever its time stamp says
+  const std::string keepName = URIUtils::GetFileName(keep);
+  std::vector<std::shared_ptr<CFileItem>> files;
+  for (const auto& item : items)
+  {
+    if (!item->IsFolder() && URIUtils::GetFileName(item->GetPath()) != keepName)
+      files.emplace_back(item);
+  }
+
+  const size_t remove = std::min(files.size(), static_cast<size_t>(items.Size()) - m_maxFiles);
+  std::partial_sort(files.begin(), files.begin() + remove, files.end(),
+                    [](const std::shared_ptr<CFileItem>& a, const std::shared_ptr<CFileItem>& b)
+                    { return a->GetDateTime() < b->GetDateTime(); });
+  for (size_t i = 0; i < remove; ++i)
+    XFILE::CFile::Delete(files[i]->GetPath());
+
+  CLog::Log(LOGDEBUG, "CTrackWaveformCache::{} - removed {} waveforms", __func__, remove);
+}
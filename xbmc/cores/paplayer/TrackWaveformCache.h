@@ -0,0 +1,52 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Song waveforms kept on disk, a small file per song.
+ *
+ * A waveform is stored along with size and modification time of the song file, a changed
+ * file invalidates it. The cache is limited to a number of files, the oldest ones are
+ * removed when a new waveform is stored.
+ */
+class CTrackWaveformCache
+{
+public:
+  static constexpr auto CACHE_PATH = "special://temp/waveforms/";
+  //! a waveform is about 1 KiB on disk
+  static constexpr size_t MAX_FILES = 2000;
+
+  explicit CTrackWaveformCache(std::string path = CACHE_PATH, size_t maxFiles = MAX_FILES);
+
+  /*!
+   * \brief Read the waveform of a song
+   * \param key identifies the song, e.g. path and offsets within the file
+   * \param size size of the song file
+   * \param mtime modification time of the song file
+   * \return false if there is none or the song file changed since it was stored
+   */
+  bool Load(const std::string& key, int64_t size, int64_t mtime, std::vector<float>& peaks) const;
+
+  /*!
+   * \brief Store the waveform of a song, removing the oldest ones above the limit
+   */
+  void Save(const std::string& key, int64_t size, int64_t mtime, const std::vector<float>& peaks);
+
+private:
+  std::string GetCacheFile(const std::string& key) const;
+  void Evict(const std::string& keep);
+
+  const std::string m_path;
+  const size_t m_maxFiles;
+};
@@ -0,0 +1,245 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "cores/paplayer/AudioDecoder.h"
+#include "cores/paplayer/ICodec.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr int SAMPLE_RATE = 48000;
+constexpr int CHANNELS = 2;
+constexpr int64_t SAMPLES_PER_SECOND = SAMPLE_RATE * CHANNELS;
+
+// float samples counting up from the position, so the order of the data can be checked
+class CFakeCodec : public ICodec
+{
+public:
+  CFakeCodec(int64_t totalSamples, std::chrono::milliseconds readDelay, int64_t errorAt)
+    : m_totalSamples(totalSamples), m_readDelay(readDelay), m_errorAt(errorAt)
+  {
+  }
+
+  bool Init(const CFileItem& file, unsigned int filecache) override
+  {
+    m_format.m_dataFormat = AE_FMT_FLOAT;
+    m_format.m_sampleRate = SAMPLE_RATE;
+    m_format.m_channelLayout = AE_CH_LAYOUT_2_0;
+    m_bitsPerSample = 32;
+    m_TotalTime = m_totalSamples * 1000 / SAMPLES_PER_SECOND;
+    return true;
+  }
+
+  bool Seek(int64_t iSeekTime) override
+  {
+    m_position = iSeekTime * SAMPLES_PER_SECOND / 1000;
+    return true;
+  }
+
+  int ReadPCM(uint8_t* pBuffer, size_t size, size_t* actualsize) override
+  {
+    if (m_readDelay > 0ms)
+      std::this_thread::sleep_for(m_readDelay);
+
+    const int64_t position = m_position;
+    if (m_errorAt >= 0 && position >= m_errorAt)
+      return READ_ERROR;
+
+    const int64_t count =
+        std::min<int64_t>(size / sizeof(float), m_totalSamples - position);
+    float* samples = reinterpret_cast<float*>(pBuffer);
+    for (int64_t i = 0; i < count; ++i)
+      samples[i] = static_cast<float>(position + i);
+
+    m_position = position + count;
+    *actualsize = count * sizeof(float);
+    return m_position >= m_totalSamples ? READ_EOF : READ_SUCCESS;
+  }
+
+  bool CanInit() override { return true; }
+
+  std::atomic<int64_t> m_position{0};
+
+private:
+  const int64_t m_totalSamples;
+  const std::chrono::milliseconds m_readDelay;
+  const int64_t m_errorAt;
+};
+
+class CTestAudioDecoder : public CAudioDecoder
+{
+public:
+  explicit CTestAudioDecoder(int64_t totalSamples,
+                             std::chrono::milliseconds readDelay = 0ms,
+                             int64_t errorAt = -1)
+    : m_totalSamples(totalSamples), m_readDelay(readDelay), m_errorAt(errorAt)
+  {
+  }
+  ~CTestAudioDecoder() override { Destroy(); }
+
+  bool Create(std::chrono::milliseconds bufferTime = 2000ms)
+  {
+    return CAudioDecoder::Create(CFileItem("/music/test.wav", false), 0, bufferTime);
+  }
+
+  // valid between Create() and Destroy()
+  CFakeCodec* m_fakeCodec = nullptr;
+
+protected:
+  ICodec* CreateCodec(const CFileItem& file, unsigned int filecache) override
+  {
+    m_fakeCodec = new CFakeCodec(m_totalSamples, m_readDelay, m_errorAt);
+    return m_fakeCodec;
+  }
+
+private:
+  const int64_t m_totalSamples;
+  const std::chrono::milliseconds m_readDelay;
+  const int64_t m_errorAt;
+};
+
+bool WaitFor(const std::function<bool()>& condition, std::chrono::milliseconds timeout = 5000ms)
+{
+  const auto end = std::chrono::steady_clock::now() + timeout;
+  while (!condition())
+  {
+    if (std::chrono::steady_clock::now() > end)
+      return false;
+    std::this_thread::sleep_for(1ms);
+  }
+  return true;
+}
+
+// position of the codec once the decode thread stopped reading
+int64_t WaitForFullBuffer(const CFakeCodec& codec)
+{
+  int64_t position = -1;
+  WaitFor([&] {
+    const int64_t current = codec.m_position;
+    if (current == position)
+      return true;
+    position = current;
+    std::this_thread::sleep_for(100ms);
+    return false;
+  });
+  return position;
+}
+} // namespace
+
+TEST(TestAudioDecoder, DecodeThreadFillsBuffer)
+{
+  constexpr int64_t total = 5 * SAMPLES_PER_SECOND;
+  CTestAudioDecoder decoder(total);
+  ASSERT_TRUE(decoder.Create());
+  decoder.Start();
+  decoder.StartDecodeThread();
+
+  ASSERT_TRUE(WaitFor([&] { return decoder.GetStatus() != STATUS_QUEUING; }));
+  // the player doesn't decode while the thread is running
+  EXPECT_EQ(decoder.ReadSamples(PACKET_SIZE), RET_SLEEP);
+
+  // consume everything, the thread refills the buffer as space becomes free
+  int64_t expected = 0;
+  ASSERT_TRUE(WaitFor([&] {
+    const unsigned int samples = decoder.GetDataSize(false);
+    if (samples == 0)
+      return decoder.GetStatus() == STATUS_ENDED;
+
+    const float* data = static_cast<const float*>(decoder.GetData(samples));
+    if (!data)
+      return true;
+    for (unsigned int i = 0; i < samples; ++i, ++expected)
+    {
+      if (data[i] != static_cast<float>(expected))
+        return true;
+    }
+    return false;
+  }));
+  EXPECT_EQ(expected, total);
+  EXPECT_EQ(decoder.GetStatus(), STATUS_ENDED);
+}
+
+TEST(TestAudioDecoder, DecodesAheadByBufferTime)
+{
+  CTestAudioDecoder decoder(60 * SAMPLES_PER_SECOND);
+  ASSERT_TRUE(decoder.Create());
+  decoder.StartDecodeThread();
+  EXPECT_NEAR(WaitForFullBuffer(*decoder.m_fakeCodec), 2 * SAMPLES_PER_SECOND, INPUT_SAMPLES);
+
+  // a slow source decodes further ahead
+  ASSERT_TRUE(decoder.Create(8000ms));
+  decoder.StartDecodeThread();
+  EXPECT_NEAR(WaitForFullBuffer(*decoder.m_fakeCodec), 8 * SAMPLES_PER_SECOND, INPUT_SAMPLES);
+
+  // queued after 1.8s of data, so a larger buffer doesn't delay the start
+  EXPECT_NE(decoder.GetStatus(), STATUS_QUEUING);
+}
+
+TEST(TestAudioDecoder, SlowSourceDoesNotBlockPlayer)
+{
+  CTestAudioDecoder decoder(10 * SAMPLES_PER_SECOND, 50ms);
+  ASSERT_TRUE(decoder.Create());
+  decoder.Start();
+  decoder.StartDecodeThread();
+
+  // reads block the decode thread only
+  for (int i = 0; i < 10; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(decoder.ReadSamples(PACKET_SIZE), RET_SLEEP);
+    decoder.GetDataSize(false);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 40ms);
+    std::this_thread::sleep_for(10ms);
+  }
+
+  EXPECT_GE(decoder.GetMaxReadTime(), 50ms);
+}
+
+TEST(TestAudioDecoder, DecodeErrorIsReported)
+{
+  CTestAudioDecoder decoder(10 * SAMPLES_PER_SECOND, 0ms, SAMPLES_PER_SECOND / 2);
+  ASSERT_TRUE(decoder.Create());
+  decoder.StartDecodeThread();
+
+  EXPECT_TRUE(WaitFor([&] { return decoder.ReadSamples(PACKET_SIZE) == RET_ERROR; }));
+}
+
+TEST(TestAudioDecoder, SeekDiscardsDecodedData)
+{
+  CTestAudioDecoder decoder(10 * SAMPLES_PER_SECOND);
+  ASSERT_TRUE(decoder.Create());
+  decoder.Start();
+  decoder.StartDecodeThread();
+  ASSERT_TRUE(WaitFor([&] { return decoder.GetStatus() != STATUS_QUEUING; }));
+
+  decoder.Seek(5000);
+  ASSERT_TRUE(WaitFor([&] { return decoder.GetDataSize(false) > 0; }));
+  const float* data = static_cast<const float*>(decoder.GetData(CHANNELS));
+  ASSERT_NE(data, nullptr);
+  EXPECT_EQ(data[0], static_cast<float>(5 * SAMPLES_PER_SECOND));
+}
+
+TEST(TestAudioDecoder, ReadSamplesWithoutThread)
+{
+  CTestAudioDecoder decoder(SAMPLES_PER_SECOND);
+  ASSERT_TRUE(decoder.Create());
+
+  // without a decode thread the player decodes
+  EXPECT_EQ(decoder.ReadSamples(PACKET_SIZE), RET_SUCCESS);
+  EXPECT_EQ(decoder.m_fakeCodec->m_position, PACKET_SIZE);
+}
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/paplayer/SourceLatency.h"
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(TestSourceLatency, LocalSource)
+{
+  CSourceLatency latency;
+  EXPECT_EQ(latency.Get(), 0ms);
+  EXPECT_EQ(latency.GetDecodeBufferTime(), 2000ms);
+  EXPECT_EQ(latency.GetCacheNextFileTime(5000ms), 5000ms);
+
+  EXPECT_FALSE(latency.Update(0ms));
+  EXPECT_EQ(latency.Get(), 0ms);
+}
+
+TEST(TestSourceLatency, FollowsIncreaseAtOnce)
+{
+  CSourceLatency latency;
+  EXPECT_TRUE(latency.Update(800ms));
+  EXPECT_EQ(latency.Get(), 800ms);
+  EXPECT_EQ(latency.GetDecodeBufferTime(), 3600ms);
+  EXPECT_EQ(latency.GetCacheNextFileTime(5000ms), 6600ms);
+
+  EXPECT_TRUE(latency.Update(1000ms));
+  EXPECT_EQ(latency.Get(), 1000ms);
+}
+
+TEST(TestSourceLatency, DecaysSlowly)
+{
+  CSourceLatency latency;
+  latency.Update(800ms);
+
+  EXPECT_TRUE(latency.Update(0ms));
+  EXPECT_EQ(latency.Get(), 600ms);
+  EXPECT_TRUE(latency.Update(0ms));
+  EXPECT_EQ(latency.Get(), 450ms);
+
+  // a fast song on a slow source doesn't reset the latency
+  EXPECT_TRUE(latency.Update(400ms));
+  EXPECT_EQ(latency.Get(), 437ms);
+
+  for (int i = 0; i < 50; ++i)
+    latency.Update(0ms);
+  EXPECT_EQ(latency.Get(), 0ms);
+}
+
+TEST(TestSourceLatency, Limits)
+{
+  CSourceLatency latency;
+  latency.Update(60000ms);
+  EXPECT_EQ(latency.GetDecodeBufferTime(), 8000ms);
+  EXPECT_EQ(latency.GetCacheNextFileTime(5000ms), 30000ms);
+  // a longer minimum isn't cut
+  EXPECT_EQ(latency.GetCacheNextFileTime(40000ms), 40000ms);
+
+  latency.Update(-10ms);
+  EXPECT_LT(latency.Get(), 60000ms);
+}
@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItemList.h"
+#include "cores/paplayer/TrackWaveformCache.h"
+#include "filesystem/Directory.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/URIUtils.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+class TestTrackWaveformCache : public testing::Test
+{
+protected:
+  TestTrackWaveformCache()
+    : m_path(URIUtils::AddFileToFolder(CSpecialProtocol::TranslatePath("special://temp/"),
+                                       "TestTrackWaveformCache/"))
+  {
+  }
+
+  ~TestTrackWaveformCache() override { XFILE::CDirectory::RemoveRecursive(m_path); }
+
+  int CountFiles() const
+  {
+    CFileItemList items;
+    if (!XFILE::CDirectory::GetDirectory(m_path, items, "", XFILE::DIR_FLAG_DEFAULTS))
+      return 0;
+    return items.Size();
+  }
+
+  const std::string m_path;
+  const std::vector<float> m_peaks{0.0f, 0.5f, 1.0f, 0.25f};
+};
+
+TEST_F(TestTrackWaveformCache, WritesAndReads)
+{
+  CTrackWaveformCache cache(m_path);
+  std::vector<float> peaks;
+  EXPECT_FALSE(cache.Load("song.flac|0|0", 1234, 5678, peaks));
+
+  cache.Save("song.flac|0|0", 1234, 5678, m_peaks);
+  EXPECT_EQ(CountFiles(), 1);
+
+  ASSERT_TRUE(CTrackWaveformCache(m_path).Load("song.flac|0|0", 1234, 5678, peaks));
+  ASSERT_EQ(peaks.size(), m_peaks.size());
+  for (size_t i = 0; i < peaks.size(); ++i)
+    EXPECT_NEAR(peaks[i], m_peaks[i], 1.0f / 255);
+
+  // another song of the same file
+  EXPECT_FALSE(cache.Load("song.flac|0|60000", 1234, 5678, peaks));
+}
+
+TEST_F(TestTrackWaveformCache, InvalidatedByChangedFile)
+{
+  CTrackWaveformCache cache(m_path);
+  cache.Save("song.flac|0|0", 1234, 5678, m_peaks);
+
+  std::vector<float> peaks;
+  EXPECT_FALSE(cache.Load("song.flac|0|0", 1235, 5678, peaks));
+  EXPECT_FALSE(cache.Load("song.flac|0|0", 1234, 5679, peaks));
+
+  // the new waveform replaces the old one
+  cache.Save("song.flac|0|0", 1235, 5679, m_peaks);
+  EXPECT_EQ(CountFiles(), 1);
+  EXPECT_TRUE(cache.Load("song.flac|0|0", 1235, 5679, peaks));
+  EXPECT_FALSE(cache.Load("song.flac|0|0", 1234, 5678, peaks));
+}
+
+TEST_F(TestTrackWaveformCache, LimitsFiles)
+{
+  CTrackWaveformCache cache(m_path, 2);
+  std::vector<float> peaks;
+  for (int i = 0; i < 5; ++i)
+  {
+    const std::string key = "song" + std::to_string(i) + ".flac|0|0";
+    cache.Save(key, 1234, 5678, m_peaks);
+    EXPECT_LE(CountFiles(), 2);
+    // the file just written is never the one removed
+    EXPECT_TRUE(cache.Load(key, 1234, 5678, peaks));
+  }
+  EXPECT_EQ(CountFiles(), 2);
+}
@@ -10,8 +10,25 @@
 
 #include "windowing/GraphicContext.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <stdio.h>
 
+namespace
+{
+// the tiles are made larger if the regions span more tiles than this, or are split into more
+// rectangles, which bounds the cost of merging them
+constexpr size_t MAX_TILES = 4096;
+constexpr size_t MAX_RECTANGLES = 64;
+
+bool IsValid(const CRect& rect)
+{
+  return rect.x2 > rect.x1 && rect.y2 > rect.y1 && std::isfinite(rect.x1) &&
+         std::isfinite(rect.y1) && std::isfinite(rect.x2) && std::isfinite(rect.y2);
+}
+} // unnamed namespace
+
 void CUnionDirtyRegionSolver::Solve(const CDirtyRegionList &input, CDirtyRegionList &output)
 {
   CDirtyRegion unifiedRegion;
@@ -71,3 +88,172 @@ void CGreedyDirtyRegionSolver::Solve(const CDirtyRegionList &input, CDirtyRegion
       output.push_back(currentRegion);
   }
 }
+
+CTiledDirtyRegionSolver::CTiledDirtyRegionSolver(float tileSize,
+                                                 float costPerPass,
+                                                 size_t maxRegions)
+  : m_tileSize(std::max(tileSize, 1.0f)),
+    m_costPerPass(costPerPass),
+    m_maxRegions(std::max<size_t>(maxRegions, 1))
+{
+}
+
+void CTiledDirtyRegionSolver::Solve(const CDirtyRegionList &input, CDirtyRegionList &output)
+{
+  CRect bounds;
+  for (const CDirtyRegion& region : input)
+  {
+    if (IsValid(region))
+      bounds.Union(region);
+  }
+  if (!IsValid(bounds))
+    return;
+
+  Grid grid;
+  grid.tileSize = m_tileSize;
+  while (true)
+  {
+    // the tiles are aligned to multiples of their size, so they stay the same between frames
+    grid.x = std::floor(bounds.x1 / grid.tileSize) * grid.tileSize;
+    grid.y = std::floor(bounds.y1 / grid.tileSize) * grid.tileSize;
+    const float columns = std::ceil((bounds.x2 - grid.x) / grid.tileSize);
+    const float rows = std::ceil((bounds.y2 - grid.y) / grid.tileSize);
+    if (columns * rows <= MAX_TILES)
+    {
+      grid.columns = static_cast<int>(columns);
+      grid.rows = static_cast<int>(rows);
+      MarkTiles(input, grid);
+      FindRectangles(grid);
+      if (m_rects.size() <= MAX_RECTANGLES)
+        break;
+    }
+    grid.tileSize *= 2;
+  }
+
+  MergeRectangles();
+
+  for (const CRect& rect : m_rects)
+  {
+    CRect covered;
+    for (const CDirtyRegion& region : input)
+    {
+      if (IsValid(region) && rect.Intersects(region))
+      {
+        CRect part(region);
+        covered.Union(part.Intersect(rect));
+      }
+    }
+    if (IsValid(covered))
+      output.emplace_back(covered);
+  }
+}
+
+void CTiledDirtyRegionSolver::MarkTiles(const CDirtyRegionList &input, const Grid &grid)
+{
+  m_tiles.assign(static_cast<size_t>(grid.columns) * grid.rows, false);
+  for (const CDirtyRegion& region : input)
+  {
+    if (!IsValid(region))
+      continue;
+
+    const int left = static_cast<int>(std::floor((region.x1 - grid.x) / grid.tileSize));
+    const int top = static_cast<int>(std::floor((region.y1 - grid.y) / grid.tileSize));
+    const int right =
+        std::min(static_cast<int>(std::ceil((region.x2 - grid.x) / grid.tileSize)), grid.columns);
+    const int bottom =
+        std::min(static_cast<int>(std::ceil((region.y2 - grid.y) / grid.tileSize)), grid.rows);
+    for (int row = std::max(top, 0); row < bottom; ++row)
+    {
+      for (int column = std::max(left, 0); column < right; ++column)
+        m_tiles[row * grid.columns + column] = true;
+    }
+  }
+}
+
+void CTiledDirtyRegionSolver::FindRectangles(const Grid &grid)
+{
+  m_rects.clear();
+  m_runs.clear();
+
+  auto close = [this, &grid](const Run& run, int row) {
+    m_rects.emplace_back(grid.x + run.first * grid.tileSize, grid.y + run.top * grid.tileSize,
+                         grid.x + run.last * grid.tileSize, grid.y + row * grid.tileSize);
+  };
+
+  // the runs of dirty tiles of a row continue the rectangles of the row above if they have the
+  // same columns, the runs are in the order of their columns
+  for (int row = 0; row <= grid.rows; ++row)
+  {
+    m_nextRuns.clear();
+    size_t run = 0;
+    for (int column = 0; row < grid.rows && column < grid.columns;)
+    {
+      if (!m_tiles[row * grid.columns + column])
+      {
+        ++column;
+        continue;
+      }
+
+      const int first = column;
+      while (column < grid.columns && m_tiles[row * grid.columns + column])
+        ++column;
+
+      while (run < m_runs.size() && m_runs[run].first < first)
+        close(m_runs[run++], row);
+      if (run < m_runs.size() && m_runs[run].first == first && m_runs[run].last == column)
+        m_nextRuns.emplace_back(m_runs[run++]);
+      else
+        m_nextRuns.push_back({first, column, row});
+    }
+    for (; run < m_runs.size(); ++run)
+      close(m_runs[run], row);
+    m_runs.swap(m_nextRuns);
+  }
+}
+
+void CTiledDirtyRegionSolver::MergeRectangles()
+{
+  while (m_rects.size() > 1)
+  {
+    // the pair that adds the fewest pixels when rendered as one
+    size_t first = 0;
+    size_t second = 0;
+    float cost = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < m_rects.size(); ++i)
+    {
+      for (size_t j = i + 1; j < m_rects.size(); ++j)
+      {
+        CRect merged(m_rects[i]);
+        merged.Union(m_rects[j]);
+        const float mergedCost = merged.Area() - m_rects[i].Area() - m_rects[j].Area();
+        if (mergedCost < cost)
+        {
+          first = i;
+          second = j;
+          cost = mergedCost;
+        }
+      }
+    }
+
+    if (cost >= m_costPerPass && m_rects.size() <= m_maxRegions)
+      break;
+
+    m_rects[first].Union(m_rects[second]);
+    m_rects.erase(m_rects.begin() + second);
+
+    // the merged rectangle takes over the ones it now overlaps, they would be rendered twice
+    for (size_t i = 0; i < m_rects.size();)
+    {
+      if (i == first || !m_rects[first].Intersects(m_rects[i]))
+      {
+        ++i;
+        continue;
+      }
+      m_rects[first].Union(m_rects[i]);
+      m_rects.erase(m_rects.begin() + i);
+      if (i < first)
+        --first;
+      i = 0;
+    }
+  }
+}
@@ -10,6 +10,9 @@
 
 #include "IDirtyRegionSolver.h"
 
+#include <stddef.h>
+#include <vector>
+
 class CUnionDirtyRegionSolver : public IDirtyRegionSolver
 {
 public:
@@ -37,3 +40,51 @@ private:
   float m_costNewRegion;
   float m_costPerArea;
 };
+
+/*!
+ \brief Collects the dirty regions on a grid of tiles and merges the rectangles of dirty tiles as
+ long as an extra render pass costs more than redrawing the pixels between them
+
+ The grid only decides which regions are rendered together, the resulting regions are shrunk to
+ the dirty regions they contain. The cost of a render pass is given as the number of pixels that
+ could be redrawn instead.
+ */
+class CTiledDirtyRegionSolver : public IDirtyRegionSolver
+{
+public:
+  explicit CTiledDirtyRegionSolver(float tileSize = 32.0f,
+                                   float costPerPass = 32768.0f,
+                                   size_t maxRegions = 8);
+  void Solve(const CDirtyRegionList &input, CDirtyRegionList &output) override;
+
+private:
+  struct Grid
+  {
+    float x;
+    float y;
+    float tileSize;
+    int columns;
+    int rows;
+  };
+
+  // a rectangle of dirty tiles growing downwards, from column first up to column last
+  struct Run
+  {
+    int first;
+    int last;
+    int top;
+  };
+
+  void MarkTiles(const CDirtyRegionList &input, const Grid &grid);
+  void FindRectangles(const Grid &grid);
+  void MergeRectangles();
+
+  float m_tileSize;
+  float m_costPerPass;
+  size_t m_maxRegions;
+
+  std::vector<bool> m_tiles;
+  std::vector<Run> m_runs;
+  std::vector<Run> m_nextRuns;
+  std::vector<CRect> m_rects;
+};
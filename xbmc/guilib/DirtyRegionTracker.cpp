@@ -16,7 +16,9 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <limits>
 #include <stdio.h>
+#include <utility>
 
 CDirtyRegionTracker::CDirtyRegionTracker()
 {
@@ -42,6 +44,10 @@ void CDirtyRegionTracker::SelectAlgorithm()
       CLog::Log(LOGDEBUG, "guilib: Cost reduction as algorithm for solving rendering passes");
       m_solver = new CGreedyDirtyRegionSolver();
       break;
+    case DIRTYREGION_SOLVER_TILED:
+      CLog::Log(LOGDEBUG, "guilib: Tiled cost reduction as algorithm for solving rendering passes");
+      m_solver = new CTiledDirtyRegionSolver();
+      break;
     case DIRTYREGION_SOLVER_UNION:
       m_solver = new CUnionDirtyRegionSolver();
       CLog::Log(LOGDEBUG, "guilib: Union as algorithm for solving rendering passes");
@@ -82,3 +88,71 @@ void CDirtyRegionTracker::CleanMarkedRegions(int bufferAge)
                                        { return r.UpdateAge() > bufferAge; }),
                         m_markedRegions.end());
 }
+
+void CDirtyRegionTracker::UpdateStats(const CDirtyRegionList &renderedRegions)
+{
+  m_stats.passes = 0;
+  m_stats.redrawnArea = 0.0f;
+  for (const CDirtyRegion& region : renderedRegions)
+  {
+    if (region.IsEmpty())
+      continue;
+    m_stats.passes++;
+    m_stats.redrawnArea += region.Area();
+  }
+  // measuring the covered area is too slow for every frame
+  m_statsRegions.assign(m_markedRegions.begin(), m_markedRegions.end());
+  m_dirtyAreaValid = false;
+}
+
+DirtyRegionStats CDirtyRegionTracker::GetStats() const
+{
+  if (!m_dirtyAreaValid)
+  {
+    m_stats.dirtyArea = GetCoveredArea(m_statsRegions);
+    m_dirtyAreaValid = true;
+  }
+  return m_stats;
+}
+
+float CDirtyRegionTracker::GetCoveredArea(const CDirtyRegionList &regions)
+{
+  // sum the covered height of each vertical strip between the left and right edges
+  std::vector<float> edges;
+  edges.reserve(regions.size() * 2);
+  for (const CDirtyRegion& region : regions)
+  {
+    if (region.x2 > region.x1 && region.y2 > region.y1)
+    {
+      edges.emplace_back(region.x1);
+      edges.emplace_back(region.x2);
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+  double area = 0.0;
+  std::vector<std::pair<float, float>> spans;
+  for (size_t i = 1; i < edges.size(); ++i)
+  {
+    spans.clear();
+    for (const CDirtyRegion& region : regions)
+    {
+      if (region.x1 <= edges[i - 1] && region.x2 >= edges[i] && region.y2 > region.y1)
+        spans.emplace_back(region.y1, region.y2);
+    }
+    std::sort(spans.begin(), spans.end());
+
+    double height = 0.0;
+    float bottom = std::numeric_limits<float>::lowest();
+    for (const auto& [top, spanBottom] : spans)
+    {
+      if (spanBottom <= bottom)
+        continue;
+      height += spanBottom - std::max(top, bottom);
+      bottom = spanBottom;
+    }
+    area += height * (edges[i] - edges[i - 1]);
+  }
+  return static_cast<float>(area);
+}
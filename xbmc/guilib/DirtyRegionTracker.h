@@ -10,6 +10,13 @@
 
 #include "IDirtyRegionSolver.h"
 
+struct DirtyRegionStats
+{
+  unsigned int passes = 0; ///< number of times the GUI was rendered
+  float dirtyArea = 0.0f; ///< pixels marked dirty, including those kept for the buffer age
+  float redrawnArea = 0.0f; ///< pixels rendered, counted once per pass
+};
+
 class CDirtyRegionTracker
 {
 public:
@@ -22,7 +29,25 @@ public:
   CDirtyRegionList GetDirtyRegions();
   void CleanMarkedRegions(int bufferAge);
 
+  /*!
+   \brief Update the statistics of the frame with the regions that were actually rendered
+   */
+  void UpdateStats(const CDirtyRegionList &renderedRegions);
+
+  /*!
+   \brief Get the statistics of the last frame, the dirty area is only measured when asked for
+   */
+  DirtyRegionStats GetStats() const;
+
+  /*!
+   \brief The number of pixels covered by the regions, overlapping parts are counted once
+   */
+  static float GetCoveredArea(const CDirtyRegionList &regions);
+
 private:
   CDirtyRegionList m_markedRegions;
   IDirtyRegionSolver *m_solver;
+  mutable DirtyRegionStats m_stats;
+  CDirtyRegionList m_statsRegions; ///< regions marked in the frame of the statistics
+  mutable bool m_dirtyAreaValid = false;
 };
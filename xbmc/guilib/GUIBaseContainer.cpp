@@ -31,6 +31,7 @@
 #include "utils/XBMCTinyXML.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <memory>
 
 using namespace KODI;
@@ -116,6 +117,7 @@ CGUIBaseContainer::~CGUIBaseContainer(void)
   // release the container from items
   for (const auto& item : m_items)
     item->FreeMemory();
+  m_layoutPool.FreeMemory();
 }
 
 void CGUIBaseContainer::DoProcess(unsigned int currentTime, CDirtyRegionList &dirtyregions)
@@ -159,6 +161,8 @@ void CGUIBaseContainer::Process(unsigned int currentTime, CDirtyRegionList &dirt
   // Free memory not used on screen
   if ((int)m_items.size() > m_itemsPerPage + cacheBefore + cacheAfter)
     FreeMemory(CorrectOffset(offset - cacheBefore, 0), CorrectOffset(offset + m_itemsPerPage + 1 + cacheAfter, 0));
+  else // only release items that left the list
+    FreeMemory(0, static_cast<int>(m_items.size()) - 1);
 
   CPoint origin = CPoint(m_posX, m_posY) + m_renderOffset;
   float pos = (m_orientation == VERTICAL) ? origin.y : origin.x;
@@ -222,7 +226,7 @@ void CGUIBaseContainer::ProcessItem(float posX,
   {
     if (!item->GetFocusedLayout())
     {
-      item->SetFocusedLayout(std::make_unique<CGUIListItemLayout>(*m_focusedLayout, this));
+      item->SetFocusedLayout(m_layoutPool.CreateLayout(item, true, this));
     }
     if (item->GetFocusedLayout())
     {
@@ -248,8 +252,7 @@ void CGUIBaseContainer::ProcessItem(float posX,
       item->GetFocusedLayout()->SetFocusedItem(0);  // focus is not set
     if (!item->GetLayout())
     {
-      auto layout = std::make_unique<CGUIListItemLayout>(*m_layout, this);
-      item->SetLayout(std::move(layout));
+      item->SetLayout(m_layoutPool.CreateLayout(item, false, this));
     }
     if (item->GetFocusedLayout() && item->GetFocusedLayout()->IsAnimating(ANIM_TYPE_UNFOCUS))
       item->GetFocusedLayout()->Process(item.get(), m_parentID, currentTime, dirtyregions);
@@ -997,6 +1000,7 @@ void CGUIBaseContainer::AllocResources()
 void CGUIBaseContainer::FreeResources(bool immediately)
 {
   CGUIControl::FreeResources(immediately);
+  m_layoutPool.Clear();
   if (m_listProvider)
   {
     if (immediately)
@@ -1014,6 +1018,7 @@ void CGUIBaseContainer::UpdateLayout(bool updateAllItems)
   { // free memory of items
     for (iItems it = m_items.begin(); it != m_items.end(); ++it)
       (*it)->FreeMemory();
+    m_layoutPool.FreeMemory();
   }
   // and recalculate the layout
   CalculateLayout();
@@ -1354,18 +1359,24 @@ void CGUIBaseContainer::SetRenderOffset(const CPoint &offset)
 
 void CGUIBaseContainer::FreeMemory(int keepStart, int keepEnd)
 {
+  // only the items holding layouts are visited, not the whole list
+  const int size = static_cast<int>(m_items.size());
+  m_keptItems.clear();
   if (keepStart < keepEnd)
-  { // remove before keepStart and after keepEnd
-    for (int i = 0; i < keepStart && i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
-    for (int i = std::max(keepEnd + 1, 0); i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
+  { // keep from keepStart to keepEnd
+    for (int i = std::max(keepStart, 0); i <= keepEnd && i < size; ++i)
+      m_keptItems.emplace_back(m_items[i].get());
   }
   else
-  { // wrapping
-    for (int i = std::max(keepEnd + 1, 0); i < keepStart && i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
+  { // wrapping, keep up to keepEnd and from keepStart
+    for (int i = 0; i <= keepEnd && i < size; ++i)
+      m_keptItems.emplace_back(m_items[i].get());
+    for (int i = std::max(keepStart, keepEnd + 1); i < size; ++i)
+      m_keptItems.emplace_back(m_items[i].get());
   }
+  std::ranges::sort(m_keptItems);
+
+  m_layoutPool.RecycleLayouts(m_keptItems);
 }
 
 bool CGUIBaseContainer::InsideLayout(const CGUIListItemLayout *layout, const CPoint &point) const
@@ -1446,6 +1457,8 @@ void CGUIBaseContainer::GetCurrentLayouts()
   }
   if (!m_focusedLayout && !m_focusedLayouts.empty())
     m_focusedLayout = &m_focusedLayouts.front(); // failsafe
+
+  m_layoutPool.SetLayouts(m_layout, m_focusedLayout);
 }
 
 bool CGUIBaseContainer::HasNextPage() const
@@ -14,6 +14,7 @@
 */
 
 #include "GUIAction.h"
+#include "GUIListItemLayoutPool.h"
 #include "IGUIContainer.h"
 #include "utils/Stopwatch.h"
 
@@ -157,6 +158,9 @@ protected:
 
   CGUIListItemLayout* m_layout{nullptr};
   CGUIListItemLayout* m_focusedLayout{nullptr};
+
+  CGUIListItemLayoutPool m_layoutPool;
+  std::vector<const CGUIListItem*> m_keptItems; ///< items keeping their layouts, see FreeMemory()
   bool m_layoutCondition = false;
   bool m_focusedLayoutCondition = false;
 
@@ -43,6 +43,7 @@
 #include "GUIToggleButtonControl.h"
 #include "GUIVideoControl.h"
 #include "GUIVisualisationControl.h"
+#include "GUIWaveformControl.h"
 #include "GUIWrappingListContainer.h"
 #include "LocalizeStrings.h"
 #include "addons/Skin.h"
@@ -103,6 +104,7 @@ static const ControlMapping controls[] = {
     {"togglebutton", CGUIControl::GUICONTROL_TOGGLEBUTTON},
     {"videowindow", CGUIControl::GUICONTROL_VIDEO},
     {"visualisation", CGUIControl::GUICONTROL_VISUALISATION},
+    {"waveform", CGUIControl::GUICONTROL_WAVEFORM},
     {"wraplist", CGUIControl::GUICONTAINER_WRAPLIST},
 };
 
@@ -806,6 +808,9 @@ CGUIControl* CGUIControlFactory::Create(int parentID,
   int pageControl = 0;
   GUIINFO::CGUIInfoColor colorDiffuse(0xFFFFFFFF);
   GUIINFO::CGUIInfoColor colorBox(0xFF000000);
+  GUIINFO::CGUIInfoColor waveColor(0xFFFFFFFF);
+  GUIINFO::CGUIInfoColor playedColor(0xFFFFFFFF);
+  std::string waveMode;
   int defaultControl = 0;
   bool defaultAlways = false;
   std::string strTmp;
@@ -975,6 +980,9 @@ CGUIControl* CGUIControlFactory::Create(int parentID,
 
   GetInfoColor(pControlNode, "colordiffuse", colorDiffuse, parentID);
   GetInfoColor(pControlNode, "colorbox", colorBox, parentID);
+  GetInfoColor(pControlNode, "wavecolor", waveColor, parentID);
+  GetInfoColor(pControlNode, "playedcolor", playedColor, parentID);
+  XMLUtils::GetString(pControlNode, "mode", waveMode);
 
   GetConditionalVisibility(pControlNode, visibleCondition, allowHiddenFocus);
   XMLUtils::GetString(pControlNode, "enable", enableCondition);
@@ -1666,6 +1674,13 @@ CGUIControl* CGUIControlFactory::Create(int parentID,
       control = new CGUIVisualisationControl(parentID, id, posX, posY, width, height);
       break;
     }
+    case CGUIControl::GUICONTROL_WAVEFORM:
+    {
+      control = new CGUIWaveformControl(parentID, id, posX, posY, width, height,
+                                        CGUIWaveformControl::TranslateMode(waveMode), waveColor,
+                                        playedColor);
+      break;
+    }
     case CGUIControl::GUICONTROL_RENDERADDON:
     {
       control = new CGUIRenderingControl(parentID, id, posX, posY, width, height);
@@ -120,6 +120,8 @@ void CGUIControlProfilerItem::SaveToXML(TiXmlElement *parent)
     lpszType = "edit"; break;
   case CGUIControl::GUICONTROL_VISUALISATION:
     lpszType = "visualisation"; break;
+  case CGUIControl::GUICONTROL_WAVEFORM:
+    lpszType = "waveform"; break;
   case CGUIControl::GUICONTROL_MULTI_IMAGE:
     lpszType = "multiimage"; break;
   case CGUIControl::GUICONTROL_GROUP:
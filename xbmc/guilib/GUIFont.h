@@ -58,6 +58,17 @@ constexpr int FONT_STYLE_CAPITALIZE = (1 << 5);
 constexpr int FONT_STYLE_MASK = 0xFF;
 constexpr int FONT_STYLES_COUNT = 7;
 
+/*!
+ \ingroup textures
+ \brief Counters of the shaped text caches of fonts
+ */
+struct FontShapingStats
+{
+  uint64_t hits{0};
+  uint64_t misses{0};
+  size_t entries{0};
+};
+
 class CScrollInfo
 {
 public:
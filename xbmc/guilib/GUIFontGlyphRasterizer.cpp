@@ -0,0 +1,241 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFontGlyphRasterizer.h"
+
+#include "GUIFont.h"
+#include "GUIFrameProfiler.h"
+#include "utils/log.h"
+
+#include <mutex>
+#include <utility>
+
+#include FT_GLYPH_H
+#include FT_OUTLINE_H
+#include FT_STROKER_H
+
+namespace
+{
+constexpr int GLYPH_STRENGTH_BOLD = 24;
+constexpr int GLYPH_STRENGTH_LIGHT = -48;
+} // unnamed namespace
+
+CGUIFontGlyphRasterizer::CGUIFontGlyphRasterizer() : CThread("FontRasterizer")
+{
+}
+
+CGUIFontGlyphRasterizer::~CGUIFontGlyphRasterizer()
+{
+  StopThread();
+
+  for (auto& [faceID, face] : m_faces)
+    ReleaseFace(face);
+}
+
+std::shared_ptr<CGUIFontGlyphRasterizer> CGUIFontGlyphRasterizer::GetShared()
+{
+  static CCriticalSection section;
+  static std::weak_ptr<CGUIFontGlyphRasterizer> shared;
+
+  std::unique_lock lock(section);
+  std::shared_ptr<CGUIFontGlyphRasterizer> rasterizer = shared.lock();
+  if (!rasterizer)
+  {
+    rasterizer = std::make_shared<CGUIFontGlyphRasterizer>();
+    shared = rasterizer;
+  }
+  return rasterizer;
+}
+
+unsigned int CGUIFontGlyphRasterizer::AddFace(FT_Face face, FT_Stroker stroker)
+{
+  std::unique_lock lock(m_critSection);
+  const unsigned int faceID = m_nextFaceID++;
+  m_faces.try_emplace(faceID, Face{face, stroker, {}});
+  if (!IsRunning())
+    Create();
+  return faceID;
+}
+
+void CGUIFontGlyphRasterizer::RemoveFace(unsigned int faceID)
+{
+  Face face;
+  {
+    std::unique_lock renderLock(m_renderSection);
+    std::unique_lock lock(m_critSection);
+    const auto it = m_faces.find(faceID);
+    if (it == m_faces.end())
+      return;
+    face = std::move(it->second);
+    m_faces.erase(it);
+    std::erase_if(m_requests,
+                  [faceID](const GlyphRequest& request) { return request.m_faceID == faceID; });
+  }
+  ReleaseFace(face);
+}
+
+void CGUIFontGlyphRasterizer::Request(unsigned int faceID, FT_UInt glyphIndex, uint32_t style)
+{
+  std::unique_lock lock(m_critSection);
+  m_requests.push_back({faceID, glyphIndex, style});
+  m_requestEvent.Set();
+}
+
+std::vector<CGUIFontGlyphRasterizer::Result> CGUIFontGlyphRasterizer::TakeResults(
+    unsigned int faceID)
+{
+  std::vector<Result> results;
+  std::unique_lock lock(m_critSection);
+  const auto it = m_faces.find(faceID);
+  if (it != m_faces.end())
+    results.swap(it->second.m_results);
+  return results;
+}
+
+void CGUIFontGlyphRasterizer::Process()
+{
+  // text shows with holes until the glyphs are ready, but the GUI must not wait for them
+  SetPriority(ThreadPriority::BELOW_NORMAL);
+
+  while (!m_bStop)
+  {
+    std::unique_lock renderLock(m_renderSection);
+    std::unique_lock lock(m_critSection);
+    if (m_requests.empty())
+    {
+      lock.unlock();
+      renderLock.unlock();
+      AbortableWait(m_requestEvent);
+      continue;
+    }
+    const GlyphRequest request = m_requests.front();
+    m_requests.pop_front();
+    // requests of removed faces are dropped with the face
+    Face& face = m_faces.at(request.m_faceID);
+    lock.unlock();
+
+    FT_Glyph glyph = nullptr;
+    {
+      CGUIFrameProfiler::CScope scope("Font::Rasterize", "font");
+      if (LoadGlyph(face.m_face, request.m_glyphIndex, request.m_style))
+        glyph = RenderGlyph(face.m_face, face.m_stroker);
+    }
+
+    lock.lock();
+    face.m_results.push_back({request.m_glyphIndex, request.m_style, glyph});
+  }
+}
+
+bool CGUIFontGlyphRasterizer::LoadGlyph(FT_Face face, FT_UInt glyphIndex, uint32_t style)
+{
+  if (FT_Load_Glyph(face, glyphIndex, FT_LOAD_TARGET_LIGHT))
+  {
+    CLog::LogF(LOGDEBUG, "Failed to load glyph {:x}", glyphIndex);
+    return false;
+  }
+
+  // make bold if applicable
+  if (style & FONT_STYLE_BOLD)
+    SetGlyphStrength(face, GLYPH_STRENGTH_BOLD);
+  // and italics if applicable
+  if (style & FONT_STYLE_ITALICS)
+    ObliqueGlyph(face->glyph);
+  // and light if applicable
+  if (style & FONT_STYLE_LIGHT)
+    SetGlyphStrength(face, GLYPH_STRENGTH_LIGHT);
+  return true;
+}
+
+FT_Glyph CGUIFontGlyphRasterizer::RenderGlyph(FT_Face face, FT_Stroker stroker)
+{
+  FT_Glyph glyph = nullptr;
+  // grab the glyph
+  if (FT_Get_Glyph(face->glyph, &glyph))
+  {
+    CLog::LogF(LOGDEBUG, "Failed to get glyph {:x}", face->glyph->glyph_index);
+    return nullptr;
+  }
+  if (stroker)
+    FT_Glyph_StrokeBorder(&glyph, stroker, 0, 1);
+  // render the glyph
+  if (FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, nullptr, 1))
+  {
+    CLog::LogF(LOGDEBUG, "Failed to render glyph {:x} to a bitmap", face->glyph->glyph_index);
+    FT_Done_Glyph(glyph);
+    return nullptr;
+  }
+  return glyph;
+}
+
+void CGUIFontGlyphRasterizer::ReleaseFace(Face& face)
+{
+  for (const Result& result : face.m_results)
+  {
+    if (result.m_glyph)
+      FT_Done_Glyph(result.m_glyph);
+  }
+  face.m_results.clear();
+  if (face.m_stroker)
+    FT_Stroker_Done(face.m_stroker);
+  FT_Done_Face(face.m_face);
+}
+
+// Oblique code - original taken from freetype2 (ftsynth.c)
+void CGUIFontGlyphRasterizer::ObliqueGlyph(FT_GlyphSlot slot)
+{
+  /* only oblique outline glyphs */
+  if (slot->format != FT_GLYPH_FORMAT_OUTLINE)
+    return;
+
+  /* we don't touch the advance width */
+
+  /* For italic, simply apply a shear transform, with an angle */
+  /* of about 12 degrees.                                      */
+
+  FT_Matrix transform;
+  transform.xx = 0x10000L;
+  transform.yx = 0x00000L;
+
+  transform.xy = 0x06000L;
+  transform.yy = 0x10000L;
+
+  FT_Outline_Transform(&slot->outline, &transform);
+}
+
+// Embolden code - original taken from freetype2 (ftsynth.c)
+void CGUIFontGlyphRasterizer::SetGlyphStrength(FT_Face face, int glyphStrength)
+{
+  FT_GlyphSlot slot = face->glyph;
+  if (slot->format != FT_GLYPH_FORMAT_OUTLINE)
+    return;
+
+  /* some reasonable strength */
+  FT_Pos strength = FT_MulFix(face->units_per_EM, face->size->metrics.y_scale) / glyphStrength;
+
+  FT_BBox bbox_before, bbox_after;
+  FT_Outline_Get_CBox(&slot->outline, &bbox_before);
+  FT_Outline_Embolden(&slot->outline, strength); // ignore error
+  FT_Outline_Get_CBox(&slot->outline, &bbox_after);
+
+  FT_Pos dx = bbox_after.xMax - bbox_before.xMax;
+  FT_Pos dy = bbox_after.yMax - bbox_before.yMax;
+
+  if (slot->advance.x)
+    slot->advance.x += dx;
+
+  if (slot->advance.y)
+    slot->advance.y += dy;
+
+  slot->metrics.width += dx;
+  slot->metrics.height += dy;
+  slot->metrics.horiBearingY += dy;
+  slot->metrics.horiAdvance += dx;
+  slot->metrics.vertBearingX -= dx / 2;
+  slot->metrics.vertBearingY += dy;
+  slot->metrics.vertAdvance += dy;
+}
@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+struct FT_GlyphRec_;
+struct FT_StrokerRec_;
+
+typedef struct FT_GlyphRec_* FT_Glyph;
+typedef struct FT_StrokerRec_* FT_Stroker;
+
+/*!
+ \ingroup textures
+ \brief Renders glyphs of fonts to bitmaps on a worker thread shared by the fonts
+
+ FreeType faces must not be used by two threads at once, so every font hands the rasterizer a face
+ and stroker of its own, opened from the same file and size as the face of the font. The rasterizer
+ takes ownership of both. Faces must be created and released on the thread creating the other
+ faces, which is why they are added and removed there.
+ */
+class CGUIFontGlyphRasterizer : private CThread
+{
+public:
+  struct Result
+  {
+    FT_UInt m_glyphIndex;
+    uint32_t m_style;
+    FT_Glyph m_glyph; ///< bitmap glyph, owned by the receiver, nullptr if it failed to render
+  };
+
+  CGUIFontGlyphRasterizer();
+  ~CGUIFontGlyphRasterizer() override;
+
+  /*!
+   \brief Get the rasterizer shared by all fonts, it is destroyed with the last font holding it
+   */
+  static std::shared_ptr<CGUIFontGlyphRasterizer> GetShared();
+
+  /*!
+   \brief Add a face to render glyphs with, the worker thread is started with the first face
+   \param face face of its own, released by RemoveFace()
+   \param stroker stroker of its own for fonts with a border or nullptr, released by RemoveFace()
+   \return the id of the face, never 0
+   */
+  unsigned int AddFace(FT_Face face, FT_Stroker stroker);
+
+  /*!
+   \brief Release a face, waiting if one of its glyphs is being rendered, and drop its glyphs
+   */
+  void RemoveFace(unsigned int faceID);
+
+  /*!
+   \brief Queue a glyph for rendering, its bitmap is returned by a later TakeResults()
+   */
+  void Request(unsigned int faceID, FT_UInt glyphIndex, uint32_t style);
+
+  /*!
+   \brief Get the glyphs of a face rendered since the last call
+   */
+  std::vector<Result> TakeResults(unsigned int faceID);
+
+  /*!
+   \brief Load a glyph into the glyph slot of the face and apply the style to it
+   \return false if the glyph could not be loaded
+   */
+  static bool LoadGlyph(FT_Face face, FT_UInt glyphIndex, uint32_t style);
+
+  /*!
+   \brief Render the glyph loaded by LoadGlyph(), with a border if a stroker is given
+   \return the bitmap glyph, to be released with FT_Done_Glyph, nullptr if it failed
+   */
+  static FT_Glyph RenderGlyph(FT_Face face, FT_Stroker stroker);
+
+protected:
+  void Process() override;
+
+private:
+  struct Face
+  {
+    FT_Face m_face{nullptr};
+    FT_Stroker m_stroker{nullptr};
+    std::vector<Result> m_results;
+  };
+
+  struct GlyphRequest
+  {
+    unsigned int m_faceID;
+    FT_UInt m_glyphIndex;
+    uint32_t m_style;
+  };
+
+  static void ReleaseFace(Face& face);
+  static void SetGlyphStrength(FT_Face face, int glyphStrength);
+  static void ObliqueGlyph(FT_GlyphSlot slot);
+
+  // held by the worker while it renders, so a face isn't released under it
+  CCriticalSection m_renderSection;
+  CCriticalSection m_critSection;
+  CEvent m_requestEvent;
+  std::map<unsigned int, Face> m_faces;
+  std::deque<GlyphRequest> m_requests;
+  unsigned int m_nextFaceID{1};
+};
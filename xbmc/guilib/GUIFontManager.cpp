@@ -339,6 +339,19 @@ void GUIFontManager::FreeFontFile(CGUIFontTTF* pFont)
   }
 }
 
+FontShapingStats GUIFontManager::GetShapingStats() const
+{
+  FontShapingStats total;
+  for (const auto& fontFile : m_vecFontFiles)
+  {
+    const FontShapingStats stats = fontFile->GetShapingStats();
+    total.hits += stats.hits;
+    total.misses += stats.misses;
+    total.entries += stats.entries;
+  }
+  return total;
+}
+
 CGUIFontTTF* GUIFontManager::GetFontFile(const std::string& fontIdent)
 {
   for (const auto& it : m_vecFontFiles)
@@ -13,6 +13,7 @@
 \brief
 */
 
+#include "GUIFont.h"
 #include "IMsgTargetCallback.h"
 #include "threads/CriticalSection.h"
 #include "threads/SingleLock.h"
@@ -98,6 +99,11 @@ public:
   void Clear();
   void FreeFontFile(CGUIFontTTF* pFont);
 
+  /*! \brief Get the shaped text cache counters of all loaded fonts added up
+   \note like drawing text, requires the graphics context to be locked
+   */
+  FontShapingStats GetShapingStats() const;
+
   static void SettingOptionsFontsFiller(const std::shared_ptr<const CSetting>& setting,
                                         std::vector<StringSettingOption>& list,
                                         std::string& current);
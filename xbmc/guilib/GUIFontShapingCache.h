@@ -0,0 +1,174 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "GUIFont.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <stdint.h>
+#include <unordered_map>
+#include <utility>
+
+/*!
+ \ingroup textures
+ \brief Recently shaped texts of a font, so texts drawn or measured again are not shaped again
+
+ Keyed by the characters and their styles, colors don't change the shape. Texts seen once wait
+ in a probation segment and move to a protected one when used again, so the prefixes a text
+ layout measures while wrapping a line only push out other texts seen once.
+ */
+template<class Value>
+class CGUIFontShapingCache
+{
+public:
+  static constexpr character_t KEY_MASK = 0xff00ffff; // style and letter, without color
+
+  /*!
+   \param size the number of texts kept
+   \param protectedSize of those, the number of texts used more than once
+   */
+  CGUIFontShapingCache(size_t size, size_t protectedSize)
+    : m_size(size), m_protectedSize(std::min(protectedSize, size))
+  {
+  }
+
+  /*!
+   \brief Find the shaped text, a text found is protected
+   \return the shaped text, nullptr if it isn't cached
+   */
+  Value* Find(const vecText& text)
+  {
+    const auto it = m_entries.find(Key{&text, Hash(text)});
+    if (it == m_entries.end())
+    {
+      m_misses++;
+      return nullptr;
+    }
+    m_hits++;
+
+    const typename EntryList::iterator entry = it->second;
+    if (entry->m_protected)
+    {
+      m_protected.splice(m_protected.begin(), m_protected, entry);
+    }
+    else
+    {
+      // used a second time, protect it and make room by moving the oldest protected text back
+      entry->m_protected = true;
+      m_protected.splice(m_protected.begin(), m_probation, entry);
+      if (m_protected.size() > m_protectedSize)
+      {
+        m_protected.back().m_protected = false;
+        m_probation.splice(m_probation.begin(), m_protected, std::prev(m_protected.end()));
+        Trim(m_probation, m_size - m_protectedSize);
+      }
+    }
+    return &entry->m_value;
+  }
+
+  /*!
+   \brief Add a text not found, on probation until it is found
+   */
+  Value& Insert(const vecText& text, Value value)
+  {
+    Entry& entry = m_probation.emplace_front();
+    entry.m_text.reserve(text.size());
+    for (const character_t ch : text)
+      entry.m_text.emplace_back(ch & KEY_MASK);
+    entry.m_hash = Hash(text);
+    entry.m_value = std::move(value);
+    m_entries.emplace(Key{&entry.m_text, entry.m_hash}, m_probation.begin());
+
+    Trim(m_probation, m_size - m_protected.size());
+    return entry.m_value;
+  }
+
+  /*!
+   \brief Call func for every shaped text, most recently used protected texts first
+   */
+  template<class Func>
+  void ForEach(Func func)
+  {
+    for (Entry& entry : m_protected)
+      func(entry.m_value);
+    for (Entry& entry : m_probation)
+      func(entry.m_value);
+  }
+
+  void Clear()
+  {
+    m_entries.clear();
+    m_probation.clear();
+    m_protected.clear();
+  }
+
+  FontShapingStats GetStats() const { return {m_hits, m_misses, m_entries.size()}; }
+
+private:
+  struct Entry
+  {
+    vecText m_text;
+    size_t m_hash{0};
+    bool m_protected{false};
+    Value m_value{};
+  };
+  using EntryList = std::list<Entry>;
+
+  struct Key
+  {
+    const vecText* m_text;
+    size_t m_hash{0};
+  };
+  struct KeyHash
+  {
+    size_t operator()(const Key& key) const { return key.m_hash; }
+  };
+  struct KeyEqual
+  {
+    bool operator()(const Key& a, const Key& b) const
+    {
+      return a.m_hash == b.m_hash &&
+             std::equal(a.m_text->begin(), a.m_text->end(), b.m_text->begin(), b.m_text->end(),
+                        [](character_t x, character_t y)
+                        { return (x & KEY_MASK) == (y & KEY_MASK); });
+    }
+  };
+
+  static size_t Hash(const vecText& text)
+  {
+    size_t hash = 14695981039346656037ull;
+    for (const character_t ch : text)
+    {
+      hash ^= ch & KEY_MASK;
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
+  void Trim(EntryList& list, size_t size)
+  {
+    while (list.size() > size)
+    {
+      m_entries.erase(Key{&list.back().m_text, list.back().m_hash});
+      list.pop_back();
+    }
+  }
+
+  const size_t m_size;
+  const size_t m_protectedSize;
+  // most recently used first
+  EntryList m_probation;
+  EntryList m_protected;
+  std::unordered_map<Key, typename EntryList::iterator, KeyHash, KeyEqual> m_entries;
+  uint64_t m_hits{0};
+  uint64_t m_misses{0};
+};
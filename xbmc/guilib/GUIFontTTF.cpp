@@ -8,7 +8,11 @@
 
 #include "GUIFontTTF.h"
 
+#include "GUIComponent.h"
+#include "GUIFontGlyphRasterizer.h"
 #include "GUIFontManager.h"
+#include "GUIFrameProfiler.h"
+#include "GUIWindowManager.h"
 #include "ServiceBroker.h"
 #include "Texture.h"
 #include "URL.h"
@@ -21,6 +25,8 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
+#include <iterator>
 #include <math.h>
 #include <memory>
 #include <queue>
@@ -56,10 +62,11 @@ constexpr int MAX_TRANSLATED_VERTEX = 32; // max number of structs CTranslatedVe
 constexpr int MAX_GLYPHS_PER_TEXT_LINE = 1024; // max number of glyphs per text line expect to use
 constexpr unsigned int SPACING_BETWEEN_CHARACTERS_IN_TEXTURE = 1;
 constexpr int CHAR_CHUNK = 64; // 64 chars allocated at a time (2048 bytes)
-constexpr int GLYPH_STRENGTH_BOLD = 24;
-constexpr int GLYPH_STRENGTH_LIGHT = -48;
 constexpr int TAB_SPACE_LENGTH = 4;
 
+constexpr size_t SHAPING_CACHE_SIZE = 2048; // shaped texts kept per font
+constexpr size_t SHAPING_CACHE_PROTECTED = SHAPING_CACHE_SIZE * 4 / 5; // of those, used twice
+
 // \brief Check for conflicting alignments
 void ValidateAlignments(uint32_t& aligns)
 {
@@ -115,8 +122,6 @@ public:
       return nullptr;
     }
 
-    FT_Face face;
-
     // ok, now load the font face
     CURL realFile(CSpecialProtocol::TranslatePath(filename));
     if (realFile.GetFileName().empty())
@@ -133,32 +138,25 @@ public:
       XFILE::CFile f;
       if (f.LoadFile(realFile, memoryBuf) <= 0)
         return nullptr;
-
-      if (FT_New_Memory_Face(m_library, reinterpret_cast<const FT_Byte*>(memoryBuf.data()),
-                             memoryBuf.size(), 0, &face) != 0)
-        return nullptr;
     }
-#ifndef TARGET_WINDOWS
-    else if (FT_New_Face(m_library, realFile.GetFileName().c_str(), 0, &face))
-      return nullptr;
-#endif // ! TARGET_WINDOWS
 
-    unsigned int ydpi = 72; // 72 points to the inch is the freetype default
-    unsigned int xdpi =
-        static_cast<unsigned int>(MathUtils::round_int(static_cast<double>(ydpi * aspect)));
+    return OpenFace(realFile.GetFileName(), memoryBuf, size, aspect);
+  };
 
-    // we set our screen res currently to 96dpi in both directions (windows default)
-    // we cache our characters (for rendering speed) so it's probably
-    // not a good idea to allow free scaling of fonts - rather, just
-    // scaling to pixel ratio on screen perhaps?
-    if (FT_Set_Char_Size(face, 0, static_cast<int>(size * 64 + 0.5f), xdpi, ydpi))
-    {
-      FT_Done_Face(face);
+  /*!
+   \brief Open another face of a font opened by GetFont(), sharing the file loaded into memory
+   */
+  FT_Face GetFontFace(const std::string& filename,
+                      float size,
+                      float aspect,
+                      const std::vector<uint8_t>& memoryBuf)
+  {
+    if (!m_library)
       return nullptr;
-    }
 
-    return face;
-  };
+    CURL realFile(CSpecialProtocol::TranslatePath(filename));
+    return OpenFace(realFile.GetFileName(), memoryBuf, size, aspect);
+  }
 
   FT_Stroker GetStroker()
   {
@@ -185,6 +183,43 @@ public:
   }
 
 private:
+  FT_Face OpenFace(const std::string& filename,
+                   const std::vector<uint8_t>& memoryBuf,
+                   float size,
+                   float aspect)
+  {
+    FT_Face face;
+    if (!memoryBuf.empty())
+    {
+      if (FT_New_Memory_Face(m_library, reinterpret_cast<const FT_Byte*>(memoryBuf.data()),
+                             memoryBuf.size(), 0, &face) != 0)
+        return nullptr;
+    }
+#ifndef TARGET_WINDOWS
+    else if (FT_New_Face(m_library, filename.c_str(), 0, &face))
+      return nullptr;
+#else
+    else
+      return nullptr;
+#endif // ! TARGET_WINDOWS
+
+    unsigned int ydpi = 72; // 72 points to the inch is the freetype default
+    unsigned int xdpi =
+        static_cast<unsigned int>(MathUtils::round_int(static_cast<double>(ydpi * aspect)));
+
+    // we set our screen res currently to 96dpi in both directions (windows default)
+    // we cache our characters (for rendering speed) so it's probably
+    // not a good idea to allow free scaling of fonts - rather, just
+    // scaling to pixel ratio on screen perhaps?
+    if (FT_Set_Char_Size(face, 0, static_cast<int>(size * 64 + 0.5f), xdpi, ydpi))
+    {
+      FT_Done_Face(face);
+      return nullptr;
+    }
+
+    return face;
+  }
+
   FT_Library m_library{nullptr};
 };
 
@@ -195,6 +230,7 @@ CGUIFontTTF::CGUIFontTTF(const std::string& fontIdent)
   : m_fontIdent(fontIdent),
     m_staticCache(*this),
     m_dynamicCache(*this),
+    m_shapingCache(SHAPING_CACHE_SIZE, SHAPING_CACHE_PROTECTED),
     m_renderSystem(CServiceBroker::GetRenderSystem())
 {
 }
@@ -227,6 +263,7 @@ void CGUIFontTTF::ClearCharacterCache()
   m_texture = nullptr;
   m_char.clear();
   m_char.reserve(CHAR_CHUNK);
+  m_pendingGlyphs.clear();
   memset(m_charquick, 0, sizeof(m_charquick));
   // set the posX and posY so that our texture will be created on first character write.
   m_posX = m_textureWidth;
@@ -236,6 +273,12 @@ void CGUIFontTTF::ClearCharacterCache()
 
 void CGUIFontTTF::Clear()
 {
+  if (m_rasterizerFace)
+    m_rasterizer->RemoveFace(m_rasterizerFace);
+  m_rasterizerFace = 0;
+  m_rasterizerFailed = false;
+  m_rasterizer.reset();
+  m_pendingGlyphs.clear();
   m_texture.reset();
   m_texture = nullptr;
   memset(m_charquick, 0, sizeof(m_charquick));
@@ -255,6 +298,7 @@ void CGUIFontTTF::Clear()
 
   m_vertexTrans.clear();
   m_vertex.clear();
+  m_shapingCache.Clear();
 
   m_fontFileInMemory.clear();
 }
@@ -292,13 +336,14 @@ bool CGUIFontTTF::Load(
   int cellDescender = std::min<int>(m_face->bbox.yMin, m_face->descender);
   int cellAscender = std::max<int>(m_face->bbox.yMax, m_face->ascender);
 
+  FT_Pos strength = 0;
   if (border)
   {
     /*
      add on the strength of any border - the non-bordered font needs
      aligning with the bordered font by utilising GetTextBaseLine()
      */
-    FT_Pos strength = FT_MulFix(m_face->units_per_EM, m_face->size->metrics.y_scale) / 12;
+    strength = FT_MulFix(m_face->units_per_EM, m_face->size->metrics.y_scale) / 12;
     if (strength < 128)
       strength = 128;
 
@@ -337,11 +382,21 @@ bool CGUIFontTTF::Load(
   m_posX = m_textureWidth;
   m_posY = -static_cast<int>(GetTextureLineHeight());
 
+  // the face of the rasterizer is opened on the first glyph left to it
+  m_filename = strFilename;
+  m_aspect = aspect;
+  m_borderStrength = strength;
+  m_rasterizer = CGUIFontGlyphRasterizer::GetShared();
+
   return true;
 }
 
 void CGUIFontTTF::Begin()
 {
+  // not when GetCharacter() restarts a batch, the text being drawn holds on to cached vertices
+  if (m_nestedBeginCount == 0 && m_rasterizerFace && !m_restartingBatch)
+    PlaceRasterizedGlyphs();
+
   if (m_nestedBeginCount == 0 && m_texture && FirstBegin())
   {
     m_vertexTrans.clear();
@@ -450,7 +505,7 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
     //! by add validating alignments from each parent caller component
     ValidateAlignments(alignment);
 
-    const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
+    const std::vector<Glyph>& glyphs = GetShapedText(text).m_glyphs;
     // save the origin, which is scaled separately
 #if not defined(HAS_DX)
     // the origin is now at [0,0], and not at "random" locations anymore. positioning is done in the vertex shader.
@@ -745,8 +800,10 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
 
 float CGUIFontTTF::GetTextWidthInternal(const vecText& text)
 {
-  const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
-  return GetTextWidthInternal(text, glyphs);
+  ShapedText& shaped = GetShapedText(text);
+  if (shaped.m_width < 0.0f)
+    shaped.m_width = GetTextWidthInternal(text, shaped.m_glyphs);
+  return shaped.m_width;
 }
 
 // this routine assumes a single line (i.e. it was called from GUITextLayout)
@@ -906,6 +963,14 @@ std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::GetHarfBuzzShapedGlyphs(const vecTe
   return glyphs;
 }
 
+CGUIFontTTF::ShapedText& CGUIFontTTF::GetShapedText(const vecText& text)
+{
+  if (ShapedText* shaped = m_shapingCache.Find(text))
+    return *shaped;
+  CGUIFrameProfiler::CScope scope("Font::Shape", "font");
+  return m_shapingCache.Insert(text, {GetHarfBuzzShapedGlyphs(text)});
+}
+
 CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyphIndex)
 {
   const wchar_t letter = static_cast<wchar_t>(chr & 0xffff);
@@ -960,11 +1025,22 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
   // must End() as we can't render text to our texture during a Begin(), End() block
   unsigned int nestedBeginCount = m_nestedBeginCount;
   m_nestedBeginCount = 1;
+  m_restartingBatch = true;
   if (nestedBeginCount)
     End();
 
+  // rasterize the first few new glyphs of a frame right away, text needing more (e.g. CJK text
+  // appearing) would stall the frame, the rest is left to the rasterizer thread
+  const auto now = std::chrono::steady_clock::now();
+  if (now - m_syncGlyphsStart > SYNC_GLYPHS_PERIOD)
+  {
+    m_syncGlyphsStart = now;
+    m_syncGlyphs = 0;
+  }
+  const bool defer = m_rasterizer && ++m_syncGlyphs > MAX_SYNC_GLYPHS;
+
   m_char.emplace(m_char.begin() + low);
-  if (!CacheCharacter(glyphIndex, style, m_char.data() + low))
+  if (!CacheCharacter(glyphIndex, style, m_char.data() + low, defer))
   { // unable to cache character - try clearing them all out and starting over
     CLog::LogF(LOGDEBUG, "Unable to cache character. Clearing character cache of {} characters",
                m_char.size());
@@ -972,12 +1048,13 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
     low = 0;
     startIndex = 0;
     m_char.emplace(m_char.begin());
-    if (!CacheCharacter(glyphIndex, style, m_char.data()))
+    if (!CacheCharacter(glyphIndex, style, m_char.data(), defer))
     {
       CLog::LogF(LOGERROR, "Unable to cache character (out of memory?)");
       if (nestedBeginCount)
         Begin();
       m_nestedBeginCount = nestedBeginCount;
+      m_restartingBatch = false;
       return nullptr;
     }
   }
@@ -985,6 +1062,7 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
   if (nestedBeginCount)
     Begin();
   m_nestedBeginCount = nestedBeginCount;
+  m_restartingBatch = false;
 
   // update the lookup table with only the m_char addresses that have changed
   for (size_t i = startIndex; i < m_char.size(); ++i)
@@ -1002,40 +1080,44 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
   return m_char.data() + low;
 }
 
-bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character* ch)
+bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character* ch, bool defer)
 {
-  FT_Glyph glyph = nullptr;
-  if (FT_Load_Glyph(m_face, glyphIndex, FT_LOAD_TARGET_LIGHT))
-  {
-    CLog::LogF(LOGDEBUG, "Failed to load glyph {:x}", glyphIndex);
+  CGUIFrameProfiler::CScope scope("Font::CacheCharacter", "font");
+
+  if (!CGUIFontGlyphRasterizer::LoadGlyph(m_face, glyphIndex, style))
     return false;
-  }
 
-  // make bold if applicable
-  if (style & FONT_STYLE_BOLD)
-    SetGlyphStrength(m_face->glyph, GLYPH_STRENGTH_BOLD);
-  // and italics if applicable
-  if (style & FONT_STYLE_ITALICS)
-    ObliqueGlyph(m_face->glyph);
-  // and light if applicable
-  if (style & FONT_STYLE_LIGHT)
-    SetGlyphStrength(m_face->glyph, GLYPH_STRENGTH_LIGHT);
-  // grab the glyph
-  if (FT_Get_Glyph(m_face->glyph, &glyph))
+  // set the character in our table
+  ch->m_glyphAndStyle = (style << 16) | glyphIndex;
+  ch->m_glyphIndex = glyphIndex;
+  ch->m_advance =
+      static_cast<float>(MathUtils::round_int(static_cast<double>(m_face->glyph->advance.x) / 64));
+
+  if (defer && OpenRasterizerFace())
   {
-    CLog::LogF(LOGDEBUG, "Failed to get glyph {:x}", glyphIndex);
-    return false;
+    // advance only, the character is blank until PlaceRasterizedGlyphs() has its bitmap
+    ch->m_offsetX = 0;
+    ch->m_offsetY = 0;
+    ch->m_left = ch->m_top = ch->m_right = ch->m_bottom = 0.0f;
+    m_pendingGlyphs.insert(ch->m_glyphAndStyle);
+    m_rasterizer->Request(m_rasterizerFace, glyphIndex, style);
+    return true;
   }
-  if (m_stroker)
-    FT_Glyph_StrokeBorder(&glyph, m_stroker, 0, 1);
-  // render the glyph
-  if (FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, nullptr, 1))
-  {
-    CLog::LogF(LOGDEBUG, "Failed to render glyph {:x} to a bitmap", glyphIndex);
+
+  FT_Glyph glyph = CGUIFontGlyphRasterizer::RenderGlyph(m_face, m_stroker);
+  if (!glyph)
     return false;
-  }
 
-  FT_BitmapGlyph bitGlyph = (FT_BitmapGlyph)glyph;
+  const bool placed = PlaceGlyph(reinterpret_cast<FT_BitmapGlyph>(glyph), ch);
+
+  // free the glyph
+  FT_Done_Glyph(glyph);
+
+  return placed;
+}
+
+bool CGUIFontTTF::PlaceGlyph(FT_BitmapGlyph bitGlyph, Character* ch)
+{
   FT_Bitmap bitmap = bitGlyph->bitmap;
   bool isEmptyGlyph = (bitmap.width == 0 || bitmap.rows == 0);
 
@@ -1063,14 +1145,12 @@ bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character*
         {
           CLog::LogF(LOGDEBUG, "New cache texture is too large ({} > {} pixels long)", newHeight,
                      m_renderSystem->GetMaxTextureSize());
-          FT_Done_Glyph(glyph);
           return false;
         }
 
         std::unique_ptr<CTexture> newTexture = ReallocTexture(newHeight);
         if (!newTexture)
         {
-          FT_Done_Glyph(glyph);
           CLog::LogF(LOGDEBUG, "Failed to allocate new texture of height {}", newHeight);
           return false;
         }
@@ -1081,23 +1161,17 @@ bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character*
 
     if (!m_texture)
     {
-      FT_Done_Glyph(glyph);
       CLog::LogF(LOGDEBUG, "no texture to cache character to");
       return false;
     }
   }
 
-  // set the character in our table
-  ch->m_glyphAndStyle = (style << 16) | glyphIndex;
-  ch->m_glyphIndex = glyphIndex;
   ch->m_offsetX = static_cast<short>(bitGlyph->left);
   ch->m_offsetY = static_cast<short>(m_cellBaseLine - bitGlyph->top);
   ch->m_left = isEmptyGlyph ? 0.0f : (static_cast<float>(m_posX));
   ch->m_top = isEmptyGlyph ? 0.0f : (static_cast<float>(m_posY));
   ch->m_right = ch->m_left + bitmap.width;
   ch->m_bottom = ch->m_top + bitmap.rows;
-  ch->m_advance =
-      static_cast<float>(MathUtils::round_int(static_cast<double>(m_face->glyph->advance.x) / 64));
 
   // we need only render if we actually have some pixels
   if (!isEmptyGlyph)
@@ -1114,12 +1188,76 @@ bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character*
               static_cast<unsigned short>(ch->m_right - ch->m_left);
   }
 
-  // free the glyph
-  FT_Done_Glyph(glyph);
+  return true;
+}
+
+bool CGUIFontTTF::OpenRasterizerFace()
+{
+  if (m_rasterizerFace)
+    return true;
+  if (m_rasterizerFailed)
+    return false;
+
+  // the rasterizer needs a face of its own, without it all glyphs are rasterized here
+  FT_Face face = g_freeTypeLibrary.GetFontFace(m_filename, m_height, m_aspect, m_fontFileInMemory);
+  if (!face)
+  {
+    CLog::LogF(LOGDEBUG, "Unable to open a face of {} for the rasterizer", m_filename);
+    m_rasterizerFailed = true;
+    return false;
+  }
 
+  FT_Stroker stroker = m_stroker ? g_freeTypeLibrary.GetStroker() : nullptr;
+  if (stroker)
+    FT_Stroker_Set(stroker, m_borderStrength, FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND,
+                   0);
+  m_rasterizerFace = m_rasterizer->AddFace(face, stroker);
   return true;
 }
 
+void CGUIFontTTF::PlaceRasterizedGlyphs()
+{
+  std::vector<CGUIFontGlyphRasterizer::Result> results =
+      m_rasterizer->TakeResults(m_rasterizerFace);
+  if (results.empty())
+    return;
+
+  bool changed = false;
+  for (const auto& result : results)
+  {
+    const character_t glyphAndStyle = (result.m_style << 16) | result.m_glyphIndex;
+    // glyphs of a cleared character cache are not waited for anymore
+    if (result.m_glyph && m_pendingGlyphs.erase(glyphAndStyle))
+    {
+      const auto ch = std::lower_bound(m_char.begin(), m_char.end(), glyphAndStyle,
+                                       [](const Character& c, character_t value)
+                                       { return c.m_glyphAndStyle < value; });
+      if (ch != m_char.end() && ch->m_glyphAndStyle == glyphAndStyle)
+      {
+        if (!PlaceGlyph(reinterpret_cast<FT_BitmapGlyph>(result.m_glyph), &*ch))
+        {
+          CLog::LogF(LOGDEBUG, "Unable to place glyph. Clearing character cache of {} characters",
+                     m_char.size());
+          ClearCharacterCache();
+        }
+        changed = true;
+      }
+    }
+    if (result.m_glyph)
+      FT_Done_Glyph(result.m_glyph);
+  }
+
+  if (changed)
+  {
+    // texts were laid out and cached with blank characters
+    m_staticCache.Flush();
+    m_dynamicCache.Flush();
+    m_shapingCache.ForEach([](ShapedText& shaped) { shaped.m_width = -1.0f; });
+    if (CGUIComponent* gui = CServiceBroker::GetGUI())
+      gui->GetWindowManager().MarkDirty();
+  }
+}
+
 void CGUIFontTTF::RenderCharacter(CGraphicContext& context,
                                   float posX,
                                   float posY,
@@ -1299,60 +1437,6 @@ void CGUIFontTTF::RenderCharacter(CGraphicContext& context,
 #endif
 }
 
-// Oblique code - original taken from freetype2 (ftsynth.c)
-void CGUIFontTTF::ObliqueGlyph(FT_GlyphSlot slot)
-{
-  /* only oblique outline glyphs */
-  if (slot->format != FT_GLYPH_FORMAT_OUTLINE)
-    return;
-
-  /* we don't touch the advance width */
-
-  /* For italic, simply apply a shear transform, with an angle */
-  /* of about 12 degrees.                                      */
-
-  FT_Matrix transform;
-  transform.xx = 0x10000L;
-  transform.yx = 0x00000L;
-
-  transform.xy = 0x06000L;
-  transform.yy = 0x10000L;
-
-  FT_Outline_Transform(&slot->outline, &transform);
-}
-
-// Embolden code - original taken from freetype2 (ftsynth.c)
-void CGUIFontTTF::SetGlyphStrength(FT_GlyphSlot slot, int glyphStrength)
-{
-  if (slot->format != FT_GLYPH_FORMAT_OUTLINE)
-    return;
-
-  /* some reasonable strength */
-  FT_Pos strength = FT_MulFix(m_face->units_per_EM, m_face->size->metrics.y_scale) / glyphStrength;
-
-  FT_BBox bbox_before, bbox_after;
-  FT_Outline_Get_CBox(&slot->outline, &bbox_before);
-  FT_Outline_Embolden(&slot->outline, strength); // ignore error
-  FT_Outline_Get_CBox(&slot->outline, &bbox_after);
-
-  FT_Pos dx = bbox_after.xMax - bbox_before.xMax;
-  FT_Pos dy = bbox_after.yMax - bbox_before.yMax;
-
-  if (slot->advance.x)
-    slot->advance.x += dx;
-
-  if (slot->advance.y)
-    slot->advance.y += dy;
-
-  slot->metrics.width += dx;
-  slot->metrics.height += dy;
-  slot->metrics.horiBearingY += dy;
-  slot->metrics.horiAdvance += dx;
-  slot->metrics.vertBearingX -= dx / 2;
-  slot->metrics.vertBearingY += dy;
-  slot->metrics.vertAdvance += dy;
-}
-
 float CGUIFontTTF::GetTabSpaceLength()
 {
   const Character* c = GetCharacter(static_cast<character_t>('X'), 0);
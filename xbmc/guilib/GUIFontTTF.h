@@ -12,7 +12,9 @@
 #include "utils/ColorUtils.h"
 #include "utils/Geometry.h"
 
+#include <chrono>
 #include <memory>
+#include <set>
 #include <stdint.h>
 #include <string>
 #include <vector>
@@ -30,6 +32,7 @@ using namespace DirectX::PackedVector;
 #endif
 
 class CGraphicContext;
+class CGUIFontGlyphRasterizer;
 class CTexture;
 class CRenderSystemBase;
 
@@ -71,6 +74,7 @@ struct SVertex
 #endif
 
 #include "GUIFontCache.h"
+#include "GUIFontShapingCache.h"
 
 
 class CGUIFontTTF
@@ -107,6 +111,8 @@ public:
 
   const std::string& GetFontIdent() const { return m_fontIdent; }
 
+  FontShapingStats GetShapingStats() const { return m_shapingCache.GetStats(); }
+
 protected:
   explicit CGUIFontTTF(const std::string& fontIdent);
 
@@ -144,10 +150,17 @@ protected:
     hb_glyph_position_t* m_glyphPositions;
   };
 
+  struct ShapedText
+  {
+    std::vector<Glyph> m_glyphs;
+    float m_width{-1.0f}; // negative until measured
+  };
+
   void AddReference();
   void RemoveReference();
 
   std::vector<Glyph> GetHarfBuzzShapedGlyphs(const vecText& text);
+  ShapedText& GetShapedText(const vecText& text);
 
   float GetTextWidthInternal(const vecText& text);
   float GetTextWidthInternal(const vecText& text, const std::vector<Glyph>& glyph);
@@ -172,7 +185,10 @@ protected:
 
   // Stuff for pre-rendering for speed
   Character* GetCharacter(character_t letter, FT_UInt glyphIndex);
-  bool CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character* ch);
+  bool CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character* ch, bool defer);
+  bool PlaceGlyph(FT_BitmapGlyph bitGlyph, Character* ch);
+  bool OpenRasterizerFace();
+  void PlaceRasterizedGlyphs();
   void RenderCharacter(CGraphicContext& context,
                        float posX,
                        float posY,
@@ -190,10 +206,6 @@ protected:
                                  unsigned int y2) = 0;
   virtual void DeleteHardwareTexture() = 0;
 
-  // modifying glyphs
-  void SetGlyphStrength(FT_GlyphSlot slot, int glyphStrength);
-  static void ObliqueGlyph(FT_GlyphSlot slot);
-
   std::unique_ptr<CTexture>
       m_texture; // texture that holds our rendered characters (8bit alpha only)
 
@@ -230,6 +242,21 @@ protected:
 
   hb_font_t* m_hbFont{nullptr};
 
+  // glyphs beyond the few rasterized per frame are rendered on a worker thread, they are drawn
+  // blank until their bitmaps are placed in the texture
+  static constexpr unsigned int MAX_SYNC_GLYPHS = 32; // rasterized right away per period
+  static constexpr auto SYNC_GLYPHS_PERIOD = std::chrono::milliseconds(16);
+  std::shared_ptr<CGUIFontGlyphRasterizer> m_rasterizer;
+  unsigned int m_rasterizerFace{0}; // opened on the first glyph left to the rasterizer
+  bool m_rasterizerFailed{false};
+  std::string m_filename;
+  float m_aspect{1.0f};
+  FT_Pos m_borderStrength{0};
+  std::set<character_t> m_pendingGlyphs; // m_glyphAndStyle of the glyphs waiting for a bitmap
+  std::chrono::steady_clock::time_point m_syncGlyphsStart;
+  unsigned int m_syncGlyphs{0};
+  bool m_restartingBatch{false};
+
   float m_originX{0.0f};
   float m_originY{0.0f};
 
@@ -273,6 +300,7 @@ protected:
 
   CGUIFontCache<CGUIFontCacheStaticPosition, CGUIFontCacheStaticValue> m_staticCache;
   CGUIFontCache<CGUIFontCacheDynamicPosition, CGUIFontCacheDynamicValue> m_dynamicCache;
+  CGUIFontShapingCache<ShapedText> m_shapingCache;
 
   CRenderSystemBase* m_renderSystem;
 
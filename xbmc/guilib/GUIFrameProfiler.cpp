@@ -0,0 +1,212 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameProfiler.h"
+
+#include "filesystem/File.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+
+std::atomic_bool CGUIFrameProfiler::m_running{false};
+
+namespace
+{
+double ToMicroseconds(CGUIFrameProfiler::Clock::duration duration)
+{
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+float ToMilliseconds(CGUIFrameProfiler::Clock::duration duration)
+{
+  return std::chrono::duration<float, std::milli>(duration).count();
+}
+} // unnamed namespace
+
+CGUIFrameProfiler& CGUIFrameProfiler::Instance()
+{
+  static CGUIFrameProfiler profiler;
+  return profiler;
+}
+
+void CGUIFrameProfiler::Start()
+{
+  std::unique_lock lock(m_critSection);
+  if (m_spans.empty())
+    m_spans.resize(CAPACITY);
+  m_next = 0;
+  m_count = 0;
+  m_threads.clear();
+  m_frame = 0;
+  m_frameStart = Clock::time_point();
+  m_stats = {};
+  // sums left from the last run
+  RecordTotals(Clock::time_point());
+  m_running = true;
+  CLog::Log(LOGINFO, "Frame profiler started");
+}
+
+void CGUIFrameProfiler::Stop()
+{
+  // the spans are kept until the profiler is started again, so they can still be saved
+  m_running = false;
+  CLog::Log(LOGINFO, "Frame profiler stopped");
+}
+
+void CGUIFrameProfiler::NewFrame()
+{
+  if (!IsRunning())
+    return;
+
+  const Clock::time_point now = Clock::now();
+  std::unique_lock lock(m_critSection);
+  if (m_frameStart != Clock::time_point())
+  {
+    m_stats.lastFrame = ToMilliseconds(now - m_frameStart);
+    m_stats.maxFrame = std::max(m_stats.maxFrame, m_stats.lastFrame);
+  }
+  RecordTotals(m_frameStart);
+  m_frameStart = now;
+  m_guiThread = std::this_thread::get_id();
+  ++m_frame;
+}
+
+void CGUIFrameProfiler::AddSpan(const char* name,
+                                const char* category,
+                                Clock::time_point start,
+                                Clock::time_point end)
+{
+  std::unique_lock lock(m_critSection);
+  AddSpanLocked(name, category, start, end - start, 0);
+}
+
+void CGUIFrameProfiler::AddSpanLocked(const char* name,
+                                      const char* category,
+                                      Clock::time_point start,
+                                      Clock::duration duration,
+                                      unsigned int count)
+{
+  // stopped and started again while the span was running
+  if (m_spans.empty())
+    return;
+
+  const auto thread =
+      m_threads.try_emplace(std::this_thread::get_id(), static_cast<unsigned int>(m_threads.size()))
+          .first->second;
+  m_spans[m_next] = {name, category, m_frame, thread, start, duration, count};
+  m_next = (m_next + 1) % CAPACITY;
+  m_count = std::min(m_count + 1, CAPACITY);
+}
+
+void CGUIFrameProfiler::RecordTotals(Clock::time_point frameStart)
+{
+  for (CTotal* total : m_totals)
+  {
+    const unsigned int count = total->m_count.exchange(0, std::memory_order_relaxed);
+    const Clock::duration duration(total->m_duration.exchange(0, std::memory_order_relaxed));
+    // nothing to record before the first frame
+    if (count > 0 && frameStart != Clock::time_point())
+      AddSpanLocked(total->m_name, total->m_category, frameStart, duration, count);
+  }
+}
+
+CGUIFrameProfiler::CTotal::CTotal(const char* name, const char* category)
+  : m_name(name), m_category(category)
+{
+  CGUIFrameProfiler& profiler = Instance();
+  std::unique_lock lock(profiler.m_critSection);
+  profiler.m_totals.emplace_back(this);
+}
+
+CGUIFrameProfiler::CTotal::~CTotal()
+{
+  CGUIFrameProfiler& profiler = Instance();
+  std::unique_lock lock(profiler.m_critSection);
+  profiler.m_totals.erase(std::remove(profiler.m_totals.begin(), profiler.m_totals.end(), this),
+                          profiler.m_totals.end());
+}
+
+void CGUIFrameProfiler::GetTrace(CVariant& trace) const
+{
+  std::vector<Span> spans;
+  std::unordered_map<std::thread::id, unsigned int> threads;
+  std::thread::id guiThread;
+  {
+    std::unique_lock lock(m_critSection);
+    spans.reserve(m_count);
+    // oldest first
+    const size_t first = (m_next + CAPACITY - m_count) % CAPACITY;
+    for (size_t i = 0; i < m_count; ++i)
+      spans.emplace_back(m_spans[(first + i) % CAPACITY]);
+    threads = m_threads;
+    guiThread = m_guiThread;
+  }
+
+  trace = CVariant(CVariant::VariantTypeObject);
+  trace["displayTimeUnit"] = "ms";
+  CVariant& events = trace["traceEvents"];
+  events = CVariant(CVariant::VariantTypeArray);
+
+  for (const auto& [id, thread] : threads)
+  {
+    CVariant event(CVariant::VariantTypeObject);
+    event["name"] = "thread_name";
+    event["ph"] = "M";
+    event["pid"] = 0;
+    event["tid"] = thread;
+    event["args"]["name"] = id == guiThread ? std::string("GUI")
+                                            : "Thread " + std::to_string(thread);
+    events.push_back(std::move(event));
+  }
+
+  for (const Span& span : spans)
+  {
+    CVariant event(CVariant::VariantTypeObject);
+    event["name"] = span.m_name;
+    event["cat"] = span.m_category;
+    event["ph"] = "X";
+    event["ts"] = ToMicroseconds(span.m_start.time_since_epoch());
+    event["dur"] = ToMicroseconds(span.m_duration);
+    event["pid"] = 0;
+    event["tid"] = span.m_thread;
+    event["args"]["frame"] = span.m_frame;
+    if (span.m_count > 0)
+      event["args"]["count"] = span.m_count;
+    events.push_back(std::move(event));
+  }
+}
+
+bool CGUIFrameProfiler::SaveTrace(const std::string& path) const
+{
+  CVariant trace;
+  GetTrace(trace);
+
+  std::string json;
+  if (!CJSONVariantWriter::Write(trace, json, true))
+    return false;
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(path, true) ||
+      file.Write(json.data(), json.size()) != static_cast<ssize_t>(json.size()))
+  {
+    CLog::Log(LOGERROR, "Unable to write frame trace to {}", path);
+    return false;
+  }
+  CLog::Log(LOGINFO, "Frame trace of {} events written to {}",
+            trace["traceEvents"].size(), path);
+  return true;
+}
+
+FrameProfilerStats CGUIFrameProfiler::GetStats() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_stats;
+}
@@ -0,0 +1,194 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class CVariant;
+
+/*!
+ \ingroup guilib
+ \brief Durations of the last frames of the application loop, in milliseconds
+ */
+struct FrameProfilerStats
+{
+  float lastFrame = 0.0f;
+  float maxFrame = 0.0f; ///< longest frame since the profiler was started
+};
+
+/*!
+ \ingroup guilib
+ \brief Records what the render loop and the work it waits for spent their time on
+
+ Unlike CGUIControlProfiler it runs continuously: spans of the last frames are kept in a ring
+ buffer, older ones are overwritten, and can be exported at any time in the trace event format
+ of Chrome (chrome://tracing or https://ui.perfetto.dev). Spans may be recorded from any thread,
+ while the profiler is stopped a span costs a single atomic load.
+ */
+class CGUIFrameProfiler
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  static CGUIFrameProfiler& Instance();
+  static bool IsRunning() { return m_running.load(std::memory_order_relaxed); }
+
+  void Start();
+  void Stop();
+
+  /*!
+   \brief Start a new frame of the application loop, called by the thread running the GUI
+   */
+  void NewFrame();
+
+  /*!
+   \brief Record a span
+   \param name name of the span, must be a string literal
+   \param category category of the span, must be a string literal
+   */
+  void AddSpan(const char* name, const char* category, Clock::time_point start, Clock::time_point end);
+
+  /*!
+   \brief Get the recorded spans as a JSON object in the trace event format
+   */
+  void GetTrace(CVariant& trace) const;
+
+  /*!
+   \brief Write the recorded spans to a file in the trace event format
+   */
+  bool SaveTrace(const std::string& path) const;
+
+  FrameProfilerStats GetStats() const;
+
+  /*!
+   \brief Records a span from its construction to its destruction
+   */
+  class CScope
+  {
+  public:
+    CScope(const char* name, const char* category) : m_name(name), m_category(category)
+    {
+      if (IsRunning())
+        m_start = Clock::now();
+    }
+    ~CScope()
+    {
+      if (m_start != Clock::time_point())
+        Instance().AddSpan(m_name, m_category, m_start, Clock::now());
+    }
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+
+  private:
+    const char* m_name;
+    const char* m_category;
+    Clock::time_point m_start;
+  };
+
+  /*!
+   \brief Sums up spans too short and frequent to be recorded one by one
+
+   The sum is recorded as one span per frame, starting with the frame, with the number of spans
+   summed up. Adding a span costs no lock, so a total can be added to from any thread.
+   */
+  class CTotal
+  {
+  public:
+    /*!
+     \param name name of the span, must be a string literal
+     \param category category of the span, must be a string literal
+     */
+    CTotal(const char* name, const char* category);
+    ~CTotal();
+    CTotal(const CTotal&) = delete;
+    CTotal& operator=(const CTotal&) = delete;
+
+    void Add(Clock::duration duration)
+    {
+      m_duration.fetch_add(duration.count(), std::memory_order_relaxed);
+      m_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+  private:
+    friend class CGUIFrameProfiler;
+
+    const char* m_name;
+    const char* m_category;
+    std::atomic<Clock::rep> m_duration{0};
+    std::atomic<unsigned int> m_count{0};
+  };
+
+  /*!
+   \brief Adds the time from its construction to its destruction to a total
+   */
+  class CTotalScope
+  {
+  public:
+    explicit CTotalScope(CTotal& total) : m_total(total)
+    {
+      if (IsRunning())
+        m_start = Clock::now();
+    }
+    ~CTotalScope()
+    {
+      if (m_start != Clock::time_point())
+        m_total.Add(Clock::now() - m_start);
+    }
+    CTotalScope(const CTotalScope&) = delete;
+    CTotalScope& operator=(const CTotalScope&) = delete;
+
+  private:
+    CTotal& m_total;
+    Clock::time_point m_start;
+  };
+
+private:
+  CGUIFrameProfiler() = default;
+
+  struct Span
+  {
+    const char* m_name;
+    const char* m_category;
+    uint64_t m_frame;
+    unsigned int m_thread;
+    Clock::time_point m_start;
+    Clock::duration m_duration;
+    unsigned int m_count; ///< number of spans summed up by a total, 0 for a single span
+  };
+
+  void AddSpanLocked(const char* name,
+                     const char* category,
+                     Clock::time_point start,
+                     Clock::duration duration,
+                     unsigned int count);
+  void RecordTotals(Clock::time_point frameStart);
+
+  static constexpr size_t CAPACITY = 1 << 16;
+  static std::atomic_bool m_running;
+
+  mutable CCriticalSection m_critSection;
+  std::vector<Span> m_spans; ///< ring buffer of CAPACITY spans, allocated once started
+  size_t m_next = 0;
+  size_t m_count = 0;
+  std::unordered_map<std::thread::id, unsigned int> m_threads; ///< small ids of the threads seen
+  std::vector<CTotal*> m_totals;
+  std::thread::id m_guiThread;
+
+  uint64_t m_frame = 0;
+  Clock::time_point m_frameStart;
+  FrameProfilerStats m_stats;
+};
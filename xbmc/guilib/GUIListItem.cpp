@@ -331,6 +331,11 @@ CGUIListItemLayout *CGUIListItem::GetLayout()
   return m_layout.get();
 }
 
+std::unique_ptr<CGUIListItemLayout> CGUIListItem::TakeLayout()
+{
+  return std::move(m_layout);
+}
+
 void CGUIListItem::SetFocusedLayout(std::unique_ptr<CGUIListItemLayout> layout)
 {
   m_focusedLayout = std::move(layout);
@@ -341,6 +346,11 @@ CGUIListItemLayout *CGUIListItem::GetFocusedLayout()
   return m_focusedLayout.get();
 }
 
+std::unique_ptr<CGUIListItemLayout> CGUIListItem::TakeFocusedLayout()
+{
+  return std::move(m_focusedLayout);
+}
+
 void CGUIListItem::SetInvalid()
 {
   if (m_layout)
@@ -130,9 +130,11 @@ public:
 
   void SetLayout(std::unique_ptr<CGUIListItemLayout> layout);
   CGUIListItemLayout *GetLayout();
+  std::unique_ptr<CGUIListItemLayout> TakeLayout();
 
   void SetFocusedLayout(std::unique_ptr<CGUIListItemLayout> layout);
   CGUIListItemLayout *GetFocusedLayout();
+  std::unique_ptr<CGUIListItemLayout> TakeFocusedLayout();
 
   void FreeIcons();
   void FreeMemory(bool immediately = false);
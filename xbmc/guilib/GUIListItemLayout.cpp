@@ -34,6 +34,7 @@ CGUIListItemLayout::CGUIListItemLayout(const CGUIListItemLayout& from, CGUIContr
     m_height(from.m_height),
     m_focused(from.m_focused),
     m_condition(from.m_condition),
+    m_source(&from),
     m_isPlaying(from.m_isPlaying),
     m_infoUpdateMillis(from.m_infoUpdateMillis)
 {
@@ -91,6 +92,17 @@ void CGUIListItemLayout::Process(CGUIListItem *item, int parentID, unsigned int
   m_group.DoProcess(currentTime, dirtyregions);
 }
 
+void CGUIListItemLayout::Recycle()
+{
+  // the controls keep the state of the last item until they are updated with the new one, only
+  // finish what was in progress
+  m_group.ResetAnimations();
+  m_group.SetFocusedItem(0);
+  m_group.AllocResources();
+  m_invalidated = true;
+  m_infoUpdateTimeout.Set(m_infoUpdateMillis);
+}
+
 void CGUIListItemLayout::Render(CGUIListItem *item, int parentID)
 {
   m_group.DoRender();
@@ -34,6 +34,11 @@ public:
   void ResetAnimation(ANIMATION_TYPE animType);
   void SetInvalid() { m_invalidated = true; }
   void FreeResources(bool immediately = false);
+  /*!
+   \brief Prepare a layout whose resources were freed for showing another item
+   */
+  void Recycle();
+  bool IsCloneOf(const CGUIListItemLayout* layout) const { return m_source == layout; }
   void SetParentControl(CGUIControl* control) { m_group.SetParentControl(control); }
   void AssignDepth();
 
@@ -60,6 +65,7 @@ protected:
   float m_height{0};
   bool m_focused{false};
   bool m_invalidated{true};
+  const CGUIListItemLayout* m_source{nullptr}; ///< the layout this one was cloned from
 
   INFO::InfoPtr m_condition;
   KODI::GUILIB::GUIINFO::CGUIInfoBool m_isPlaying;
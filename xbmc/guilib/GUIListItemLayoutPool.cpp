@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIListItemLayoutPool.h"
+
+#include "GUIListItem.h"
+#include "GUIListItemLayout.h"
+
+#include <algorithm>
+
+CGUIListItemLayoutPool::CGUIListItemLayoutPool() = default;
+
+CGUIListItemLayoutPool::~CGUIListItemLayoutPool() = default;
+
+void CGUIListItemLayoutPool::SetLayouts(const CGUIListItemLayout* layout,
+                                        const CGUIListItemLayout* focusedLayout)
+{
+  if (layout != m_layout)
+    m_layouts.clear();
+  if (focusedLayout != m_focusedLayout)
+    m_focusedLayouts.clear();
+  m_layout = layout;
+  m_focusedLayout = focusedLayout;
+}
+
+std::unique_ptr<CGUIListItemLayout> CGUIListItemLayoutPool::CreateLayout(
+    const std::shared_ptr<CGUIListItem>& item, bool focused, CGUIControl* control)
+{
+  const CGUIListItemLayout* from = focused ? m_focusedLayout : m_layout;
+  if (!from)
+    return nullptr;
+
+  if (std::ranges::none_of(m_items, [&item](const std::weak_ptr<CGUIListItem>& layoutItem)
+                           { return layoutItem.lock() == item; }))
+    m_items.emplace_back(item);
+
+  auto& pool = focused ? m_focusedLayouts : m_layouts;
+  if (pool.empty())
+    return std::make_unique<CGUIListItemLayout>(*from, control);
+
+  std::unique_ptr<CGUIListItemLayout> layout = std::move(pool.back());
+  pool.pop_back();
+  layout->Recycle();
+  return layout;
+}
+
+void CGUIListItemLayoutPool::RecycleLayouts(const std::vector<const CGUIListItem*>& keptItems)
+{
+  std::erase_if(m_items,
+                [this, &keptItems](const std::weak_ptr<CGUIListItem>& layoutItem)
+                {
+                  const std::shared_ptr<CGUIListItem> item = layoutItem.lock();
+                  if (!item)
+                    return true;
+                  if (std::ranges::binary_search(keptItems, item.get()))
+                    return false;
+                  Recycle(*item);
+                  return true;
+                });
+}
+
+void CGUIListItemLayoutPool::FreeMemory()
+{
+  for (const auto& layoutItem : m_items)
+  {
+    if (const std::shared_ptr<CGUIListItem> item = layoutItem.lock())
+      item->FreeMemory();
+  }
+  m_items.clear();
+  Clear();
+}
+
+void CGUIListItemLayoutPool::Clear()
+{
+  m_layouts.clear();
+  m_focusedLayouts.clear();
+}
+
+size_t CGUIListItemLayoutPool::GetPooledLayouts(bool focused) const
+{
+  return focused ? m_focusedLayouts.size() : m_layouts.size();
+}
+
+void CGUIListItemLayoutPool::Recycle(CGUIListItem& item)
+{
+  if (std::unique_ptr<CGUIListItemLayout> layout = item.TakeLayout())
+  {
+    layout->FreeResources();
+    // layouts of a previous layout or of another container showing the same item are dropped
+    if (m_layout && layout->IsCloneOf(m_layout))
+      m_layouts.emplace_back(std::move(layout));
+  }
+  if (std::unique_ptr<CGUIListItemLayout> layout = item.TakeFocusedLayout())
+  {
+    layout->FreeResources();
+    if (m_focusedLayout && layout->IsCloneOf(m_focusedLayout))
+      m_focusedLayouts.emplace_back(std::move(layout));
+  }
+}
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+class CGUIControl;
+class CGUIListItem;
+class CGUIListItemLayout;
+
+/*!
+ \ingroup controls
+ \brief Layouts of the items of a container, recycled between its items
+
+ Layouts are only held by the items on screen and the cached ones around them. The layouts of
+ items leaving that range are kept for the items entering it, instead of cloning the layout of the
+ container again. Items are only remembered weakly, the layouts of items removed from the list go
+ with them.
+ */
+class CGUIListItemLayoutPool
+{
+public:
+  CGUIListItemLayoutPool();
+  ~CGUIListItemLayoutPool();
+
+  /*!
+   \brief Set the layouts of the container, pooled clones of other layouts are dropped
+   */
+  void SetLayouts(const CGUIListItemLayout* layout, const CGUIListItemLayout* focusedLayout);
+
+  /*!
+   \brief Take a layout from the pool, or clone the layout of the container if it is empty
+   \param item the item getting the layout, its layouts are taken back by RecycleLayouts()
+   \param control the container
+   */
+  std::unique_ptr<CGUIListItemLayout> CreateLayout(const std::shared_ptr<CGUIListItem>& item,
+                                                   bool focused,
+                                                   CGUIControl* control);
+
+  /*!
+   \brief Take back the layouts of the items that aren't kept
+   \param keptItems the items keeping their layouts, sorted
+   */
+  void RecycleLayouts(const std::vector<const CGUIListItem*>& keptItems);
+
+  /*!
+   \brief Free the layouts of all items and empty the pool
+   */
+  void FreeMemory();
+
+  /*!
+   \brief Empty the pool, items keep their layouts
+   */
+  void Clear();
+
+  size_t GetPooledLayouts(bool focused) const;
+
+private:
+  void Recycle(CGUIListItem& item);
+
+  const CGUIListItemLayout* m_layout{nullptr};
+  const CGUIListItemLayout* m_focusedLayout{nullptr};
+  std::vector<std::weak_ptr<CGUIListItem>> m_items; ///< items holding our layouts
+  std::vector<std::unique_ptr<CGUIListItemLayout>> m_layouts;
+  std::vector<std::unique_ptr<CGUIListItemLayout>> m_focusedLayouts;
+};
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIRenderBatch.h"
+
+#include <algorithm>
+
+namespace
+{
+// how many draws a quad is compared with to find one it can join, bounds the cost of a quad
+// on screens with a lot of different textures
+constexpr size_t MAX_LOOKBACK = 64;
+
+CRect GetBounds(const CGUIRenderBatch::Vertex* vertices)
+{
+  CRect bounds(vertices[0].x, vertices[0].y, vertices[0].x, vertices[0].y);
+  for (int i = 1; i < 4; ++i)
+  {
+    bounds.x1 = std::min(bounds.x1, vertices[i].x);
+    bounds.y1 = std::min(bounds.y1, vertices[i].y);
+    bounds.x2 = std::max(bounds.x2, vertices[i].x);
+    bounds.y2 = std::max(bounds.y2, vertices[i].y);
+  }
+  return bounds;
+}
+} // unnamed namespace
+
+void CGUIRenderBatch::AddQuad(const State& state, const Vertex* vertices)
+{
+  const CRect bounds = GetBounds(vertices);
+
+  // find the latest draw with the same state the quad can be moved to, without passing a draw
+  // it overlaps
+  size_t draw = m_openDraws.size();
+  const size_t last = m_openDraws.size() > MAX_LOOKBACK ? m_openDraws.size() - MAX_LOOKBACK : 0;
+  for (size_t i = m_openDraws.size(); i > last; --i)
+  {
+    OpenDraw& openDraw = m_openDraws[i - 1];
+    if (openDraw.state == state)
+    {
+      draw = i - 1;
+      break;
+    }
+    if (openDraw.bounds.Intersects(bounds))
+      break;
+  }
+
+  if (draw == m_openDraws.size())
+  {
+    m_openDraws.push_back({state, bounds, 1});
+  }
+  else
+  {
+    m_openDraws[draw].bounds.Union(bounds);
+    m_openDraws[draw].quadCount++;
+  }
+
+  Quad& quad = m_quads.emplace_back();
+  std::copy(vertices, vertices + 4, quad.vertices);
+  quad.draw = draw;
+}
+
+void CGUIRenderBatch::Build()
+{
+  m_draws.clear();
+  m_vertices.resize(m_quads.size() * 4);
+
+  // the quads of a draw follow each other, in the order they were added
+  std::vector<size_t> firstQuads;
+  firstQuads.reserve(m_openDraws.size());
+  size_t firstQuad = 0;
+  for (const OpenDraw& openDraw : m_openDraws)
+  {
+    firstQuads.emplace_back(firstQuad);
+    for (size_t quad = 0; quad < openDraw.quadCount; quad += MAX_QUADS_PER_DRAW)
+    {
+      m_draws.push_back({openDraw.state, firstQuad + quad,
+                         std::min(openDraw.quadCount - quad, MAX_QUADS_PER_DRAW)});
+    }
+    firstQuad += openDraw.quadCount;
+  }
+
+  for (const Quad& quad : m_quads)
+  {
+    std::copy(quad.vertices, quad.vertices + 4, m_vertices.begin() + firstQuads[quad.draw]++ * 4);
+  }
+}
+
+void CGUIRenderBatch::Clear()
+{
+  m_quads.clear();
+  m_openDraws.clear();
+  m_draws.clear();
+  m_vertices.clear();
+}
+
+void CGUIRenderBatch::GetQuadIndices(std::vector<uint16_t>& indices, size_t quadCount)
+{
+  quadCount = std::min(quadCount, MAX_QUADS_PER_DRAW);
+  indices.resize(quadCount * 6);
+  for (size_t quad = 0; quad < quadCount; ++quad)
+  {
+    const uint16_t vertex = static_cast<uint16_t>(quad * 4);
+    uint16_t* index = &indices[quad * 6];
+    index[0] = vertex + 0;
+    index[1] = vertex + 1;
+    index[2] = vertex + 2;
+    index[3] = vertex + 2;
+    index[4] = vertex + 3;
+    index[5] = vertex + 0;
+  }
+}
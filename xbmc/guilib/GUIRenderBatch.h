@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/Geometry.h"
+
+#include <stdint.h>
+#include <vector>
+
+/*!
+ \ingroup textures
+ \brief Collects the quads of the GUI textures of a frame and merges them into as few draws as
+ possible
+
+ Quads sharing the same render state are drawn together. To keep the result identical to drawing
+ every quad in the order it was added, a quad is only moved in front of the draws added after the
+ one it joins if it does not overlap any of them, otherwise a new draw is started. The batch knows
+ nothing about the graphics API, it is submitted and cleared by the render system.
+ */
+class CGUIRenderBatch
+{
+public:
+  struct Vertex
+  {
+    float x, y, z;
+    float u1, v1;
+    float u2, v2;
+  };
+
+  /*!
+   \brief The render state of a quad, quads are only merged if it is identical
+   */
+  struct State
+  {
+    unsigned int texture0 = 0; ///< texture of unit 0, an API specific handle
+    unsigned int texture1 = 0; ///< texture of unit 1, only used by shaders with two textures
+    int shader = 0; ///< API specific shader method
+    bool blend = true;
+    uint32_t color = 0xFFFFFFFF; ///< the uniform colour as RGBA
+    float depth = 0.0f; ///< the depth of the layer, only set while depth culling is used
+
+    bool operator==(const State& right) const
+    {
+      return texture0 == right.texture0 && texture1 == right.texture1 && shader == right.shader &&
+             blend == right.blend && color == right.color && depth == right.depth;
+    }
+    bool operator!=(const State& right) const { return !(*this == right); }
+  };
+
+  struct Draw
+  {
+    State state;
+    size_t firstQuad; ///< index of the first quad in GetVertices(), each quad has 4 vertices
+    size_t quadCount;
+  };
+
+  /*!
+   \brief Add a quad, its vertices are in the order top left, top right, bottom right, bottom left
+   */
+  void AddQuad(const State& state, const Vertex* vertices);
+
+  bool IsEmpty() const { return m_quads.empty(); }
+
+  /*!
+   \brief Sort the quads into their draws, valid until the next AddQuad() or Clear()
+   */
+  void Build();
+
+  const std::vector<Draw>& GetDraws() const { return m_draws; }
+  const std::vector<Vertex>& GetVertices() const { return m_vertices; }
+
+  /*!
+   \brief Number of quads added since the last Clear()
+   */
+  size_t GetQuadCount() const { return m_quads.size(); }
+
+  void Clear();
+
+  /*!
+   \brief The indices of the two triangles of each of the given number of quads
+   */
+  static void GetQuadIndices(std::vector<uint16_t>& indices, size_t quadCount);
+
+  /*!
+   \brief The maximum number of quads drawn by a single draw with 16 bit indices
+   */
+  static constexpr size_t MAX_QUADS_PER_DRAW = 65536 / 4;
+
+private:
+  struct Quad
+  {
+    Vertex vertices[4];
+    size_t draw;
+  };
+
+  struct OpenDraw
+  {
+    State state;
+    CRect bounds;
+    size_t quadCount;
+  };
+
+  std::vector<Quad> m_quads;
+  std::vector<OpenDraw> m_openDraws;
+
+  std::vector<Draw> m_draws;
+  std::vector<Vertex> m_vertices;
+};
@@ -9,7 +9,7 @@
 #include "GUITextureGL.h"
 
 #include "ServiceBroker.h"
-#include "Texture.h"
+#include "TextureGL.h"
 #include "rendering/gl/RenderSystemGL.h"
 #include "utils/GLUtils.h"
 #include "utils/Geometry.h"
@@ -50,123 +50,58 @@ void CGUITextureGL::Begin(KODI::UTILS::COLOR::Color color)
   if (m_diffuse.size())
     m_diffuse.m_textures[0]->LoadToGPU();
 
-  texture->BindToUnit(0);
-
   // Setup Colors
-  m_col[0] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color);
-  m_col[1] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color);
-  m_col[2] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::B, color);
-  m_col[3] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::A, color);
+  const GLubyte r = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color);
+  const GLubyte g = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color);
+  const GLubyte b = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::B, color);
+  const GLubyte a = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::A, color);
+
+  bool hasAlpha = m_texture.m_textures[m_currentFrame]->HasAlpha() || a < 255;
 
-  bool hasAlpha = m_texture.m_textures[m_currentFrame]->HasAlpha() || m_col[3] < 255;
+  m_state = {};
+  m_state.texture0 = static_cast<CGLTexture*>(texture)->GetTextureID();
+  m_state.color = (r << 24) | (g << 16) | (b << 8) | a;
+  m_state.depth = m_depth;
 
   if (m_diffuse.size())
   {
-    if (m_col[0] == 255 && m_col[1] == 255 && m_col[2] == 255 && m_col[3] == 255 )
+    if (r == 255 && g == 255 && b == 255 && a == 255)
     {
-      m_renderSystem->EnableShader(ShaderMethodGL::SM_MULTI);
+      m_state.shader = static_cast<int>(ShaderMethodGL::SM_MULTI);
     }
     else
     {
-      m_renderSystem->EnableShader(ShaderMethodGL::SM_MULTI_BLENDCOLOR);
+      m_state.shader = static_cast<int>(ShaderMethodGL::SM_MULTI_BLENDCOLOR);
     }
 
     hasAlpha |= m_diffuse.m_textures[0]->HasAlpha();
 
-    m_diffuse.m_textures[0]->BindToUnit(1);
+    m_state.texture1 = static_cast<CGLTexture*>(m_diffuse.m_textures[0].get())->GetTextureID();
   }
   else
   {
-    if (m_col[0] == 255 && m_col[1] == 255 && m_col[2] == 255 && m_col[3] == 255)
+    if (r == 255 && g == 255 && b == 255 && a == 255)
     {
-      m_renderSystem->EnableShader(ShaderMethodGL::SM_TEXTURE_NOBLEND);
+      m_state.shader = static_cast<int>(ShaderMethodGL::SM_TEXTURE_NOBLEND);
     }
     else
     {
-      m_renderSystem->EnableShader(ShaderMethodGL::SM_TEXTURE);
+      m_state.shader = static_cast<int>(ShaderMethodGL::SM_TEXTURE);
     }
   }
 
-  if (hasAlpha)
-  {
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
-    glEnable(GL_BLEND);
-  }
-  else
-  {
-    glDisable(GL_BLEND);
-  }
-  m_packedVertices.clear();
-  m_idx.clear();
+  m_state.blend = hasAlpha;
 }
 
 void CGUITextureGL::End()
 {
-  if (!m_packedVertices.empty())
-  {
-    GLint posLoc  = m_renderSystem->ShaderGetPos();
-    GLint tex0Loc = m_renderSystem->ShaderGetCoord0();
-    GLint tex1Loc = m_renderSystem->ShaderGetCoord1();
-    GLint uniColLoc = m_renderSystem->ShaderGetUniCol();
-    GLint depthLoc = m_renderSystem->ShaderGetDepth();
-
-    GLuint VertexVBO;
-    GLuint IndexVBO;
-
-    glGenBuffers(1, &VertexVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VertexVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex) * m_packedVertices.size(),
-                 m_packedVertices.data(), GL_STATIC_DRAW);
-
-    glUniform1f(depthLoc, m_depth);
-
-    if (uniColLoc >= 0)
-    {
-      glUniform4f(uniColLoc,(m_col[0] / 255.0f), (m_col[1] / 255.0f), (m_col[2] / 255.0f), (m_col[3] / 255.0f));
-    }
-
-    if (m_diffuse.size())
-    {
-      glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                            reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, u2)));
-      glEnableVertexAttribArray(tex1Loc);
-    }
-
-    glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(PackedVertex),
-                          reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, x)));
-    glEnableVertexAttribArray(posLoc);
-    glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                          reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, u1)));
-    glEnableVertexAttribArray(tex0Loc);
-
-    glGenBuffers(1, &IndexVBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexVBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(ushort)*m_idx.size(), m_idx.data(), GL_STATIC_DRAW);
-
-    glDrawElements(GL_TRIANGLES, m_packedVertices.size()*6 / 4, GL_UNSIGNED_SHORT, 0);
-
-    if (m_diffuse.size())
-      glDisableVertexAttribArray(tex1Loc);
-
-    glDisableVertexAttribArray(posLoc);
-    glDisableVertexAttribArray(tex0Loc);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glDeleteBuffers(1, &VertexVBO);
-    glDeleteBuffers(1, &IndexVBO);
-  }
-
-  if (m_diffuse.size())
-    glActiveTexture(GL_TEXTURE0);
-  glEnable(GL_BLEND);
-
-  m_renderSystem->DisableShader();
+  // the quads are drawn by the render system, together with those of other textures sharing
+  // their state
 }
 
 void CGUITextureGL::Draw(float *x, float *y, float *z, const CRect &texture, const CRect &diffuse, int orientation)
 {
-  PackedVertex vertices[4];
+  CGUIRenderBatch::Vertex vertices[4];
 
   // Setup texture coordinates
   // TopLeft
@@ -241,19 +176,9 @@ void CGUITextureGL::Draw(float *x, float *y, float *z, const CRect &texture, con
     vertices[i].x = x[i];
     vertices[i].y = y[i];
     vertices[i].z = z[i];
-    m_packedVertices.push_back(vertices[i]);
   }
 
-  if ((m_packedVertices.size() / 4) > (m_idx.size() / 6))
-  {
-    size_t i = m_packedVertices.size() - 4;
-    m_idx.push_back(i+0);
-    m_idx.push_back(i+1);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+3);
-    m_idx.push_back(i+0);
-  }
+  m_renderSystem->AddBatchedQuad(m_state, vertices);
 }
 
 void CGUITextureGL::DrawQuad(const CRect& rect,
@@ -264,6 +189,7 @@ void CGUITextureGL::DrawQuad(const CRect& rect,
                              const bool blending)
 {
   CRenderSystemGL *renderSystem = dynamic_cast<CRenderSystemGL*>(CServiceBroker::GetRenderSystem());
+  renderSystem->FlushBatchedDraws();
   if (texture)
   {
     texture->LoadToGPU();
@@ -361,6 +287,7 @@ void CGUITextureGL::DrawQuad(const CRect& rect,
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLubyte)*4, idx, GL_STATIC_DRAW);
 
   glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_BYTE, nullptr);
+  renderSystem->AddDrawCalls(1);
 
   glDisableVertexAttribArray(posLoc);
   if (texture)
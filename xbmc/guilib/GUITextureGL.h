@@ -8,11 +8,10 @@
 
 #pragma once
 
+#include "GUIRenderBatch.h"
 #include "GUITexture.h"
 #include "utils/ColorUtils.h"
 
-#include <array>
-
 #include "system_gl.h"
 
 class CRenderSystemGL;
@@ -44,17 +43,7 @@ protected:
 private:
   CGUITextureGL(const CGUITextureGL& texture) = default;
 
-  std::array<GLubyte, 4> m_col;
-
-  struct PackedVertex
-  {
-    float x, y, z;
-    float u1, v1;
-    float u2, v2;
-  };
-
-  std::vector<PackedVertex> m_packedVertices;
-  std::vector<GLushort> m_idx;
+  CGUIRenderBatch::State m_state;
   CRenderSystemGL *m_renderSystem;
 };
 
@@ -9,7 +9,7 @@
 #include "GUITextureGLES.h"
 
 #include "ServiceBroker.h"
-#include "Texture.h"
+#include "TextureGLES.h"
 #include "guilib/TextureFormats.h"
 #include "rendering/gles/RenderSystemGLES.h"
 #include "utils/GLUtils.h"
@@ -18,7 +18,7 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
-#include <cstddef>
+#include <utility>
 
 void CGUITextureGLES::Register()
 {
@@ -54,140 +54,102 @@ void CGUITextureGLES::Begin(KODI::UTILS::COLOR::Color color)
     m_diffuse.m_textures[0]->LoadToGPU();
 
   // Setup Colors
-  m_col[0] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color);
-  m_col[1] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color);
-  m_col[2] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::B, color);
-  m_col[3] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::A, color);
+  GLubyte r = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color);
+  GLubyte g = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color);
+  GLubyte b = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::B, color);
+  const GLubyte a = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::A, color);
 
   if (CServiceBroker::GetWinSystem()->UseLimitedColor())
   {
-    m_col[0] = (235 - 16) * m_col[0] / 255 + 16;
-    m_col[1] = (235 - 16) * m_col[1] / 255 + 16;
-    m_col[2] = (235 - 16) * m_col[2] / 255 + 16;
+    r = (235 - 16) * r / 255 + 16;
+    g = (235 - 16) * g / 255 + 16;
+    b = (235 - 16) * b / 255 + 16;
   }
 
-  bool hasAlpha = m_texture.m_textures[m_currentFrame]->HasAlpha() || m_col[3] < 255;
-  const bool hasBlendColor =
-      m_col[0] != 255 || m_col[1] != 255 || m_col[2] != 255 || m_col[3] != 255;
+  bool hasAlpha = m_texture.m_textures[m_currentFrame]->HasAlpha() || a < 255;
+  const bool hasBlendColor = r != 255 || g != 255 || b != 255 || a != 255;
+
+  m_state = {};
+  m_state.color = (r << 24) | (g << 16) | (b << 8) | a;
+  m_state.depth = m_depth;
+  m_swapUnits = false;
+
+  const GLuint textureID = static_cast<CGLESTexture*>(texture)->GetTextureID();
 
   if (m_diffuse.size())
   {
+    CTexture* diffuse = m_diffuse.m_textures[0].get();
+    ShaderMethodGLES method;
     if (m_isGLES20 && (texture->GetSwizzle() == KD_TEX_SWIZ_111R ||
-                       m_diffuse.m_textures[0]->GetSwizzle() == KD_TEX_SWIZ_111R))
+                       diffuse->GetSwizzle() == KD_TEX_SWIZ_111R))
     {
       if (texture->GetSwizzle() == KD_TEX_SWIZ_111R &&
-          m_diffuse.m_textures[0]->GetSwizzle() == KD_TEX_SWIZ_111R)
-        m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_111R_111R_BLENDCOLOR);
+          diffuse->GetSwizzle() == KD_TEX_SWIZ_111R)
+        method = ShaderMethodGLES::SM_MULTI_111R_111R_BLENDCOLOR;
       else if (hasBlendColor)
-        m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_RGBA_111R_BLENDCOLOR);
+        method = ShaderMethodGLES::SM_MULTI_RGBA_111R_BLENDCOLOR;
       else
-        m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_RGBA_111R);
+        method = ShaderMethodGLES::SM_MULTI_RGBA_111R;
     }
     else if (hasBlendColor)
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_BLENDCOLOR);
+      method = ShaderMethodGLES::SM_MULTI_BLENDCOLOR;
     }
     else
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI);
+      method = ShaderMethodGLES::SM_MULTI;
     }
+    m_state.shader = static_cast<int>(method);
 
-    hasAlpha |= m_diffuse.m_textures[0]->HasAlpha();
+    hasAlpha |= diffuse->HasAlpha();
 
     // We don't need a 111R_RGBA version of the GLES 2.0 shaders, so in the
     // unlikely event of having an alpha-only texture, switch with the
     // diffuse.
+    const GLuint diffuseID = static_cast<CGLESTexture*>(diffuse)->GetTextureID();
     if (texture->GetSwizzle() == KD_TEX_SWIZ_111R)
     {
-      texture->BindToUnit(1);
-      m_diffuse.m_textures[0]->BindToUnit(0);
+      m_state.texture0 = diffuseID;
+      m_state.texture1 = textureID;
+      m_swapUnits = true;
     }
     else
     {
-      texture->BindToUnit(0);
-      m_diffuse.m_textures[0]->BindToUnit(1);
+      m_state.texture0 = textureID;
+      m_state.texture1 = diffuseID;
     }
   }
   else
   {
+    ShaderMethodGLES method;
     if (m_isGLES20 && texture->GetSwizzle() == KD_TEX_SWIZ_111R)
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE_111R);
+      method = ShaderMethodGLES::SM_TEXTURE_111R;
     }
     else if (hasBlendColor)
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE);
+      method = ShaderMethodGLES::SM_TEXTURE;
     }
     else
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE_NOBLEND);
+      method = ShaderMethodGLES::SM_TEXTURE_NOBLEND;
     }
-
-    texture->BindToUnit(0);
+    m_state.shader = static_cast<int>(method);
+    m_state.texture0 = textureID;
   }
 
-  if ( hasAlpha )
-  {
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
-    glEnable( GL_BLEND );
-  }
-  else
-  {
-    glDisable(GL_BLEND);
-  }
-  m_packedVertices.clear();
+  m_state.blend = hasAlpha;
 }
 
 void CGUITextureGLES::End()
 {
-  if (!m_packedVertices.empty())
-  {
-    GLint posLoc  = m_renderSystem->GUIShaderGetPos();
-    GLint tex0Loc = m_renderSystem->GUIShaderGetCoord0();
-    GLint tex1Loc = m_renderSystem->GUIShaderGetCoord1();
-    GLint uniColLoc = m_renderSystem->GUIShaderGetUniCol();
-    GLint depthLoc = m_renderSystem->GUIShaderGetDepth();
-
-    if(uniColLoc >= 0)
-    {
-      glUniform4f(uniColLoc,(m_col[0] / 255.0f), (m_col[1] / 255.0f), (m_col[2] / 255.0f), (m_col[3] / 255.0f));
-    }
-
-    glUniform1f(depthLoc, m_depth);
-
-    if(m_diffuse.size())
-    {
-      if (m_texture.m_textures[m_currentFrame]->GetSwizzle() == KD_TEX_SWIZ_111R)
-        std::swap(tex0Loc, tex1Loc);
-      glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                            (char*)m_packedVertices.data() + offsetof(PackedVertex, u2));
-      glEnableVertexAttribArray(tex1Loc);
-    }
-    glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(PackedVertex),
-                          (char*)m_packedVertices.data() + offsetof(PackedVertex, x));
-    glEnableVertexAttribArray(posLoc);
-    glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                          (char*)m_packedVertices.data() + offsetof(PackedVertex, u1));
-    glEnableVertexAttribArray(tex0Loc);
-
-    glDrawElements(GL_TRIANGLES, m_packedVertices.size()*6 / 4, GL_UNSIGNED_SHORT, m_idx.data());
-
-    if (m_diffuse.size())
-      glDisableVertexAttribArray(tex1Loc);
-
-    glDisableVertexAttribArray(posLoc);
-    glDisableVertexAttribArray(tex0Loc);
-  }
-
-  if (m_diffuse.size())
-    glActiveTexture(GL_TEXTURE0);
-  glEnable(GL_BLEND);
-  m_renderSystem->DisableGUIShader();
+  // the quads are drawn by the render system, together with those of other textures sharing
+  // their state
 }
 
 void CGUITextureGLES::Draw(float *x, float *y, float *z, const CRect &texture, const CRect &diffuse, int orientation)
 {
-  PackedVertex vertices[4];
+  CGUIRenderBatch::Vertex vertices[4];
 
   // Setup texture coordinates
   //TopLeft
@@ -256,19 +218,15 @@ void CGUITextureGLES::Draw(float *x, float *y, float *z, const CRect &texture, c
     vertices[i].x = x[i];
     vertices[i].y = y[i];
     vertices[i].z = z[i];
-    m_packedVertices.push_back(vertices[i]);
+    // the texture is bound to the unit of the diffuse and the other way round
+    if (m_swapUnits)
+    {
+      std::swap(vertices[i].u1, vertices[i].u2);
+      std::swap(vertices[i].v1, vertices[i].v2);
+    }
   }
 
-  if ((m_packedVertices.size() / 4) > (m_idx.size() / 6))
-  {
-    size_t i = m_packedVertices.size() - 4;
-    m_idx.push_back(i+0);
-    m_idx.push_back(i+1);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+3);
-    m_idx.push_back(i+0);
-  }
+  m_renderSystem->AddBatchedQuad(m_state, vertices);
 }
 
 void CGUITextureGLES::DrawQuad(const CRect& rect,
@@ -279,6 +237,7 @@ void CGUITextureGLES::DrawQuad(const CRect& rect,
                                const bool blending)
 {
   CRenderSystemGLES *renderSystem = dynamic_cast<CRenderSystemGLES*>(CServiceBroker::GetRenderSystem());
+  renderSystem->FlushBatchedDraws();
   if (texture)
   {
     texture->LoadToGPU();
@@ -345,6 +304,7 @@ void CGUITextureGLES::DrawQuad(const CRect& rect,
     tex[2][1] = tex[3][1] = coords.y2;
   }
   glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_BYTE, idx);
+  renderSystem->AddDrawCalls(1);
 
   glDisableVertexAttribArray(posLoc);
   if (texture)
@@ -8,22 +8,12 @@
 
 #pragma once
 
+#include "GUIRenderBatch.h"
 #include "GUITexture.h"
 #include "utils/ColorUtils.h"
 
-#include <array>
-#include <vector>
-
 #include "system_gl.h"
 
-struct PackedVertex
-{
-  float x, y, z;
-  float u1, v1;
-  float u2, v2;
-};
-typedef std::vector<PackedVertex> PackedVertices;
-
 class CRenderSystemGLES;
 
 class CGUITextureGLES : public CGUITexture
@@ -53,10 +43,8 @@ protected:
 private:
   CGUITextureGLES(const CGUITextureGLES& texture) = default;
 
-  std::array<GLubyte, 4> m_col;
-
-  PackedVertices m_packedVertices;
-  std::vector<GLushort> m_idx;
+  CGUIRenderBatch::State m_state;
+  bool m_swapUnits{false};
   CRenderSystemGLES *m_renderSystem;
   bool m_isGLES20{true};
 };
@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIWaveformControl.h"
+
+#include "GUITexture.h"
+#include "ServiceBroker.h"
+#include "application/ApplicationComponents.h"
+#include "application/ApplicationPlayer.h"
+#include "cores/AudioEngine/Interfaces/AE.h"
+#include "cores/AudioEngine/Utils/AEVisualizationAnalyzer.h"
+#include "utils/StringUtils.h"
+#include "windowing/GraphicContext.h"
+#include "windowing/WinSystem.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace KODI::GUILIB;
+
+namespace
+{
+
+// bars are this wide in skin pixels, including the gap to the next one
+constexpr float BAR_STEP = 3.0f;
+
+} // namespace
+
+CGUIWaveformControl::CGUIWaveformControl(int parentID,
+                                         int controlID,
+                                         float posX,
+                                         float posY,
+                                         float width,
+                                         float height,
+                                         Mode mode,
+                                         const GUIINFO::CGUIInfoColor& waveColor,
+                                         const GUIINFO::CGUIInfoColor& playedColor)
+  : CGUIControl(parentID, controlID, posX, posY, width, height),
+    m_mode(mode),
+    m_waveColor(waveColor),
+    m_playedColor(playedColor)
+{
+  ControlType = GUICONTROL_WAVEFORM;
+}
+
+CGUIWaveformControl::CGUIWaveformControl(const CGUIWaveformControl& from)
+  : CGUIControl(from),
+    m_mode(from.m_mode),
+    m_waveColor(from.m_waveColor),
+    m_playedColor(from.m_playedColor)
+{
+  ControlType = GUICONTROL_WAVEFORM;
+}
+
+CGUIWaveformControl::~CGUIWaveformControl()
+{
+  FreeResources(true);
+}
+
+CGUIWaveformControl::Mode CGUIWaveformControl::TranslateMode(const std::string& mode)
+{
+  if (StringUtils::EqualsNoCase(mode, "waveform"))
+    return Mode::WAVEFORM;
+  if (StringUtils::EqualsNoCase(mode, "spectrum"))
+    return Mode::SPECTRUM;
+  return Mode::TRACK;
+}
+
+void CGUIWaveformControl::AllocResources()
+{
+  CGUIControl::AllocResources();
+
+  // the engine only analyses what is heard while somebody shows it
+  if (m_mode != Mode::TRACK && !m_registered)
+  {
+    IAE* ae = CServiceBroker::GetActiveAE();
+    if (ae)
+    {
+      ae->RegisterVisualizationConsumer();
+      m_registered = true;
+    }
+  }
+}
+
+void CGUIWaveformControl::FreeResources(bool immediately)
+{
+  if (m_registered)
+  {
+    IAE* ae = CServiceBroker::GetActiveAE();
+    if (ae)
+      ae->UnregisterVisualizationConsumer();
+    m_registered = false;
+  }
+  m_values.clear();
+  m_bars.clear();
+
+  CGUIControl::FreeResources(immediately);
+}
+
+bool CGUIWaveformControl::UpdateValues()
+{
+  if (m_mode == Mode::TRACK)
+  {
+    const auto& appPlayer = CServiceBroker::GetAppComponents().GetComponent<CApplicationPlayer>();
+    if (!appPlayer->IsPlayingAudio() || !appPlayer->GetWaveform(m_values))
+      return false;
+
+    const unsigned int bars = std::min(static_cast<unsigned int>(m_values.size()),
+                                       std::max(1u, static_cast<unsigned int>(m_width / BAR_STEP)));
+    m_playedBars = static_cast<unsigned int>(std::lround(appPlayer->GetPercentage() / 100.0f * bars));
+    return true;
+  }
+
+  AEVisualizationFrame frame;
+  IAE* ae = CServiceBroker::GetActiveAE();
+  if (!ae || !ae->GetVisualizationFrame(frame))
+    return false;
+
+  m_values = m_mode == Mode::WAVEFORM ? std::move(frame.waveform) : std::move(frame.spectrum);
+  return true;
+}
+
+void CGUIWaveformControl::Process(unsigned int currentTime, CDirtyRegionList& dirtyregions)
+{
+  std::vector<float> bars;
+  const unsigned int playedBars = m_playedBars;
+  if (UpdateValues() && !m_values.empty())
+  {
+    // never more bars than fit, each one is the loudest of the values it covers
+    const size_t count =
+        std::min(m_values.size(), std::max<size_t>(1, static_cast<size_t>(m_width / BAR_STEP)));
+    bars.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      const size_t first = i * m_values.size() / count;
+      const size_t last = std::max(first + 1, (i + 1) * m_values.size() / count);
+      bars[i] = std::clamp(*std::max_element(m_values.begin() + first, m_values.begin() + last),
+                           0.0f, 1.0f);
+    }
+  }
+  else
+  {
+    m_playedBars = 0;
+  }
+
+  if (bars != m_bars || playedBars != m_playedBars)
+  {
+    m_bars = std::move(bars);
+    MarkDirtyRegion();
+  }
+
+  CGUIControl::Process(currentTime, dirtyregions);
+}
+
+void CGUIWaveformControl::Render()
+{
+  if (!m_bars.empty())
+  {
+    CGraphicContext& context = CServiceBroker::GetWinSystem()->GetGfxContext();
+    const KODI::UTILS::COLOR::Color waveColor = context.MergeAlpha(m_waveColor);
+    const KODI::UTILS::COLOR::Color playedColor = context.MergeAlpha(m_playedColor);
+
+    const float step = m_width / m_bars.size();
+    const float barWidth = std::max(step * 2.0f / 3.0f, 1.0f);
+    const float centre = m_posY + m_height / 2.0f;
+    const float bottom = m_posY + m_height;
+
+    for (size_t i = 0; i < m_bars.size(); ++i)
+    {
+      const float x = m_posX + i * step;
+      const float height = std::max(m_bars[i] * m_height, 1.0f);
+
+      // waveforms are symmetric around the middle, spectrum bands grow from the bottom
+      CRect rect = m_mode == Mode::SPECTRUM
+                       ? CRect(x, bottom - height, x + barWidth, bottom)
+                       : CRect(x, centre - height / 2.0f, x + barWidth, centre + height / 2.0f);
+
+      CGUITexture::DrawQuad(context.GenerateAABB(rect), i < m_playedBars ? playedColor : waveColor);
+    }
+  }
+
+  CGUIControl::Render();
+}
+
+bool CGUIWaveformControl::UpdateColors(const CGUIListItem* item)
+{
+  bool changed = CGUIControl::UpdateColors(item);
+  changed |= m_waveColor.Update(item);
+  changed |= m_playedColor.Update(item);
+  return changed;
+}
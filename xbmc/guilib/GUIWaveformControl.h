@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+/*!
+\file GUIWaveformControl.h
+\brief
+*/
+
+#include "GUIControl.h"
+#include "guilib/guiinfo/GUIInfoColor.h"
+
+#include <string>
+#include <vector>
+
+/*!
+ \ingroup controls
+ \brief Draws the waveform of the playing song, or the waveform or spectrum of what is heard.
+
+ Nothing is analysed here: the whole song comes from the player, which caches it, and the
+ live modes poll the analysis the audio engine does once for all controls.
+ */
+class CGUIWaveformControl : public CGUIControl
+{
+public:
+  enum class Mode
+  {
+    TRACK, //!< peaks of the whole song, the part played in another color
+    WAVEFORM, //!< peaks of the last seconds heard
+    SPECTRUM, //!< levels of the frequency bands heard
+  };
+
+  CGUIWaveformControl(int parentID,
+                      int controlID,
+                      float posX,
+                      float posY,
+                      float width,
+                      float height,
+                      Mode mode,
+                      const KODI::GUILIB::GUIINFO::CGUIInfoColor& waveColor,
+                      const KODI::GUILIB::GUIINFO::CGUIInfoColor& playedColor);
+  CGUIWaveformControl(const CGUIWaveformControl& from);
+  ~CGUIWaveformControl() override;
+  CGUIWaveformControl* Clone() const override { return new CGUIWaveformControl(*this); }
+
+  void AllocResources() override;
+  void FreeResources(bool immediately = false) override;
+  void Process(unsigned int currentTime, CDirtyRegionList& dirtyregions) override;
+  void Render() override;
+  bool CanFocus() const override { return false; }
+
+  static Mode TranslateMode(const std::string& mode);
+
+protected:
+  bool UpdateColors(const CGUIListItem* item) override;
+
+private:
+  bool UpdateValues();
+
+  Mode m_mode;
+  KODI::GUILIB::GUIINFO::CGUIInfoColor m_waveColor;
+  KODI::GUILIB::GUIINFO::CGUIInfoColor m_playedColor;
+
+  std::vector<float> m_values;
+  std::vector<float> m_bars;
+  unsigned int m_playedBars = 0;
+  bool m_registered = false;
+};
@@ -26,16 +26,61 @@
 #include "settings/SettingsComponent.h"
 #include "threads/SingleLock.h"
 #include "utils/ColorUtils.h"
+#include "utils/ExecString.h"
 #include "utils/StringUtils.h"
 #include "utils/TimeUtils.h"
 #include "utils/Variant.h"
 #include "utils/XMLUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <mutex>
 
 using namespace KODI;
 
+namespace
+{
+// the first windows the actions of a window open are preloaded, they're likely its menu
+constexpr size_t MAX_LINKED_WINDOWS = 8;
+
+void FindLinkedWindows(const TiXmlElement* element, std::vector<int>& windows)
+{
+  for (const TiXmlElement* child = element->FirstChildElement();
+       child && windows.size() < MAX_LINKED_WINDOWS; child = child->NextSiblingElement())
+  {
+    if (!StringUtils::StartsWith(child->ValueStr(), "on"))
+    {
+      FindLinkedWindows(child, windows);
+      continue;
+    }
+    if (!child->FirstChild() || !child->FirstChild()->ToText())
+      continue;
+
+    std::string action = child->FirstChild()->ValueStr();
+    StringUtils::Trim(action);
+    if (!StringUtils::StartsWithNoCase(action, "activatewindow") &&
+        !StringUtils::StartsWithNoCase(action, "replacewindow"))
+      continue;
+
+    const CExecString exec(action);
+    if (exec.GetParams().empty())
+      continue;
+    const int window = CWindowTranslator::TranslateWindow(exec.GetParams()[0]);
+    if (window != WINDOW_INVALID &&
+        std::find(windows.begin(), windows.end(), window) == windows.end())
+      windows.emplace_back(window);
+  }
+}
+
+void PreloadLinkedWindows(const TiXmlElement* rootElement)
+{
+  std::vector<int> windows;
+  FindLinkedWindows(rootElement, windows);
+  for (int id : windows)
+    CServiceBroker::GetGUI()->GetWindowManager().PreloadWindowXML(id);
+}
+} // unnamed namespace
+
 bool CGUIWindow::icompare::operator()(const std::string &s1, const std::string &s2) const
 {
   return StringUtils::CompareNoCase(s1, s2) < 0;
@@ -95,16 +140,7 @@ bool CGUIWindow::Load(const std::string& strFileName, bool bContainsPath)
   // Find appropriate skin folder + resolution to load from
   std::string strPath;
   std::string strLowerPath;
-  if (bContainsPath)
-    strPath = strFileName;
-  else
-  {
-    // FIXME: strLowerPath needs to eventually go since resToUse can get incorrectly overridden
-    std::string strFileNameLower = strFileName;
-    StringUtils::ToLower(strFileNameLower);
-    strLowerPath =  g_SkinInfo->GetSkinPath(strFileNameLower, &m_coordsRes);
-    strPath = g_SkinInfo->GetSkinPath(strFileName, &m_coordsRes);
-  }
+  GetXMLPath(strFileName, bContainsPath, strPath, strLowerPath, m_coordsRes);
 
   bool ret = LoadXML(strPath, strLowerPath);
   if (ret)
@@ -122,24 +158,58 @@ bool CGUIWindow::Load(const std::string& strFileName, bool bContainsPath)
   return ret;
 }
 
+void CGUIWindow::PreloadXML()
+{
+  if (m_windowXMLRootElement || !g_SkinInfo)
+    return;
+
+  const std::string xmlFile = GetProperty("xmlfile").asString();
+  if (xmlFile.empty())
+    return;
+
+  std::string strPath;
+  std::string strLowerPath;
+  RESOLUTION_INFO res;
+  const bool bHasPath =
+      xmlFile.find('\\') != std::string::npos || xmlFile.find('/') != std::string::npos;
+  GetXMLPath(xmlFile, bHasPath, strPath, strLowerPath, res);
+  CServiceBroker::GetGUI()->GetWindowManager().GetXMLCache().Preload(strPath, strLowerPath);
+}
+
+void CGUIWindow::GetXMLPath(const std::string& strFileName,
+                            bool bContainsPath,
+                            std::string& strPath,
+                            std::string& strLowerPath,
+                            RESOLUTION_INFO& res)
+{
+  if (bContainsPath)
+    strPath = strFileName;
+  else
+  {
+    // FIXME: strLowerPath needs to eventually go since resToUse can get incorrectly overridden
+    std::string strFileNameLower = strFileName;
+    StringUtils::ToLower(strFileNameLower);
+    strLowerPath = g_SkinInfo->GetSkinPath(strFileNameLower, &res);
+    strPath = g_SkinInfo->GetSkinPath(strFileName, &res);
+  }
+}
+
 bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLowerPath)
 {
+  CGUIWindowXMLCache& xmlCache = CServiceBroker::GetGUI()->GetWindowManager().GetXMLCache();
+
   // load window xml if we don't have it stored yet
   if (!m_windowXMLRootElement)
   {
-    CXBMCTinyXML xmlDoc;
-    std::string strPathLower = strPath;
-    StringUtils::ToLower(strPathLower);
-    if (!xmlDoc.LoadFile(strPath) && !xmlDoc.LoadFile(strPathLower) && !xmlDoc.LoadFile(strLowerPath))
+    std::shared_ptr<const TiXmlElement> rootElement = xmlCache.Get(strPath, strLowerPath);
+    if (!rootElement)
     {
-      CLog::Log(LOGERROR, "Unable to load window XML: {}. Line {}\n{}", strPath, xmlDoc.ErrorRow(),
-                xmlDoc.ErrorDesc());
       SetID(WINDOW_INVALID);
       return false;
     }
 
     // xml need a <window> root element
-    if (!StringUtils::EqualsNoCase(xmlDoc.RootElement()->Value(), "window"))
+    if (!StringUtils::EqualsNoCase(rootElement->Value(), "window"))
     {
       CLog::Log(LOGERROR, "XML file {} does not contain a <window> root element",
                 GetProperty("xmlfile").asString());
@@ -147,15 +217,38 @@ bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLower
     }
 
     // store XML for further processing if window's load type is LOAD_EVERY_TIME or a reload is needed
-    m_windowXMLRootElement.reset(static_cast<TiXmlElement*>(xmlDoc.RootElement()->Clone()));
+    m_windowXMLRootElement = std::move(rootElement);
+    m_windowXMLPath = strPath;
+
+    // take back the prepared xml a window loaded every time left when it was closed
+    CGUIWindowXMLCache::PreparedFile prepared =
+        xmlCache.TakePrepared(strPath, m_windowXMLRootElement);
+    m_preparedXMLRootElement = std::move(prepared.root);
+    if (m_preparedXMLRootElement)
+      m_xmlIncludeConditions = std::move(prepared.includeConditions);
   }
   else
     CLog::Log(LOGDEBUG, "Using already stored xml root node for {}", strPath);
 
-  return Load(Prepare(m_windowXMLRootElement).get());
+  // the includes resolve to the same XML as long as their conditions keep their values
+  if (!m_preparedXMLRootElement ||
+      CServiceBroker::GetGUI()->GetInfoManager().ConditionsChangedValues(m_xmlIncludeConditions))
+  {
+    m_preparedXMLRootElement = Prepare(m_windowXMLRootElement);
+    PreloadLinkedWindows(m_preparedXMLRootElement.get());
+  }
+
+  const bool loaded = Load(m_preparedXMLRootElement.get());
+
+  // other windows prepare their xml again anyway when they are reloaded
+  if (m_loadType != LOAD_EVERY_TIME)
+    m_preparedXMLRootElement.reset();
+
+  return loaded;
 }
 
-std::unique_ptr<TiXmlElement> CGUIWindow::Prepare(const std::unique_ptr<TiXmlElement>& rootElement)
+std::unique_ptr<TiXmlElement> CGUIWindow::Prepare(
+    const std::shared_ptr<const TiXmlElement>& rootElement)
 {
   if (!rootElement)
     return nullptr;
@@ -795,11 +888,17 @@ void CGUIWindow::FreeResources(bool forceUnload /*= false */)
   m_bAllocated = false;
   CGUIControlGroup::FreeResources();
   //CServiceBroker::GetGUI()->GetTextureManager().Dump();
-  // unload the skin
-  if (m_loadType == LOAD_EVERY_TIME || forceUnload) ClearAll();
-  if (forceUnload)
+  // unload the skin, windows loaded every time leave their xml to the window XML cache
+  if (m_loadType == LOAD_EVERY_TIME || forceUnload)
   {
+    ClearAll();
+    CGUIComponent* gui = CServiceBroker::GetGUI();
+    if (!forceUnload && m_preparedXMLRootElement && gui)
+      gui->GetWindowManager().GetXMLCache().KeepPrepared(
+          m_windowXMLPath, m_windowXMLRootElement,
+          {std::move(m_preparedXMLRootElement), std::move(m_xmlIncludeConditions)});
     m_windowXMLRootElement.reset();
+    m_preparedXMLRootElement.reset();
     m_xmlIncludeConditions.clear();
   }
 }
@@ -1038,7 +1137,11 @@ void CGUIWindow::DumpTextureUse()
 void CGUIWindow::SetProperty(const std::string &strKey, const CVariant &value)
 {
   std::unique_lock<CCriticalSection> lock(*this);
-  m_mapProperties[strKey] = value;
+  CVariant& property = m_mapProperties[strKey];
+  if (property == value)
+    return;
+  property = value;
+  CServiceBroker::GetGUI()->GetInfoManager().InvalidateInfos(INFO::InfoSource::WINDOW_PROPERTIES);
 }
 
 CVariant CGUIWindow::GetProperty(const std::string &strKey) const
@@ -1054,7 +1157,10 @@ CVariant CGUIWindow::GetProperty(const std::string &strKey) const
 void CGUIWindow::ClearProperties()
 {
   std::unique_lock<CCriticalSection> lock(*this);
+  if (m_mapProperties.empty())
+    return;
   m_mapProperties.clear();
+  CServiceBroker::GetGUI()->GetInfoManager().InvalidateInfos(INFO::InfoSource::WINDOW_PROPERTIES);
 }
 
 void CGUIWindow::SetRunActionsManually()
@@ -65,6 +65,11 @@ public:
   bool Initialize();  // loads the window
   bool Load(const std::string& strFileName, bool bContainsPath = false);
 
+  /*! \brief Parse the window XML in the background, so the window opens faster
+   Does nothing if the window has its XML already.
+   */
+  void PreloadXML();
+
   void CenterWindow();
 
   void DoProcess(unsigned int currentTime, CDirtyRegionList &dirtyregions) override;
@@ -212,7 +217,8 @@ protected:
    \param rootElement the original XML element
    \return the prepared XML (resolved includes, constants and expression)
    */
-  virtual std::unique_ptr<TiXmlElement> Prepare(const std::unique_ptr<TiXmlElement>& rootElement);
+  virtual std::unique_ptr<TiXmlElement> Prepare(
+      const std::shared_ptr<const TiXmlElement>& rootElement);
 
   /*!
    \brief Check if window needs a (re)load. The window need to be (re)loaded when window is not loaded or include conditions values were changed
@@ -238,6 +244,18 @@ protected:
 
   void LoadControl(TiXmlElement* pControl, CGUIControlGroup *pGroup, const CRect &rect);
 
+  /*! \brief Find the window XML of the current skin
+   \param strFileName the file name of the window XML, or its path if bContainsPath is set
+   \param strPath [out] the path to the window XML
+   \param strLowerPath [out] a lowered path to the window XML
+   \param res [out] the resolution that the window coordinates are in
+   */
+  static void GetXMLPath(const std::string& strFileName,
+                         bool bContainsPath,
+                         std::string& strPath,
+                         std::string& strLowerPath,
+                         RESOLUTION_INFO& res);
+
   std::vector<int> m_idRange;
   RESOLUTION_INFO m_coordsRes; // resolution that the window coordinates are in.
   bool m_needsScaling;
@@ -272,10 +290,18 @@ protected:
   CGUIAction m_loadActions;
   CGUIAction m_unloadActions;
 
+  /*! \brief window root xml definition, shared with the window XML cache.
+    Stored to avoid parsing the XML every time the window is loaded, released when a window loaded
+    every time is closed.
+   */
+  std::shared_ptr<const TiXmlElement> m_windowXMLRootElement;
+  std::string m_windowXMLPath; ///< \brief path the root xml definition was requested with
+
   /*! \brief window root xml definition after resolving any skin includes.
-    Stored to avoid parsing the XML every time the window is loaded.
+    Only kept by windows loaded every time, which leave it to the window XML cache while they are
+    closed and reuse it as long as the include conditions keep their values.
    */
-  std::unique_ptr<TiXmlElement> m_windowXMLRootElement;
+  std::unique_ptr<TiXmlElement> m_preparedXMLRootElement;
 
   bool m_manualRunActions;
 
@@ -10,6 +10,7 @@
 
 #include "GUIAudioManager.h"
 #include "GUIDialog.h"
+#include "GUIFrameProfiler.h"
 #include "GUIInfoManager.h"
 #include "GUIPassword.h"
 #include "GUITexture.h"
@@ -1214,6 +1215,7 @@ bool RenderOrderSortFunction(CGUIWindow *first, CGUIWindow *second)
 void CGUIWindowManager::Process(unsigned int currentTime)
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
+  CGUIFrameProfiler::CScope scope("WindowManager::Process", "gui");
   std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
   m_dirtyregions.clear();
@@ -1350,6 +1352,7 @@ void CGUIWindowManager::RenderEx() const
 bool CGUIWindowManager::Render()
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
+  CGUIFrameProfiler::CScope scope("WindowManager::Render", "gui");
   CSingleExit lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
   int bufferAge = CServiceBroker::GetWinSystem()->GetBufferAge();
@@ -1373,6 +1376,8 @@ bool CGUIWindowManager::Render()
   {
     RenderPass();
     hasRendered = true;
+    m_tracker.UpdateStats(CDirtyRegionList(
+        1, CDirtyRegion(CServiceBroker::GetWinSystem()->GetGfxContext().GetViewWindow())));
   }
   else if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions == DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE)
   {
@@ -1381,6 +1386,7 @@ bool CGUIWindowManager::Render()
       RenderPass();
       hasRendered = true;
     }
+    m_tracker.UpdateStats(dirtyRegions);
   }
   else
   {
@@ -1397,6 +1403,7 @@ bool CGUIWindowManager::Render()
       hasRendered = true;
     }
     CServiceBroker::GetWinSystem()->GetGfxContext().ResetScissors();
+    m_tracker.UpdateStats(dirtyRegions);
   }
 
   if (visualizeDirtyRegions)
@@ -1485,6 +1492,13 @@ CGUIWindow* CGUIWindowManager::GetWindow(int id) const
   return nullptr;
 }
 
+void CGUIWindowManager::PreloadWindowXML(int id) const
+{
+  CGUIWindow* window = GetWindow(id);
+  if (window)
+    window->PreloadXML();
+}
+
 bool CGUIWindowManager::ProcessRenderLoop(bool renderOnly)
 {
   bool renderGui = true;
@@ -10,6 +10,7 @@
 
 #include "DirtyRegionTracker.h"
 #include "GUIWindow.h"
+#include "GUIWindowXMLCache.h"
 #include "IMsgTargetCallback.h"
 #include "IWindowManagerCallback.h"
 #include "guilib/WindowIDs.h"
@@ -107,6 +108,10 @@ public:
 
   void RenderEx() const;
 
+  /*! \brief The number of render passes and the pixels redrawn by the last Render()
+   */
+  DirtyRegionStats GetDirtyRegionStats() const { return m_tracker.GetStats(); }
+
   /*! \brief Do any post render activities.
    */
   void AfterRender();
@@ -168,6 +173,17 @@ public:
    */
   CGUIDialog* GetDialog(int id) const;
 
+  /*! \brief Parse the XML of the window with the given id in the background, if the window has
+   * not loaded it yet.
+   *
+   * \param id the window id
+   */
+  void PreloadWindowXML(int id) const;
+
+  /*! \brief The parsed window XML files of the skin, shared by all windows
+   */
+  CGUIWindowXMLCache& GetXMLCache() { return m_xmlCache; }
+
   void SetCallback(IWindowManagerCallback& callback);
   void DeInitialize();
 
@@ -289,4 +305,5 @@ private:
 
   CDirtyRegionList m_dirtyregions;
   CDirtyRegionTracker m_tracker;
+  CGUIWindowXMLCache m_xmlCache;
 };
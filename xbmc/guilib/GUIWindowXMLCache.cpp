@@ -0,0 +1,222 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIWindowXMLCache.h"
+
+#include "ServiceBroker.h"
+#include "addons/AddonVersion.h"
+#include "addons/Skin.h"
+#include "filesystem/File.h"
+#include "utils/JobManager.h"
+#include "utils/StringUtils.h"
+#include "utils/XBMCTinyXML.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+CGUIWindowXMLCache::CGUIWindowXMLCache(size_t maxFiles) : m_maxFiles(std::max<size_t>(maxFiles, 1))
+{
+}
+
+CGUIWindowXMLCache::~CGUIWindowXMLCache()
+{
+  CancelJobs();
+}
+
+std::shared_ptr<const TiXmlElement> CGUIWindowXMLCache::Get(const std::string& path,
+                                                            const std::string& lowerPath)
+{
+  CachedFile cached;
+  {
+    std::unique_lock lock(m_critSection);
+    UpdateSkin();
+    const auto it = m_entries.find(path);
+    if (it != m_entries.end())
+    {
+      it->second.lastUse = ++m_uses;
+      cached = it->second.file;
+    }
+  }
+
+  if (cached.root && !IsModified(cached))
+    return cached.root;
+
+  // a file still parsed in the background is parsed again, the window is needed now
+  CachedFile file;
+  if (!LoadFile(path, lowerPath, file))
+    return nullptr;
+
+  std::unique_lock lock(m_critSection);
+  Entry& entry = Use(path);
+  if (entry.jobID)
+    CServiceBroker::GetJobManager()->CancelJob(entry.jobID);
+  entry.jobID = 0;
+  entry.file = file;
+  entry.prepared = {};
+  return file.root;
+}
+
+void CGUIWindowXMLCache::Preload(const std::string& path, const std::string& lowerPath)
+{
+  std::unique_lock lock(m_critSection);
+  UpdateSkin();
+  Entry& entry = Use(path);
+  if (entry.file.root || entry.jobID)
+    return;
+
+  CLog::Log(LOGDEBUG, "Preloading skin file: {}", path);
+  entry.jobID = CServiceBroker::GetJobManager()->AddJob(new CLoadJob(path, lowerPath), this,
+                                                        CJob::PRIORITY_LOW);
+}
+
+void CGUIWindowXMLCache::KeepPrepared(const std::string& path,
+                                      const std::shared_ptr<const TiXmlElement>& root,
+                                      PreparedFile prepared)
+{
+  std::unique_lock lock(m_critSection);
+  const auto it = m_entries.find(path);
+  if (it == m_entries.end() || it->second.file.root != root)
+    return;
+
+  it->second.lastUse = ++m_uses;
+  it->second.prepared = std::move(prepared);
+}
+
+CGUIWindowXMLCache::PreparedFile CGUIWindowXMLCache::TakePrepared(
+    const std::string& path, const std::shared_ptr<const TiXmlElement>& root)
+{
+  std::unique_lock lock(m_critSection);
+  const auto it = m_entries.find(path);
+  if (it == m_entries.end() || it->second.file.root != root)
+    return {};
+
+  return std::exchange(it->second.prepared, {});
+}
+
+void CGUIWindowXMLCache::Clear()
+{
+  std::unique_lock lock(m_critSection);
+  CancelJobs();
+  m_entries.clear();
+}
+
+void CGUIWindowXMLCache::OnJobComplete(unsigned int jobID, bool success, CJob* job)
+{
+  std::unique_lock lock(m_critSection);
+  CLoadJob* loadJob = static_cast<CLoadJob*>(job);
+  const auto it = m_entries.find(loadJob->m_path);
+  // cleared, or loaded by Get() in the meantime
+  if (it == m_entries.end() || it->second.jobID != jobID)
+    return;
+
+  if (success)
+  {
+    it->second.file = loadJob->m_file;
+    it->second.jobID = 0;
+  }
+  else
+    m_entries.erase(it);
+}
+
+CGUIWindowXMLCache::Entry& CGUIWindowXMLCache::Use(const std::string& path)
+{
+  Entry& entry = m_entries[path];
+  entry.lastUse = ++m_uses;
+
+  // drop the least recently used files, windows still hold on to the files they use
+  while (m_entries.size() > m_maxFiles)
+  {
+    const auto oldest =
+        std::min_element(m_entries.begin(), m_entries.end(), [](const auto& a, const auto& b)
+                         { return a.second.lastUse < b.second.lastUse; });
+    if (oldest->second.jobID)
+      CServiceBroker::GetJobManager()->CancelJob(oldest->second.jobID);
+    m_entries.erase(oldest);
+  }
+  return entry;
+}
+
+void CGUIWindowXMLCache::UpdateSkin()
+{
+  std::string skin;
+  if (g_SkinInfo)
+    skin = g_SkinInfo->ID() + " " + g_SkinInfo->Version().asString();
+  if (skin == m_skin)
+    return;
+
+  CancelJobs();
+  m_entries.clear();
+  m_skin = skin;
+}
+
+void CGUIWindowXMLCache::CancelJobs()
+{
+  for (auto& [path, entry] : m_entries)
+  {
+    if (entry.jobID)
+      CServiceBroker::GetJobManager()->CancelJob(entry.jobID);
+    entry.jobID = 0;
+  }
+}
+
+bool CGUIWindowXMLCache::LoadFile(const std::string& path,
+                                  const std::string& lowerPath,
+                                  CachedFile& file)
+{
+  CXBMCTinyXML xmlDoc;
+  std::string pathLower = path;
+  StringUtils::ToLower(pathLower);
+  if (xmlDoc.LoadFile(path))
+    file.path = path;
+  else if (xmlDoc.LoadFile(pathLower))
+    file.path = pathLower;
+  else if (xmlDoc.LoadFile(lowerPath))
+    file.path = lowerPath;
+  else
+  {
+    CLog::Log(LOGERROR, "Unable to load window XML: {}. Line {}\n{}", path, xmlDoc.ErrorRow(),
+              xmlDoc.ErrorDesc());
+    return false;
+  }
+
+  if (!xmlDoc.RootElement())
+  {
+    CLog::Log(LOGERROR, "Window XML {} has no root element", file.path);
+    return false;
+  }
+
+  file.root.reset(static_cast<TiXmlElement*>(xmlDoc.RootElement()->Clone()));
+
+  struct __stat64 buffer;
+  if (XFILE::CFile::Stat(file.path, &buffer) == 0)
+  {
+    file.modified = buffer.st_mtime;
+    file.size = buffer.st_size;
+  }
+  return true;
+}
+
+bool CGUIWindowXMLCache::IsModified(const CachedFile& file)
+{
+  struct __stat64 buffer;
+  if (XFILE::CFile::Stat(file.path, &buffer) != 0)
+    return true;
+  return buffer.st_mtime != file.modified || buffer.st_size != file.size;
+}
+
+CGUIWindowXMLCache::CLoadJob::CLoadJob(const std::string& path, const std::string& lowerPath)
+  : m_path(path), m_lowerPath(lowerPath)
+{
+}
+
+bool CGUIWindowXMLCache::CLoadJob::DoWork()
+{
+  return LoadFile(m_path, m_lowerPath, m_file);
+}
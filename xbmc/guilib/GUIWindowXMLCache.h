@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "interfaces/info/InfoBool.h"
+#include "threads/CriticalSection.h"
+#include "utils/Job.h"
+
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <string>
+
+class TiXmlElement;
+
+/*!
+ \ingroup winman
+ \brief Cache of the parsed window XML files of the skin
+
+ A file is parsed once and shared by the windows loading it, until the skin or its version changes
+ or the file is modified, so skin reloads and windows loaded every time they are opened don't read
+ and parse their file again. Files can be parsed in the background before the window is opened.
+ Windows loaded every time leave their file with its includes resolved here while they are closed,
+ so it is reused as long as the include conditions keep their values. The least recently used
+ files are dropped beyond a maximum number of files.
+ */
+class CGUIWindowXMLCache : public IJobCallback
+{
+public:
+  static constexpr size_t MAX_FILES = 32;
+
+  struct PreparedFile
+  {
+    std::unique_ptr<TiXmlElement> root; ///< root element with the includes resolved
+    std::map<INFO::InfoPtr, bool> includeConditions; ///< conditions the includes depend on
+  };
+
+  /*!
+   \param maxFiles the number of files kept, those in use by windows are kept by the windows
+   */
+  explicit CGUIWindowXMLCache(size_t maxFiles = MAX_FILES);
+  ~CGUIWindowXMLCache() override;
+
+  /*!
+   \brief Get the root element of a window XML file, it is parsed if it isn't cached
+   \param path the path of the file
+   \param lowerPath the lowered path, tried after path and path in lower case
+   \return the root element, nullptr if the file can't be parsed
+   */
+  std::shared_ptr<const TiXmlElement> Get(const std::string& path, const std::string& lowerPath);
+
+  /*!
+   \brief Parse a window XML file in the background, if it isn't cached already
+   \sa Get()
+   */
+  void Preload(const std::string& path, const std::string& lowerPath);
+
+  /*!
+   \brief Keep the file of a closed window with its includes resolved, until it is opened again
+   \param root the root element it was prepared from, it is dropped if the file changed since
+   */
+  void KeepPrepared(const std::string& path,
+                    const std::shared_ptr<const TiXmlElement>& root,
+                    PreparedFile prepared);
+
+  /*!
+   \brief Take back the file kept by KeepPrepared()
+   \param root the root element returned by Get()
+   \return the prepared file, empty if none is kept for root
+   */
+  PreparedFile TakePrepared(const std::string& path,
+                            const std::shared_ptr<const TiXmlElement>& root);
+
+  void Clear();
+
+private:
+  struct CachedFile
+  {
+    std::shared_ptr<const TiXmlElement> root;
+    std::string path; ///< the path the file was parsed from
+    int64_t modified = 0;
+    int64_t size = 0;
+  };
+
+  struct Entry
+  {
+    CachedFile file;
+    PreparedFile prepared; ///< kept by a closed window, prepared from file.root
+    unsigned int jobID = 0; ///< set while the file is parsed in the background
+    uint64_t lastUse = 0;
+  };
+
+  class CLoadJob : public CJob
+  {
+  public:
+    CLoadJob(const std::string& path, const std::string& lowerPath);
+    bool DoWork() override;
+    const char* GetType() const override { return "windowxml"; }
+
+    std::string m_path;
+    std::string m_lowerPath;
+    CachedFile m_file;
+  };
+
+  void OnJobComplete(unsigned int jobID, bool success, CJob* job) override;
+
+  Entry& Use(const std::string& path);
+  void UpdateSkin();
+  void CancelJobs();
+
+  static bool LoadFile(const std::string& path, const std::string& lowerPath, CachedFile& file);
+  static bool IsModified(const CachedFile& file);
+
+  CCriticalSection m_critSection;
+  std::map<std::string, Entry> m_entries;
+  const size_t m_maxFiles;
+  uint64_t m_uses = 0;
+  std::string m_skin; ///< id and version of the skin the files belong to
+};
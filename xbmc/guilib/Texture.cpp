@@ -9,6 +9,7 @@
 #include "Texture.h"
 
 #include "DDSImage.h"
+#include "GUIFrameProfiler.h"
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "commons/ilog.h"
@@ -150,6 +151,8 @@ bool CTexture::LoadFromFileInternal(const std::string& texturePath,
                                     CAspectRatio::AspectRatio aspectRatio,
                                     const std::string& strMimeType)
 {
+  CGUIFrameProfiler::CScope scope("Texture::Load", "texture");
+
   if (URIUtils::HasExtension(texturePath, ".dds"))
   { // special case for DDS images
     CDDSImage image;
@@ -225,6 +228,8 @@ bool CTexture::LoadFromFileInMem(unsigned char* buffer,
                                  unsigned int idealHeight,
                                  CAspectRatio::AspectRatio aspectRatio)
 {
+  CGUIFrameProfiler::CScope scope("Texture::Load", "texture");
+
   if (!buffer || !size)
     return false;
 
@@ -14,6 +14,7 @@
 #include "addons/Skin.h"
 #include "games/GameServices.h"
 #include "guilib/GUIComponent.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUIListItem.h"
 #include "guilib/LocalizeStrings.h"
 #include "utils/StringUtils.h"
@@ -25,6 +26,12 @@
 
 using namespace KODI::GUILIB::GUIINFO;
 
+namespace
+{
+// labels are updated too often to record a span for every one
+CGUIFrameProfiler::CTotal updateTotal("InfoLabel::Update", "info");
+} // unnamed namespace
+
 CGUIInfoLabel::CGUIInfoLabel(const std::string &label, const std::string &fallback /*= ""*/, int context /*= 0*/)
 {
   SetLabel(label, fallback, context);
@@ -56,6 +63,22 @@ void CGUIInfoLabel::SetLabel(const std::string &label, const std::string &fallba
   Parse(label, m_infoLabel, context);
   Parse(fallback, m_infoFallback, context);
   m_fallback = fallback;
+  m_sources = GetSources();
+  m_stampValid = false;
+}
+
+INFO::InfoSourceMask CGUIInfoLabel::GetSources() const
+{
+  INFO::InfoSourceMask sources = 0;
+  for (const auto* portions : {&m_infoLabel, &m_infoFallback})
+  {
+    for (const auto& portion : *portions)
+    {
+      if (portion.GetInfo())
+        sources |= CServiceBroker::GetGUI()->GetInfoManager().GetInfoSources(portion.GetInfo());
+    }
+  }
+  return sources;
 }
 
 bool CGUIInfoLabel::LabelNeedsUpdate(int context,
@@ -84,9 +107,29 @@ const std::string& CGUIInfoLabel::GetLabel(int contextWindow,
                                            bool preferImage,
                                            std::string* fallback /*= NULL*/) const
 {
+  // the fallback parameter is written by the providers, so it needs the infos to be evaluated
+  const bool tracked = !(m_sources & INFO::ToMask(INFO::InfoSource::FRAME)) && !fallback;
+  unsigned int stamp = 0;
+  if (m_sources)
+  {
+    INFO::CInfoSourceTracker& tracker =
+        CServiceBroker::GetGUI()->GetInfoManager().GetInfoSourceTracker();
+    if (tracked)
+    {
+      stamp = tracker.GetStamp(m_sources);
+      if (!m_dirty && m_stampValid && stamp == m_stamp && preferImage == m_stampPreferImage)
+      {
+        tracker.CountLabel(false);
+        return CacheLabel(false);
+      }
+    }
+    tracker.CountLabel(true);
+  }
+
   bool needsUpdate = m_dirty;
   if (!m_infoLabel.empty())
   {
+    CGUIFrameProfiler::CTotalScope scope(updateTotal);
     needsUpdate |= LabelNeedsUpdate(contextWindow, preferImage, fallback, m_infoLabel);
   }
   else
@@ -100,6 +143,10 @@ const std::string& CGUIInfoLabel::GetLabel(int contextWindow,
         LabelNeedsUpdate(contextWindow, preferImage, fallback, m_infoFallback) && m_label.empty();
   }
 
+  m_stamp = stamp;
+  m_stampValid = m_sources && tracked;
+  m_stampPreferImage = preferImage;
+
   return CacheLabel(needsUpdate);
 }
 
@@ -130,6 +177,9 @@ const std::string& CGUIInfoLabel::GetItemLabel(const CGUIListItem* item,
                                                bool preferImages,
                                                std::string* fallback /*= nullptr */) const
 {
+  // the cached label is replaced by the one of the item
+  m_stampValid = false;
+
   bool needsUpdate = m_dirty;
   if (item->IsFileItem())
   {
@@ -14,6 +14,7 @@
 */
 
 #include "interfaces/info/Info.h"
+#include "interfaces/info/InfoSource.h"
 
 #include <functional>
 #include <string>
@@ -185,11 +186,21 @@ private:
                             std::string* fallback,
                             const std::vector<CInfoPortion>& infoPortion) const;
 
+  /*! \brief Gets the sources the info portions depend on, 0 if there are none
+   */
+  INFO::InfoSourceMask GetSources() const;
+
   mutable bool        m_dirty = false;
   mutable std::string m_label;
   mutable std::string m_fallback;
   std::vector<CInfoPortion> m_infoLabel;
   std::vector<CInfoPortion> m_infoFallback;
+
+  // labels depending on tracked sources only are not evaluated again until one of them changed
+  INFO::InfoSourceMask m_sources = 0;
+  mutable unsigned int m_stamp = 0;
+  mutable bool m_stampValid = false;
+  mutable bool m_stampPreferImage = false;
 };
 
 } // namespace KODI::GUILIB::GUIINFO
@@ -0,0 +1,157 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace KODI::GUILIB::GUIINFO
+{
+
+struct InfoMap
+{
+  std::string_view str{};
+  int val{0};
+};
+
+/*!
+ \brief Lookup of info names, a perfect hash built at compile time
+
+ Names are first hashed to a bucket, each bucket has a seed that mixes the hash of its names to
+ free slots of the table (hash and displace). A lookup is one hash of the name, one mix and one
+ comparison, the table is never written after it was built so it can be read from any thread.
+ */
+template<size_t N>
+class CInfoNameMap
+{
+public:
+  consteval explicit CInfoNameMap(const std::array<InfoMap, N>& map) : m_entries(map)
+  {
+    // group the entries by bucket, so the seeds of a bucket are only tried on its own names
+    std::array<uint32_t, N> hashes{};
+    std::array<uint16_t, BUCKETS + 1> starts{};
+    for (size_t i = 0; i < N; ++i)
+    {
+      hashes[i] = Hash(m_entries[i].str);
+      ++starts[(hashes[i] & (BUCKETS - 1)) + 1];
+    }
+    size_t largest = 0;
+    for (size_t bucket = 0; bucket < BUCKETS; ++bucket)
+    {
+      largest = std::max<size_t>(largest, starts[bucket + 1]);
+      starts[bucket + 1] += starts[bucket];
+    }
+    std::array<uint16_t, N> members{};
+    std::array<uint16_t, BUCKETS> ends{};
+    for (size_t bucket = 0; bucket < BUCKETS; ++bucket)
+      ends[bucket] = starts[bucket];
+    for (size_t i = 0; i < N; ++i)
+      members[ends[hashes[i] & (BUCKETS - 1)]++] = static_cast<uint16_t>(i);
+
+    // place the largest buckets first, while most slots are still free
+    for (size_t size = largest; size > 0; --size)
+    {
+      for (size_t bucket = 0; bucket < BUCKETS; ++bucket)
+      {
+        const uint16_t* first = members.data() + starts[bucket];
+        const uint16_t* last = members.data() + starts[bucket + 1];
+        if (static_cast<size_t>(last - first) == size)
+          Place(bucket, hashes, first, last);
+      }
+    }
+  }
+
+  /*!
+   \brief Find the entry of a name
+   \return the entry, nullptr if the name is unknown
+   */
+  constexpr const InfoMap* Find(std::string_view name) const
+  {
+    const uint32_t hash = Hash(name);
+    const uint16_t index = m_slots[Mix(hash, m_seeds[hash & (BUCKETS - 1)]) & (SLOTS - 1)];
+    if (index && m_entries[index - 1].str == name)
+      return &m_entries[index - 1];
+    return nullptr;
+  }
+
+private:
+  static constexpr size_t BUCKETS = std::bit_ceil(N / 2 + 1);
+  static constexpr size_t SLOTS = std::bit_ceil(N) * 2;
+
+  // FNV-1a
+  static constexpr uint32_t Hash(std::string_view name)
+  {
+    uint32_t hash = 2166136261u;
+    for (const char c : name)
+    {
+      hash ^= static_cast<unsigned char>(c);
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+
+  // murmur3 finalizer of the hash and the seed of its bucket
+  static constexpr uint32_t Mix(uint32_t hash, uint32_t seed)
+  {
+    hash ^= seed * 0x9e3779b9u;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    return hash ^ (hash >> 16);
+  }
+
+  consteval void Place(size_t bucket,
+                       const std::array<uint32_t, N>& hashes,
+                       const uint16_t* first,
+                       const uint16_t* last)
+  {
+    for (uint32_t seed = 1; seed < 1u << 20; ++seed)
+    {
+      const uint16_t* member = first;
+      for (; member != last; ++member)
+      {
+        uint16_t& slot = m_slots[Mix(hashes[*member], seed) & (SLOTS - 1)];
+        if (slot)
+        {
+          // names of the same hash can never be told apart by a seed
+          if (hashes[slot - 1] == hashes[*member])
+          {
+            if (m_entries[slot - 1].str == m_entries[*member].str)
+              throw std::logic_error("duplicate info name");
+            throw std::logic_error("info names with the same hash");
+          }
+          break;
+        }
+        slot = static_cast<uint16_t>(*member + 1);
+      }
+      if (member == last)
+      {
+        m_seeds[bucket] = seed;
+        return;
+      }
+
+      // take back the names placed with this seed
+      for (const uint16_t* placed = first; placed != member; ++placed)
+        m_slots[Mix(hashes[*placed], seed) & (SLOTS - 1)] = 0;
+    }
+    throw std::logic_error("no seed found for bucket");
+  }
+
+  std::array<InfoMap, N> m_entries;
+  std::array<uint16_t, SLOTS> m_slots{}; ///< index + 1 of the entry, 0 if free
+  std::array<uint32_t, BUCKETS> m_seeds{};
+};
+
+} // namespace KODI::GUILIB::GUIINFO
@@ -0,0 +1,62 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIInfoTable.h"
+
+#include <functional>
+#include <mutex>
+#include <string>
+
+using namespace KODI::GUILIB::GUIINFO;
+
+namespace
+{
+void Combine(size_t& hash, size_t value)
+{
+  hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+}
+} // unnamed namespace
+
+size_t CGUIInfoHash::operator()(const CGUIInfo& info) const
+{
+  size_t hash = std::hash<int>{}(info.GetInfo());
+  Combine(hash, info.GetData1() | info.GetInfoFlag());
+  Combine(hash, std::hash<int>{}(info.GetData2()));
+  Combine(hash, std::hash<std::string>{}(info.GetData3()));
+  Combine(hash, std::hash<int>{}(info.GetData4()));
+  Combine(hash, std::hash<std::string>{}(info.GetData5()));
+  return hash;
+}
+
+CGUIInfoTable::CGUIInfoTable(size_t capacity)
+  : m_capacity(capacity), m_chunks((capacity + CHUNK_SIZE - 1) / CHUNK_SIZE)
+{
+}
+
+int CGUIInfoTable::Add(const CGUIInfo& info)
+{
+  std::unique_lock lock(m_critSection);
+
+  const auto it = m_indexes.find(info);
+  if (it != m_indexes.end())
+    return it->second;
+
+  const size_t index = m_size.load(std::memory_order_relaxed);
+  if (index >= m_capacity)
+    return -1;
+
+  std::unique_ptr<Chunk>& chunk = m_chunks[index / CHUNK_SIZE];
+  if (!chunk)
+    chunk = std::make_unique<Chunk>(CHUNK_SIZE, CGUIInfo(0));
+  (*chunk)[index % CHUNK_SIZE] = info;
+  m_indexes.emplace(info, static_cast<int>(index));
+
+  // readers that see the new size see the entry
+  m_size.store(index + 1, std::memory_order_release);
+  return static_cast<int>(index);
+}
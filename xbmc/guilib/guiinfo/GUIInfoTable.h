@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "guilib/guiinfo/GUIInfo.h"
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace KODI::GUILIB::GUIINFO
+{
+
+struct CGUIInfoHash
+{
+  size_t operator()(const CGUIInfo& info) const;
+};
+
+/*!
+ \brief Append only table of infos with parameters, an info keeps its index for the lifetime of
+ the table
+
+ Entries are stored in chunks that never move, so reading an entry takes no lock: whoever got an
+ index from Add() may read it from any thread while other threads add. Adding is serialized and
+ finds an existing equal entry by hash.
+ */
+class CGUIInfoTable
+{
+public:
+  static constexpr size_t CHUNK_SIZE = 1024;
+
+  /*!
+   \param capacity maximum number of entries
+   */
+  explicit CGUIInfoTable(size_t capacity);
+
+  /*!
+   \brief Add an info unless an equal one exists already
+   \return index of the info, -1 if the table is full
+   */
+  int Add(const CGUIInfo& info);
+
+  /*!
+   \brief Get the entry of an index returned by Add()
+   */
+  const CGUIInfo& operator[](size_t index) const
+  {
+    return (*m_chunks[index / CHUNK_SIZE])[index % CHUNK_SIZE];
+  }
+
+  size_t Size() const { return m_size.load(std::memory_order_acquire); }
+
+private:
+  using Chunk = std::vector<CGUIInfo>;
+
+  const size_t m_capacity;
+  // chunks are allocated whole, an entry is written once before m_size is published
+  std::vector<std::unique_ptr<Chunk>> m_chunks;
+  std::atomic<size_t> m_size{0};
+
+  CCriticalSection m_critSection;
+  std::unordered_map<CGUIInfo, int, CGUIInfoHash> m_indexes;
+};
+
+} // namespace KODI::GUILIB::GUIINFO
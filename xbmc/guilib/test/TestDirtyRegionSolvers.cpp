@@ -0,0 +1,238 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/DirtyRegionSolvers.h"
+#include "guilib/DirtyRegionTracker.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// every dirty pixel has to be part of a region that is rendered
+void ExpectCovered(const CDirtyRegionList& input, const CDirtyRegionList& output)
+{
+  CDirtyRegionList combined(output);
+  combined.insert(combined.end(), input.begin(), input.end());
+  const float area = CDirtyRegionTracker::GetCoveredArea(output);
+  EXPECT_NEAR(CDirtyRegionTracker::GetCoveredArea(combined), area, 1.0f + area * 1e-6f);
+}
+
+float GetTotalArea(const CDirtyRegionList& regions)
+{
+  float area = 0.0f;
+  for (const CDirtyRegion& region : regions)
+    area += region.Area();
+  return area;
+}
+
+// a 1080p screen with a scrolling list, a busy spinner, a clock and a grid of pulsing icons
+std::vector<CDirtyRegionList> MakeRecording(size_t frames)
+{
+  std::mt19937 random(42);
+  std::vector<CDirtyRegionList> recording(frames);
+  for (size_t frame = 0; frame < frames; ++frame)
+  {
+    CDirtyRegionList& regions = recording[frame];
+    if (frame % 60 < 20)
+    {
+      for (int item = 0; item < 10; ++item)
+        regions.emplace_back(100.0f, 200.0f + item * 80, 1300.0f, 280.0f + item * 80);
+    }
+    regions.emplace_back(1800.0f, 980.0f, 1864.0f, 1044.0f);
+    if (frame % 30 == 0)
+      regions.emplace_back(1650.0f, 20.0f, 1880.0f, 60.0f);
+    for (int icon = 0; icon < 24; ++icon)
+    {
+      if (random() % 3 == 0)
+      {
+        const float x = 1360.0f + (icon % 4) * 130;
+        const float y = 200.0f + (icon / 4) * 130;
+        regions.emplace_back(x, y, x + 120, y + 120);
+      }
+    }
+  }
+  return recording;
+}
+
+// one frame per line, each region as x1,y1,x2,y2 separated by spaces
+std::vector<CDirtyRegionList> LoadRecording(const std::string& path)
+{
+  std::vector<CDirtyRegionList> recording;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line))
+  {
+    CDirtyRegionList& regions = recording.emplace_back();
+    std::istringstream frame(line);
+    std::string region;
+    while (frame >> region)
+    {
+      float x1, y1, x2, y2;
+      if (std::sscanf(region.c_str(), "%f,%f,%f,%f", &x1, &y1, &x2, &y2) == 4)
+        regions.emplace_back(x1, y1, x2, y2);
+    }
+  }
+  return recording;
+}
+} // namespace
+
+TEST(TestDirtyRegionSolvers, CoveredArea)
+{
+  CDirtyRegionList regions;
+  EXPECT_EQ(CDirtyRegionTracker::GetCoveredArea(regions), 0.0f);
+
+  regions.emplace_back(0.0f, 0.0f, 10.0f, 10.0f);
+  regions.emplace_back(5.0f, 5.0f, 15.0f, 15.0f);
+  regions.emplace_back(2.0f, 2.0f, 4.0f, 4.0f);
+  regions.emplace_back(20.0f, 0.0f, 20.0f, 10.0f);
+  EXPECT_EQ(CDirtyRegionTracker::GetCoveredArea(regions), 175.0f);
+}
+
+TEST(TestDirtyRegionSolvers, TrackerStats)
+{
+  CDirtyRegionTracker tracker;
+  tracker.MarkDirtyRegion(CDirtyRegion(0.0f, 0.0f, 10.0f, 10.0f));
+  tracker.MarkDirtyRegion(CDirtyRegion(5.0f, 5.0f, 15.0f, 15.0f));
+
+  CDirtyRegionList rendered;
+  rendered.emplace_back(0.0f, 0.0f, 15.0f, 15.0f);
+  rendered.emplace_back(0.0f, 0.0f, 0.0f, 0.0f);
+  tracker.UpdateStats(rendered);
+
+  // regions marked for the next frame don't count
+  tracker.MarkDirtyRegion(CDirtyRegion(100.0f, 100.0f, 200.0f, 200.0f));
+  DirtyRegionStats stats = tracker.GetStats();
+  EXPECT_EQ(stats.passes, 1u);
+  EXPECT_EQ(stats.redrawnArea, 225.0f);
+  EXPECT_EQ(stats.dirtyArea, 175.0f);
+
+  tracker.UpdateStats(CDirtyRegionList());
+  stats = tracker.GetStats();
+  EXPECT_EQ(stats.passes, 0u);
+  EXPECT_EQ(stats.redrawnArea, 0.0f);
+  EXPECT_EQ(stats.dirtyArea, 10175.0f);
+}
+
+TEST(TestDirtyRegionSolvers, TiledMergesNearbyRegions)
+{
+  CTiledDirtyRegionSolver solver;
+  CDirtyRegionList input;
+  input.emplace_back(0.0f, 0.0f, 10.0f, 10.0f);
+  input.emplace_back(30.0f, 0.0f, 40.0f, 10.0f);
+
+  CDirtyRegionList output;
+  solver.Solve(input, output);
+  ASSERT_EQ(output.size(), 1u);
+  // the region is not extended to the tiles
+  EXPECT_EQ(output[0], CRect(0.0f, 0.0f, 40.0f, 10.0f));
+}
+
+TEST(TestDirtyRegionSolvers, TiledKeepsDistantRegionsApart)
+{
+  CTiledDirtyRegionSolver solver;
+  CDirtyRegionList input;
+  input.emplace_back(0.0f, 0.0f, 100.0f, 100.0f);
+  input.emplace_back(1000.0f, 900.0f, 1100.0f, 1000.0f);
+  input.emplace_back(0.0f, 0.0f, 0.0f, 0.0f);
+
+  CDirtyRegionList output;
+  solver.Solve(input, output);
+  ASSERT_EQ(output.size(), 2u);
+  EXPECT_EQ(GetTotalArea(output), 20000.0f);
+  ExpectCovered(input, output);
+
+  output.clear();
+  solver.Solve(CDirtyRegionList(), output);
+  EXPECT_TRUE(output.empty());
+}
+
+TEST(TestDirtyRegionSolvers, TiledCoversAllRegions)
+{
+  std::mt19937 random(1);
+  std::uniform_real_distribution<float> position(-100.0f, 2000.0f);
+  std::uniform_real_distribution<float> size(1.0f, 300.0f);
+  for (size_t maxRegions : {1, 4, 8})
+  {
+    CTiledDirtyRegionSolver solver(32.0f, 32768.0f, maxRegions);
+    for (int frame = 0; frame < 50; ++frame)
+    {
+      CDirtyRegionList input;
+      for (int i = 0; i < frame; ++i)
+      {
+        const float x = position(random);
+        const float y = position(random);
+        input.emplace_back(x, y, x + size(random), y + size(random));
+      }
+
+      CDirtyRegionList output;
+      solver.Solve(input, output);
+      EXPECT_LE(output.size(), maxRegions);
+      ExpectCovered(input, output);
+      // the regions are rendered once
+      const float area = GetTotalArea(output);
+      EXPECT_NEAR(CDirtyRegionTracker::GetCoveredArea(output), area, 1.0f + area * 1e-6f);
+    }
+  }
+}
+
+// Compares the solvers on a list of dirty regions per frame, run with
+//   kodi-test --gtest_also_run_disabled_tests --gtest_filter=TestDirtyRegionSolvers.DISABLED_Benchmark
+// Optional:
+//   KODI_DIRTYREGION_BENCHMARK_FILE=<file>  recorded regions, one frame per line with each
+//                                           region as x1,y1,x2,y2 separated by spaces
+TEST(TestDirtyRegionSolvers, DISABLED_Benchmark)
+{
+  std::vector<CDirtyRegionList> recording;
+  if (const char* value = std::getenv("KODI_DIRTYREGION_BENCHMARK_FILE"))
+    recording = LoadRecording(value);
+  else
+    recording = MakeRecording(600);
+  ASSERT_FALSE(recording.empty());
+
+  float dirtyArea = 0.0f;
+  for (const CDirtyRegionList& frame : recording)
+    dirtyArea += CDirtyRegionTracker::GetCoveredArea(frame);
+
+  auto run = [&](const char* name, IDirtyRegionSolver& solver) {
+    using Duration = std::chrono::duration<double, std::micro>;
+    Duration time{};
+    size_t passes = 0;
+    float redrawnArea = 0.0f;
+    for (const CDirtyRegionList& frame : recording)
+    {
+      CDirtyRegionList output;
+      const auto start = std::chrono::steady_clock::now();
+      solver.Solve(frame, output);
+      time += std::chrono::steady_clock::now() - start;
+      ExpectCovered(frame, output);
+      passes += output.size();
+      redrawnArea += GetTotalArea(output);
+    }
+    const double frames = static_cast<double>(recording.size());
+    std::cout << name << ": " << time.count() / frames << " us, " << passes / frames
+              << " passes, " << redrawnArea / frames / 1000 << " kpx redrawn of "
+              << dirtyArea / frames / 1000 << " kpx dirty per frame" << std::endl;
+  };
+
+  CUnionDirtyRegionSolver unionSolver;
+  run("union", unionSolver);
+  CGreedyDirtyRegionSolver greedySolver;
+  run("cost reduction", greedySolver);
+  CTiledDirtyRegionSolver tiledSolver;
+  run("tiled", tiledSolver);
+}
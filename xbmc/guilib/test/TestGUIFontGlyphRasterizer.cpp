@@ -0,0 +1,634 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "filesystem/SpecialProtocol.h"
+#include "guilib/GUIFont.h"
+#include "guilib/GUIFontGlyphRasterizer.h"
+#include "guilib/GUIFontTTF.h"
+#include "guilib/Texture.h"
+#include "rendering/RenderSystem.h"
+#include "test/TestUtils.h"
+#include "windowing/WinSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include FT_GLYPH_H
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class CTestRenderSystem : public CRenderSystemBase
+{
+public:
+  bool InitRenderSystem() override { return true; }
+  bool DestroyRenderSystem() override { return true; }
+  bool ResetRenderSystem(int width, int height) override { return true; }
+  bool BeginRender() override { return true; }
+  bool EndRender() override { return true; }
+  void PresentRender(bool rendered, bool videoLayer) override {}
+  bool ClearBuffers(KODI::UTILS::COLOR::Color color) override { return true; }
+  bool IsExtSupported(const char* extension) const override { return false; }
+  void SetViewPort(const CRect& viewPort) override {}
+  void GetViewPort(CRect& viewPort) override {}
+  void SetScissors(const CRect& rect) override {}
+  void ResetScissors() override {}
+  void CaptureStateBlock() override {}
+  void ApplyStateBlock() override {}
+  void SetCameraPosition(const CPoint& camera,
+                         int screenWidth,
+                         int screenHeight,
+                         float stereoFactor) override
+  {
+  }
+};
+
+class CTestWinSystem : public CWinSystemBase
+{
+public:
+  CRenderSystemBase* GetRenderSystem() override { return &m_renderSystem; }
+  bool CreateNewWindow(const std::string& name, bool fullScreen, RESOLUTION_INFO& res) override
+  {
+    return false;
+  }
+  bool ResizeWindow(int newWidth, int newHeight, int newLeft, int newTop) override
+  {
+    return false;
+  }
+  bool SetFullScreen(bool fullScreen, RESOLUTION_INFO& res, bool blankOtherDisplays) override
+  {
+    return false;
+  }
+  void Register(IDispResource* resource) override {}
+  void Unregister(IDispResource* resource) override {}
+
+private:
+  CTestRenderSystem m_renderSystem;
+};
+
+class CTestTexture : public CTexture
+{
+public:
+  CTestTexture(unsigned int width, unsigned int height) : CTexture(width, height, XB_FMT_A8) {}
+  void CreateTextureObject() override {}
+  void DestroyTextureObject() override {}
+  void LoadToGPU() override {}
+  void BindToUnit(unsigned int unit) override {}
+};
+
+// a font drawing to a texture in memory only
+class CTestFontTTF : public CGUIFontTTF
+{
+public:
+  CTestFontTTF() : CGUIFontTTF("test") {}
+  ~CTestFontTTF() override { m_dynamicCache.Flush(); }
+
+  using CGUIFontTTF::Character;
+  using CGUIFontTTF::GetTextWidthInternal;
+  using CGUIFontTTF::MAX_SYNC_GLYPHS;
+  using CGUIFontTTF::ShapedText;
+  using CGUIFontTTF::SYNC_GLYPHS_PERIOD;
+  using CGUIFontTTF::m_char;
+  using CGUIFontTTF::m_pendingGlyphs;
+  using CGUIFontTTF::m_rasterizerFace;
+  using CGUIFontTTF::m_rasterizerFailed;
+  using CGUIFontTTF::m_shapingCache;
+  using CGUIFontTTF::m_texture;
+
+protected:
+  std::unique_ptr<CTexture> ReallocTexture(unsigned int& newHeight) override
+  {
+    newHeight = CTexture::PadPow2(newHeight);
+    std::unique_ptr<CTexture> newTexture = std::make_unique<CTestTexture>(m_textureWidth, newHeight);
+    if (!newTexture->GetPixels())
+      return nullptr;
+
+    m_textureHeight = newTexture->GetHeight();
+    m_textureScaleY = 1.0f / m_textureHeight;
+    m_textureWidth = newTexture->GetWidth();
+    m_textureScaleX = 1.0f / m_textureWidth;
+    m_staticCache.Flush();
+    m_dynamicCache.Flush();
+
+    std::memset(newTexture->GetPixels(), 0, m_textureHeight * newTexture->GetPitch());
+    if (m_texture)
+    {
+      for (unsigned int y = 0; y < m_texture->GetHeight(); y++)
+        std::memcpy(newTexture->GetPixels() + y * newTexture->GetPitch(),
+                    m_texture->GetPixels() + y * m_texture->GetPitch(), m_texture->GetPitch());
+    }
+    return newTexture;
+  }
+
+  bool CopyCharToTexture(FT_BitmapGlyph bitGlyph,
+                         unsigned int x1,
+                         unsigned int y1,
+                         unsigned int x2,
+                         unsigned int y2) override
+  {
+    const FT_Bitmap& bitmap = bitGlyph->bitmap;
+    for (unsigned int y = y1; y < y2; y++)
+      std::memcpy(m_texture->GetPixels() + y * m_texture->GetPitch() + x1,
+                  bitmap.buffer + (y - y1) * bitmap.pitch, x2 - x1);
+    return true;
+  }
+
+  void DeleteHardwareTexture() override {}
+  bool FirstBegin() override { return true; }
+  void LastEnd() override {}
+};
+
+void ExpectSameBitmap(const FT_Bitmap& bitmap, const FT_Bitmap& expected)
+{
+  ASSERT_EQ(bitmap.width, expected.width);
+  ASSERT_EQ(bitmap.rows, expected.rows);
+  for (unsigned int y = 0; y < bitmap.rows; ++y)
+    EXPECT_EQ(std::memcmp(bitmap.buffer + y * bitmap.pitch, expected.buffer + y * expected.pitch,
+                          bitmap.width),
+              0)
+        << "row " << y;
+}
+
+class TestGUIFontGlyphRasterizer : public testing::Test
+{
+protected:
+  void SetUp() override { ASSERT_EQ(FT_Init_FreeType(&m_library), 0); }
+  void TearDown() override
+  {
+    if (m_library)
+      FT_Done_FreeType(m_library);
+  }
+
+  FT_Face OpenFace(const std::string& path, int size)
+  {
+    FT_Face face = nullptr;
+    if (FT_New_Face(m_library, CSpecialProtocol::TranslatePath(path).c_str(), 0, &face))
+      return nullptr;
+    if (FT_Set_Char_Size(face, 0, size * 64, 72, 72))
+    {
+      FT_Done_Face(face);
+      return nullptr;
+    }
+    return face;
+  }
+
+  // wait until the rasterizer returned the given number of glyphs of a face
+  static std::vector<CGUIFontGlyphRasterizer::Result> WaitForResults(
+      CGUIFontGlyphRasterizer& rasterizer, unsigned int faceID, size_t count)
+  {
+    std::vector<CGUIFontGlyphRasterizer::Result> results;
+    const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (results.size() < count && std::chrono::steady_clock::now() < end)
+    {
+      for (const auto& result : rasterizer.TakeResults(faceID))
+        results.emplace_back(result);
+      if (results.size() < count)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return results;
+  }
+
+  // compare rasterized glyphs with the glyphs rendered right away with another face
+  static void ExpectRenderedLike(FT_Face face,
+                                 const std::vector<CGUIFontGlyphRasterizer::Result>& results)
+  {
+    for (const auto& result : results)
+    {
+      ASSERT_NE(result.m_glyph, nullptr);
+      ASSERT_TRUE(CGUIFontGlyphRasterizer::LoadGlyph(face, result.m_glyphIndex, result.m_style));
+      FT_Glyph expected = CGUIFontGlyphRasterizer::RenderGlyph(face, nullptr);
+      ASSERT_NE(expected, nullptr);
+      ExpectSameBitmap(reinterpret_cast<FT_BitmapGlyph>(result.m_glyph)->bitmap,
+                       reinterpret_cast<FT_BitmapGlyph>(expected)->bitmap);
+      FT_Done_Glyph(expected);
+    }
+  }
+
+  static void ReleaseResults(const std::vector<CGUIFontGlyphRasterizer::Result>& results)
+  {
+    for (const auto& result : results)
+    {
+      if (result.m_glyph)
+        FT_Done_Glyph(result.m_glyph);
+    }
+  }
+
+  FT_Library m_library = nullptr;
+};
+
+class TestGUIFontTTF : public TestGUIFontGlyphRasterizer
+{
+protected:
+  void SetUp() override
+  {
+    TestGUIFontGlyphRasterizer::SetUp();
+    CServiceBroker::RegisterWinSystem(&m_winSystem);
+  }
+  void TearDown() override
+  {
+    CServiceBroker::UnregisterWinSystem();
+    TestGUIFontGlyphRasterizer::TearDown();
+  }
+
+  // lines of characters the font has glyphs for, CJK ideographs first
+  static std::vector<vecText> MakeLines(FT_Face face, size_t characters, size_t lineLength)
+  {
+    std::vector<vecText> lines;
+    vecText line;
+    for (const auto& [first, last] : {std::pair<character_t, character_t>{0x4e00, 0x9fff},
+                                      std::pair<character_t, character_t>{0x0100, 0x02af},
+                                      std::pair<character_t, character_t>{0x0370, 0x052f}})
+    {
+      for (character_t ch = first; ch <= last && characters > 0; ++ch)
+      {
+        if (!FT_Get_Char_Index(face, ch))
+          continue;
+        line.emplace_back(ch);
+        --characters;
+        if (line.size() == lineLength)
+        {
+          lines.emplace_back(std::move(line));
+          line.clear();
+        }
+      }
+    }
+    if (!line.empty())
+      lines.emplace_back(std::move(line));
+    return lines;
+  }
+
+  // place the glyphs rasterized in the background until none is left
+  static void WaitForPlacement(CTestFontTTF& font)
+  {
+    const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!font.m_pendingGlyphs.empty() && std::chrono::steady_clock::now() < end)
+    {
+      font.Begin();
+      font.End();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  CTestWinSystem m_winSystem;
+};
+
+std::string GetFontPath()
+{
+  if (const char* value = std::getenv("KODI_FONT_TEST_FONT"))
+    return value;
+  return XBMC_REF_FILE_PATH("addons/skin.estuary/fonts/NotoSans-Regular.ttf");
+}
+} // namespace
+
+TEST_F(TestGUIFontGlyphRasterizer, MatchesSynchronousRendering)
+{
+  const std::string font = XBMC_REF_FILE_PATH("addons/skin.estuary/fonts/NotoSans-Regular.ttf");
+  FT_Face face = OpenFace(font, 24);
+  ASSERT_NE(face, nullptr);
+  FT_Face workerFace = OpenFace(font, 24);
+  ASSERT_NE(workerFace, nullptr);
+
+  std::vector<FT_UInt> indexes;
+  for (const char c : std::string("Kodi 0123"))
+    indexes.emplace_back(FT_Get_Char_Index(face, c));
+
+  std::vector<CGUIFontGlyphRasterizer::Result> results;
+  {
+    CGUIFontGlyphRasterizer rasterizer;
+    const unsigned int faceID = rasterizer.AddFace(workerFace, nullptr);
+    EXPECT_NE(faceID, 0u);
+    for (const FT_UInt index : indexes)
+      rasterizer.Request(faceID, index, FONT_STYLE_BOLD);
+    results = WaitForResults(rasterizer, faceID, indexes.size());
+  }
+  ASSERT_EQ(results.size(), indexes.size());
+
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    // glyphs are rendered in the order they were requested
+    EXPECT_EQ(results[i].m_glyphIndex, indexes[i]);
+    EXPECT_EQ(results[i].m_style, static_cast<uint32_t>(FONT_STYLE_BOLD));
+  }
+  ExpectRenderedLike(face, results);
+  ReleaseResults(results);
+  FT_Done_Face(face);
+}
+
+TEST_F(TestGUIFontGlyphRasterizer, SharesWorkerBetweenFaces)
+{
+  const std::string sans = XBMC_REF_FILE_PATH("addons/skin.estuary/fonts/NotoSans-Regular.ttf");
+  const std::string mono = XBMC_REF_FILE_PATH("addons/skin.estuary/fonts/NotoMono-Regular.ttf");
+  FT_Face sansFace = OpenFace(sans, 24);
+  ASSERT_NE(sansFace, nullptr);
+  FT_Face monoFace = OpenFace(mono, 32);
+  ASSERT_NE(monoFace, nullptr);
+
+  const std::shared_ptr<CGUIFontGlyphRasterizer> rasterizer = CGUIFontGlyphRasterizer::GetShared();
+  EXPECT_EQ(CGUIFontGlyphRasterizer::GetShared(), rasterizer);
+
+  const unsigned int sansID = rasterizer->AddFace(OpenFace(sans, 24), nullptr);
+  const unsigned int monoID = rasterizer->AddFace(OpenFace(mono, 32), nullptr);
+  EXPECT_NE(sansID, monoID);
+
+  const std::string text = "Kodi 0123";
+  for (const char c : text)
+  {
+    rasterizer->Request(sansID, FT_Get_Char_Index(sansFace, c), FONT_STYLE_NORMAL);
+    rasterizer->Request(monoID, FT_Get_Char_Index(monoFace, c), FONT_STYLE_ITALICS);
+  }
+
+  // every face gets its own glyphs back
+  const auto sansResults = WaitForResults(*rasterizer, sansID, text.size());
+  const auto monoResults = WaitForResults(*rasterizer, monoID, text.size());
+  ASSERT_EQ(sansResults.size(), text.size());
+  ASSERT_EQ(monoResults.size(), text.size());
+  for (size_t i = 0; i < text.size(); ++i)
+  {
+    EXPECT_EQ(sansResults[i].m_glyphIndex, FT_Get_Char_Index(sansFace, text[i]));
+    EXPECT_EQ(monoResults[i].m_glyphIndex, FT_Get_Char_Index(monoFace, text[i]));
+    EXPECT_EQ(monoResults[i].m_style, static_cast<uint32_t>(FONT_STYLE_ITALICS));
+  }
+  ExpectRenderedLike(sansFace, sansResults);
+  ExpectRenderedLike(monoFace, monoResults);
+  ReleaseResults(sansResults);
+  ReleaseResults(monoResults);
+
+  // the glyphs of a removed face are dropped, the other faces are still served
+  for (FT_UInt index = 1; index < 200; ++index)
+    rasterizer->Request(sansID, index, FONT_STYLE_NORMAL);
+  rasterizer->RemoveFace(sansID);
+  EXPECT_TRUE(rasterizer->TakeResults(sansID).empty());
+  rasterizer->Request(monoID, FT_Get_Char_Index(monoFace, 'K'), FONT_STYLE_NORMAL);
+  const auto lastResults = WaitForResults(*rasterizer, monoID, 1);
+  ASSERT_EQ(lastResults.size(), 1u);
+  ReleaseResults(lastResults);
+  rasterizer->RemoveFace(monoID);
+
+  FT_Done_Face(sansFace);
+  FT_Done_Face(monoFace);
+}
+
+TEST_F(TestGUIFontTTF, DefersGlyphsBeyondFrameBudget)
+{
+  const std::string path = GetFontPath();
+  FT_Face face = OpenFace(path, 24);
+  ASSERT_NE(face, nullptr);
+  const std::vector<vecText> lines = MakeLines(face, 200, 200);
+  ASSERT_FALSE(lines.empty());
+  ASSERT_GT(lines[0].size(), CTestFontTTF::MAX_SYNC_GLYPHS);
+
+  CTestFontTTF font;
+  ASSERT_TRUE(font.Load(path, 24.0f));
+  // the face of the rasterizer is only opened for a glyph left to it
+  EXPECT_EQ(font.m_rasterizerFace, 0u);
+
+  font.Begin();
+  EXPECT_GT(font.GetTextWidthInternal(lines[0]), 0.0f);
+  font.End();
+  ASSERT_FALSE(font.m_pendingGlyphs.empty());
+  EXPECT_NE(font.m_rasterizerFace, 0u);
+
+  for (const CTestFontTTF::Character& ch : font.m_char)
+  {
+    // the metrics are there right away, deferred glyphs are blank
+    ASSERT_TRUE(CGUIFontGlyphRasterizer::LoadGlyph(face, ch.m_glyphIndex, ch.m_glyphAndStyle >> 16));
+    EXPECT_EQ(ch.m_advance, std::round(face->glyph->advance.x / 64.0f));
+    if (font.m_pendingGlyphs.count(ch.m_glyphAndStyle))
+    {
+      EXPECT_EQ(ch.m_right, ch.m_left);
+      EXPECT_EQ(ch.m_bottom, ch.m_top);
+    }
+  }
+  FT_Done_Face(face);
+}
+
+TEST_F(TestGUIFontTTF, PlacesRasterizedGlyphs)
+{
+  const std::string path = GetFontPath();
+  FT_Face face = OpenFace(path, 24);
+  ASSERT_NE(face, nullptr);
+  const std::vector<vecText> lines = MakeLines(face, 300, 100);
+
+  CTestFontTTF font;
+  ASSERT_TRUE(font.Load(path, 24.0f));
+  CTestFontTTF syncFont;
+  ASSERT_TRUE(syncFont.Load(path, 24.0f));
+  syncFont.m_rasterizerFailed = true;
+
+  font.Begin();
+  for (const vecText& line : lines)
+    font.GetTextWidthInternal(line);
+  font.End();
+  ASSERT_FALSE(font.m_pendingGlyphs.empty());
+
+  WaitForPlacement(font);
+  ASSERT_TRUE(font.m_pendingGlyphs.empty());
+
+  // texts measured with blank glyphs are measured again
+  font.m_shapingCache.ForEach([](CTestFontTTF::ShapedText& shaped)
+                              { EXPECT_LT(shaped.m_width, 0.0f); });
+  for (const vecText& line : lines)
+    EXPECT_EQ(font.GetTextWidthInternal(line), syncFont.GetTextWidthInternal(line));
+
+  // the texture holds the same pixels as if all glyphs were rendered right away
+  ASSERT_NE(font.m_texture, nullptr);
+  for (const CTestFontTTF::Character& ch : font.m_char)
+  {
+    ASSERT_TRUE(CGUIFontGlyphRasterizer::LoadGlyph(face, ch.m_glyphIndex, ch.m_glyphAndStyle >> 16));
+    FT_Glyph expected = CGUIFontGlyphRasterizer::RenderGlyph(face, nullptr);
+    ASSERT_NE(expected, nullptr);
+    const FT_BitmapGlyph expectedGlyph = reinterpret_cast<FT_BitmapGlyph>(expected);
+
+    if (expectedGlyph->bitmap.width && expectedGlyph->bitmap.rows)
+    {
+      EXPECT_EQ(ch.m_offsetX, expectedGlyph->left);
+      FT_Bitmap bitmap{};
+      bitmap.width = static_cast<unsigned int>(ch.m_right - ch.m_left);
+      bitmap.rows = static_cast<unsigned int>(ch.m_bottom - ch.m_top);
+      bitmap.pitch = static_cast<int>(font.m_texture->GetPitch());
+      bitmap.buffer = font.m_texture->GetPixels() +
+                      static_cast<unsigned int>(ch.m_top) * font.m_texture->GetPitch() +
+                      static_cast<unsigned int>(ch.m_left);
+      ExpectSameBitmap(bitmap, expectedGlyph->bitmap);
+    }
+    FT_Done_Glyph(expected);
+  }
+  FT_Done_Face(face);
+}
+
+// Lays out screens of new text, like a list of CJK titles scrolling in, and compares the frame
+// times with those of a font rasterizing every glyph right away. Set KODI_FONT_TEST_FONT to a CJK
+// font to lay out CJK text, the font of the default skin has none.
+TEST_F(TestGUIFontTTF, LayoutFrameTimes)
+{
+  const std::string path = GetFontPath();
+  FT_Face face = OpenFace(path, 24);
+  ASSERT_NE(face, nullptr);
+  constexpr size_t LINE_LENGTH = 40;
+  constexpr size_t LINES_PER_FRAME = 4;
+  const std::vector<vecText> lines = MakeLines(face, 1000, LINE_LENGTH);
+  FT_Done_Face(face);
+  ASSERT_GE(lines.size(), LINES_PER_FRAME * 2);
+
+  using Duration = std::chrono::duration<double, std::milli>;
+  auto layout = [&](CTestFontTTF& font, std::vector<Duration>& frames)
+  {
+    size_t deferred = 0;
+    for (size_t first = 0; first < lines.size(); first += LINES_PER_FRAME)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      font.Begin();
+      const size_t characters = font.m_char.size();
+      const size_t pending = font.m_pendingGlyphs.size();
+      for (size_t line = first; line < std::min(first + LINES_PER_FRAME, lines.size()); ++line)
+        font.GetTextWidthInternal(lines[line]);
+      font.End();
+      const Duration frame = std::chrono::steady_clock::now() - start;
+      frames.emplace_back(frame);
+
+      // a cleared character cache starts over
+      if (font.m_char.size() < characters || font.m_pendingGlyphs.size() < pending)
+        continue;
+      const size_t newDeferred = font.m_pendingGlyphs.size() - pending;
+      const size_t rasterized = font.m_char.size() - characters - newDeferred;
+      deferred += newDeferred;
+      if (!font.m_rasterizerFailed)
+      {
+        const auto periods = static_cast<size_t>(frame / CTestFontTTF::SYNC_GLYPHS_PERIOD);
+        EXPECT_LE(rasterized, CTestFontTTF::MAX_SYNC_GLYPHS * (periods + 1));
+      }
+    }
+    return deferred;
+  };
+
+  auto report = [&](const char* name, const std::vector<Duration>& frames)
+  {
+    Duration total{};
+    Duration max{};
+    for (const Duration& frame : frames)
+    {
+      total += frame;
+      max = std::max(max, frame);
+    }
+    std::cout << name << ": " << frames.size() << " frames of " << LINES_PER_FRAME * LINE_LENGTH
+              << " new characters, mean " << total.count() / frames.size() << " ms, max "
+              << max.count() << " ms" << std::endl;
+  };
+
+  CTestFontTTF syncFont;
+  ASSERT_TRUE(syncFont.Load(path, 24.0f));
+  syncFont.m_rasterizerFailed = true;
+  std::vector<Duration> syncFrames;
+  EXPECT_EQ(layout(syncFont, syncFrames), 0u);
+  report("synchronous", syncFrames);
+
+  CTestFontTTF font;
+  ASSERT_TRUE(font.Load(path, 24.0f));
+  std::vector<Duration> frames;
+  EXPECT_GT(layout(font, frames), 0u);
+  report("background rasterization", frames);
+
+  WaitForPlacement(font);
+  EXPECT_TRUE(font.m_pendingGlyphs.empty());
+}
+
+// Compares the time a frame full of new glyphs takes to rasterize on the render thread with the
+// time it takes to only load their metrics and hand them to the rasterizer, run with
+//   kodi-test --gtest_also_run_disabled_tests --gtest_filter=TestGUIFontGlyphRasterizer.DISABLED_Benchmark
+// Optional:
+//   KODI_FONT_BENCHMARK_FONT=<file>     font to render, a CJK font shows the difference best
+//   KODI_FONT_BENCHMARK_GLYPHS=<n>      number of new glyphs per frame
+TEST_F(TestGUIFontGlyphRasterizer, DISABLED_Benchmark)
+{
+  std::string font = XBMC_REF_FILE_PATH("addons/skin.estuary/fonts/NotoSans-Regular.ttf");
+  if (const char* value = std::getenv("KODI_FONT_BENCHMARK_FONT"))
+    font = value;
+  int glyphsPerFrame = 200;
+  if (const char* value = std::getenv("KODI_FONT_BENCHMARK_GLYPHS"))
+    glyphsPerFrame = std::max(1, std::atoi(value));
+
+  FT_Face face = OpenFace(font, 40);
+  ASSERT_NE(face, nullptr);
+  FT_Face workerFace = OpenFace(font, 40);
+  ASSERT_NE(workerFace, nullptr);
+  const FT_UInt glyphCount = static_cast<FT_UInt>(face->num_glyphs);
+  ASSERT_GT(glyphCount, 1u);
+
+  using Duration = std::chrono::duration<double, std::milli>;
+  auto report = [&](const char* name, const std::vector<Duration>& frames) {
+    Duration total{};
+    Duration max{};
+    for (const Duration& frame : frames)
+    {
+      total += frame;
+      max = std::max(max, frame);
+    }
+    std::cout << name << ": " << frames.size() << " frames of " << glyphsPerFrame
+              << " glyphs, mean " << total.count() / frames.size() << " ms, max " << max.count()
+              << " ms" << std::endl;
+  };
+
+  // every glyph of the font once, in frames
+  std::vector<Duration> syncFrames;
+  for (FT_UInt index = 1; index < glyphCount;)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < glyphsPerFrame && index < glyphCount; ++i, ++index)
+    {
+      if (CGUIFontGlyphRasterizer::LoadGlyph(face, index, FONT_STYLE_NORMAL))
+      {
+        if (FT_Glyph glyph = CGUIFontGlyphRasterizer::RenderGlyph(face, nullptr))
+          FT_Done_Glyph(glyph);
+      }
+    }
+    syncFrames.emplace_back(std::chrono::steady_clock::now() - start);
+  }
+  report("synchronous", syncFrames);
+
+  std::vector<Duration> asyncFrames;
+  size_t requested = 0;
+  size_t received = 0;
+  {
+    CGUIFontGlyphRasterizer rasterizer;
+    const unsigned int faceID = rasterizer.AddFace(workerFace, nullptr);
+    for (FT_UInt index = 1; index < glyphCount;)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      for (const auto& result : rasterizer.TakeResults(faceID))
+      {
+        if (result.m_glyph)
+          FT_Done_Glyph(result.m_glyph);
+        ++received;
+      }
+      for (int i = 0; i < glyphsPerFrame && index < glyphCount; ++i, ++index)
+      {
+        if (CGUIFontGlyphRasterizer::LoadGlyph(face, index, FONT_STYLE_NORMAL))
+        {
+          rasterizer.Request(faceID, index, FONT_STYLE_NORMAL);
+          ++requested;
+        }
+      }
+      asyncFrames.emplace_back(std::chrono::steady_clock::now() - start);
+    }
+    ReleaseResults(WaitForResults(rasterizer, faceID, requested - received));
+  }
+  report("metrics and background rasterization", asyncFrames);
+
+  FT_Done_Face(face);
+}
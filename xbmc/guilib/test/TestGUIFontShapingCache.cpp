@@ -0,0 +1,124 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFontShapingCache.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+vecText MakeText(const std::string& text, character_t color = 0)
+{
+  vecText result;
+  for (const char ch : text)
+    result.emplace_back(static_cast<character_t>(ch) | (color << 16));
+  return result;
+}
+} // namespace
+
+TEST(TestGUIFontShapingCache, CountsHitsAndMisses)
+{
+  CGUIFontShapingCache<int> cache(4, 2);
+  EXPECT_EQ(cache.Find(MakeText("a")), nullptr);
+  cache.Insert(MakeText("a"), 1);
+  ASSERT_NE(cache.Find(MakeText("a")), nullptr);
+  EXPECT_EQ(*cache.Find(MakeText("a")), 1);
+  EXPECT_EQ(cache.Find(MakeText("b")), nullptr);
+
+  FontShapingStats stats = cache.GetStats();
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(stats.misses, 2u);
+  EXPECT_EQ(stats.entries, 1u);
+
+  cache.Clear();
+  EXPECT_EQ(cache.Find(MakeText("a")), nullptr);
+  stats = cache.GetStats();
+  EXPECT_EQ(stats.misses, 3u);
+  EXPECT_EQ(stats.entries, 0u);
+}
+
+TEST(TestGUIFontShapingCache, IgnoresColors)
+{
+  CGUIFontShapingCache<int> cache(4, 2);
+  cache.Insert(MakeText("text", 1), 1);
+  ASSERT_NE(cache.Find(MakeText("text", 2)), nullptr);
+  EXPECT_EQ(*cache.Find(MakeText("text", 0)), 1);
+
+  // styles do change the shape
+  vecText bold = MakeText("text");
+  for (character_t& ch : bold)
+    ch |= 1 << 24;
+  EXPECT_EQ(cache.Find(bold), nullptr);
+  EXPECT_EQ(cache.GetStats().entries, 1u);
+}
+
+TEST(TestGUIFontShapingCache, EvictsOldestOnProbation)
+{
+  CGUIFontShapingCache<int> cache(3, 2);
+  cache.Insert(MakeText("a"), 1);
+  cache.Insert(MakeText("b"), 2);
+  cache.Insert(MakeText("c"), 3);
+  cache.Insert(MakeText("d"), 4);
+  EXPECT_EQ(cache.GetStats().entries, 3u);
+  EXPECT_EQ(cache.Find(MakeText("a")), nullptr);
+  EXPECT_NE(cache.Find(MakeText("b")), nullptr);
+  EXPECT_NE(cache.Find(MakeText("c")), nullptr);
+  EXPECT_NE(cache.Find(MakeText("d")), nullptr);
+}
+
+TEST(TestGUIFontShapingCache, ProtectsTextsUsedTwice)
+{
+  CGUIFontShapingCache<int> cache(3, 2);
+  cache.Insert(MakeText("a"), 1);
+  ASSERT_NE(cache.Find(MakeText("a")), nullptr);
+
+  // texts seen once don't push out a protected text
+  for (const char* text : {"b", "c", "d", "e"})
+    cache.Insert(MakeText(text), 0);
+  EXPECT_EQ(cache.GetStats().entries, 3u);
+  EXPECT_NE(cache.Find(MakeText("a")), nullptr);
+  EXPECT_EQ(cache.Find(MakeText("c")), nullptr);
+  EXPECT_NE(cache.Find(MakeText("d")), nullptr);
+  EXPECT_NE(cache.Find(MakeText("e")), nullptr);
+}
+
+TEST(TestGUIFontShapingCache, DemotesOldestProtected)
+{
+  CGUIFontShapingCache<int> cache(3, 2);
+  for (const char* text : {"a", "b", "c"})
+  {
+    cache.Insert(MakeText(text), 0);
+    ASSERT_NE(cache.Find(MakeText(text)), nullptr);
+  }
+
+  // a was protected first and went back on probation for c, the next new text pushes it out
+  cache.Insert(MakeText("d"), 0);
+  EXPECT_EQ(cache.GetStats().entries, 3u);
+  EXPECT_EQ(cache.Find(MakeText("a")), nullptr);
+  EXPECT_NE(cache.Find(MakeText("b")), nullptr);
+  EXPECT_NE(cache.Find(MakeText("c")), nullptr);
+}
+
+TEST(TestGUIFontShapingCache, ForEach)
+{
+  CGUIFontShapingCache<int> cache(4, 2);
+  cache.Insert(MakeText("a"), 1);
+  cache.Insert(MakeText("b"), 2);
+  ASSERT_NE(cache.Find(MakeText("a")), nullptr);
+
+  int sum = 0;
+  cache.ForEach([&sum](int& value) {
+    sum += value;
+    value = -1;
+  });
+  EXPECT_EQ(sum, 3);
+  EXPECT_EQ(*cache.Find(MakeText("a")), -1);
+  EXPECT_EQ(*cache.Find(MakeText("b")), -1);
+}
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFrameProfiler.h"
+#include "utils/Variant.h"
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+TEST(TestGUIFrameProfiler, RecordsOnlyWhileRunning)
+{
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::Instance();
+  profiler.Stop();
+  {
+    CGUIFrameProfiler::CScope scope("Ignored", "test");
+  }
+
+  profiler.Start();
+  profiler.NewFrame();
+  {
+    CGUIFrameProfiler::CScope scope("Outer", "test");
+    CGUIFrameProfiler::CScope inner("Inner", "test");
+  }
+  std::thread([] { CGUIFrameProfiler::CScope scope("Worker", "test"); }).join();
+  profiler.Stop();
+
+  CVariant trace;
+  profiler.GetTrace(trace);
+  EXPECT_EQ(trace["displayTimeUnit"].asString(), "ms");
+
+  const CVariant& events = trace["traceEvents"];
+  std::string names;
+  unsigned int threads = 0;
+  for (auto it = events.begin_array(); it != events.end_array(); ++it)
+  {
+    if ((*it)["ph"].asString() == "M")
+    {
+      ++threads;
+      continue;
+    }
+    EXPECT_EQ((*it)["ph"].asString(), "X");
+    EXPECT_EQ((*it)["cat"].asString(), "test");
+    EXPECT_GE((*it)["dur"].asDouble(), 0.0);
+    EXPECT_EQ((*it)["args"]["frame"].asUnsignedInteger(), 1u);
+    names += (*it)["name"].asString() + " ";
+  }
+  // spans are recorded when they end
+  EXPECT_EQ(names, "Inner Outer Worker ");
+  EXPECT_EQ(threads, 2u);
+}
+
+TEST(TestGUIFrameProfiler, KeepsLastSpans)
+{
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::Instance();
+  profiler.Start();
+  const auto now = CGUIFrameProfiler::Clock::now();
+  for (int i = 0; i < 100000; ++i)
+    profiler.AddSpan(i < 99999 ? "Old" : "Last", "test", now, now);
+  profiler.Stop();
+
+  CVariant trace;
+  profiler.GetTrace(trace);
+  const CVariant& events = trace["traceEvents"];
+  ASSERT_GT(events.size(), 1u);
+  EXPECT_LT(events.size(), 100000u);
+  EXPECT_EQ(events[events.size() - 1]["name"].asString(), "Last");
+}
+
+TEST(TestGUIFrameProfiler, SumsUpTotalsPerFrame)
+{
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::Instance();
+  CGUIFrameProfiler::CTotal total("Total", "test");
+  {
+    // not added to while stopped
+    profiler.Stop();
+    CGUIFrameProfiler::CTotalScope scope(total);
+  }
+
+  profiler.Start();
+  profiler.NewFrame();
+  for (int i = 0; i < 100; ++i)
+    CGUIFrameProfiler::CTotalScope scope(total);
+  std::thread([&total] { CGUIFrameProfiler::CTotalScope scope(total); }).join();
+  profiler.NewFrame();
+  // nothing was added in the second frame
+  profiler.NewFrame();
+  profiler.Stop();
+
+  CVariant trace;
+  profiler.GetTrace(trace);
+  const CVariant& events = trace["traceEvents"];
+  unsigned int spans = 0;
+  for (auto it = events.begin_array(); it != events.end_array(); ++it)
+  {
+    if ((*it)["ph"].asString() != "X")
+      continue;
+    ++spans;
+    EXPECT_EQ((*it)["name"].asString(), "Total");
+    EXPECT_EQ((*it)["args"]["count"].asUnsignedInteger(), 101u);
+    EXPECT_EQ((*it)["args"]["frame"].asUnsignedInteger(), 1u);
+    EXPECT_GE((*it)["dur"].asDouble(), 0.0);
+  }
+  EXPECT_EQ(spans, 1u);
+}
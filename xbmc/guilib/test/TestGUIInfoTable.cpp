@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/guiinfo/GUIInfoNameMap.h"
+#include "guilib/guiinfo/GUIInfoTable.h"
+
+#include <array>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::GUILIB::GUIINFO;
+
+namespace
+{
+constexpr std::array<InfoMap, 6> names = {{
+    {"label", 1},
+    {"label2", 2},
+    {"icon", 3},
+    {"thumb", 4},
+    {"", 5},
+    {"actualicon", 6},
+}};
+constexpr CInfoNameMap names_map{names};
+
+// looked up at compile time as well
+static_assert(names_map.Find("thumb")->val == 4);
+static_assert(names_map.Find("thumbs") == nullptr);
+} // unnamed namespace
+
+TEST(TestGUIInfoNameMap, Find)
+{
+  for (const auto& name : names)
+  {
+    const InfoMap* found = names_map.Find(name.str);
+    ASSERT_NE(found, nullptr) << name.str;
+    EXPECT_EQ(found->val, name.val);
+  }
+  EXPECT_EQ(names_map.Find("Label"), nullptr);
+  EXPECT_EQ(names_map.Find("labe"), nullptr);
+  EXPECT_EQ(names_map.Find("label22"), nullptr);
+}
+
+TEST(TestGUIInfoTable, AddDeduplicates)
+{
+  CGUIInfoTable table(10);
+  const int first = table.Add(CGUIInfo(1, 2, 3));
+  const int second = table.Add(CGUIInfo(1, "property"));
+  EXPECT_EQ(first, 0);
+  EXPECT_EQ(second, 1);
+  EXPECT_EQ(table.Add(CGUIInfo(1, 2, 3)), first);
+  EXPECT_EQ(table.Add(CGUIInfo(1, "property")), second);
+  EXPECT_EQ(table.Add(CGUIInfo(1, "property", "other")), 2);
+  EXPECT_EQ(table.Size(), 3u);
+  EXPECT_EQ(table[1].GetData3(), "property");
+}
+
+TEST(TestGUIInfoTable, Capacity)
+{
+  CGUIInfoTable table(CGUIInfoTable::CHUNK_SIZE + 1);
+  for (int i = 0; i <= static_cast<int>(CGUIInfoTable::CHUNK_SIZE); ++i)
+    EXPECT_EQ(table.Add(CGUIInfo(i)), i);
+  EXPECT_EQ(table.Add(CGUIInfo(-1)), -1);
+  EXPECT_EQ(table[CGUIInfoTable::CHUNK_SIZE].GetInfo(), static_cast<int>(CGUIInfoTable::CHUNK_SIZE));
+}
+
+TEST(TestGUIInfoTable, ConcurrentReaders)
+{
+  constexpr int COUNT = 5000;
+  CGUIInfoTable table(COUNT);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&table]() {
+      // every thread adds the same infos, each must get the same index and read it back
+      for (int i = 0; i < COUNT; ++i)
+      {
+        const int index = table.Add(CGUIInfo(i, "info" + std::to_string(i)));
+        ASSERT_GE(index, 0);
+        ASSERT_EQ(table[index].GetInfo(), i);
+        ASSERT_EQ(table[index].GetData3(), "info" + std::to_string(i));
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  EXPECT_EQ(table.Size(), static_cast<size_t>(COUNT));
+}
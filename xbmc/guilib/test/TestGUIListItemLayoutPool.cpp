@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIListItem.h"
+#include "guilib/GUIListItemLayout.h"
+#include "guilib/GUIListItemLayoutPool.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+void GiveLayout(CGUIListItemLayoutPool& pool, const std::shared_ptr<CGUIListItem>& item)
+{
+  item->SetLayout(pool.CreateLayout(item, false, nullptr));
+  item->SetFocusedLayout(pool.CreateLayout(item, true, nullptr));
+}
+} // namespace
+
+class TestGUIListItemLayoutPool : public testing::Test
+{
+protected:
+  TestGUIListItemLayoutPool() { m_pool.SetLayouts(&m_layout, &m_focusedLayout); }
+
+  CGUIListItemLayout m_layout;
+  CGUIListItemLayout m_focusedLayout;
+  CGUIListItemLayoutPool m_pool;
+};
+
+TEST_F(TestGUIListItemLayoutPool, ReusesFreedLayouts)
+{
+  const auto first = std::make_shared<CGUIListItem>();
+  GiveLayout(m_pool, first);
+  const CGUIListItemLayout* layout = first->GetLayout();
+  const CGUIListItemLayout* focusedLayout = first->GetFocusedLayout();
+  ASSERT_NE(layout, nullptr);
+  ASSERT_NE(focusedLayout, nullptr);
+  EXPECT_TRUE(layout->IsCloneOf(&m_layout));
+  EXPECT_TRUE(focusedLayout->IsCloneOf(&m_focusedLayout));
+
+  // the item scrolled out of view
+  m_pool.RecycleLayouts({});
+  EXPECT_EQ(first->GetLayout(), nullptr);
+  EXPECT_EQ(first->GetFocusedLayout(), nullptr);
+  EXPECT_EQ(m_pool.GetPooledLayouts(false), 1u);
+  EXPECT_EQ(m_pool.GetPooledLayouts(true), 1u);
+
+  const auto second = std::make_shared<CGUIListItem>();
+  GiveLayout(m_pool, second);
+  EXPECT_EQ(second->GetLayout(), layout);
+  EXPECT_EQ(second->GetFocusedLayout(), focusedLayout);
+  EXPECT_EQ(m_pool.GetPooledLayouts(false), 0u);
+  EXPECT_EQ(m_pool.GetPooledLayouts(true), 0u);
+}
+
+TEST_F(TestGUIListItemLayoutPool, NeverSharesLayouts)
+{
+  const auto first = std::make_shared<CGUIListItem>();
+  const auto second = std::make_shared<CGUIListItem>();
+  GiveLayout(m_pool, first);
+  GiveLayout(m_pool, second);
+  ASSERT_NE(first->GetLayout(), nullptr);
+  EXPECT_NE(first->GetLayout(), second->GetLayout());
+  EXPECT_NE(first->GetFocusedLayout(), second->GetFocusedLayout());
+
+  // kept items hold on to their layouts, recycled ones are handed out once
+  const std::vector<const CGUIListItem*> kept{first.get()};
+  const CGUIListItemLayout* firstLayout = first->GetLayout();
+  m_pool.RecycleLayouts(kept);
+  EXPECT_EQ(first->GetLayout(), firstLayout);
+  EXPECT_EQ(m_pool.GetPooledLayouts(false), 1u);
+
+  const auto third = std::make_shared<CGUIListItem>();
+  const auto fourth = std::make_shared<CGUIListItem>();
+  GiveLayout(m_pool, third);
+  GiveLayout(m_pool, fourth);
+  EXPECT_NE(third->GetLayout(), firstLayout);
+  EXPECT_NE(fourth->GetLayout(), firstLayout);
+  EXPECT_NE(third->GetLayout(), fourth->GetLayout());
+}
+
+TEST_F(TestGUIListItemLayoutPool, DoesNotKeepRemovedItems)
+{
+  auto item = std::make_shared<CGUIListItem>();
+  const std::weak_ptr<CGUIListItem> weakItem = item;
+  GiveLayout(m_pool, item);
+
+  // the item was removed from the list, its layouts go with it
+  item.reset();
+  EXPECT_TRUE(weakItem.expired());
+  m_pool.RecycleLayouts({});
+  EXPECT_EQ(m_pool.GetPooledLayouts(false), 0u);
+  EXPECT_EQ(m_pool.GetPooledLayouts(true), 0u);
+}
+
+TEST_F(TestGUIListItemLayoutPool, EmptiedOnFreeMemory)
+{
+  const auto first = std::make_shared<CGUIListItem>();
+  const auto second = std::make_shared<CGUIListItem>();
+  GiveLayout(m_pool, first);
+  GiveLayout(m_pool, second);
+  const std::vector<const CGUIListItem*> kept{second.get()};
+  m_pool.RecycleLayouts(kept);
+  ASSERT_EQ(m_pool.GetPooledLayouts(false), 1u);
+
+  m_pool.FreeMemory();
+  EXPECT_EQ(m_pool.GetPooledLayouts(false), 0u);
+  EXPECT_EQ(m_pool.GetPooledLayouts(true), 0u);
+  EXPECT_EQ(second->GetLayout(), nullptr);
+  EXPECT_EQ(second->GetFocusedLayout(), nullptr);
+}
+
+TEST_F(TestGUIListItemLayoutPool, DropsClonesOfOtherLayouts)
+{
+  const auto item = std::make_shared<CGUIListItem>();
+  GiveLayout(m_pool, item);
+
+  // the layout condition of the container changed
+  CGUIListItemLayout layout;
+  m_pool.SetLayouts(&layout, &m_focusedLayout);
+  m_pool.RecycleLayouts({});
+  EXPECT_EQ(m_pool.GetPooledLayouts(false), 0u);
+  EXPECT_EQ(m_pool.GetPooledLayouts(true), 1u);
+
+  const auto other = std::make_shared<CGUIListItem>();
+  GiveLayout(m_pool, other);
+  ASSERT_NE(other->GetLayout(), nullptr);
+  EXPECT_TRUE(other->GetLayout()->IsCloneOf(&layout));
+}
@@ -0,0 +1,138 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIRenderBatch.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+CGUIRenderBatch::State MakeState(unsigned int texture)
+{
+  CGUIRenderBatch::State state;
+  state.texture0 = texture;
+  return state;
+}
+
+// adds a quad and marks its vertices with the given id in u2
+void AddQuad(CGUIRenderBatch& batch,
+             const CGUIRenderBatch::State& state,
+             const CRect& rect,
+             float id)
+{
+  const CGUIRenderBatch::Vertex vertices[4] = {{rect.x1, rect.y1, 0, 0, 0, id, 0},
+                                               {rect.x2, rect.y1, 0, 1, 0, id, 0},
+                                               {rect.x2, rect.y2, 0, 1, 1, id, 0},
+                                               {rect.x1, rect.y2, 0, 0, 1, id, 0}};
+  batch.AddQuad(state, vertices);
+}
+
+// the ids of the quads in the order they are drawn
+std::vector<float> GetDrawOrder(const CGUIRenderBatch& batch)
+{
+  std::vector<float> ids;
+  for (const CGUIRenderBatch::Draw& draw : batch.GetDraws())
+  {
+    for (size_t quad = draw.firstQuad; quad < draw.firstQuad + draw.quadCount; ++quad)
+      ids.emplace_back(batch.GetVertices()[quad * 4].u2);
+  }
+  return ids;
+}
+} // namespace
+
+TEST(TestGUIRenderBatch, MergesQuadsWithTheSameState)
+{
+  CGUIRenderBatch batch;
+  for (int i = 0; i < 10; ++i)
+    AddQuad(batch, MakeState(1), CRect(i * 10.0f, 0, i * 10.0f + 10, 10), i);
+  batch.Build();
+
+  ASSERT_EQ(batch.GetDraws().size(), 1u);
+  EXPECT_EQ(batch.GetDraws()[0].quadCount, 10u);
+  EXPECT_EQ(batch.GetVertices().size(), 40u);
+  EXPECT_EQ(GetDrawOrder(batch), std::vector<float>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(TestGUIRenderBatch, MovesQuadsPastDrawsTheyDoNotOverlap)
+{
+  // a list of items, each a background with an icon on top
+  CGUIRenderBatch batch;
+  for (int i = 0; i < 3; ++i)
+  {
+    const float y = i * 100.0f;
+    AddQuad(batch, MakeState(1), CRect(0, y, 500, y + 100), i * 2);
+    AddQuad(batch, MakeState(2 + i), CRect(10, y + 10, 90, y + 90), i * 2 + 1);
+  }
+  batch.Build();
+
+  // the backgrounds are drawn at once, the icons still over their background
+  ASSERT_EQ(batch.GetDraws().size(), 4u);
+  EXPECT_EQ(batch.GetDraws()[0].state.texture0, 1u);
+  EXPECT_EQ(batch.GetDraws()[0].quadCount, 3u);
+  EXPECT_EQ(GetDrawOrder(batch), std::vector<float>({0, 2, 4, 1, 3, 5}));
+}
+
+TEST(TestGUIRenderBatch, KeepsTheOrderOfOverlappingQuads)
+{
+  CGUIRenderBatch batch;
+  AddQuad(batch, MakeState(1), CRect(0, 0, 100, 100), 0);
+  AddQuad(batch, MakeState(2), CRect(50, 50, 150, 150), 1);
+  AddQuad(batch, MakeState(1), CRect(100, 100, 200, 200), 2);
+  // touching edges do not overlap
+  AddQuad(batch, MakeState(2), CRect(150, 0, 200, 50), 3);
+  batch.Build();
+
+  ASSERT_EQ(batch.GetDraws().size(), 3u);
+  EXPECT_EQ(GetDrawOrder(batch), std::vector<float>({0, 1, 3, 2}));
+}
+
+TEST(TestGUIRenderBatch, SeparatesDifferentStates)
+{
+  CGUIRenderBatch batch;
+  CGUIRenderBatch::State state = MakeState(1);
+  AddQuad(batch, state, CRect(0, 0, 10, 10), 0);
+  state.color = 0x808080FF;
+  AddQuad(batch, state, CRect(10, 0, 20, 10), 1);
+  state.blend = false;
+  AddQuad(batch, state, CRect(20, 0, 30, 10), 2);
+  state.shader = 1;
+  AddQuad(batch, state, CRect(30, 0, 40, 10), 3);
+  state.texture1 = 2;
+  AddQuad(batch, state, CRect(40, 0, 50, 10), 4);
+  state.depth = 0.5f;
+  AddQuad(batch, state, CRect(50, 0, 60, 10), 5);
+  batch.Build();
+
+  EXPECT_EQ(batch.GetDraws().size(), 6u);
+  EXPECT_EQ(GetDrawOrder(batch), std::vector<float>({0, 1, 2, 3, 4, 5}));
+}
+
+TEST(TestGUIRenderBatch, SplitsDrawsAtTheIndexLimit)
+{
+  CGUIRenderBatch batch;
+  const size_t quads = CGUIRenderBatch::MAX_QUADS_PER_DRAW + 10;
+  for (size_t i = 0; i < quads; ++i)
+    AddQuad(batch, MakeState(1), CRect(0, 0, 10, 10), 0);
+  batch.Build();
+
+  ASSERT_EQ(batch.GetDraws().size(), 2u);
+  EXPECT_EQ(batch.GetDraws()[0].quadCount, CGUIRenderBatch::MAX_QUADS_PER_DRAW);
+  EXPECT_EQ(batch.GetDraws()[1].firstQuad, CGUIRenderBatch::MAX_QUADS_PER_DRAW);
+  EXPECT_EQ(batch.GetDraws()[1].quadCount, 10u);
+
+  std::vector<uint16_t> indices;
+  CGUIRenderBatch::GetQuadIndices(indices, quads);
+  ASSERT_EQ(indices.size(), CGUIRenderBatch::MAX_QUADS_PER_DRAW * 6);
+  EXPECT_EQ(indices[6], 4);
+  EXPECT_EQ(indices.back(), static_cast<uint16_t>(CGUIRenderBatch::MAX_QUADS_PER_DRAW * 4 - 4));
+
+  batch.Clear();
+  EXPECT_TRUE(batch.IsEmpty());
+}
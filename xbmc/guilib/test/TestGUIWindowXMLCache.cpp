@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "guilib/GUIWindowXMLCache.h"
+#include "test/TestUtils.h"
+#include "utils/XBMCTinyXML.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+bool WriteFile(const std::string& path, const std::string& content)
+{
+  XFILE::CFile file;
+  if (!file.OpenForWrite(path, true))
+    return false;
+  const bool written = file.Write(content.data(), content.size()) ==
+                       static_cast<ssize_t>(content.size());
+  file.Close();
+  return written;
+}
+} // namespace
+
+TEST(TestGUIWindowXMLCache, ReusesParsedFiles)
+{
+  XFILE::CFile* file = XBMC_CREATETEMPFILE(".xml");
+  ASSERT_NE(file, nullptr);
+  file->Close();
+  const std::string path = XBMC_TEMPFILEPATH(file);
+  ASSERT_TRUE(WriteFile(path, "<window><controls/></window>"));
+
+  CGUIWindowXMLCache cache;
+  const std::shared_ptr<const TiXmlElement> root = cache.Get(path, "");
+  ASSERT_NE(root, nullptr);
+  EXPECT_EQ(root->ValueStr(), "window");
+  EXPECT_NE(root->FirstChildElement("controls"), nullptr);
+  EXPECT_EQ(cache.Get(path, ""), root);
+
+  // a modified file is parsed again
+  ASSERT_TRUE(WriteFile(path, "<window><defaultcontrol>2</defaultcontrol></window>"));
+  const std::shared_ptr<const TiXmlElement> modified = cache.Get(path, "");
+  ASSERT_NE(modified, nullptr);
+  EXPECT_NE(modified, root);
+  EXPECT_NE(modified->FirstChildElement("defaultcontrol"), nullptr);
+
+  cache.Clear();
+  EXPECT_NE(cache.Get(path, ""), modified);
+
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+  EXPECT_EQ(cache.Get(path, ""), nullptr);
+}
+
+TEST(TestGUIWindowXMLCache, DropsLeastRecentlyUsedFiles)
+{
+  std::vector<XFILE::CFile*> files;
+  std::vector<std::string> paths;
+  for (int i = 0; i < 3; i++)
+  {
+    XFILE::CFile* file = XBMC_CREATETEMPFILE(".xml");
+    ASSERT_NE(file, nullptr);
+    file->Close();
+    files.emplace_back(file);
+    paths.emplace_back(XBMC_TEMPFILEPATH(file));
+    ASSERT_TRUE(WriteFile(paths.back(), "<window/>"));
+  }
+
+  CGUIWindowXMLCache cache(2);
+  const std::shared_ptr<const TiXmlElement> first = cache.Get(paths[0], "");
+  const std::shared_ptr<const TiXmlElement> second = cache.Get(paths[1], "");
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+
+  // the first file was used last, so the third one pushes out the second
+  EXPECT_EQ(cache.Get(paths[0], ""), first);
+  ASSERT_NE(cache.Get(paths[2], ""), nullptr);
+  EXPECT_EQ(cache.Get(paths[0], ""), first);
+  EXPECT_NE(cache.Get(paths[1], ""), second);
+
+  for (XFILE::CFile* file : files)
+    EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+}
+
+TEST(TestGUIWindowXMLCache, KeepsPreparedFiles)
+{
+  XFILE::CFile* file = XBMC_CREATETEMPFILE(".xml");
+  ASSERT_NE(file, nullptr);
+  file->Close();
+  const std::string path = XBMC_TEMPFILEPATH(file);
+  ASSERT_TRUE(WriteFile(path, "<window/>"));
+
+  CGUIWindowXMLCache cache;
+  const std::shared_ptr<const TiXmlElement> root = cache.Get(path, "");
+  ASSERT_NE(root, nullptr);
+  EXPECT_EQ(cache.TakePrepared(path, root).root, nullptr);
+
+  auto prepared = std::make_unique<TiXmlElement>(*root);
+  const TiXmlElement* preparedRoot = prepared.get();
+  cache.KeepPrepared(path, root, {std::move(prepared), {}});
+  EXPECT_EQ(cache.TakePrepared(path, root).root.get(), preparedRoot);
+  EXPECT_EQ(cache.TakePrepared(path, root).root, nullptr);
+
+  // a file modified while the window was closed is prepared again
+  cache.KeepPrepared(path, root, {std::make_unique<TiXmlElement>(*root), {}});
+  ASSERT_TRUE(WriteFile(path, "<window><controls/></window>"));
+  const std::shared_ptr<const TiXmlElement> modified = cache.Get(path, "");
+  ASSERT_NE(modified, nullptr);
+  EXPECT_EQ(cache.TakePrepared(path, modified).root, nullptr);
+  EXPECT_EQ(cache.TakePrepared(path, root).root, nullptr);
+
+  // nor is the file kept for a window still holding the old root
+  cache.KeepPrepared(path, root, {std::make_unique<TiXmlElement>(*root), {}});
+  EXPECT_EQ(cache.TakePrepared(path, modified).root, nullptr);
+
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+}
@@ -15,7 +15,9 @@
 #include "dialogs/GUIDialogKaiToast.h"
 #include "dialogs/GUIDialogNumeric.h"
 #include "filesystem/Directory.h"
+#include "filesystem/SpecialProtocol.h"
 #include "guilib/GUIComponent.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/LocalizeStrings.h"
 #include "guilib/StereoscopicsManager.h"
@@ -271,6 +273,33 @@ static int CloseDialog(const std::vector<std::string>& params)
   return 0;
 }
 
+/*! \brief Control the frame profiler.
+ *  \param params The parameters.
+ *  \details params[0] = "start", "stop" or "save".
+ *           params[1] = File to save the trace to (optional).
+ */
+static int FrameProfiler(const std::vector<std::string>& params)
+{
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::Instance();
+  if (StringUtils::EqualsNoCase(params[0], "start"))
+    profiler.Start();
+  else if (StringUtils::EqualsNoCase(params[0], "stop"))
+    profiler.Stop();
+  else if (StringUtils::EqualsNoCase(params[0], "save"))
+  {
+    const std::string file = params.size() > 1 ? params[1] : "special://home/frametrace.json";
+    if (!profiler.SaveTrace(CSpecialProtocol::TranslatePath(file)))
+      return -1;
+  }
+  else
+  {
+    CLog::Log(LOGERROR, "Builtin 'FrameProfiler' called with unknown parameter: {}", params[0]);
+    return -2;
+  }
+
+  return 0;
+}
+
 /*! \brief Send a notification.
  *  \param params The parameters.
  *  \details params[0] = Notification title.
@@ -498,6 +527,16 @@ static int ToggleDirty(const std::vector<std::string>&)
 ///     @param[in] force                 Send "true" to force close (skip animations) (optional).
 ///   }
 ///   \table_row2_l{
+///     <b>`FrameProfiler(command[\,file])`</b>
+///     ,
+///     Controls the frame profiler\, which keeps the timings of the last frames
+///     of the render loop. The trace is saved in the trace event format of
+///     Chrome\, to be opened with chrome://tracing or ui.perfetto.dev.
+///     @param[in] command               "start"\, "stop" or "save".
+///     @param[in] file                  File to save the trace to\, special://home/frametrace.json
+///                                      by default (optional).
+///   }
+///   \table_row2_l{
 ///     <b>`Notification(header\,message[\,time\,image])`</b>
 ///     ,
 ///     Will display a notification dialog with the specified header and message\,
@@ -593,6 +632,7 @@ CBuiltins::CommandMap CGUIBuiltins::GetOperations() const
            {"activatewindowandfocus",         {"Activate the specified window and sets focus to the specified id", 1, ActivateAndFocus<false>}},
            {"clearproperty",                  {"Clears a window property for the current focused window/dialog (key,value)", 1, ClearProperty}},
            {"dialog.close",                   {"Close a dialog", 1, CloseDialog}},
+           {"frameprofiler",                  {"Starts, stops or saves the frame profiler (start|stop|save[,file])", 1, FrameProfiler}},
            {"notification",                   {"Shows a notification on screen, specify header, then message, and optionally time in milliseconds and a icon.", 2, Notification}},
            {"refreshrss",                     {"Reload RSS feeds from RSSFeeds.xml", 0, RefreshRSS}},
            {"replacewindow",                  {"Replaces the current window with the new one", 1, ActivateWindow<true>}},
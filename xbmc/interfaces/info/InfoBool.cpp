@@ -12,8 +12,8 @@
 
 namespace INFO
 {
-InfoBool::InfoBool(const std::string& expression, int context, unsigned int& refreshCounter)
-  : m_context(context), m_expression(expression), m_parentRefreshCounter(refreshCounter)
+InfoBool::InfoBool(const std::string& expression, int context, CInfoSourceTracker& tracker)
+  : m_context(context), m_expression(expression), m_tracker(tracker)
 {
   StringUtils::ToLower(m_expression);
 }
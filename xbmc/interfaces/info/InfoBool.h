@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "InfoSource.h"
+
 #include <memory>
 #include <string>
 
@@ -23,24 +25,35 @@ namespace INFO
 class InfoBool
 {
 public:
-  InfoBool(const std::string &expression, int context, unsigned int &refreshCounter);
+  InfoBool(const std::string& expression, int context, CInfoSourceTracker& tracker);
   virtual ~InfoBool() = default;
 
   virtual void Initialize(CGUIInfoManager* infoMgr) { m_infoMgr = infoMgr; }
 
   /*! \brief Get the value of this info bool
-   This is called to update (if dirty) and fetch the value of the info bool
+   This is called to update (if dirty) and fetch the value of the info bool.
+   It is dirty once one of the sources it depends on changed since it was last updated.
    \param contextWindow the context (window id) where this condition is being evaluated
    \param item the item used to evaluate the bool
    */
   inline bool Get(int contextWindow, const CGUIListItem* item = nullptr)
   {
     if (item && m_listItemDependent)
+    {
+      m_tracker.CountBool(true);
       Update(contextWindow, item);
-    else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
+    }
+    else
     {
-      Update(contextWindow, nullptr);
-      m_refreshCounter = m_parentRefreshCounter;
+      const unsigned int stamp = m_tracker.GetStamp(m_sources);
+      const bool dirty = !m_updated || stamp != m_stamp;
+      m_tracker.CountBool(dirty);
+      if (dirty)
+      {
+        Update(contextWindow, nullptr);
+        m_stamp = stamp;
+        m_updated = true;
+      }
     }
     return m_value;
   }
@@ -68,16 +81,23 @@ public:
 
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
+
+  /*! \brief Get the sources the value of this info bool depends on, known once initialized
+   */
+  InfoSourceMask GetSources() const { return m_sources; }
+
 protected:
   bool m_value = false; ///< current value
   int m_context;               ///< contextual information to go with the condition
   bool m_listItemDependent = false; ///< do not cache if a listitem pointer is given
   std::string  m_expression;   ///< original expression
   CGUIInfoManager* m_infoMgr;
+  InfoSourceMask m_sources = ToMask(InfoSource::FRAME); ///< what the value depends on
 
 private:
-  unsigned int m_refreshCounter = 0;
-  unsigned int &m_parentRefreshCounter;
+  CInfoSourceTracker& m_tracker;
+  unsigned int m_stamp = 0; ///< stamp of the sources at the last update
+  bool m_updated = false;
 };
 
 typedef std::shared_ptr<InfoBool> InfoPtr;
@@ -9,22 +9,35 @@
 #include "InfoExpression.h"
 
 #include "GUIInfoManager.h"
+#include "guilib/GUIFrameProfiler.h"
+#include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <stack>
+#include <string>
+#include <vector>
 
 using namespace INFO;
 
+namespace
+{
+// conditions are evaluated too often to record a span for every one
+CGUIFrameProfiler::CTotal updateTotal("InfoBool::Update", "info");
+} // unnamed namespace
+
 void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
   m_condition = m_infoMgr->TranslateSingleString(m_expression, m_listItemDependent);
+  m_sources = m_infoMgr->GetInfoSources(m_condition);
 }
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
 {
+  CGUIFrameProfiler::CTotalScope scope(updateTotal);
   // use propagated context in case this info has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
@@ -39,6 +52,13 @@ void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
     m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
   }
+  Compile(m_expression_tree);
+  m_expression_tree.reset();
+
+  // the expression is dirty whenever one of its operands is
+  m_sources = 0;
+  for (const auto& operand : m_operands)
+    m_sources |= operand->GetSources();
 }
 
 void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
@@ -46,17 +66,19 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
   // use propagated context in case this info expression has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
-  m_value = m_expression_tree->Evaluate(context, item);
+  int next = 0;
+  while (next >= 0)
+  {
+    const Instruction& instruction = m_code[next];
+    next = instruction.info->Get(context, item) ? instruction.onTrue : instruction.onFalse;
+  }
+  m_value = next == RESULT_TRUE;
 }
 
 /* Expressions are rewritten at parse time into a form which favours the
- * formation of groups of associative nodes. These groups are then reordered at
- * evaluation time such that nodes whose value renders the evaluation of the
- * remainder of the group unnecessary tend to be evaluated first (these are
- * true nodes for OR subexpressions, or false nodes for AND subexpressions).
- * The end effect is to minimise the number of leaf nodes that need to be
- * evaluated in order to determine the value of the expression. The runtime
- * adaptability has the advantage of not being customised for any particular skin.
+ * formation of groups of associative nodes. The end effect is to minimise the
+ * number of leaf nodes that need to be evaluated in order to determine the
+ * value of the expression.
  *
  * The modifications to the expression at parse time fall into two groups:
  * 1) Moving logical NOTs so that they are only applied to leaf nodes.
@@ -65,11 +87,92 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
  * 2) Combining adjacent AND or OR operations such that each path from the root
  *    to a leaf encounters a strictly alternating pattern of AND and OR
  *    operations. So [A|B]|[C|D+[[E|F]|G] becomes A|B|C|[D+[E|F|G]].
+ *
+ * The tree is then compiled. Groups below the root are written in a canonical
+ * form (children sorted) and registered as expressions of their own, so
+ * [D+[E|F|G]] is shared with every other condition containing it, in any order.
+ * What is left is a single group of operands, which becomes a list of tests
+ * jumping to the next test or straight to the result, e.g. for A|B|C|[D+...]
+ *   0: A ? TRUE : 1
+ *   1: B ? TRUE : 2
+ *   2: C ? TRUE : 3
+ *   3: [d+...] ? TRUE : FALSE
+ * Operands whose value stays cached across frames are tested first.
  */
 
-bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* item)
+std::string InfoExpression::GetCanonicalExpression(const InfoSubexpressionPtr& node)
+{
+  if (node->Type() == NODE_LEAF)
+  {
+    const auto& leaf = std::static_pointer_cast<InfoLeaf>(node);
+    return (leaf->IsInverted() ? "!" : "") + leaf->GetInfo()->GetExpression();
+  }
+
+  std::vector<std::string> children;
+  for (const auto& child : std::static_pointer_cast<InfoAssociativeGroup>(node)->GetChildren())
+  {
+    if (child->Type() == NODE_LEAF)
+      children.emplace_back(GetCanonicalExpression(child));
+    else
+      children.emplace_back("[" + GetCanonicalExpression(child) + "]");
+  }
+  std::sort(children.begin(), children.end());
+  return StringUtils::Join(children, node->Type() == NODE_AND ? "+" : "|");
+}
+
+InfoPtr InfoExpression::RegisterOperand(const InfoSubexpressionPtr& node)
 {
-  return m_invert ^ m_info->Get(contextWindow, item);
+  if (node->Type() == NODE_LEAF)
+    return std::static_pointer_cast<InfoLeaf>(node)->GetInfo();
+
+  return m_infoMgr->Register(GetCanonicalExpression(node), m_context);
+}
+
+void InfoExpression::Compile(const InfoSubexpressionPtr& tree)
+{
+  struct Operand
+  {
+    InfoPtr info;
+    bool invert;
+  };
+  std::vector<Operand> operands;
+
+  node_type_t type = tree->Type();
+  if (type == NODE_LEAF)
+  {
+    const auto& leaf = std::static_pointer_cast<InfoLeaf>(tree);
+    operands.push_back({leaf->GetInfo(), leaf->IsInverted()});
+  }
+  else
+  {
+    for (const auto& child : std::static_pointer_cast<InfoAssociativeGroup>(tree)->GetChildren())
+    {
+      const bool invert =
+          child->Type() == NODE_LEAF && std::static_pointer_cast<InfoLeaf>(child)->IsInverted();
+      operands.push_back({RegisterOperand(child), invert});
+    }
+  }
+
+  // operands that are cached across frames are cheap, test them first
+  std::stable_partition(operands.begin(), operands.end(), [](const Operand& operand) {
+    return !(operand.info->GetSources() & ToMask(InfoSource::FRAME));
+  });
+
+  // an OR group is decided by the first true operand, an AND group by the first false one
+  const bool isOr = type != NODE_AND;
+  const int decided = isOr ? RESULT_TRUE : RESULT_FALSE;
+  const int undecided = isOr ? RESULT_FALSE : RESULT_TRUE;
+
+  m_operands.clear();
+  m_code.clear();
+  for (size_t i = 0; i < operands.size(); ++i)
+  {
+    const int next = i + 1 < operands.size() ? static_cast<int>(i + 1) : undecided;
+    // the value of the info that decides the group
+    const bool deciding = isOr != operands[i].invert;
+    m_code.push_back({operands[i].info.get(), deciding ? decided : next, deciding ? next : decided});
+    m_operands.push_back(std::move(operands[i].info));
+  }
 }
 
 InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
@@ -92,29 +195,6 @@ void InfoExpression::InfoAssociativeGroup::Merge(const std::shared_ptr<InfoAssoc
   m_children.splice(m_children.end(), other->m_children);
 }
 
-bool InfoExpression::InfoAssociativeGroup::Evaluate(int contextWindow, const CGUIListItem* item)
-{
-  /* Handle either AND or OR by using the relation
-   * A AND B == !(!A OR !B)
-   * to convert ANDs into ORs
-   */
-  std::list<InfoSubexpressionPtr>::iterator last = m_children.end();
-  std::list<InfoSubexpressionPtr>::iterator it = m_children.begin();
-  bool use_and = (m_type == NODE_AND);
-  bool result = use_and ^ (*it)->Evaluate(contextWindow, item);
-  while (!result && ++it != last)
-  {
-    result = use_and ^ (*it)->Evaluate(contextWindow, item);
-    if (result)
-    {
-      /* Move this child to the head of the list so we evaluate faster next time */
-      m_children.push_front(*it);
-      m_children.erase(it);
-    }
-  }
-  return use_and ^ result;
-}
-
 /* Expressions are parsed using the shunting-yard algorithm. Binary operators
  * (AND/OR) are treated as right-associative so that we don't need to make a
  * special case for the unary NOT operator. This has no effect upon the answers
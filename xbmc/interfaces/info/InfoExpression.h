@@ -12,6 +12,7 @@
 
 #include <list>
 #include <stack>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -24,8 +25,8 @@ namespace INFO
 class InfoSingle : public InfoBool
 {
 public:
-  InfoSingle(const std::string& expression, int context, unsigned int& refreshCounter)
-    : InfoBool(expression, context, refreshCounter)
+  InfoSingle(const std::string& expression, int context, CInfoSourceTracker& tracker)
+    : InfoBool(expression, context, tracker)
   {
   }
   void Initialize(CGUIInfoManager* infoMgr) override;
@@ -37,12 +38,15 @@ private:
 };
 
 /*! \brief Class to wrap active boolean expressions
+ Expressions are compiled to a flat list of tests with short-circuit jumps. Bracketed
+ sub-expressions are registered as expressions of their own, so all conditions using the
+ same sub-expression share it and its cached value.
  */
 class InfoExpression : public InfoBool
 {
 public:
-  InfoExpression(const std::string& expression, int context, unsigned int& refreshCounter)
-    : InfoBool(expression, context, refreshCounter)
+  InfoExpression(const std::string& expression, int context, CInfoSourceTracker& tracker)
+    : InfoBool(expression, context, tracker)
   {
   }
   ~InfoExpression() override = default;
@@ -69,12 +73,11 @@ private:
     NODE_OR,
   } node_type_t;
 
-  // An abstract base class for nodes in the expression tree
+  // An abstract base class for nodes in the expression tree, only used while compiling
   class InfoSubexpression
   {
   public:
     virtual ~InfoSubexpression(void) = default; // so we can destruct derived classes using a pointer to their base class
-    virtual bool Evaluate(int contextWindow, const CGUIListItem* item) = 0;
     virtual node_type_t Type() const=0;
   };
 
@@ -85,8 +88,9 @@ private:
   {
   public:
     InfoLeaf(InfoPtr info, bool invert) : m_info(std::move(info)), m_invert(invert) {}
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return NODE_LEAF; }
+    const InfoPtr& GetInfo() const { return m_info; }
+    bool IsInverted() const { return m_invert; }
 
   private:
     InfoPtr m_info;
@@ -100,18 +104,38 @@ private:
     InfoAssociativeGroup(node_type_t type, const InfoSubexpressionPtr &left, const InfoSubexpressionPtr &right);
     void AddChild(const InfoSubexpressionPtr &child);
     void Merge(const std::shared_ptr<InfoAssociativeGroup>& other);
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return m_type; }
+    const std::list<InfoSubexpressionPtr>& GetChildren() const { return m_children; }
 
   private:
     node_type_t m_type;
     std::list<InfoSubexpressionPtr> m_children;
   };
 
+  /*! \brief A test of the compiled expression
+   The info is evaluated and the evaluation continues with the instruction of the outcome,
+   until the outcome is one of the results.
+   */
+  struct Instruction
+  {
+    InfoBool* info; ///< the info to test, owned by m_operands
+    int onTrue; ///< next instruction if the info is true, or a result
+    int onFalse; ///< next instruction if the info is false, or a result
+  };
+
+  static constexpr int RESULT_FALSE = -1;
+  static constexpr int RESULT_TRUE = -2;
+
   static operator_t GetOperator(char ch);
   static void OperatorPop(std::stack<operator_t> &operator_stack, bool &invert, std::stack<InfoSubexpressionPtr> &nodes);
   bool Parse(const std::string &expression);
-  InfoSubexpressionPtr m_expression_tree;
+  static std::string GetCanonicalExpression(const InfoSubexpressionPtr& node);
+  InfoPtr RegisterOperand(const InfoSubexpressionPtr& node);
+  void Compile(const InfoSubexpressionPtr& tree);
+
+  InfoSubexpressionPtr m_expression_tree; ///< only set while parsing
+  std::vector<InfoPtr> m_operands;
+  std::vector<Instruction> m_code;
 };
 
 };
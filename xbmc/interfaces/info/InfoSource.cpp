@@ -0,0 +1,28 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "InfoSource.h"
+
+using namespace INFO;
+
+void CInfoSourceTracker::NewFrame()
+{
+  Invalidate(InfoSource::FRAME);
+
+  const std::time_t now = std::time(nullptr);
+  if (now != m_lastSecond)
+  {
+    m_lastSecond = now;
+    Invalidate(InfoSource::CLOCK);
+  }
+
+  m_lastFrame.boolsEvaluated = m_boolsEvaluated.exchange(0, std::memory_order_relaxed);
+  m_lastFrame.boolsCached = m_boolsCached.exchange(0, std::memory_order_relaxed);
+  m_lastFrame.labelsEvaluated = m_labelsEvaluated.exchange(0, std::memory_order_relaxed);
+  m_lastFrame.labelsCached = m_labelsCached.exchange(0, std::memory_order_relaxed);
+}
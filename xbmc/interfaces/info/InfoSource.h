@@ -0,0 +1,109 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <ctime>
+
+namespace INFO
+{
+/*!
+ \ingroup info
+ \brief What the value of an info depends on
+ */
+enum class InfoSource : unsigned int
+{
+  FRAME = 0, ///< not tracked, may change at any time and is refreshed every frame
+  SKIN_SETTINGS, ///< Skin.HasSetting, Skin.String, Skin.Numeric
+  CLOCK, ///< System.Time and System.Date, changes every second
+  WINDOW_PROPERTIES, ///< Window(id).Property of a given window
+  COUNT
+};
+
+/*! \brief Set of InfoSource, an info without any source is constant */
+using InfoSourceMask = unsigned int;
+
+constexpr InfoSourceMask ToMask(InfoSource source)
+{
+  return 1u << static_cast<unsigned int>(source);
+}
+
+/*!
+ \ingroup info
+ \brief Counts of info evaluations of the last frame
+ */
+struct InfoFrameStats
+{
+  unsigned int boolsEvaluated = 0;
+  unsigned int boolsCached = 0;
+  unsigned int labelsEvaluated = 0;
+  unsigned int labelsCached = 0;
+};
+
+/*!
+ \ingroup info
+ \brief Keeps a version per info source, bumped whenever something the source covers changes
+
+ Infos remember the stamp of their sources when evaluated and are evaluated again only once it
+ differs, so infos that depend on nothing that changes every frame are not evaluated every frame.
+ */
+class CInfoSourceTracker
+{
+public:
+  /*! \brief Mark all infos depending on the given source as dirty */
+  void Invalidate(InfoSource source)
+  {
+    m_versions[static_cast<unsigned int>(source)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /*! \brief Mark all infos as dirty, whatever they depend on */
+  void InvalidateAll() { m_all.fetch_add(1, std::memory_order_relaxed); }
+
+  /*! \brief Start a new frame, infos depending on FRAME or on a clock that ticked are dirty */
+  void NewFrame();
+
+  /*! \brief Get a value that changes whenever one of the given sources changes
+   \param sources the sources an info depends on
+   */
+  unsigned int GetStamp(InfoSourceMask sources) const
+  {
+    unsigned int stamp = m_all.load(std::memory_order_relaxed);
+    for (unsigned int i = 0; sources; ++i, sources >>= 1)
+    {
+      if (sources & 1)
+        stamp += m_versions[i].load(std::memory_order_relaxed);
+    }
+    return stamp;
+  }
+
+  void CountBool(bool evaluated)
+  {
+    (evaluated ? m_boolsEvaluated : m_boolsCached).fetch_add(1, std::memory_order_relaxed);
+  }
+  void CountLabel(bool evaluated)
+  {
+    (evaluated ? m_labelsEvaluated : m_labelsCached).fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /*! \brief Get the counts of evaluated and cached infos of the last complete frame */
+  const InfoFrameStats& GetLastFrameStats() const { return m_lastFrame; }
+
+private:
+  std::array<std::atomic_uint, static_cast<unsigned int>(InfoSource::COUNT)> m_versions{};
+  std::atomic_uint m_all{0};
+  std::time_t m_lastSecond = 0;
+
+  std::atomic_uint m_boolsEvaluated{0};
+  std::atomic_uint m_boolsCached{0};
+  std::atomic_uint m_labelsEvaluated{0};
+  std::atomic_uint m_labelsCached{0};
+  InfoFrameStats m_lastFrame;
+};
+} // namespace INFO
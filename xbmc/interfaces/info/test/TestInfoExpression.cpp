@@ -0,0 +1,202 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIInfoManager.h"
+#include "filesystem/SpecialProtocol.h"
+#include "interfaces/info/Info.h"
+#include "test/TestUtils.h"
+#include "utils/StringUtils.h"
+#include "utils/XBMCTinyXML.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+const std::string T = "integer.isequal(1,1)";
+const std::string F = "integer.isequal(1,2)";
+
+struct ExpressionTest
+{
+  std::string expression;
+  bool value;
+};
+
+const auto ExpressionTests = std::array{
+    ExpressionTest{T + "|" + F, true},
+    ExpressionTest{T + "+" + F, false},
+    ExpressionTest{"!" + T + "|" + F, false},
+    ExpressionTest{"![" + T + "+" + F + "]", true},
+    ExpressionTest{"!" + F + "+!" + F, true},
+    ExpressionTest{"[" + T + "|" + F + "]+[" + F + "|" + T + "]", true},
+    ExpressionTest{"[" + T + "+" + F + "]|[" + F + "+" + T + "]", false},
+    ExpressionTest{"[" + T + "+[" + F + "|" + T + "]]+!" + F, true},
+    ExpressionTest{"!" + T + "|![" + F + "|![" + T + "+" + F + "]]", false},
+};
+
+class TestInfoExpression : public testing::WithParamInterface<ExpressionTest>,
+                           public testing::Test
+{
+};
+
+void CollectConditions(const TiXmlElement* element,
+                       std::vector<std::string>& conditions,
+                       std::map<std::string, std::string>& expressions)
+{
+  for (; element; element = element->NextSiblingElement())
+  {
+    const std::string& name = element->ValueStr();
+    if (name == "expression" && element->Attribute("name") && element->GetText())
+      expressions[element->Attribute("name")] = element->GetText();
+    else if ((name == "visible" || name == "enable" || name == "selected" ||
+              name == "usealttexture") &&
+             element->GetText())
+      conditions.emplace_back(element->GetText());
+
+    if (const char* condition = element->Attribute("condition"))
+      conditions.emplace_back(condition);
+
+    CollectConditions(element->FirstChildElement(), conditions, expressions);
+  }
+}
+
+/*!
+ \brief Replace the operands of a condition by integer comparisons with a fixed outcome
+
+ Keeps the structure of the condition and which operands it shares with others, but does not
+ depend on anything running, so only the expressions themselves are measured.
+ */
+std::string ReplaceOperands(const std::string& condition, std::map<std::string, int>& operands)
+{
+  std::string result;
+  std::string operand;
+  auto flush = [&]() {
+    StringUtils::Trim(operand);
+    if (!operand.empty())
+    {
+      StringUtils::ToLower(operand);
+      const auto it = operands.try_emplace(operand, static_cast<int>(operands.size())).first;
+      const int index = it->second;
+      // about half of the operands are true
+      if (std::hash<std::string>{}(operand) % 2)
+        result += StringUtils::Format("integer.isequal({},{})", index, index);
+      else
+        result += StringUtils::Format("integer.isequal({},-1)", index);
+    }
+    operand.clear();
+  };
+
+  for (const char c : condition)
+  {
+    if (c == '[' || c == ']' || c == '!' || c == '+' || c == '|')
+    {
+      flush();
+      result += c;
+    }
+    else
+      operand += c;
+  }
+  flush();
+  return result;
+}
+} // namespace
+
+TEST_P(TestInfoExpression, Evaluate)
+{
+  CGUIInfoManager infoMgr;
+  INFO::InfoPtr info = infoMgr.Register(GetParam().expression);
+  ASSERT_NE(info, nullptr);
+  EXPECT_EQ(info->Get(INFO::DEFAULT_CONTEXT), GetParam().value);
+}
+
+INSTANTIATE_TEST_SUITE_P(TestInfoExpression,
+                         TestInfoExpression,
+                         testing::ValuesIn(ExpressionTests));
+
+TEST(TestInfoExpression, SharedSubexpressions)
+{
+  CGUIInfoManager infoMgr;
+  // sub-expressions are registered in a canonical form, whatever the order of their operands
+  INFO::InfoPtr shared = infoMgr.Register(T + "+" + F);
+  const long uses = shared.use_count();
+
+  INFO::InfoPtr first = infoMgr.Register(F + "|[" + F + "+" + T + "]");
+  INFO::InfoPtr second = infoMgr.Register("[" + T + "+" + F + "]|!" + F);
+  EXPECT_EQ(shared.use_count(), uses + 2);
+  EXPECT_FALSE(first->Get(INFO::DEFAULT_CONTEXT));
+  EXPECT_TRUE(second->Get(INFO::DEFAULT_CONTEXT));
+}
+
+// Evaluates the conditions of a skin, run with
+//   kodi-test --gtest_also_run_disabled_tests --gtest_filter=TestInfoExpression.DISABLED_Benchmark
+// on two builds to compare them.
+// Optional:
+//   KODI_INFO_BENCHMARK_SKIN=<dir>     xml folder of the skin, Estuary by default
+//   KODI_INFO_BENCHMARK_ROUNDS=<n>     number of times all conditions are evaluated
+TEST(TestInfoExpression, DISABLED_Benchmark)
+{
+  std::string folder = XBMC_REF_FILE_PATH("addons/skin.estuary/xml");
+  if (const char* skin = std::getenv("KODI_INFO_BENCHMARK_SKIN"))
+    folder = skin;
+  int rounds = 1000;
+  if (const char* value = std::getenv("KODI_INFO_BENCHMARK_ROUNDS"))
+    rounds = std::max(1, std::atoi(value));
+
+  std::vector<std::string> conditions;
+  std::map<std::string, std::string> expressions;
+  for (const auto& entry :
+       std::filesystem::directory_iterator(CSpecialProtocol::TranslatePath(folder)))
+  {
+    if (entry.path().extension() != ".xml")
+      continue;
+    CXBMCTinyXML doc;
+    if (doc.LoadFile(entry.path().string()))
+      CollectConditions(doc.RootElement(), conditions, expressions);
+  }
+  ASSERT_FALSE(conditions.empty()) << "no conditions found in " << folder;
+
+  CGUIInfoManager infoMgr;
+  std::map<std::string, int> operands;
+  std::vector<INFO::InfoPtr> infos;
+  for (std::string condition : conditions)
+  {
+    for (const auto& [name, expression] : expressions)
+      StringUtils::Replace(condition, "$EXP[" + name + "]", "[" + expression + "]");
+    // parameters of includes and variables are only known once the skin is loaded
+    if (condition.find('$') != std::string::npos)
+      continue;
+    if (INFO::InfoPtr info = infoMgr.Register(ReplaceOperands(condition, operands)))
+      infos.emplace_back(std::move(info));
+  }
+  ASSERT_FALSE(infos.empty());
+
+  const auto start = std::chrono::steady_clock::now();
+  unsigned int trueCount = 0;
+  for (int round = 0; round < rounds; ++round)
+  {
+    infoMgr.ResetCache();
+    for (const auto& info : infos)
+      trueCount += info->Get(INFO::DEFAULT_CONTEXT);
+  }
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << infos.size() << " conditions, " << operands.size() << " operands, "
+            << trueCount / rounds << " true" << std::endl;
+  std::cout << elapsed.count() / (static_cast<double>(rounds) * infos.size())
+            << " ns per evaluation" << std::endl;
+}
@@ -0,0 +1,168 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIInfoManager.h"
+#include "addons/Skin.h"
+#include "addons/addoninfo/AddonInfo.h"
+#include "addons/addoninfo/AddonType.h"
+#include "interfaces/info/InfoBool.h"
+#include "interfaces/info/InfoSource.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+using namespace INFO;
+
+namespace
+{
+class CCountingBool : public InfoBool
+{
+public:
+  CCountingBool(CInfoSourceTracker& tracker, InfoSourceMask sources)
+    : InfoBool("test", 0, tracker)
+  {
+    m_sources = sources;
+  }
+
+  void Update(int contextWindow, const CGUIListItem* item) override { ++m_updates; }
+
+  unsigned int m_updates = 0;
+};
+} // namespace
+
+TEST(TestInfoSource, FrameIsEvaluatedEveryFrame)
+{
+  CInfoSourceTracker tracker;
+  CCountingBool info(tracker, ToMask(InfoSource::FRAME));
+
+  info.Get(0);
+  info.Get(0);
+  EXPECT_EQ(1u, info.m_updates);
+
+  tracker.NewFrame();
+  info.Get(0);
+  EXPECT_EQ(2u, info.m_updates);
+}
+
+TEST(TestInfoSource, TrackedIsEvaluatedOnChange)
+{
+  CInfoSourceTracker tracker;
+  CCountingBool info(tracker, ToMask(InfoSource::SKIN_SETTINGS));
+
+  info.Get(0);
+  tracker.NewFrame();
+  tracker.Invalidate(InfoSource::WINDOW_PROPERTIES);
+  info.Get(0);
+  EXPECT_EQ(1u, info.m_updates);
+
+  tracker.Invalidate(InfoSource::SKIN_SETTINGS);
+  info.Get(0);
+  EXPECT_EQ(2u, info.m_updates);
+
+  tracker.InvalidateAll();
+  info.Get(0);
+  EXPECT_EQ(3u, info.m_updates);
+}
+
+TEST(TestInfoSource, ConstantIsEvaluatedOnce)
+{
+  CInfoSourceTracker tracker;
+  CCountingBool info(tracker, 0);
+
+  for (int i = 0; i < 3; ++i)
+  {
+    info.Get(0);
+    tracker.NewFrame();
+  }
+  EXPECT_EQ(1u, info.m_updates);
+}
+
+TEST(TestInfoSource, FrameStats)
+{
+  CInfoSourceTracker tracker;
+  CCountingBool tracked(tracker, ToMask(InfoSource::SKIN_SETTINGS));
+  CCountingBool untracked(tracker, ToMask(InfoSource::FRAME));
+
+  tracked.Get(0);
+  tracker.NewFrame();
+  tracked.Get(0);
+  untracked.Get(0);
+  tracker.NewFrame();
+
+  const InfoFrameStats& stats = tracker.GetLastFrameStats();
+  EXPECT_EQ(1u, stats.boolsEvaluated);
+  EXPECT_EQ(1u, stats.boolsCached);
+}
+
+class TestInfoSources : public testing::Test
+{
+protected:
+  // skin settings are translated by the skin
+  TestInfoSources()
+    : m_skin(std::exchange(g_SkinInfo,
+                           std::make_shared<ADDON::CSkinInfo>(
+                               std::make_shared<ADDON::CAddonInfo>(), RESOLUTION_INFO())))
+  {
+  }
+  ~TestInfoSources() override { g_SkinInfo = m_skin; }
+
+  InfoSourceMask GetSources(const std::string& info)
+  {
+    return m_infoMgr.GetInfoSources(m_infoMgr.TranslateString(info));
+  }
+
+  std::shared_ptr<ADDON::CSkinInfo> m_skin;
+  CGUIInfoManager m_infoMgr;
+};
+
+TEST_F(TestInfoSources, Infos)
+{
+  const InfoSourceMask skin = ToMask(InfoSource::SKIN_SETTINGS);
+  EXPECT_EQ(skin, GetSources("skin.hassetting(test)"));
+  EXPECT_EQ(skin, GetSources("skin.string(test)"));
+  EXPECT_EQ(skin, GetSources("skin.string(test,value)"));
+  EXPECT_EQ(skin, GetSources("skin.numeric(test)"));
+
+  EXPECT_EQ(ToMask(InfoSource::CLOCK), GetSources("system.time"));
+  EXPECT_EQ(ToMask(InfoSource::CLOCK), GetSources("system.date"));
+  EXPECT_EQ(ToMask(InfoSource::WINDOW_PROPERTIES), GetSources("window(home).property(test)"));
+  // without a window the property is the one of the window rendered
+  EXPECT_EQ(ToMask(InfoSource::FRAME), GetSources("window.property(test)"));
+  EXPECT_EQ(ToMask(InfoSource::FRAME), GetSources("player.playing"));
+
+  EXPECT_EQ(0u, GetSources("true"));
+  EXPECT_EQ(0u, GetSources("false"));
+  EXPECT_EQ(0u, GetSources("integer.isequal(1,2)"));
+}
+
+TEST_F(TestInfoSources, Comparisons)
+{
+  const InfoSourceMask skin = ToMask(InfoSource::SKIN_SETTINGS);
+  const InfoSourceMask clock = ToMask(InfoSource::CLOCK);
+  EXPECT_EQ(skin, GetSources("string.isempty(skin.string(test))"));
+  EXPECT_EQ(skin, GetSources("string.isequal(skin.string(test),value)"));
+  EXPECT_EQ(skin | clock, GetSources("string.contains(system.time,skin.string(test))"));
+  EXPECT_EQ(skin, GetSources("integer.isgreater(skin.numeric(test),3)"));
+  EXPECT_EQ(skin | ToMask(InfoSource::FRAME),
+            GetSources("integer.isequal(skin.numeric(test),player.volume)"));
+}
+
+TEST_F(TestInfoSources, Expressions)
+{
+  // an expression depends on everything its leaves depend on
+  const InfoPtr info = m_infoMgr.Register("skin.hassetting(test) + !string.isempty(system.time)");
+  ASSERT_NE(info, nullptr);
+  EXPECT_EQ(ToMask(InfoSource::SKIN_SETTINGS) | ToMask(InfoSource::CLOCK), info->GetSources());
+
+  const InfoPtr constant = m_infoMgr.Register("integer.isequal(1,1) | false");
+  ASSERT_NE(constant, nullptr);
+  EXPECT_EQ(0u, constant->GetSources());
+}
@@ -32,6 +32,7 @@
 #include "utils/Variant.h"
 
 #include <memory>
+#include <vector>
 
 #include <music/MusicLibraryQueue.h>
 
@@ -513,6 +514,46 @@ JSONRPC_STATUS CAudioLibrary::GetSongDetails(const std::string &method, ITranspo
   return OK;
 }
 
+JSONRPC_STATUS CAudioLibrary::GetSongDuplicates(const std::string& method,
+                                                ITransportLayer* transport,
+                                                IClient* client,
+                                                const CVariant& parameterObject,
+                                                CVariant& result)
+{
+  int idSong = static_cast<int>(parameterObject["songid"].asInteger());
+
+  CMusicDatabase musicdatabase;
+  if (!musicdatabase.Open())
+    return InternalError;
+
+  CSong song;
+  if (!musicdatabase.GetSong(idSong, song))
+    return InvalidParams;
+
+  std::vector<int> duplicates;
+  if (!musicdatabase.GetSongDuplicates(idSong, duplicates))
+    return InternalError;
+
+  CFileItemList items;
+  for (int idDuplicate : duplicates)
+  {
+    CSong duplicate;
+    if (!musicdatabase.GetSong(idDuplicate, duplicate))
+      continue;
+
+    CFileItemPtr item = std::make_shared<CFileItem>(duplicate);
+    FillItemArtistIDs(duplicate.GetArtistIDArray(), item);
+    items.Add(item);
+  }
+
+  JSONRPC_STATUS ret = GetAdditionalSongDetails(parameterObject, items, musicdatabase);
+  if (ret != OK)
+    return ret;
+
+  HandleFileItemList("songid", true, "songs", items, parameterObject, result);
+  return OK;
+}
+
 JSONRPC_STATUS CAudioLibrary::GetRecentlyAddedAlbums(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
   CMusicDatabase musicdatabase;
@@ -881,20 +881,24 @@ JSONRPC_STATUS CSettingsOperations::SetSkinSettingValue(const std::string& metho
   if (setting == nullptr)
     return InvalidParams;
 
+  // set through CSkinSettings, so the change is saved and the infos using it are updated
+  CSkinSettings& skinSettings = CSkinSettings::GetInstance();
   CVariant value = parameterObject["value"];
   if (setting->GetType() == "string")
   {
     if (!value.isString())
       return InvalidParams;
 
-    result = std::static_pointer_cast<ADDON::CSkinSettingString>(setting)->value = value.asString();
+    skinSettings.SetString(skinSettings.TranslateString(settingId), value.asString());
+    result = value.asString();
   }
   else if (setting->GetType() == "bool")
   {
     if (!value.isBoolean())
       return InvalidParams;
 
-    result = std::static_pointer_cast<ADDON::CSkinSettingBool>(setting)->value = value.asBoolean();
+    skinSettings.SetBool(skinSettings.TranslateBool(settingId), value.asBoolean());
+    result = value.asBoolean();
   }
   else
   {
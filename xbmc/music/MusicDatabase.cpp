@@ -65,6 +65,7 @@
 #include "utils/XMLUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <inttypes.h>
@@ -251,6 +252,16 @@ void CMusicDatabase::CreateTables()
 
   CLog::Log(LOGINFO, "create removed_link table");
   m_pDS->exec("CREATE TABLE removed_link (idArtist INTEGER, idMedia INTEGER, idRole INTEGER)");
+
+  CLog::Log(LOGINFO, "create songfingerprint table");
+  m_pDS->exec("CREATE TABLE songfingerprint (idSong INTEGER PRIMARY KEY, iVersion INTEGER, "
+              "strFingerprint TEXT)");
+
+  CLog::Log(LOGINFO, "create songloudness table");
+  m_pDS->exec("CREATE TABLE songloudness (idSong INTEGER PRIMARY KEY, iVersion INTEGER)");
+
+  CLog::Log(LOGINFO, "create songduplicate table");
+  m_pDS->exec("CREATE TABLE songduplicate (idSong INTEGER PRIMARY KEY, idGroup INTEGER)");
 }
 
 void CMusicDatabase::CreateAnalytics()
@@ -300,6 +311,8 @@ void CMusicDatabase::CreateAnalytics()
 
   m_pDS->exec("CREATE INDEX idxDiscography_1 ON discography ( idArtist )");
 
+  m_pDS->exec("CREATE INDEX idxSongDuplicate ON songduplicate ( idGroup )");
+
   m_pDS->exec("CREATE INDEX ix_art ON art(media_id, media_type(20), type(20))");
 
   CLog::Log(LOGINFO, "create triggers");
@@ -319,6 +332,9 @@ void CMusicDatabase::CreateAnalytics()
               "  DELETE FROM song_artist WHERE song_artist.idSong = old.idSong;"
               "  DELETE FROM song_genre WHERE song_genre.idSong = old.idSong;"
               "  DELETE FROM art WHERE media_id=old.idSong AND media_type='song';"
+              "  DELETE FROM songfingerprint WHERE songfingerprint.idSong = old.idSong;"
+              "  DELETE FROM songloudness WHERE songloudness.idSong = old.idSong;"
+              "  DELETE FROM songduplicate WHERE songduplicate.idSong = old.idSong;"
               " END");
   m_pDS->exec("CREATE TRIGGER tgrDeleteSource AFTER delete ON source FOR EACH ROW BEGIN"
               "  DELETE FROM source_path WHERE source_path.idSource = old.idSource;"
@@ -9431,6 +9447,16 @@ void CMusicDatabase::UpdateTables(int version)
   if (version < 83)
     m_pDS->exec("ALTER TABLE song ADD strVideoURL TEXT");
 
+  if (version < 84)
+    m_pDS->exec("CREATE TABLE songfingerprint (idSong INTEGER PRIMARY KEY, iVersion INTEGER, "
+                "strFingerprint TEXT)");
+
+  if (version < 85)
+    m_pDS->exec("CREATE TABLE songloudness (idSong INTEGER PRIMARY KEY, iVersion INTEGER)");
+
+  if (version < 86)
+    m_pDS->exec("CREATE TABLE songduplicate (idSong INTEGER PRIMARY KEY, idGroup INTEGER)");
+
   // Set the version of tag scanning required.
   // Not every schema change requires the tags to be rescanned, set to the highest schema version
   // that needs this. Forced rescanning (of music files that have not changed since they were
@@ -9451,7 +9477,7 @@ void CMusicDatabase::UpdateTables(int version)
 
 int CMusicDatabase::GetSchemaVersion() const
 {
-  return 83;
+  return 86;
 }
 
 int CMusicDatabase::GetMusicNeedsTagScan()
@@ -11523,6 +11549,277 @@ bool CMusicDatabase::SetSongVotes(const std::string& filePath, int votes)
   return false;
 }
 
+bool CMusicDatabase::GetSongsWithoutReplayGain(int version, std::vector<SongReplayGain>& songs)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    songs.clear();
+
+    // all songs of an album are needed for the album gain, even if some are tagged
+    std::string sql =
+        PrepareSQL("SELECT song.idSong, song.idAlbum, path.strPath, song.strFileName, "
+                   "song.iStartOffset, song.iEndOffset, song.strReplayGain "
+                   "FROM song JOIN path ON song.idPath = path.idPath "
+                   "WHERE song.idAlbum IN (SELECT DISTINCT song.idAlbum FROM song "
+                   "LEFT JOIN songloudness ON song.idSong = songloudness.idSong "
+                   "WHERE (songloudness.idSong IS NULL OR songloudness.iVersion <> %i) "
+                   "AND (strReplayGain IS NULL OR strReplayGain = '' "
+                   "OR strReplayGain LIKE '-1000%%' OR strReplayGain LIKE '%%-1000, -1')) "
+                   "ORDER BY song.idAlbum, song.iTrack",
+                   version);
+    if (!m_pDS->query(sql))
+      return false;
+
+    songs.reserve(m_pDS->num_rows());
+    while (!m_pDS->eof())
+    {
+      SongReplayGain song;
+      song.idSong = m_pDS->fv(0).get_asInt();
+      song.idAlbum = m_pDS->fv(1).get_asInt();
+      song.strFileName =
+          URIUtils::AddFileToFolder(m_pDS->fv(2).get_asString(), m_pDS->fv(3).get_asString());
+      song.iStartOffset = m_pDS->fv(4).get_asInt();
+      song.iEndOffset = m_pDS->fv(5).get_asInt();
+      song.replayGain.Set(m_pDS->fv(6).get_asString());
+      songs.push_back(std::move(song));
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
+bool CMusicDatabase::SetSongReplayGain(int idSong, const ReplayGain& replayGain)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    std::string sql = PrepareSQL("UPDATE song SET strReplayGain = '%s' WHERE idSong = %i",
+                                 replayGain.Get().c_str(), idSong);
+    m_pDS->exec(sql);
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", idSong);
+  }
+  return false;
+}
+
+bool CMusicDatabase::SetSongLoudnessMeasured(int idSong, int version)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    std::string sql =
+        PrepareSQL("REPLACE INTO songloudness (idSong, iVersion) VALUES (%i, %i)", idSong, version);
+    m_pDS->exec(sql);
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", idSong);
+  }
+  return false;
+}
+
+bool CMusicDatabase::GetSongsWithoutFingerprint(int version, std::vector<SongFingerprint>& songs)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    songs.clear();
+
+    std::string sql = PrepareSQL("SELECT song.idSong, path.strPath, song.strFileName, "
+                                 "song.iStartOffset, song.iEndOffset "
+                                 "FROM song JOIN path ON song.idPath = path.idPath "
+                                 "LEFT JOIN songfingerprint ON song.idSong = songfingerprint.idSong "
+                                 "WHERE songfingerprint.idSong IS NULL OR "
+                                 "songfingerprint.iVersion <> %i "
+                                 "ORDER BY song.idSong",
+                                 version);
+    if (!m_pDS->query(sql))
+      return false;
+
+    songs.reserve(m_pDS->num_rows());
+    while (!m_pDS->eof())
+    {
+      SongFingerprint song;
+      song.idSong = m_pDS->fv(0).get_asInt();
+      song.strFileName =
+          URIUtils::AddFileToFolder(m_pDS->fv(1).get_asString(), m_pDS->fv(2).get_asString());
+      song.iStartOffset = m_pDS->fv(3).get_asInt();
+      song.iEndOffset = m_pDS->fv(4).get_asInt();
+      songs.push_back(std::move(song));
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
+bool CMusicDatabase::GetSongFingerprints(int version,
+                                         int idAfter,
+                                         int limit,
+                                         std::vector<SongFingerprint>& songs)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    songs.clear();
+
+    std::string sql = PrepareSQL("SELECT song.idSong, path.strPath, song.strFileName, "
+                                 "songfingerprint.strFingerprint "
+                                 "FROM songfingerprint "
+                                 "JOIN song ON song.idSong = songfingerprint.idSong "
+                                 "JOIN path ON song.idPath = path.idPath "
+                                 "WHERE songfingerprint.iVersion = %i AND song.idSong > %i "
+                                 "AND songfingerprint.strFingerprint <> '' "
+                                 "ORDER BY song.idSong LIMIT %i",
+                                 version, idAfter, limit);
+    if (!m_pDS->query(sql))
+      return false;
+
+    songs.reserve(m_pDS->num_rows());
+    while (!m_pDS->eof())
+    {
+      SongFingerprint song;
+      song.idSong = m_pDS->fv(0).get_asInt();
+      song.strFileName =
+          URIUtils::AddFileToFolder(m_pDS->fv(1).get_asString(), m_pDS->fv(2).get_asString());
+      song.strFingerprint = m_pDS->fv(3).get_asString();
+      songs.push_back(std::move(song));
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", idAfter);
+  }
+  return false;
+}
+
+bool CMusicDatabase::SetSongFingerprint(int idSong, int version, const std::string& fingerprint)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    std::string sql = PrepareSQL("REPLACE INTO songfingerprint (idSong, iVersion, strFingerprint) "
+                                 "VALUES (%i, %i, '%s')",
+                                 idSong, version, fingerprint.c_str());
+    m_pDS->exec(sql);
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", idSong);
+  }
+  return false;
+}
+
+bool CMusicDatabase::SetSongDuplicates(const std::vector<std::vector<int>>& groups)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    BeginTransaction();
+    m_pDS->exec("DELETE FROM songduplicate");
+    for (const std::vector<int>& group : groups)
+    {
+      if (group.empty())
+        continue;
+      const int idGroup = *std::min_element(group.begin(), group.end());
+      for (const int idSong : group)
+        m_pDS->exec(PrepareSQL("INSERT INTO songduplicate (idSong, idGroup) VALUES (%i, %i)",
+                               idSong, idGroup));
+    }
+    CommitTransaction();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+    RollbackTransaction();
+  }
+  return false;
+}
+
+bool CMusicDatabase::GetSongDuplicates(int idSong, std::vector<int>& songs)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    songs.clear();
+
+    std::string sql =
+        PrepareSQL("SELECT other.idSong FROM songduplicate "
+                   "JOIN songduplicate AS other ON other.idGroup = songduplicate.idGroup "
+                   "WHERE songduplicate.idSong = %i AND other.idSong <> %i "
+                   "ORDER BY other.idSong",
+                   idSong, idSong);
+    if (!m_pDS->query(sql))
+      return false;
+
+    while (!m_pDS->eof())
+    {
+      songs.push_back(m_pDS->fv(0).get_asInt());
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", idSong);
+  }
+  return false;
+}
+
 int CMusicDatabase::GetSongIDFromPath(const std::string& filePath)
 {
   // grab the where string to identify the song id
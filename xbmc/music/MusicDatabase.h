@@ -65,6 +65,37 @@ struct ArtForThumbLoader
   std::string url;
 };
 
+/*!
+\ingroup music
+\brief A structure used for measuring the loudness of songs
+\sa CMusicDatabase::GetSongsWithoutReplayGain()
+*/
+
+struct SongReplayGain
+{
+  int idSong = -1;
+  int idAlbum = -1;
+  std::string strFileName;
+  int iStartOffset = 0;
+  int iEndOffset = 0;
+  ReplayGain replayGain;
+};
+
+/*!
+\ingroup music
+\brief A structure used for the acoustic fingerprints of songs
+\sa CMusicDatabase::GetSongsWithoutFingerprint(), CMusicDatabase::GetSongFingerprints()
+*/
+
+struct SongFingerprint
+{
+  int idSong = -1;
+  std::string strFileName;
+  int iStartOffset = 0;
+  int iEndOffset = 0;
+  std::string strFingerprint;
+};
+
 class CGUIDialogProgress;
 class CFileItemList;
 
@@ -239,6 +270,55 @@ public:
   bool SetSongUserrating(const std::string& filePath, int userrating);
   bool SetSongUserrating(int idSong, int userrating);
   bool SetSongVotes(const std::string& filePath, int votes);
+
+  /*! \brief Get the songs of all albums with a song missing its track or album ReplayGain
+   Songs already measured with the given version are skipped, even if they still miss a value.
+   \param version the version of the loudness measurement in use
+   \param songs [out] the songs with full path, grouped by album
+   \return true if the query succeeded
+   */
+  bool GetSongsWithoutReplayGain(int version, std::vector<SongReplayGain>& songs);
+  bool SetSongReplayGain(int idSong, const ReplayGain& replayGain);
+
+  /*! \brief Mark a song as measured, so it is not decoded again if it failed or was silent
+   */
+  bool SetSongLoudnessMeasured(int idSong, int version);
+
+  /*! \brief Get the songs without a fingerprint of the given version
+   \param version the version of the fingerprints in use
+   \param songs [out] the songs with full path, but no fingerprint
+   \return true if the query succeeded
+   */
+  bool GetSongsWithoutFingerprint(int version, std::vector<SongFingerprint>& songs);
+
+  /*! \brief Get the fingerprints of songs in pages, ordered by song id
+   \param version the version of the fingerprints in use, others are skipped
+   \param idAfter only songs with a larger id, -1 to start with the first one
+   \param limit number of songs to get at most
+   \param songs [out] the songs with path and fingerprint
+   \return true if the query succeeded
+   */
+  bool GetSongFingerprints(int version,
+                           int idAfter,
+                           int limit,
+                           std::vector<SongFingerprint>& songs);
+
+  /*! \brief Store the fingerprint of a song
+   An empty fingerprint marks a song which could not be fingerprinted, so it is not tried again.
+   */
+  bool SetSongFingerprint(int idSong, int version, const std::string& fingerprint);
+
+  /*! \brief Replace the stored groups of songs which are the same recording
+   \param groups the song ids of every group, as found by CMusicFingerprintIndex::FindDuplicates()
+   */
+  bool SetSongDuplicates(const std::vector<std::vector<int>>& groups);
+
+  /*! \brief Get the other songs of the same recording as a song
+   \param idSong the song to look up
+   \param songs [out] the ids of its duplicates, empty if it has none
+   \return true if the query succeeded
+   */
+  bool GetSongDuplicates(int idSong, std::vector<int>& songs);
   int GetSongByArtistAndAlbumAndTitle(const std::string& strArtist,
                                       const std::string& strAlbum,
                                       const std::string& strTitle);
@@ -0,0 +1,161 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MusicFileDecoder.h"
+
+#include "FileItem.h"
+#include "URL.h"
+#include "cores/paplayer/CodecFactory.h"
+#include "cores/paplayer/ICodec.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+
+// bytes read from the codec at a time
+constexpr size_t READ_SIZE = 32768;
+
+bool IsSupported(AEDataFormat format)
+{
+  switch (format)
+  {
+    case AE_FMT_U8:
+    case AE_FMT_S16NE:
+    case AE_FMT_S32NE:
+    case AE_FMT_FLOAT:
+    case AE_FMT_DOUBLE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void ToFloat(AEDataFormat format, const uint8_t* src, float* dst, size_t samples)
+{
+  switch (format)
+  {
+    case AE_FMT_U8:
+      for (size_t i = 0; i < samples; ++i)
+        dst[i] = (src[i] - 128) / 128.0f;
+      break;
+    case AE_FMT_S16NE:
+    {
+      const int16_t* in = reinterpret_cast<const int16_t*>(src);
+      for (size_t i = 0; i < samples; ++i)
+        dst[i] = in[i] / 32768.0f;
+      break;
+    }
+    case AE_FMT_S32NE:
+    {
+      const int32_t* in = reinterpret_cast<const int32_t*>(src);
+      for (size_t i = 0; i < samples; ++i)
+        dst[i] = static_cast<float>(in[i] / 2147483648.0);
+      break;
+    }
+    case AE_FMT_FLOAT:
+      std::memcpy(dst, src, samples * sizeof(float));
+      break;
+    case AE_FMT_DOUBLE:
+    {
+      const double* in = reinterpret_cast<const double*>(src);
+      for (size_t i = 0; i < samples; ++i)
+        dst[i] = static_cast<float>(in[i]);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+} // namespace
+
+CMusicFileDecoder::CMusicFileDecoder() = default;
+
+CMusicFileDecoder::~CMusicFileDecoder() = default;
+
+bool CMusicFileDecoder::Open(const std::string& path,
+                             int startOffset /* = 0 */,
+                             int endOffset /* = 0 */)
+{
+  m_path = path;
+  m_codec.reset();
+  m_eof = false;
+  m_pending = 0;
+
+  const CFileItem item(path, false);
+  m_codec.reset(CodecFactory::CreateCodecDemux(item, 0));
+  if (!m_codec || !m_codec->Init(item, 0))
+  {
+    CLog::Log(LOGWARNING, "CMusicFileDecoder: unable to open {}", CURL::GetRedacted(path));
+    m_codec.reset();
+    return false;
+  }
+
+  m_format = m_codec->m_format;
+  m_channels = m_format.m_channelLayout.Count();
+  m_bytesPerSample = m_codec->m_bitsPerSample >> 3;
+  if (!IsSupported(m_format.m_dataFormat) || m_bytesPerSample == 0 || m_channels == 0 ||
+      m_format.m_sampleRate == 0)
+  {
+    CLog::Log(LOGWARNING, "CMusicFileDecoder: unsupported format of {}", CURL::GetRedacted(path));
+    m_codec.reset();
+    return false;
+  }
+
+  // songs of a cue sheet share the file
+  if (startOffset > 0)
+    m_codec->Seek(startOffset);
+  m_framesLeft = std::numeric_limits<int64_t>::max();
+  if (endOffset > startOffset)
+    m_framesLeft = static_cast<int64_t>(endOffset - startOffset) * m_format.m_sampleRate / 1000;
+
+  const size_t frameSize = static_cast<size_t>(m_bytesPerSample) * m_channels;
+  m_buffer.resize(std::max(READ_SIZE - READ_SIZE % frameSize, frameSize));
+  m_samples.resize(m_buffer.size() / m_bytesPerSample);
+  return true;
+}
+
+int CMusicFileDecoder::Read(const float*& samples)
+{
+  if (!m_codec)
+    return -1;
+
+  const size_t frameSize = static_cast<size_t>(m_bytesPerSample) * m_channels;
+  while (!m_eof && m_framesLeft > 0)
+  {
+    size_t read = 0;
+    const int result = m_codec->ReadPCM(m_buffer.data() + m_pending, m_buffer.size() - m_pending,
+                                        &read);
+    if (result == READ_ERROR)
+    {
+      CLog::Log(LOGWARNING, "CMusicFileDecoder: error decoding {}", CURL::GetRedacted(m_path));
+      return -1;
+    }
+    m_eof = result == READ_EOF;
+
+    read += m_pending;
+    const size_t frames = std::min<int64_t>(read / frameSize, m_framesLeft);
+    ToFloat(m_format.m_dataFormat, m_buffer.data(), m_samples.data(), frames * m_channels);
+    m_framesLeft -= frames;
+
+    m_pending = read % frameSize;
+    std::memmove(m_buffer.data(), m_buffer.data() + read - m_pending, m_pending);
+
+    if (frames > 0)
+    {
+      samples = m_samples.data();
+      return static_cast<int>(frames);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/AudioEngine/Utils/AEAudioFormat.h"
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+class ICodec;
+
+/*!
+ \ingroup music
+ \brief Decodes a song to interleaved float with the codecs of the music player.
+
+ Used by library jobs which analyse the audio of songs. The songs of a cue sheet are
+ decoded from their start to their end offset only.
+ */
+class CMusicFileDecoder
+{
+public:
+  CMusicFileDecoder();
+  ~CMusicFileDecoder();
+
+  /*!
+   \brief Open a song
+   \param path full path of the file
+   \param startOffset start of the song in the file in ms, 0 if it is the whole file
+   \param endOffset end of the song in the file in ms, 0 if it is the whole file
+   \return false if the file cannot be decoded or not to float
+   */
+  bool Open(const std::string& path, int startOffset = 0, int endOffset = 0);
+
+  const AEAudioFormat& GetFormat() const { return m_format; }
+  unsigned int GetChannels() const { return m_channels; }
+
+  /*!
+   \brief Decode the next part of the song
+   \param samples [out] interleaved samples, valid until the next call
+   \return number of frames, 0 at the end of the song and -1 on a decoding error
+   */
+  int Read(const float*& samples);
+
+private:
+  std::string m_path;
+  std::unique_ptr<ICodec> m_codec;
+  AEAudioFormat m_format;
+  unsigned int m_channels = 0;
+  unsigned int m_bytesPerSample = 0;
+  int64_t m_framesLeft = 0;
+  bool m_eof = false;
+
+  std::vector<uint8_t> m_buffer;
+  //! bytes of an incomplete frame, kept for the next read
+  size_t m_pending = 0;
+  std::vector<float> m_samples;
+};
@@ -0,0 +1,246 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MusicFingerprintIndex.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+
+// one in SAMPLE_MASK + 1 words is indexed
+constexpr uint32_t SAMPLE_MASK = 15;
+
+// words shared by more songs tell nothing, silence or a plain tone
+constexpr size_t MAX_BUCKET = 256;
+
+// positions and offsets are packed into 12 bits of the vote keys
+constexpr unsigned int MAX_POSITION = 2047;
+constexpr unsigned int OFFSET_BIAS = 2048;
+constexpr uint64_t OFFSET_MASK = 0xfff;
+
+constexpr unsigned int MIN_VOTES = 4;
+constexpr float MIN_SCORE = 0.1f;
+
+uint32_t Mix(uint32_t word)
+{
+  // murmur3 finalizer, the words themselves are far from evenly distributed
+  word ^= word >> 16;
+  word *= 0x85ebca6b;
+  word ^= word >> 13;
+  word *= 0xc2b2ae35;
+  word ^= word >> 16;
+  return word;
+}
+
+struct DisjointSet
+{
+  explicit DisjointSet(size_t size) : parent(size) { std::iota(parent.begin(), parent.end(), 0); }
+
+  uint32_t Find(uint32_t i)
+  {
+    while (parent[i] != i)
+      i = parent[i] = parent[parent[i]];
+    return i;
+  }
+
+  void Join(uint32_t a, uint32_t b) { parent[Find(a)] = Find(b); }
+
+  std::vector<uint32_t> parent;
+};
+
+} // namespace
+
+bool CMusicFingerprintIndex::IsIndexed(uint32_t word)
+{
+  // all bits equal comes from silence
+  return word != 0 && word != 0xffffffff && (Mix(word) & SAMPLE_MASK) == 0;
+}
+
+void CMusicFingerprintIndex::Add(int idSong, const std::vector<uint32_t>& fingerprint)
+{
+  const uint32_t song = static_cast<uint32_t>(m_songs.size());
+  unsigned int keys = 0;
+  const size_t count = std::min<size_t>(fingerprint.size(), MAX_POSITION + 1);
+  for (size_t pos = 0; pos < count; ++pos)
+  {
+    if (!IsIndexed(fingerprint[pos]))
+      continue;
+    m_entries.push_back({fingerprint[pos], song, static_cast<uint16_t>(pos)});
+    keys++;
+  }
+
+  m_songs.push_back({idSong, keys});
+  m_sorted = false;
+}
+
+void CMusicFingerprintIndex::Build()
+{
+  if (m_sorted)
+    return;
+
+  std::sort(m_entries.begin(), m_entries.end(),
+            [](const Entry& a, const Entry& b)
+            {
+              if (a.key != b.key)
+                return a.key < b.key;
+              return a.song < b.song;
+            });
+
+  auto out = m_entries.begin();
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    auto end = std::find_if(it, m_entries.end(), [key = it->key](const Entry& entry)
+                            { return entry.key != key; });
+    if (static_cast<size_t>(end - it) <= MAX_BUCKET)
+      out = std::move(it, end, out);
+    it = end;
+  }
+  m_entries.erase(out, m_entries.end());
+  m_entries.shrink_to_fit();
+
+  m_sorted = true;
+}
+
+void CMusicFingerprintIndex::Clear()
+{
+  m_entries.clear();
+  m_entries.shrink_to_fit();
+  m_songs.clear();
+  m_sorted = true;
+}
+
+unsigned int CMusicFingerprintIndex::CountVotes(
+    const std::unordered_map<uint64_t, unsigned int>& votes, uint64_t key)
+{
+  // the same recording may be a fraction of a word off, the neighbouring offsets count too
+  auto get = [&votes](uint64_t key)
+  {
+    const auto it = votes.find(key);
+    return it != votes.end() ? it->second : 0;
+  };
+
+  unsigned int count = get(key);
+  if ((key & OFFSET_MASK) > 0)
+    count += get(key - 1);
+  if ((key & OFFSET_MASK) < OFFSET_MASK)
+    count += get(key + 1);
+  return count;
+}
+
+bool CMusicFingerprintIndex::IsMatch(unsigned int votes, uint32_t songA, uint32_t songB) const
+{
+  const unsigned int keys = std::min(m_songs[songA].keys, m_songs[songB].keys);
+  return votes >= MIN_VOTES && votes >= MIN_SCORE * keys;
+}
+
+std::vector<CMusicFingerprintIndex::Match> CMusicFingerprintIndex::Query(
+    const std::vector<uint32_t>& fingerprint, int idExclude /* = -1 */) const
+{
+  std::vector<Match> matches;
+  if (!m_sorted)
+    return matches;
+
+  // votes per song and offset
+  std::unordered_map<uint64_t, unsigned int> votes;
+  unsigned int keys = 0;
+  const size_t count = std::min<size_t>(fingerprint.size(), MAX_POSITION + 1);
+  for (size_t pos = 0; pos < count; ++pos)
+  {
+    const uint32_t word = fingerprint[pos];
+    if (!IsIndexed(word))
+      continue;
+    keys++;
+
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), word,
+                               [](const Entry& entry, uint32_t key) { return entry.key < key; });
+    for (; it != m_entries.end() && it->key == word; ++it)
+    {
+      const uint64_t offset = it->position + OFFSET_BIAS - pos;
+      votes[(static_cast<uint64_t>(it->song) << 12) | offset]++;
+    }
+  }
+
+  // best offset of every song
+  std::unordered_map<uint32_t, std::pair<unsigned int, int>> best;
+  for (const auto& [key, value] : votes)
+  {
+    const uint32_t song = static_cast<uint32_t>(key >> 12);
+    const unsigned int count = CountVotes(votes, key);
+    auto& [bestVotes, bestOffset] = best[song];
+    if (count > bestVotes)
+    {
+      bestVotes = count;
+      bestOffset = static_cast<int>(key & OFFSET_MASK) - static_cast<int>(OFFSET_BIAS);
+    }
+  }
+
+  for (const auto& [song, value] : best)
+  {
+    const auto& [count, offset] = value;
+    const unsigned int songKeys = std::min(keys, m_songs[song].keys);
+    if (m_songs[song].idSong == idExclude || count < MIN_VOTES || count < MIN_SCORE * songKeys)
+      continue;
+    matches.push_back({m_songs[song].idSong,
+                       std::min(1.0f, static_cast<float>(count) / std::max(1u, songKeys)), offset});
+  }
+
+  std::sort(matches.begin(), matches.end(),
+            [](const Match& a, const Match& b) { return a.score > b.score; });
+  return matches;
+}
+
+std::vector<std::vector<int>> CMusicFingerprintIndex::FindDuplicates() const
+{
+  std::vector<std::vector<int>> groups;
+  if (!m_sorted)
+    return groups;
+
+  // votes per pair of songs and offset, every bucket holds the songs sharing a word
+  std::unordered_map<uint64_t, unsigned int> votes;
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    auto end = std::find_if(it, m_entries.end(), [key = it->key](const Entry& entry)
+                            { return entry.key != key; });
+    for (auto a = it; a != end; ++a)
+    {
+      for (auto b = a + 1; b != end; ++b)
+      {
+        // sorted by song, b is the later one
+        if (a->song == b->song)
+          continue;
+        const uint64_t offset = b->position + OFFSET_BIAS - a->position;
+        votes[(static_cast<uint64_t>(a->song) << 38) | (static_cast<uint64_t>(b->song) << 12) |
+              offset]++;
+      }
+    }
+    it = end;
+  }
+
+  DisjointSet sets(m_songs.size());
+  for (const auto& [key, value] : votes)
+  {
+    const uint32_t songA = static_cast<uint32_t>(key >> 38);
+    const uint32_t songB = static_cast<uint32_t>((key >> 12) & 0x3ffffff);
+    if (sets.Find(songA) != sets.Find(songB) && IsMatch(CountVotes(votes, key), songA, songB))
+      sets.Join(songA, songB);
+  }
+
+  std::unordered_map<uint32_t, std::vector<int>> members;
+  for (uint32_t song = 0; song < m_songs.size(); ++song)
+    members[sets.Find(song)].push_back(m_songs[song].idSong);
+
+  for (auto& [root, songs] : members)
+  {
+    if (songs.size() > 1)
+      groups.push_back(std::move(songs));
+  }
+  std::sort(groups.begin(), groups.end());
+  return groups;
+}
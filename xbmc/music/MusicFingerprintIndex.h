@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+/*!
+ \ingroup music
+ \brief In-memory index of song fingerprints to find the same recording quickly.
+
+ Words of a CAEFingerprint are used as hash keys. Two files of one recording share many
+ words exactly and at the same distance from each other, unrelated songs hardly any. Only
+ the words whose hash falls into a fixed 1/16 of the range are indexed. That choice
+ depends on the word alone, so both files keep the same words, and an index of a large
+ library needs about a kilobyte per song.
+
+ A query counts the hits of every song per offset, a song matches if enough of the words
+ line up at one offset.
+ */
+class CMusicFingerprintIndex
+{
+public:
+  struct Match
+  {
+    int idSong = -1;
+    //! share of the indexed words which line up, 0.0 - 1.0
+    float score = 0.0f;
+    //! position of the query in the song in fingerprint words
+    int offset = 0;
+  };
+
+  /*!
+   \brief Add the fingerprint of a song, Build() has to be called before the next query
+   */
+  void Add(int idSong, const std::vector<uint32_t>& fingerprint);
+
+  /*!
+   \brief Sort the words added, words shared by too many songs are dropped as useless
+   */
+  void Build();
+
+  void Clear();
+
+  size_t GetSongCount() const { return m_songs.size(); }
+
+  /*!
+   \brief Find the songs of the same recording as a fingerprint, best match first
+   \param fingerprint the words to look up
+   \param idExclude song not to report, the one the fingerprint belongs to
+   */
+  std::vector<Match> Query(const std::vector<uint32_t>& fingerprint, int idExclude = -1) const;
+
+  /*!
+   \brief Group all songs of the index which are the same recording
+   \return the song ids of every group of two or more
+   */
+  std::vector<std::vector<int>> FindDuplicates() const;
+
+private:
+  struct Entry
+  {
+    uint32_t key;
+    uint32_t song;
+    uint16_t position;
+  };
+
+  struct Song
+  {
+    int idSong;
+    unsigned int keys;
+  };
+
+  static bool IsIndexed(uint32_t word);
+  bool IsMatch(unsigned int votes, uint32_t songA, uint32_t songB) const;
+  static unsigned int CountVotes(const std::unordered_map<uint64_t, unsigned int>& votes,
+                                 uint64_t key);
+
+  std::vector<Entry> m_entries;
+  std::vector<Song> m_songs;
+  bool m_sorted = true;
+};
@@ -11,14 +11,18 @@
 #include "GUIUserMessages.h"
 #include "ServiceBroker.h"
 #include "Util.h"
+#include "dialogs/GUIDialogExtendedProgressBar.h"
 #include "dialogs/GUIDialogProgress.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
+#include "guilib/LocalizeStrings.h"
 #include "music/infoscanner/MusicInfoScanner.h"
 #include "music/jobs/MusicLibraryCleaningJob.h"
 #include "music/jobs/MusicLibraryExportJob.h"
+#include "music/jobs/MusicLibraryFingerprintJob.h"
 #include "music/jobs/MusicLibraryImportJob.h"
 #include "music/jobs/MusicLibraryJob.h"
+#include "music/jobs/MusicLibraryLoudnessJob.h"
 #include "music/jobs/MusicLibraryScanningJob.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
@@ -154,6 +158,36 @@ void CMusicLibraryQueue::StartArtistScan(const std::string& strDirectory, bool r
   AddJob(new CMusicLibraryScanningJob(strDirectory, flags, true));
 }
 
+void CMusicLibraryQueue::MeasureLoudness(bool showProgress /* = true */)
+{
+  CGUIDialogProgressBarHandle* progressBar = nullptr;
+  if (showProgress)
+  {
+    CGUIDialogExtendedProgressBar* dialog =
+        CServiceBroker::GetGUI()->GetWindowManager().GetWindow<CGUIDialogExtendedProgressBar>(
+            WINDOW_DIALOG_EXT_PROGRESS);
+    if (dialog)
+      progressBar = dialog->GetHandle(g_localizeStrings.Get(34139));
+  }
+
+  AddJob(new CMusicLibraryLoudnessJob(progressBar));
+}
+
+void CMusicLibraryQueue::FingerprintSongs(bool showProgress /* = true */)
+{
+  CGUIDialogProgressBarHandle* progressBar = nullptr;
+  if (showProgress)
+  {
+    CGUIDialogExtendedProgressBar* dialog =
+        CServiceBroker::GetGUI()->GetWindowManager().GetWindow<CGUIDialogExtendedProgressBar>(
+            WINDOW_DIALOG_EXT_PROGRESS);
+    if (dialog)
+      progressBar = dialog->GetHandle(g_localizeStrings.Get(34142));
+  }
+
+  AddJob(new CMusicLibraryFingerprintJob(progressBar));
+}
+
 bool CMusicLibraryQueue::IsScanningLibrary() const
 {
   // check if the library is being cleaned synchronously
@@ -71,6 +71,18 @@ public:
    */
   void StartArtistScan(const std::string& strDirectory, bool refresh = false);
 
+  /*!
+   \brief Enqueue a job measuring the loudness of songs without ReplayGain.
+   \param[in] showProgress Whether or not to show a progress bar. Defaults to true
+   */
+  void MeasureLoudness(bool showProgress = true);
+
+  /*!
+   \brief Enqueue a job fingerprinting new songs and looking for duplicates.
+   \param[in] showProgress Whether or not to show a progress bar. Defaults to true
+   */
+  void FingerprintSongs(bool showProgress = true);
+
   /*!
    \brief Check if a library scan or cleaning is in progress.
    \return True if a scan or clean is in progress, false otherwise
@@ -193,6 +193,14 @@ void CMusicInfoScanner::Process()
 
           m_musicDatabase.Compress(false);
         }
+
+        // songs without ReplayGain tags are measured once the library is up to date
+        if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+                CSettings::SETTING_MUSICLIBRARY_MEASURELOUDNESS))
+          CMusicLibraryQueue::GetInstance().MeasureLoudness(m_showDialog);
+        if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+                CSettings::SETTING_MUSICLIBRARY_FINGERPRINT))
+          CMusicLibraryQueue::GetInstance().FingerprintSongs(m_showDialog);
       }
 
       m_fileCountReader.StopThread();
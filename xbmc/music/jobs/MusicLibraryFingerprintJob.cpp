@@ -0,0 +1,191 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MusicLibraryFingerprintJob.h"
+
+#include "URL.h"
+#include "cores/AudioEngine/Utils/AEFingerprint.h"
+#include "guilib/LocalizeStrings.h"
+#include "music/MusicDatabase.h"
+#include "music/MusicFileDecoder.h"
+#include "music/MusicFingerprintIndex.h"
+#include "music/jobs/MusicLibraryWorkers.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+// fingerprints loaded from the database at a time to build the index
+constexpr int PAGE_SIZE = 1000;
+
+struct Result
+{
+  bool done = false;
+  std::string fingerprint;
+};
+
+Result Fingerprint(const SongFingerprint& song, const std::atomic_bool& cancelled)
+{
+  // songs which cannot be decoded get an empty fingerprint, they are not tried again
+  Result result;
+  result.done = true;
+
+  CMusicFileDecoder decoder;
+  CAEFingerprint fingerprint;
+  if (!decoder.Open(song.strFileName, song.iStartOffset, song.iEndOffset) ||
+      !fingerprint.Init(decoder.GetChannels(), decoder.GetFormat().m_sampleRate))
+    return result;
+
+  const float* samples;
+  int frames = 0;
+  while (!cancelled && (frames = decoder.Read(samples)) > 0)
+  {
+    if (!fingerprint.AddSamples(samples, static_cast<unsigned int>(frames)))
+      break;
+  }
+
+  if (cancelled)
+    result.done = false;
+  else if (frames >= 0)
+    result.fingerprint = CAEFingerprint::Serialize(fingerprint.GetFingerprint());
+  return result;
+}
+
+} // namespace
+
+CMusicLibraryFingerprintJob::CMusicLibraryFingerprintJob(CGUIDialogProgressBarHandle* progressBar)
+  : CMusicLibraryProgressJob(progressBar)
+{
+}
+
+CMusicLibraryFingerprintJob::~CMusicLibraryFingerprintJob() = default;
+
+bool CMusicLibraryFingerprintJob::Cancel()
+{
+  m_cancelled = true;
+  return true;
+}
+
+bool CMusicLibraryFingerprintJob::operator==(const CJob* job) const
+{
+  if (strcmp(job->GetType(), GetType()) != 0)
+    return false;
+
+  return dynamic_cast<const CMusicLibraryFingerprintJob*>(job) != nullptr;
+}
+
+bool CMusicLibraryFingerprintJob::Work(CMusicDatabase& db)
+{
+  std::vector<SongFingerprint> songs;
+  if (!db.GetSongsWithoutFingerprint(CAEFingerprint::VERSION, songs))
+    return false;
+  if (songs.empty())
+    return true;
+
+  const auto start = std::chrono::steady_clock::now();
+  SetTitle(g_localizeStrings.Get(34142));
+
+  std::vector<Result> results(songs.size());
+
+  size_t written = 0;
+  size_t processed = 0;
+  const size_t workers = CMusicLibraryWorkers::Run(
+      songs.size(), m_cancelled,
+      [&](size_t index) { results[index] = Fingerprint(songs[index], m_cancelled); },
+      [&](const std::vector<size_t>& done)
+      {
+        if (!done.empty())
+        {
+          db.BeginTransaction();
+          for (const size_t index : done)
+          {
+            Result& result = results[index];
+            if (!result.done)
+              continue;
+            db.SetSongFingerprint(songs[index].idSong, CAEFingerprint::VERSION,
+                                  result.fingerprint);
+            if (!result.fingerprint.empty())
+              written++;
+            // keep the memory of the job low on large libraries
+            std::string().swap(result.fingerprint);
+          }
+          db.CommitTransaction();
+          processed += done.size();
+          SetText(CURL::GetRedacted(songs[done.back()].strFileName));
+        }
+
+        if (IsCancelled())
+          m_cancelled = true;
+        SetProgress(static_cast<int>(processed), static_cast<int>(songs.size()));
+      });
+
+  const auto elapsed =
+      std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start);
+  CLog::Log(LOGINFO,
+            "CMusicLibraryFingerprintJob: fingerprinted {} songs of {} in {}s with {} workers{}",
+            written, songs.size(), elapsed.count(), workers, m_cancelled ? ", cancelled" : "");
+
+  if (written > 0 && !m_cancelled)
+    FindDuplicates(db);
+
+  return !m_cancelled;
+}
+
+void CMusicLibraryFingerprintJob::FindDuplicates(CMusicDatabase& db)
+{
+  const auto start = std::chrono::steady_clock::now();
+
+  CMusicFingerprintIndex index;
+  std::unordered_map<int, std::string> paths;
+  std::vector<SongFingerprint> page;
+  std::vector<uint32_t> words;
+  int idAfter = -1;
+  do
+  {
+    if (!db.GetSongFingerprints(CAEFingerprint::VERSION, idAfter, PAGE_SIZE, page))
+      return;
+
+    for (const SongFingerprint& song : page)
+    {
+      if (CAEFingerprint::Deserialize(song.strFingerprint, words))
+      {
+        index.Add(song.idSong, words);
+        paths.emplace(song.idSong, song.strFileName);
+      }
+      idAfter = song.idSong;
+    }
+  } while (page.size() == PAGE_SIZE && !m_cancelled);
+  // an index of part of the library would drop the duplicates stored for the rest
+  if (m_cancelled)
+    return;
+  index.Build();
+
+  const auto groups = index.FindDuplicates();
+  for (const auto& group : groups)
+  {
+    std::vector<std::string> files;
+    for (const int idSong : group)
+      files.push_back(CURL::GetRedacted(paths[idSong]));
+    CLog::Log(LOGDEBUG, "CMusicLibraryFingerprintJob: same recording: {}",
+              StringUtils::Join(files, ", "));
+  }
+  db.SetSongDuplicates(groups);
+
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  CLog::Log(LOGINFO,
+            "CMusicLibraryFingerprintJob: {} groups of duplicates among {} songs, found in {}ms",
+            groups.size(), index.GetSongCount(), elapsed.count());
+}
@@ -0,0 +1,50 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "music/jobs/MusicLibraryProgressJob.h"
+
+#include <atomic>
+
+/*!
+ \brief Music library job computing acoustic fingerprints of new songs and finding duplicates.
+
+ Only songs without a fingerprint of the current CAEFingerprint version are decoded, so a
+ rescan costs as much as the songs it added. Songs are fingerprinted in parallel, one per
+ cpu core, only the database is written from the job itself. Once new fingerprints were
+ stored, all of them are put into a CMusicFingerprintIndex and the groups of songs which
+ are the same recording are stored, see CMusicDatabase::GetSongDuplicates().
+*/
+class CMusicLibraryFingerprintJob : public CMusicLibraryProgressJob
+{
+public:
+  /*!
+   \brief Creates a new music library fingerprint job.
+   \param[in] progressBar Progress bar to be used to display the progress
+  */
+  explicit CMusicLibraryFingerprintJob(CGUIDialogProgressBarHandle* progressBar);
+  ~CMusicLibraryFingerprintJob() override;
+
+  // specialization of CMusicLibraryJob
+  bool CanBeCancelled() const override { return true; }
+  bool Cancel() override;
+
+  // specialization of CJob
+  const char* GetType() const override { return "MusicLibraryFingerprintJob"; }
+  bool operator==(const CJob* job) const override;
+
+protected:
+  // implementation of CMusicLibraryJob
+  bool Work(CMusicDatabase& db) override;
+
+private:
+  void FindDuplicates(CMusicDatabase& db);
+
+  std::atomic_bool m_cancelled = false;
+};
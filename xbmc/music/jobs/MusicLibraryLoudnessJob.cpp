@@ -0,0 +1,191 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MusicLibraryLoudnessJob.h"
+
+#include "URL.h"
+#include "cores/AudioEngine/Utils/AELoudnessMeter.h"
+#include "guilib/LocalizeStrings.h"
+#include "music/MusicDatabase.h"
+#include "music/MusicFileDecoder.h"
+#include "music/jobs/MusicLibraryWorkers.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+struct Measurement
+{
+  bool measured = false;
+  double loudness = -std::numeric_limits<double>::infinity();
+  float peak = 0.0f;
+};
+
+struct Album
+{
+  size_t first = 0;
+  size_t last = 0;
+  Measurement album;
+  bool attempted = false; ///< all songs were decoded, even if some failed
+};
+
+bool Measure(const SongReplayGain& song, CAELoudnessMeter& meter, const std::atomic_bool& cancelled)
+{
+  CMusicFileDecoder decoder;
+  if (!decoder.Open(song.strFileName, song.iStartOffset, song.iEndOffset) ||
+      !meter.Init(decoder.GetFormat().m_channelLayout, decoder.GetFormat().m_sampleRate))
+    return false;
+
+  const float* samples;
+  int frames = 0;
+  while (!cancelled && (frames = decoder.Read(samples)) > 0)
+    meter.AddSamples(samples, static_cast<unsigned int>(frames));
+
+  return frames == 0 && !cancelled;
+}
+
+void MeasureAlbum(const std::vector<SongReplayGain>& songs,
+                  Album& album,
+                  std::vector<Measurement>& tracks,
+                  const std::atomic_bool& cancelled)
+{
+  CAELoudnessMeter meter;
+  std::vector<float> blocks;
+  bool complete = true;
+
+  for (size_t i = album.first; i < album.last && !cancelled; ++i)
+  {
+    if (!Measure(songs[i], meter, cancelled))
+    {
+      complete = false;
+      continue;
+    }
+
+    tracks[i].measured = true;
+    tracks[i].loudness = meter.GetIntegratedLoudness();
+    tracks[i].peak = meter.GetTruePeak();
+
+    blocks.insert(blocks.end(), meter.GetBlocks().begin(), meter.GetBlocks().end());
+    album.album.peak = std::max(album.album.peak, tracks[i].peak);
+  }
+
+  if (cancelled)
+    return;
+  album.attempted = true;
+
+  // the album gain is only right if all of its songs were measured
+  if (complete)
+  {
+    album.album.measured = true;
+    album.album.loudness = CAELoudnessMeter::GetIntegratedLoudness(blocks);
+  }
+}
+
+bool Apply(ReplayGain& replayGain, ReplayGain::Type type, const Measurement& measurement)
+{
+  if (replayGain.Get(type).Valid() || !measurement.measured ||
+      !std::isfinite(measurement.loudness))
+    return false;
+
+  replayGain.SetGain(type, static_cast<float>(CAELoudnessMeter::REFERENCE_LOUDNESS -
+                                              measurement.loudness));
+  replayGain.SetPeak(type, measurement.peak);
+  return true;
+}
+
+} // namespace
+
+CMusicLibraryLoudnessJob::CMusicLibraryLoudnessJob(CGUIDialogProgressBarHandle* progressBar)
+  : CMusicLibraryProgressJob(progressBar)
+{
+}
+
+CMusicLibraryLoudnessJob::~CMusicLibraryLoudnessJob() = default;
+
+bool CMusicLibraryLoudnessJob::Cancel()
+{
+  m_cancelled = true;
+  return true;
+}
+
+bool CMusicLibraryLoudnessJob::operator==(const CJob* job) const
+{
+  if (strcmp(job->GetType(), GetType()) != 0)
+    return false;
+
+  return dynamic_cast<const CMusicLibraryLoudnessJob*>(job) != nullptr;
+}
+
+bool CMusicLibraryLoudnessJob::Work(CMusicDatabase& db)
+{
+  std::vector<SongReplayGain> songs;
+  if (!db.GetSongsWithoutReplayGain(CAELoudnessMeter::VERSION, songs))
+    return false;
+  if (songs.empty())
+    return true;
+
+  const auto start = std::chrono::steady_clock::now();
+  SetTitle(g_localizeStrings.Get(34139));
+
+  std::vector<Album> albums;
+  for (size_t i = 0; i < songs.size(); ++i)
+  {
+    if (albums.empty() || songs[albums.back().first].idAlbum != songs[i].idAlbum)
+      albums.push_back({i, i, {}, false});
+    albums.back().last = i + 1;
+  }
+  std::vector<Measurement> tracks(songs.size());
+
+  size_t written = 0;
+  const size_t workers = CMusicLibraryWorkers::Run(
+      albums.size(), m_cancelled,
+      [&](size_t index) { MeasureAlbum(songs, albums[index], tracks, m_cancelled); },
+      [&](const std::vector<size_t>& done)
+      {
+        if (!done.empty())
+        {
+          db.BeginTransaction();
+          for (const size_t index : done)
+          {
+            const Album& album = albums[index];
+            for (size_t i = album.first; i < album.last; ++i)
+            {
+              ReplayGain replayGain = songs[i].replayGain;
+              const bool track = Apply(replayGain, ReplayGain::TRACK, tracks[i]);
+              if (Apply(replayGain, ReplayGain::ALBUM, album.album) || track)
+                db.SetSongReplayGain(songs[i].idSong, replayGain);
+              // songs that failed or were silent are not decoded again on the next scan
+              if (album.attempted)
+                db.SetSongLoudnessMeasured(songs[i].idSong, CAELoudnessMeter::VERSION);
+            }
+            SetText(CURL::GetRedacted(songs[album.first].strFileName));
+          }
+          db.CommitTransaction();
+          written += done.size();
+        }
+
+        if (IsCancelled())
+          m_cancelled = true;
+        SetProgress(static_cast<int>(written), static_cast<int>(albums.size()));
+      });
+
+  const auto elapsed =
+      std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start);
+  CLog::Log(LOGINFO,
+            "CMusicLibraryLoudnessJob: measured {} albums of {} in {}s with {} workers{}", written,
+            albums.size(), elapsed.count(), workers, m_cancelled ? ", cancelled" : "");
+
+  return !m_cancelled;
+}
@@ -0,0 +1,47 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "music/jobs/MusicLibraryProgressJob.h"
+
+#include <atomic>
+
+/*!
+ \brief Music library job measuring the loudness of songs without ReplayGain.
+
+ Songs are decoded with the codecs of the music player and measured after EBU R128. Track
+ and album gain normalise to the -18 LUFS of ReplayGain 2.0, the peaks are true peaks.
+ Albums are measured in parallel, one per cpu core, only the database is written from
+ the job itself.
+*/
+class CMusicLibraryLoudnessJob : public CMusicLibraryProgressJob
+{
+public:
+  /*!
+   \brief Creates a new music library loudness job.
+   \param[in] progressBar Progress bar to be used to display the progress
+  */
+  explicit CMusicLibraryLoudnessJob(CGUIDialogProgressBarHandle* progressBar);
+  ~CMusicLibraryLoudnessJob() override;
+
+  // specialization of CMusicLibraryJob
+  bool CanBeCancelled() const override { return true; }
+  bool Cancel() override;
+
+  // specialization of CJob
+  const char* GetType() const override { return "MusicLibraryLoudnessJob"; }
+  bool operator==(const CJob* job) const override;
+
+protected:
+  // implementation of CMusicLibraryJob
+  bool Work(CMusicDatabase& db) override;
+
+private:
+  std::atomic_bool m_cancelled = false;
+};
@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MusicLibraryWorkers.h"
+
+#include "ServiceBroker.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <mutex>
+
+using namespace std::chrono_literals;
+
+size_t CMusicLibraryWorkers::Run(size_t count,
+                                 const std::atomic_bool& cancelled,
+                                 const WorkFunc& work,
+                                 const FinishedFunc& onFinished,
+                                 size_t maxWorkers)
+{
+  if (count == 0)
+    return 0;
+
+  if (maxWorkers == 0)
+  {
+    const auto cpuInfo = CServiceBroker::GetCPUInfo();
+    maxWorkers = cpuInfo ? cpuInfo->GetCPUCount() : 1;
+  }
+  const size_t workers = std::clamp<size_t>(maxWorkers, 1, count);
+
+  // items are handed out to the workers, the finished ones handed back to the caller
+  std::atomic<size_t> next = 0;
+  std::atomic<size_t> running = workers;
+  std::vector<size_t> finished;
+  CCriticalSection section;
+  CEvent event;
+
+  auto worker = [&]()
+  {
+    for (size_t index = next++; index < count && !cancelled; index = next++)
+    {
+      work(index);
+
+      std::unique_lock lock(section);
+      finished.push_back(index);
+      event.Set();
+    }
+
+    running--;
+    event.Set();
+  };
+
+  std::vector<std::future<void>> futures;
+  for (size_t i = 0; i < workers; ++i)
+    futures.push_back(std::async(std::launch::async, worker));
+
+  while (true)
+  {
+    event.Wait(100ms);
+
+    // read before taking the finished items, so none are left behind by a worker stopping
+    const bool stopped = running == 0;
+    std::vector<size_t> done;
+    {
+      std::unique_lock lock(section);
+      done.swap(finished);
+    }
+    onFinished(done);
+
+    if (stopped)
+      break;
+  }
+
+  for (auto& future : futures)
+    future.wait();
+
+  return workers;
+}
@@ -0,0 +1,44 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <stddef.h>
+#include <vector>
+
+/*!
+ \brief Runs the items of a music library job in parallel, one worker per cpu core.
+
+ Workers take the items in order. The finished ones are handed back to the thread calling
+ Run(), so a job can keep all database writes on its own thread.
+*/
+class CMusicLibraryWorkers
+{
+public:
+  //! processes one item, called on a worker
+  using WorkFunc = std::function<void(size_t index)>;
+  //! called on the calling thread with the items finished since the last call, at least every 100ms
+  using FinishedFunc = std::function<void(const std::vector<size_t>& indices)>;
+
+  /*!
+   \brief Process the items 0 to count - 1 and wait until all workers are done
+   \param count number of items
+   \param cancelled no more items are handed out once set, it may be set by onFinished
+   \param work processes an item
+   \param onFinished gets the finished items
+   \param maxWorkers limit of workers, 0 for the number of cpu cores
+   \return number of workers used
+  */
+  static size_t Run(size_t count,
+                    const std::atomic_bool& cancelled,
+                    const WorkFunc& work,
+                    const FinishedFunc& onFinished,
+                    size_t maxWorkers = 0);
+};
@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "music/jobs/MusicLibraryWorkers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestMusicLibraryWorkers, ProcessesEveryItemOnce)
+{
+  constexpr size_t COUNT = 1000;
+  std::vector<std::atomic<int>> processed(COUNT);
+  std::vector<int> finished(COUNT);
+  const std::atomic_bool cancelled = false;
+  const std::thread::id caller = std::this_thread::get_id();
+  bool onCaller = true;
+
+  const size_t workers = CMusicLibraryWorkers::Run(
+      COUNT, cancelled, [&](size_t index) { processed[index]++; },
+      [&](const std::vector<size_t>& indices)
+      {
+        onCaller = onCaller && std::this_thread::get_id() == caller;
+        for (const size_t index : indices)
+        {
+          // an item is only handed back once it was processed
+          EXPECT_EQ(processed[index], 1);
+          finished[index]++;
+        }
+      },
+      4);
+
+  EXPECT_EQ(workers, 4u);
+  EXPECT_TRUE(onCaller);
+  EXPECT_TRUE(std::all_of(processed.begin(), processed.end(), [](const auto& p) { return p == 1; }));
+  EXPECT_TRUE(std::all_of(finished.begin(), finished.end(), [](int f) { return f == 1; }));
+}
+
+TEST(TestMusicLibraryWorkers, StopsWhenCancelled)
+{
+  constexpr size_t COUNT = 1000;
+  std::atomic_bool cancelled = false;
+  std::atomic<size_t> processed = 0;
+  size_t finished = 0;
+
+  CMusicLibraryWorkers::Run(
+      COUNT, cancelled,
+      [&](size_t)
+      {
+        processed++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      },
+      [&](const std::vector<size_t>& indices)
+      {
+        finished += indices.size();
+        if (finished > 0)
+          cancelled = true;
+      },
+      2);
+
+  // items being processed when it was cancelled still finish and are handed back
+  EXPECT_EQ(finished, processed);
+  EXPECT_LT(processed, COUNT);
+}
+
+TEST(TestMusicLibraryWorkers, LimitsWorkersToItems)
+{
+  const std::atomic_bool cancelled = false;
+  size_t finished = 0;
+  auto count = [&](const std::vector<size_t>& indices) { finished += indices.size(); };
+
+  EXPECT_EQ(CMusicLibraryWorkers::Run(2, cancelled, [](size_t) {}, count, 8), 2u);
+  EXPECT_EQ(finished, 2u);
+
+  EXPECT_EQ(CMusicLibraryWorkers::Run(0, cancelled, [](size_t) {}, count, 8), 0u);
+  EXPECT_EQ(finished, 2u);
+}
@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "music/MusicFingerprintIndex.h"
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+constexpr size_t WORDS = 1287;
+
+std::vector<uint32_t> MakeFingerprint(std::mt19937& gen)
+{
+  std::vector<uint32_t> words(WORDS);
+  for (uint32_t& word : words)
+    word = static_cast<uint32_t>(gen());
+  return words;
+}
+
+// another file of the same recording, a few bits flipped and the start moved
+std::vector<uint32_t> MakeCopy(const std::vector<uint32_t>& words,
+                               std::mt19937& gen,
+                               double errorRate,
+                               size_t skip = 0)
+{
+  std::bernoulli_distribution flip(errorRate);
+  std::vector<uint32_t> copy(words.begin() + skip, words.end());
+  for (uint32_t& word : copy)
+  {
+    for (unsigned int bit = 0; bit < 32; ++bit)
+    {
+      if (flip(gen))
+        word ^= 1u << bit;
+    }
+  }
+  return copy;
+}
+
+} // namespace
+
+class TestMusicFingerprintIndex : public testing::Test
+{
+protected:
+  TestMusicFingerprintIndex() : m_gen(42)
+  {
+    for (int id = 0; id < SONGS; ++id)
+    {
+      m_songs.push_back(MakeFingerprint(m_gen));
+      m_index.Add(id, m_songs.back());
+    }
+  }
+
+  static constexpr int SONGS = 500;
+
+  std::mt19937 m_gen;
+  std::vector<std::vector<uint32_t>> m_songs;
+  CMusicFingerprintIndex m_index;
+};
+
+TEST_F(TestMusicFingerprintIndex, Query)
+{
+  // nothing to find before the index is built
+  EXPECT_TRUE(m_index.Query(m_songs[17]).empty());
+  m_index.Build();
+  EXPECT_EQ(m_index.GetSongCount(), static_cast<size_t>(SONGS));
+
+  const auto matches = m_index.Query(MakeCopy(m_songs[17], m_gen, 0.02, 3));
+  ASSERT_EQ(matches.size(), 1u);
+  EXPECT_EQ(matches[0].idSong, 17);
+  EXPECT_EQ(matches[0].offset, 3);
+  EXPECT_GT(matches[0].score, 0.3f);
+
+  EXPECT_FLOAT_EQ(m_index.Query(m_songs[17])[0].score, 1.0f);
+  EXPECT_TRUE(m_index.Query(m_songs[17], 17).empty());
+  EXPECT_TRUE(m_index.Query(MakeFingerprint(m_gen)).empty());
+}
+
+TEST_F(TestMusicFingerprintIndex, FindDuplicates)
+{
+  m_index.Build();
+  EXPECT_TRUE(m_index.FindDuplicates().empty());
+
+  m_index.Add(1000, MakeCopy(m_songs[5], m_gen, 0.02));
+  m_index.Add(1001, MakeCopy(m_songs[5], m_gen, 0.03, 10));
+  m_index.Add(1002, MakeCopy(m_songs[9], m_gen, 0.01, 1));
+  m_index.Build();
+
+  const std::vector<std::vector<int>> expected = {{5, 1000, 1001}, {9, 1002}};
+  EXPECT_EQ(m_index.FindDuplicates(), expected);
+
+  m_index.Clear();
+  EXPECT_EQ(m_index.GetSongCount(), 0u);
+  EXPECT_TRUE(m_index.FindDuplicates().empty());
+}
@@ -941,6 +941,13 @@ bool CGUIWindowMusicBase::OnSelect(int iItem)
   return CGUIMediaWindow::OnSelect(iItem);
 }
 
+void CGUIWindowMusicBase::OnWindowLoaded()
+{
+  CGUIMediaWindow::OnWindowLoaded();
+  // the info dialog is opened by the window, not by an action of the skin
+  CServiceBroker::GetGUI()->GetWindowManager().PreloadWindowXML(WINDOW_DIALOG_MUSIC_INFO);
+}
+
 void CGUIWindowMusicBase::OnInitWindow()
 {
   CGUIMediaWindow::OnInitWindow();
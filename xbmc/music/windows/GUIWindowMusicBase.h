@@ -55,6 +55,7 @@ public:
 
 protected:
   void OnInitWindow() override;
+  void OnWindowLoaded() override;
   /*!
   \brief Will be called when an popup context menu has been asked for
   \param itemNumber List/thumb control item that has been clicked on
@@ -23,6 +23,7 @@ std::unique_ptr<CSlideShowPic> CSlideShowPic::CreateSlideShowPicture()
 void CSlideShowPicGL::Render(float* x, float* y, CTexture* pTexture, Color color)
 {
   CRenderSystemGL* renderSystem = dynamic_cast<CRenderSystemGL*>(CServiceBroker::GetRenderSystem());
+  renderSystem->FlushBatchedDraws();
   if (pTexture)
   {
     pTexture->LoadToGPU();
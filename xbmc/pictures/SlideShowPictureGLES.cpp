@@ -26,6 +26,7 @@ void CSlideShowPicGLES::Render(float* x,
 {
   CRenderSystemGLES* renderSystem =
       dynamic_cast<CRenderSystemGLES*>(CServiceBroker::GetRenderSystem());
+  renderSystem->FlushBatchedDraws();
   if (pTexture)
   {
     pTexture->LoadToGPU();
@@ -13,8 +13,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <mutex>
 
+#include <pthread.h>
+#include <sched.h>
 #include <sys/resource.h>
 #include <unistd.h>
 
@@ -63,6 +66,8 @@ static pid_t gettid()
 
 std::once_flag flag;
 
+constexpr int REALTIME_PRIORITY = 10;
+
 } // namespace
 
 static int s_appPriority = getpriority(PRIO_PROCESS, getpid());
@@ -103,3 +108,22 @@ bool CThreadImplLinux::SetPriority(const ThreadPriority& priority)
 
   return true;
 }
+
+bool CThreadImplLinux::SetRealtime(bool realtime)
+{
+  // low end of the range, stay below the threads of audio servers and the kernel
+  sched_param param{};
+  param.sched_priority = realtime ? sched_get_priority_min(SCHED_FIFO) + REALTIME_PRIORITY : 0;
+
+  const int ret = pthread_setschedparam(m_handle, realtime ? SCHED_FIFO : SCHED_OTHER, &param);
+  if (ret != 0)
+  {
+    // usually EPERM, needs CAP_SYS_NICE or an RLIMIT_RTPRIO limit
+    CLog::Log(LOGDEBUG, "[threads] name: '{}' realtime scheduling not permitted: {}", m_name,
+              strerror(ret));
+    return false;
+  }
+
+  CLog::Log(LOGDEBUG, "[threads] name: '{}' realtime: {}", m_name, realtime);
+  return true;
+}
@@ -33,3 +33,9 @@ bool CThreadImplPosix::SetPriority(const ThreadPriority& priority)
   CLog::Log(LOGDEBUG, "[threads] setting priority is not supported on this platform");
   return false;
 }
+
+bool CThreadImplPosix::SetRealtime(bool realtime)
+{
+  CLog::Log(LOGDEBUG, "[threads] realtime scheduling is not supported on this platform");
+  return false;
+}
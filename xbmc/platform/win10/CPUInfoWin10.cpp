@@ -60,6 +60,22 @@ CCPUInfoWin10::CCPUInfoWin10()
       m_cpuFeatures |= CPU_FEATURE_SSE4;
     if (CPUInfo[CPUINFO_ECX] & CPUID_00000001_ECX_SSE42)
       m_cpuFeatures |= CPU_FEATURE_SSE42;
+
+    // AVX registers are only usable if the os saves their state
+    if ((CPUInfo[CPUINFO_ECX] & CPUID_00000001_ECX_OSXSAVE) &&
+        (CPUInfo[CPUINFO_ECX] & CPUID_00000001_ECX_AVX) &&
+        (_xgetbv(0) & XCR0_AVX_STATE) == XCR0_AVX_STATE)
+    {
+      if (CPUInfo[CPUINFO_ECX] & CPUID_00000001_ECX_FMA3)
+        m_cpuFeatures |= CPU_FEATURE_FMA3;
+
+      if (MaxStdInfoType >= CPUID_INFOTYPE_STRUCTURED_EXTENDED)
+      {
+        __cpuidex(CPUInfo, CPUID_INFOTYPE_STRUCTURED_EXTENDED, 0);
+        if (CPUInfo[CPUINFO_EBX] & CPUID_00000007_EBX_AVX2)
+          m_cpuFeatures |= CPU_FEATURE_AVX2;
+      }
+    }
   }
 
   __cpuid(CPUInfo, CPUID_INFOTYPE_EXTENDED_IMPLEMENTED);
@@ -103,3 +103,15 @@ bool CThreadImplWin::SetPriority(const ThreadPriority& priority)
 
   return bReturn;
 }
+
+bool CThreadImplWin::SetRealtime(bool realtime)
+{
+  bool bReturn = false;
+
+  std::unique_lock lock(m_criticalSection);
+  if (m_handle)
+    bReturn = SetThreadPriority(m_handle, realtime ? THREAD_PRIORITY_TIME_CRITICAL
+                                                   : THREAD_PRIORITY_NORMAL) == TRUE;
+
+  return bReturn;
+}
@@ -22,6 +22,8 @@ public:
 
   bool SetPriority(const ThreadPriority& priority) override;
 
+  bool SetRealtime(bool realtime) override;
+
 private:
   CCriticalSection m_criticalSection;
 };
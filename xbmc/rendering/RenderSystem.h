@@ -76,6 +76,21 @@ public:
 
   virtual std::string GetShaderPath(const std::string &filename) { return ""; }
 
+  /**
+   * Submit the GUI draws collected so far, needed before drawing without the render system
+   */
+  virtual void FlushBatchedDraws() {}
+
+  /**
+   * Count draw calls issued for the GUI in the current frame
+   */
+  void AddDrawCalls(unsigned int count) { m_drawCalls += count; }
+
+  /**
+   * Number of draw calls issued for the GUI in the last presented frame
+   */
+  unsigned int GetFrameDrawCalls() const { return m_frameDrawCalls; }
+
   void GetRenderVersion(unsigned int& major, unsigned int& minor) const;
   const std::string& GetRenderVendor() const { return m_RenderVendor; }
   const std::string& GetRenderRenderer() const { return m_RenderRenderer; }
@@ -103,6 +118,9 @@ protected:
   bool m_limitedColorRange = false;
   bool m_transferPQ{false};
 
+  unsigned int m_drawCalls = 0;
+  unsigned int m_frameDrawCalls = 0;
+
   std::unique_ptr<CGUIImage> m_splashImage;
   std::unique_ptr<CGUITextLayout> m_splashMessageLayout;
 };
@@ -22,6 +22,7 @@
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
+#include <cstddef>
 #include <exception>
 
 #if defined(TARGET_LINUX)
@@ -245,6 +246,18 @@ bool CRenderSystemGL::ResetRenderSystem(int width, int height)
 
 bool CRenderSystemGL::DestroyRenderSystem()
 {
+  m_batch.Clear();
+  if (m_batchVertexBuffer != GL_NONE)
+  {
+    glDeleteBuffers(1, &m_batchVertexBuffer);
+    m_batchVertexBuffer = GL_NONE;
+  }
+  if (m_batchIndexBuffer != GL_NONE)
+  {
+    glDeleteBuffers(1, &m_batchIndexBuffer);
+    m_batchIndexBuffer = GL_NONE;
+  }
+
   if (m_vertexArray != GL_NONE)
   {
     glDeleteVertexArrays(1, &m_vertexArray);
@@ -278,6 +291,8 @@ bool CRenderSystemGL::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+  FlushBatchedDraws();
+
   return true;
 }
 
@@ -290,6 +305,8 @@ void CRenderSystemGL::InvalidateColorBuffer()
   if (m_stereoMode == RENDER_STEREO_MODE_INTERLACED && m_stereoView == RENDER_STEREO_VIEW_RIGHT)
     return;
 
+  FlushBatchedDraws();
+
   // some platforms prefer a clear, instead of rendering over
   if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiGeometryClear)
   {
@@ -314,6 +331,8 @@ bool CRenderSystemGL::ClearBuffers(KODI::UTILS::COLOR::Color color)
   if(m_stereoMode == RENDER_STEREO_MODE_INTERLACED && m_stereoView == RENDER_STEREO_VIEW_RIGHT)
     return true;
 
+  FlushBatchedDraws();
+
   float r = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color) / 255.0f;
   float g = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color) / 255.0f;
   float b = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::B, color) / 255.0f;
@@ -370,6 +389,10 @@ void CRenderSystemGL::PresentRender(bool rendered, bool videoLayer)
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+  m_frameDrawCalls = m_drawCalls;
+  m_drawCalls = 0;
+
   PresentRenderImpl(rendered);
 
   if (!rendered)
@@ -400,6 +423,8 @@ void CRenderSystemGL::CaptureStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+
   glMatrixProject.Push();
   glMatrixModview.Push();
   glMatrixTexture.Push();
@@ -413,6 +438,8 @@ void CRenderSystemGL::ApplyStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+
   glBindVertexArray(m_vertexArray);
 
   glViewport(m_viewPort[0], m_viewPort[1], m_viewPort[2], m_viewPort[3]);
@@ -431,6 +458,8 @@ void CRenderSystemGL::SetCameraPosition(const CPoint &camera, int screenWidth, i
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+
   CPoint offset = camera - CPoint(screenWidth*0.5f, screenHeight*0.5f);
 
 
@@ -506,6 +535,8 @@ void CRenderSystemGL::SetViewPort(const CRect& viewPort)
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+
   glScissor((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   glViewport((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   m_viewPort[0] = viewPort.x1;
@@ -540,6 +571,9 @@ void CRenderSystemGL::SetScissors(const CRect &rect)
 {
   if (!m_bRenderCreated)
     return;
+
+  FlushBatchedDraws();
+
   GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1));
   GLint y1 = MathUtils::round_int(static_cast<double>(rect.y1));
   GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2));
@@ -554,6 +588,9 @@ void CRenderSystemGL::ResetScissors()
 
 void CRenderSystemGL::SetDepthCulling(DEPTH_CULLING culling)
 {
+  FlushBatchedDraws();
+  m_depthCulling = culling;
+
   if (culling == DEPTH_CULLING_OFF)
   {
     glDisable(GL_DEPTH_TEST);
@@ -573,6 +610,120 @@ void CRenderSystemGL::SetDepthCulling(DEPTH_CULLING culling)
   }
 }
 
+void CRenderSystemGL::AddBatchedQuad(CGUIRenderBatch::State state,
+                                     const CGUIRenderBatch::Vertex* vertices)
+{
+  // the depth is only used by the depth test
+  if (m_depthCulling == DEPTH_CULLING_OFF)
+    state.depth = 0.0f;
+
+  m_batch.AddQuad(state, vertices);
+}
+
+void CRenderSystemGL::FlushBatchedDraws()
+{
+  // the shaders are enabled by the flush itself
+  if (m_batch.IsEmpty() || m_flushingBatch)
+    return;
+
+  m_flushingBatch = true;
+  m_batch.Build();
+
+  if (m_batchIndexBuffer == GL_NONE)
+  {
+    std::vector<uint16_t> indices;
+    CGUIRenderBatch::GetQuadIndices(indices, CGUIRenderBatch::MAX_QUADS_PER_DRAW);
+    glGenBuffers(1, &m_batchIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_batchIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint16_t) * indices.size(), indices.data(),
+                 GL_STATIC_DRAW);
+  }
+  if (m_batchVertexBuffer == GL_NONE)
+    glGenBuffers(1, &m_batchVertexBuffer);
+
+  const std::vector<CGUIRenderBatch::Vertex>& vertices = m_batch.GetVertices();
+  glBindBuffer(GL_ARRAY_BUFFER, m_batchVertexBuffer);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(CGUIRenderBatch::Vertex) * vertices.size(), vertices.data(),
+               GL_STREAM_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_batchIndexBuffer);
+
+  for (const CGUIRenderBatch::Draw& draw : m_batch.GetDraws())
+  {
+    const CGUIRenderBatch::State& state = draw.state;
+    const ShaderMethodGL method = static_cast<ShaderMethodGL>(state.shader);
+    const bool multi =
+        method == ShaderMethodGL::SM_MULTI || method == ShaderMethodGL::SM_MULTI_BLENDCOLOR;
+    EnableShader(method);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, state.texture0);
+    if (multi)
+    {
+      glActiveTexture(GL_TEXTURE1);
+      glBindTexture(GL_TEXTURE_2D, state.texture1);
+    }
+
+    if (state.blend)
+    {
+      glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
+      glEnable(GL_BLEND);
+    }
+    else
+    {
+      glDisable(GL_BLEND);
+    }
+
+    GLint posLoc = ShaderGetPos();
+    GLint tex0Loc = ShaderGetCoord0();
+    GLint tex1Loc = ShaderGetCoord1();
+    GLint uniColLoc = ShaderGetUniCol();
+    GLint depthLoc = ShaderGetDepth();
+
+    glUniform1f(depthLoc, state.depth);
+    if (uniColLoc >= 0)
+    {
+      glUniform4f(uniColLoc, ((state.color >> 24) & 0xFF) / 255.0f,
+                  ((state.color >> 16) & 0xFF) / 255.0f, ((state.color >> 8) & 0xFF) / 255.0f,
+                  (state.color & 0xFF) / 255.0f);
+    }
+
+    const size_t offset = draw.firstQuad * 4 * sizeof(CGUIRenderBatch::Vertex);
+    if (multi)
+    {
+      glVertexAttribPointer(
+          tex1Loc, 2, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+          reinterpret_cast<const GLvoid*>(offset + offsetof(CGUIRenderBatch::Vertex, u2)));
+      glEnableVertexAttribArray(tex1Loc);
+    }
+    glVertexAttribPointer(
+        posLoc, 3, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+        reinterpret_cast<const GLvoid*>(offset + offsetof(CGUIRenderBatch::Vertex, x)));
+    glEnableVertexAttribArray(posLoc);
+    glVertexAttribPointer(
+        tex0Loc, 2, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+        reinterpret_cast<const GLvoid*>(offset + offsetof(CGUIRenderBatch::Vertex, u1)));
+    glEnableVertexAttribArray(tex0Loc);
+
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(draw.quadCount * 6), GL_UNSIGNED_SHORT, 0);
+
+    if (multi)
+      glDisableVertexAttribArray(tex1Loc);
+    glDisableVertexAttribArray(posLoc);
+    glDisableVertexAttribArray(tex0Loc);
+
+    DisableShader();
+  }
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+  glActiveTexture(GL_TEXTURE0);
+  glEnable(GL_BLEND);
+
+  AddDrawCalls(static_cast<unsigned int>(m_batch.GetDraws().size()));
+  m_batch.Clear();
+  m_flushingBatch = false;
+}
+
 void CRenderSystemGL::GetGLSLVersion(int& major, int& minor)
 {
   major = m_glslMajor;
@@ -633,6 +784,7 @@ static const GLubyte stipple_3d[] = {
 
 void CRenderSystemGL::SetStereoMode(RENDER_STEREO_MODE mode, RENDER_STEREO_VIEW view)
 {
+  FlushBatchedDraws();
   CRenderSystemBase::SetStereoMode(mode, view);
 
   glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -826,6 +978,9 @@ void CRenderSystemGL::ReleaseShaders()
 
 void CRenderSystemGL::EnableShader(ShaderMethodGL method)
 {
+  // anything drawn with the shader has to be drawn over the batched quads
+  FlushBatchedDraws();
+
   m_method = method;
   if (m_pShader[m_method])
   {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GLShader.h"
+#include "guilib/GUIRenderBatch.h"
 #include "rendering/RenderSystem.h"
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
@@ -105,6 +106,14 @@ public:
 
   std::string GetShaderPath(const std::string &filename) override;
 
+  void FlushBatchedDraws() override;
+
+  /*!
+   \brief Queue a quad of a GUI texture, it is drawn with the quads sharing its state by the next
+   FlushBatchedDraws(), which happens at the latest before the render state is changed
+   */
+  void AddBatchedQuad(CGUIRenderBatch::State state, const CGUIRenderBatch::Vertex* vertices);
+
   void GetGLVersion(int& major, int& minor);
   void GetGLSLVersion(int& major, int& minor);
 
@@ -145,4 +154,10 @@ protected:
   std::map<ShaderMethodGL, std::unique_ptr<CGLShader>> m_pShader;
   ShaderMethodGL m_method = ShaderMethodGL::SM_DEFAULT;
   GLuint m_vertexArray = GL_NONE;
+
+  CGUIRenderBatch m_batch;
+  bool m_flushingBatch = false;
+  GLuint m_batchVertexBuffer = GL_NONE;
+  GLuint m_batchIndexBuffer = GL_NONE;
+  DEPTH_CULLING m_depthCulling = DEPTH_CULLING_OFF;
 };
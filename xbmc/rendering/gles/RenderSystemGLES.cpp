@@ -153,6 +153,7 @@ bool CRenderSystemGLES::ResetRenderSystem(int width, int height)
 
 bool CRenderSystemGLES::DestroyRenderSystem()
 {
+  m_batch.Clear();
   ResetScissors();
   CDirtyRegionList dirtyRegions;
   CDirtyRegion dirtyWindow(CServiceBroker::GetWinSystem()->GetGfxContext().GetViewWindow());
@@ -194,6 +195,8 @@ bool CRenderSystemGLES::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+  FlushBatchedDraws();
+
   return true;
 }
 
@@ -202,6 +205,8 @@ void CRenderSystemGLES::InvalidateColorBuffer()
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+
   // some platforms prefer a clear, instead of rendering over
   if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiGeometryClear)
     ClearBuffers(0);
@@ -219,6 +224,8 @@ bool CRenderSystemGLES::ClearBuffers(KODI::UTILS::COLOR::Color color)
   if (!m_bRenderCreated)
     return false;
 
+  FlushBatchedDraws();
+
   float r = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color) / 255.0f;
   float g = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color) / 255.0f;
   float b = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::B, color) / 255.0f;
@@ -265,6 +272,10 @@ void CRenderSystemGLES::PresentRender(bool rendered, bool videoLayer)
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+  m_frameDrawCalls = m_drawCalls;
+  m_drawCalls = 0;
+
   PresentRenderImpl(rendered);
 
   // if video is rendered to a separate layer, we should not block this thread
@@ -295,6 +306,8 @@ void CRenderSystemGLES::CaptureStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+
   glMatrixProject.Push();
   glMatrixModview.Push();
   glMatrixTexture.Push();
@@ -310,6 +323,8 @@ void CRenderSystemGLES::ApplyStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+
   glMatrixProject.PopLoad();
   glMatrixModview.PopLoad();
   glMatrixTexture.PopLoad();
@@ -324,6 +339,8 @@ void CRenderSystemGLES::SetCameraPosition(const CPoint &camera, int screenWidth,
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+
   CPoint offset = camera - CPoint(screenWidth*0.5f, screenHeight*0.5f);
 
   float w = (float)m_viewPort[2]*0.5f;
@@ -372,6 +389,8 @@ void CRenderSystemGLES::SetViewPort(const CRect& viewPort)
   if (!m_bRenderCreated)
     return;
 
+  FlushBatchedDraws();
+
   glScissor((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   glViewport((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   m_viewPort[0] = viewPort.x1;
@@ -406,6 +425,9 @@ void CRenderSystemGLES::SetScissors(const CRect &rect)
 {
   if (!m_bRenderCreated)
     return;
+
+  FlushBatchedDraws();
+
   GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1));
   GLint y1 = MathUtils::round_int(static_cast<double>(rect.y1));
   GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2));
@@ -420,6 +442,9 @@ void CRenderSystemGLES::ResetScissors()
 
 void CRenderSystemGLES::SetDepthCulling(DEPTH_CULLING culling)
 {
+  FlushBatchedDraws();
+  m_depthCulling = culling;
+
   if (culling == DEPTH_CULLING_OFF)
   {
     glDisable(GL_DEPTH_TEST);
@@ -439,6 +464,103 @@ void CRenderSystemGLES::SetDepthCulling(DEPTH_CULLING culling)
   }
 }
 
+void CRenderSystemGLES::AddBatchedQuad(CGUIRenderBatch::State state,
+                                       const CGUIRenderBatch::Vertex* vertices)
+{
+  // the depth is only used by the depth test
+  if (m_depthCulling == DEPTH_CULLING_OFF)
+    state.depth = 0.0f;
+
+  m_batch.AddQuad(state, vertices);
+}
+
+void CRenderSystemGLES::FlushBatchedDraws()
+{
+  // the shaders are enabled by the flush itself
+  if (m_batch.IsEmpty() || m_flushingBatch)
+    return;
+
+  m_flushingBatch = true;
+  m_batch.Build();
+
+  if (m_batchIndices.empty())
+    CGUIRenderBatch::GetQuadIndices(m_batchIndices, CGUIRenderBatch::MAX_QUADS_PER_DRAW);
+
+  for (const CGUIRenderBatch::Draw& draw : m_batch.GetDraws())
+  {
+    const CGUIRenderBatch::State& state = draw.state;
+    const ShaderMethodGLES method = static_cast<ShaderMethodGLES>(state.shader);
+    const bool multi = method == ShaderMethodGLES::SM_MULTI ||
+                       method == ShaderMethodGLES::SM_MULTI_RGBA_111R ||
+                       method == ShaderMethodGLES::SM_MULTI_BLENDCOLOR ||
+                       method == ShaderMethodGLES::SM_MULTI_RGBA_111R_BLENDCOLOR ||
+                       method == ShaderMethodGLES::SM_MULTI_111R_111R_BLENDCOLOR;
+    EnableGUIShader(method);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, state.texture0);
+    if (multi)
+    {
+      glActiveTexture(GL_TEXTURE1);
+      glBindTexture(GL_TEXTURE_2D, state.texture1);
+    }
+
+    if (state.blend)
+    {
+      glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
+      glEnable(GL_BLEND);
+    }
+    else
+    {
+      glDisable(GL_BLEND);
+    }
+
+    GLint posLoc = GUIShaderGetPos();
+    GLint tex0Loc = GUIShaderGetCoord0();
+    GLint tex1Loc = GUIShaderGetCoord1();
+    GLint uniColLoc = GUIShaderGetUniCol();
+    GLint depthLoc = GUIShaderGetDepth();
+
+    if (uniColLoc >= 0)
+    {
+      glUniform4f(uniColLoc, ((state.color >> 24) & 0xFF) / 255.0f,
+                  ((state.color >> 16) & 0xFF) / 255.0f, ((state.color >> 8) & 0xFF) / 255.0f,
+                  (state.color & 0xFF) / 255.0f);
+    }
+    glUniform1f(depthLoc, state.depth);
+
+    const CGUIRenderBatch::Vertex* vertices = m_batch.GetVertices().data() + draw.firstQuad * 4;
+    if (multi)
+    {
+      glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+                            &vertices->u2);
+      glEnableVertexAttribArray(tex1Loc);
+    }
+    glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex), &vertices->x);
+    glEnableVertexAttribArray(posLoc);
+    glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+                          &vertices->u1);
+    glEnableVertexAttribArray(tex0Loc);
+
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(draw.quadCount * 6), GL_UNSIGNED_SHORT,
+                   m_batchIndices.data());
+
+    if (multi)
+      glDisableVertexAttribArray(tex1Loc);
+    glDisableVertexAttribArray(posLoc);
+    glDisableVertexAttribArray(tex0Loc);
+
+    DisableGUIShader();
+  }
+
+  glActiveTexture(GL_TEXTURE0);
+  glEnable(GL_BLEND);
+
+  AddDrawCalls(static_cast<unsigned int>(m_batch.GetDraws().size()));
+  m_batch.Clear();
+  m_flushingBatch = false;
+}
+
 void CRenderSystemGLES::InitialiseShaders()
 {
   std::string defines;
@@ -687,6 +809,9 @@ void CRenderSystemGLES::ReleaseShaders()
 
 void CRenderSystemGLES::EnableGUIShader(ShaderMethodGLES method)
 {
+  // anything drawn with the shader has to be drawn over the batched quads
+  FlushBatchedDraws();
+
   m_method = method;
   if (m_pShader[m_method])
   {
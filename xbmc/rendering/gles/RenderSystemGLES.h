@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GLESShader.h"
+#include "guilib/GUIRenderBatch.h"
 #include "rendering/RenderSystem.h"
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
@@ -123,6 +124,14 @@ public:
 
   std::string GetShaderPath(const std::string& filename) override;
 
+  void FlushBatchedDraws() override;
+
+  /*!
+   \brief Queue a quad of a GUI texture, it is drawn with the quads sharing its state by the next
+   FlushBatchedDraws(), which happens at the latest before the render state is changed
+   */
+  void AddBatchedQuad(CGUIRenderBatch::State state, const CGUIRenderBatch::Vertex* vertices);
+
   void InitialiseShaders();
   void ReleaseShaders();
   void EnableGUIShader(ShaderMethodGLES method);
@@ -159,4 +168,9 @@ protected:
   ShaderMethodGLES m_method = ShaderMethodGLES::SM_DEFAULT;
 
   GLint      m_viewPort[4];
+
+  CGUIRenderBatch m_batch;
+  bool m_flushingBatch = false;
+  std::vector<uint16_t> m_batchIndices;
+  DEPTH_CULLING m_depthCulling = DEPTH_CULLING_OFF;
 };
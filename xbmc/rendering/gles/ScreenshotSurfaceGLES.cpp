@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
+#include "rendering/RenderSystem.h"
 #include "utils/Screenshot.h"
 #include "windowing/GraphicContext.h"
 
@@ -43,6 +44,9 @@ bool CScreenshotSurfaceGLES::Capture()
   std::unique_lock lock(winsystem->GetGfxContext());
   gui->GetWindowManager().Render();
 
+  // draw the textures still batched before reading the backbuffer
+  CServiceBroker::GetRenderSystem()->FlushBatchedDraws();
+
   //get current viewport
   GLint viewport[4];
   glGetIntegerv(GL_VIEWPORT, viewport);
@@ -159,6 +159,14 @@ void CAdvancedSettings::Initialize()
   m_DXVACheckCompatibility = false;
   m_DXVACheckCompatibilityPresent = false;
   m_videoFpsDetect = 1;
+  m_videoRenderAheadFrames = 6;
+  m_videoRenderAheadMemory = 0;
+  m_videoAdaptiveRenderAhead = false;
+  m_videoDecodeThreads = 0;
+  m_videoDecodeThreadType = "auto";
+  m_videoDecodeReservedCores = 0;
+  m_videoAdaptiveDecodeThreads = true;
+  m_videoPreOpenNextItem = true;
   m_maxTempo = 1.55f;
   m_videoPreferStereoStream = false;
 
@@ -580,6 +588,25 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
                       20, 80);
     XMLUtils::GetBoolean(pElement, "allowmultichannelfloat", m_AllowMultiChannelFloat);
     XMLUtils::GetBoolean(pElement, "superviseaudiodelay", m_superviseAudioDelay);
+
+    const TiXmlElement* pZones = pElement->FirstChildElement("zones");
+    if (pZones)
+    {
+      m_audioZones.clear();
+      for (const TiXmlElement* pZone = pZones->FirstChildElement("zone"); pZone;
+           pZone = pZone->NextSiblingElement("zone"))
+      {
+        if (!pZone->FirstChild())
+          continue;
+
+        AudioZone zone;
+        zone.device = pZone->FirstChild()->ValueStr();
+        const char* music = pZone->Attribute("music");
+        if (music)
+          zone.music = StringUtils::EqualsNoCase(music, "true");
+        m_audioZones.push_back(std::move(zone));
+      }
+    }
   }
 
   pElement = pRootElement->FirstChildElement("x11");
@@ -738,6 +765,20 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
 
     //0 = disable fps detect, 1 = only detect on timestamps with uniform spacing, 2 detect on all timestamps
     XMLUtils::GetInt(pElement, "fpsdetect", m_videoFpsDetect, 0, 2);
+    // number of decoded frames the renderer may hold ahead of presentation, optionally bounded
+    // by a memory budget in MB. adaptive mode starts small and grows on decode time spikes
+    XMLUtils::GetInt(pElement, "renderaheadframes", m_videoRenderAheadFrames, 2, 16);
+    XMLUtils::GetInt(pElement, "renderaheadmemory", m_videoRenderAheadMemory, 0, 4096);
+    XMLUtils::GetBoolean(pElement, "adaptiverenderahead", m_videoAdaptiveRenderAhead);
+    // software decoder threading: thread count (0 = auto), thread type (auto, frame, slice) and
+    // cores kept free for gui and audio engine. adaptive reopens with more threads when dropping
+    XMLUtils::GetInt(pElement, "decodethreads", m_videoDecodeThreads, 0, 16);
+    XMLUtils::GetString(pElement, "decodethreadtype", m_videoDecodeThreadType);
+    XMLUtils::GetInt(pElement, "decodereservedcores", m_videoDecodeReservedCores, 0, 16);
+    XMLUtils::GetBoolean(pElement, "adaptivedecodethreads", m_videoAdaptiveDecodeThreads);
+    // open the next playlist item in the background near the end of the current one and hand
+    // over to it inside the running player
+    XMLUtils::GetBoolean(pElement, "preopennextitem", m_videoPreOpenNextItem);
     XMLUtils::GetFloat(pElement, "maxtempo", m_maxTempo, 1.5, 2.1);
     XMLUtils::GetBoolean(pElement, "preferstereostream", m_videoPreferStereoStream);
 
@@ -101,6 +101,12 @@ struct RefreshVideoLatency
   float hdrextradelay;
 };
 
+struct AudioZone
+{
+  std::string device; //!< sink device, as in the audio output device setting
+  bool music = true; //!< music played by paplayer is heard in this zone too
+};
+
 using SETTINGS_TVSHOWLIST = std::vector<TVShowRegexp>;
 
 class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
@@ -162,6 +168,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     unsigned int m_maxPassthroughOffSyncDuration = 50; // when 50 ms off adjust
     bool m_AllowMultiChannelFloat = false; // Android only switch to be removed in v22
     bool m_superviseAudioDelay = false; // Android only to correct broken audio firmwares
+    std::vector<AudioZone> m_audioZones; // outputs played besides the audio device setting
 
     int   m_videoVDPAUScaling;
     float m_videoNonLinStretchRatio;
@@ -174,6 +181,14 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_DXVACheckCompatibility;
     bool m_DXVACheckCompatibilityPresent;
     int  m_videoFpsDetect;
+    int m_videoRenderAheadFrames;
+    int m_videoRenderAheadMemory; // MB, 0 = no limit
+    bool m_videoAdaptiveRenderAhead;
+    int m_videoDecodeThreads; // 0 = auto
+    std::string m_videoDecodeThreadType;
+    int m_videoDecodeReservedCores;
+    bool m_videoAdaptiveDecodeThreads;
+    bool m_videoPreOpenNextItem;
     float m_maxTempo;
     bool m_videoPreferStereoStream = false;
 
@@ -275,6 +275,8 @@ public:
   static constexpr auto SETTING_MUSICLIBRARY_SHOWALLITEMS = "musiclibrary.showallitems";
   static constexpr auto SETTING_MUSICLIBRARY_UPDATEONSTARTUP = "musiclibrary.updateonstartup";
   static constexpr auto SETTING_MUSICLIBRARY_BACKGROUNDUPDATE = "musiclibrary.backgroundupdate";
+  static constexpr auto SETTING_MUSICLIBRARY_MEASURELOUDNESS = "musiclibrary.measureloudness";
+  static constexpr auto SETTING_MUSICLIBRARY_FINGERPRINT = "musiclibrary.fingerprint";
   static constexpr auto SETTING_MUSICLIBRARY_CLEANUP = "musiclibrary.cleanup";
   static constexpr auto SETTING_MUSICLIBRARY_EXPORT = "musiclibrary.export";
   static constexpr auto SETTING_MUSICLIBRARY_EXPORT_FILETYPE = "musiclibrary.exportfiletype";
@@ -300,6 +302,7 @@ public:
   static constexpr auto SETTING_MUSICPLAYER_CROSSFADEALBUMTRACKS =
       "musicplayer.crossfadealbumtracks";
   static constexpr auto SETTING_MUSICPLAYER_VISUALISATION = "musicplayer.visualisation";
+  static constexpr auto SETTING_MUSICPLAYER_WAVEFORMCACHE = "musicplayer.waveformcache";
   static constexpr auto SETTING_MUSICFILES_SELECTACTION = "musicfiles.selectaction";
   static constexpr auto SETTING_MUSICFILES_USETAGS = "musicfiles.usetags";
   static constexpr auto SETTING_MUSICFILES_TRACKFORMAT = "musicfiles.trackformat";
@@ -397,9 +400,11 @@ public:
   static constexpr auto SETTING_AUDIOOUTPUT_MAINTAINORIGINALVOLUME =
       "audiooutput.maintainoriginalvolume";
   static constexpr auto SETTING_AUDIOOUTPUT_PROCESSQUALITY = "audiooutput.processquality";
+  static constexpr auto SETTING_AUDIOOUTPUT_RESAMPLER = "audiooutput.resampler";
   static constexpr auto SETTING_AUDIOOUTPUT_ATEMPOTHRESHOLD = "audiooutput.atempothreshold";
   static constexpr auto SETTING_AUDIOOUTPUT_STREAMSILENCE = "audiooutput.streamsilence";
   static constexpr auto SETTING_AUDIOOUTPUT_STREAMNOISE = "audiooutput.streamnoise";
+  static constexpr auto SETTING_AUDIOOUTPUT_LOWLATENCY = "audiooutput.lowlatency";
   static constexpr auto SETTING_AUDIOOUTPUT_MIXSUBLEVEL = "audiooutput.mixsublevel";
   static constexpr auto SETTING_AUDIOOUTPUT_GUISOUNDMODE = "audiooutput.guisoundmode";
   static constexpr auto SETTING_AUDIOOUTPUT_GUISOUNDVOLUME = "audiooutput.guisoundvolume";
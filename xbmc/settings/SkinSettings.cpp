@@ -25,6 +25,11 @@
 namespace
 {
 constexpr const char* XML_SKINSETTINGS = "skinsettings";
+
+void InvalidateSkinSettingInfos()
+{
+  CServiceBroker::GetGUI()->GetInfoManager().InvalidateInfos(INFO::InfoSource::SKIN_SETTINGS);
+}
 } // unnamed namespace
 
 CSkinSettings::CSkinSettings()
@@ -53,6 +58,7 @@ const std::string& CSkinSettings::GetString(int setting) const
 void CSkinSettings::SetString(int setting, const std::string& label) const
 {
   g_SkinInfo->SetString(setting, label);
+  InvalidateSkinSettingInfos();
 }
 
 int CSkinSettings::TranslateBool(const std::string& setting) const
@@ -73,11 +79,13 @@ int CSkinSettings::GetInt(int setting) const
 void CSkinSettings::SetBool(int setting, bool set) const
 {
   g_SkinInfo->SetBool(setting, set);
+  InvalidateSkinSettingInfos();
 }
 
 void CSkinSettings::Reset(const std::string& setting) const
 {
   g_SkinInfo->Reset(setting);
+  InvalidateSkinSettingInfos();
 }
 
 std::set<ADDON::CSkinSettingPtr> CSkinSettings::GetSettings() const
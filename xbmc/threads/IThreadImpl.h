@@ -33,6 +33,13 @@ public:
    */
   virtual bool SetPriority(const ThreadPriority& priority) = 0;
 
+  /*!
+   * \brief Move the thread into or out of a realtime scheduling class via the native
+   *        threading library. Fails if the platform or the permissions don't allow it.
+   *
+   */
+  virtual bool SetRealtime(bool realtime) = 0;
+
 protected:
   IThreadImpl(std::thread::native_handle_type handle) : m_handle(handle) {}
 
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+/*!
+ * \brief Bounded lock-free queue for exactly one producer and one consumer thread.
+ *
+ * Push() must only be called by the producer, Pop() only by the consumer. Neither blocks
+ * or allocates, waking up a waiting consumer is left to the caller.
+ */
+template<typename T>
+class CSPSCQueue
+{
+public:
+  /*!
+   * \param capacity minimum number of elements, rounded up to the next power of two
+   */
+  explicit CSPSCQueue(size_t capacity)
+    : m_buffer(std::bit_ceil(capacity)), m_mask(m_buffer.size() - 1)
+  {
+  }
+
+  CSPSCQueue(const CSPSCQueue&) = delete;
+  CSPSCQueue& operator=(const CSPSCQueue&) = delete;
+
+  /*!
+   * \brief Producer: append a value
+   * \return false if the queue is full
+   */
+  bool Push(const T& value)
+  {
+    const size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) > m_mask)
+      return false;
+
+    m_buffer[tail & m_mask] = value;
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+   * \brief Consumer: take the oldest value
+   * \return false if the queue is empty
+   */
+  bool Pop(T& value)
+  {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire))
+      return false;
+
+    value = m_buffer[head & m_mask];
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+   * \brief Snapshot of the fill level, exact only when called by one of the two sides
+   */
+  size_t Size() const
+  {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+  }
+
+  bool Empty() const { return Size() == 0; }
+
+  size_t Capacity() const { return m_buffer.size(); }
+
+  /*!
+   * \brief Drop all values. Neither side may access the queue at the same time.
+   */
+  void Clear() { m_head.store(m_tail.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
+private:
+  std::vector<T> m_buffer;
+  const size_t m_mask;
+
+  // producer and consumer index on separate cache lines
+  alignas(64) std::atomic<size_t> m_head{0};
+  alignas(64) std::atomic<size_t> m_tail{0};
+};
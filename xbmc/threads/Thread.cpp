@@ -197,6 +197,11 @@ bool CThread::SetPriority(const ThreadPriority& priority)
   return m_impl->SetPriority(priority);
 }
 
+bool CThread::SetRealtime(bool realtime)
+{
+  return m_impl->SetRealtime(realtime);
+}
+
 bool CThread::IsAutoDelete() const
 {
   return m_bAutoDelete;
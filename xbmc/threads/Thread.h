@@ -79,6 +79,14 @@ public:
    */
   bool SetPriority(const ThreadPriority& priority);
 
+  /*!
+   * \brief Run the thread with realtime scheduling, for threads with hard deadlines
+   *        like audio output. Returns false if the platform doesn't permit it, the
+   *        priority is left unchanged then.
+   *
+   */
+  bool SetRealtime(bool realtime);
+
   static CThread* GetCurrentThread();
 
   virtual void OnException(){} // signal termination handler
@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/SPSCQueue.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+TEST(TestSPSCQueue, Capacity)
+{
+  CSPSCQueue<int> queue(5);
+  EXPECT_EQ(queue.Capacity(), 8u);
+  EXPECT_TRUE(queue.Empty());
+
+  for (int i = 0; i < 8; ++i)
+    EXPECT_TRUE(queue.Push(i));
+  EXPECT_FALSE(queue.Push(8));
+  EXPECT_EQ(queue.Size(), 8u);
+
+  int value;
+  for (int i = 0; i < 8; ++i)
+  {
+    ASSERT_TRUE(queue.Pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.Pop(value));
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(TestSPSCQueue, Clear)
+{
+  CSPSCQueue<int> queue(4);
+  queue.Push(1);
+  queue.Push(2);
+  queue.Clear();
+  EXPECT_TRUE(queue.Empty());
+
+  int value;
+  EXPECT_FALSE(queue.Pop(value));
+  EXPECT_TRUE(queue.Push(3));
+  ASSERT_TRUE(queue.Pop(value));
+  EXPECT_EQ(value, 3);
+}
+
+TEST(TestSPSCQueue, Threads)
+{
+  constexpr int count = 200000;
+  CSPSCQueue<int> queue(16);
+
+  std::thread producer(
+      [&queue]()
+      {
+        for (int i = 0; i < count; ++i)
+        {
+          while (!queue.Push(i))
+            std::this_thread::yield();
+        }
+      });
+
+  int expected = 0;
+  while (expected < count)
+  {
+    int value;
+    if (!queue.Pop(value))
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(value, expected);
+    ++expected;
+  }
+
+  producer.join();
+  EXPECT_TRUE(queue.Empty());
+}
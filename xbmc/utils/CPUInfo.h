@@ -30,6 +30,8 @@ enum CpuFeature
   CPU_FEATURE_3DNOWEXT = 1 << 9,
   CPU_FEATURE_ALTIVEC = 1 << 10,
   CPU_FEATURE_NEON = 1 << 11,
+  CPU_FEATURE_AVX2 = 1 << 12,
+  CPU_FEATURE_FMA3 = 1 << 13,
 };
 
 struct CoreInfo
@@ -47,6 +49,7 @@ public:
   // Defines to help with calls to CPUID
   const unsigned int CPUID_INFOTYPE_MANUFACTURER = 0x00000000;
   const unsigned int CPUID_INFOTYPE_STANDARD = 0x00000001;
+  const unsigned int CPUID_INFOTYPE_STRUCTURED_EXTENDED = 0x00000007;
   const unsigned int CPUID_INFOTYPE_EXTENDED_IMPLEMENTED = 0x80000000;
   const unsigned int CPUID_INFOTYPE_EXTENDED = 0x80000001;
   const unsigned int CPUID_INFOTYPE_PROCESSOR_1 = 0x80000002;
@@ -59,6 +62,9 @@ public:
   const unsigned int CPUID_00000001_ECX_SSSE3 = (1 << 9);
   const unsigned int CPUID_00000001_ECX_SSE4 = (1 << 19);
   const unsigned int CPUID_00000001_ECX_SSE42 = (1 << 20);
+  const unsigned int CPUID_00000001_ECX_FMA3 = (1 << 12);
+  const unsigned int CPUID_00000001_ECX_OSXSAVE = (1 << 27);
+  const unsigned int CPUID_00000001_ECX_AVX = (1 << 28);
 
   const unsigned int CPUID_00000001_EDX_MMX = (1 << 23);
   const unsigned int CPUID_00000001_EDX_SSE = (1 << 25);
@@ -71,6 +77,13 @@ public:
   const unsigned int CPUID_80000001_EDX_3DNOWEXT = (1 << 30);
   const unsigned int CPUID_80000001_EDX_3DNOW = (1U << 31);
 
+  // Structured Extended Features
+  // Bitmasks for the values returned by a call to cpuid with eax=0x00000007, ecx=0
+  const unsigned int CPUID_00000007_EBX_AVX2 = (1 << 5);
+
+  // XMM and YMM register state enabled by the os, returned by xgetbv with ecx=0
+  const unsigned int XCR0_AVX_STATE = 0x6;
+
   // In milliseconds
   const std::chrono::milliseconds MINIMUM_TIME_BETWEEN_READS{500};
 
@@ -120,6 +120,13 @@ bool CGUIWindowVideoBase::OnPopupMenu(int iItem)
   return CGUIMediaWindow::OnPopupMenu(iItem);
 }
 
+void CGUIWindowVideoBase::OnWindowLoaded()
+{
+  CGUIMediaWindow::OnWindowLoaded();
+  // the info dialog is opened by the window, not by an action of the skin
+  CServiceBroker::GetGUI()->GetWindowManager().PreloadWindowXML(WINDOW_DIALOG_VIDEO_INFO);
+}
+
 bool CGUIWindowVideoBase::OnMessage(CGUIMessage& message)
 {
   switch ( message.GetMessage() )
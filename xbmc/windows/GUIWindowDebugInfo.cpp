@@ -17,9 +17,11 @@
 #include "guilib/GUIControlFactory.h"
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUITextLayout.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/WindowTranslator.h"
+#include "rendering/RenderSystem.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CPUInfo.h"
@@ -129,6 +131,19 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetFPS(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
+    const unsigned int drawCalls = CServiceBroker::GetRenderSystem()->GetFrameDrawCalls();
+    if (drawCalls > 0)
+      info += StringUtils::Format("\nDRAW: {} calls", drawCalls);
+    const DirtyRegionStats dirty =
+        CServiceBroker::GetGUI()->GetWindowManager().GetDirtyRegionStats();
+    info += StringUtils::Format("\nDIRTY: {} passes, {:.0f} kpx redrawn, {:.0f} kpx dirty",
+                                dirty.passes, dirty.redrawnArea / 1000, dirty.dirtyArea / 1000);
+    if (CGUIFrameProfiler::IsRunning())
+    {
+      const FrameProfilerStats frames = CGUIFrameProfiler::Instance().GetStats();
+      info += StringUtils::Format("\nFRAME: {:.1f} ms, max {:.1f} ms (recording)",
+                                  frames.lastFrame, frames.maxFrame);
+    }
   }
 
   // render the skin debug info
@@ -165,6 +180,17 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
             "Focused: {} ({})", control->GetID(),
             CGUIControlFactory::TranslateControlType(control->GetControlType()));
     }
+    const INFO::InfoFrameStats& stats =
+        CServiceBroker::GetGUI()->GetInfoManager().GetInfoSourceTracker().GetLastFrameStats();
+    info += StringUtils::Format("\nConditions: {} evaluated, {} cached - Labels: {} evaluated, {} "
+                                "cached",
+                                stats.boolsEvaluated, stats.boolsCached, stats.labelsEvaluated,
+                                stats.labelsCached);
+    const FontShapingStats shaping = g_fontManager.GetShapingStats();
+    const uint64_t lookups = shaping.hits + shaping.misses;
+    info += StringUtils::Format("\nText shaping: {} cached, {:.1f}% hits",
+                                shaping.entries,
+                                lookups ? 100.0 * shaping.hits / lookups : 0.0);
   }
 
   float w, h;